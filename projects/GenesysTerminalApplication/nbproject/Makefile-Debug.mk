@@ -120,8 +120,10 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/18d98d98/Rectifier.o \
 	${OBJECTDIR}/_ext/cecf075e/TestingTerminalApp.o \
 	${OBJECTDIR}/_ext/113d9686/Attribute.o \
+	${OBJECTDIR}/_ext/113d9686/BinarySerializer.o \
 	${OBJECTDIR}/_ext/113d9686/ComponentManager.o \
 	${OBJECTDIR}/_ext/113d9686/ConnectionManager.o \
+	${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o \
 	${OBJECTDIR}/_ext/113d9686/Counter.o \
 	${OBJECTDIR}/_ext/113d9686/CppSerializer.o \
 	${OBJECTDIR}/_ext/113d9686/Entity.o \
@@ -140,6 +142,7 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/113d9686/ModelInfo.o \
 	${OBJECTDIR}/_ext/113d9686/ModelManager.o \
 	${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2.o \
+	${OBJECTDIR}/_ext/113d9686/ModelProfiler.o \
 	${OBJECTDIR}/_ext/113d9686/ModelSerializer.o \
 	${OBJECTDIR}/_ext/113d9686/ModelSimulation.o \
 	${OBJECTDIR}/_ext/113d9686/OnEventManager.o \
@@ -154,6 +157,7 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/113d9686/PluginManager.o \
 	${OBJECTDIR}/_ext/113d9686/SimulationExperiment.o \
 	${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1.o \
+	${OBJECTDIR}/_ext/113d9686/SimulationResults.o \
 	${OBJECTDIR}/_ext/113d9686/SimulationScenario.o \
 	${OBJECTDIR}/_ext/113d9686/Simulator.o \
 	${OBJECTDIR}/_ext/113d9686/SinkModelComponent.o \
@@ -178,10 +182,29 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/f13e5db9/Batch.o \
 	${OBJECTDIR}/_ext/f13e5db9/Buffer.o \
 	${OBJECTDIR}/_ext/f13e5db9/CellularAutomata.o \
+	${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o \
+	${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o \
+	${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o \
+	${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o \
+	${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o \
+	${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o \
+	${OBJECTDIR}/_ext/78795a70/Lattice.o \
+	${OBJECTDIR}/_ext/78795a70/LocalRule.o \
+	${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o \
+	${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o \
+	${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o \
+	${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o \
+	${OBJECTDIR}/_ext/78795a70/Neighborhood.o \
+	${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o \
+	${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o \
+	${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o \
+	${OBJECTDIR}/_ext/78795a70/StateSet.o \
+	${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o \
 	${OBJECTDIR}/_ext/f13e5db9/Clone.o \
 	${OBJECTDIR}/_ext/f13e5db9/CppForG.o \
 	${OBJECTDIR}/_ext/f13e5db9/Create.o \
 	${OBJECTDIR}/_ext/f13e5db9/Decide.o \
+	${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o \
 	${OBJECTDIR}/_ext/f13e5db9/Delay.o \
 	${OBJECTDIR}/_ext/f13e5db9/DiffEquations.o \
 	${OBJECTDIR}/_ext/f13e5db9/Dispose.o \
@@ -221,7 +244,10 @@ OBJECTFILES= \
 	${OBJECTDIR}/_ext/f13e5db9/Unstore.o \
 	${OBJECTDIR}/_ext/f13e5db9/Wait.o \
 	${OBJECTDIR}/_ext/f13e5db9/Write.o \
+	${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o \
+	${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o \
 	${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o \
+	${OBJECTDIR}/_ext/ccae408d/Conveyor.o \
 	${OBJECTDIR}/_ext/ccae408d/CppCompiler.o \
 	${OBJECTDIR}/_ext/ccae408d/DummyElement.o \
 	${OBJECTDIR}/_ext/ccae408d/EFSM.o \
@@ -623,6 +649,10 @@ ${OBJECTDIR}/_ext/113d9686/Attribute.o: ../../source/kernel/simulator/Attribute.
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/Attribute.o ../../source/kernel/simulator/Attribute.cpp
 
+${OBJECTDIR}/_ext/113d9686/BinarySerializer.o: ../../source/kernel/simulator/BinarySerializer.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/BinarySerializer.o ../../source/kernel/simulator/BinarySerializer.cpp
+
 ${OBJECTDIR}/_ext/113d9686/ComponentManager.o: ../../source/kernel/simulator/ComponentManager.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ComponentManager.o ../../source/kernel/simulator/ComponentManager.cpp
@@ -631,6 +661,10 @@ ${OBJECTDIR}/_ext/113d9686/ConnectionManager.o: ../../source/kernel/simulator/Co
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ConnectionManager.o ../../source/kernel/simulator/ConnectionManager.cpp
 
+${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o: ../../source/kernel/simulator/ContinuousIntegrator.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o ../../source/kernel/simulator/ContinuousIntegrator.cpp
+
 ${OBJECTDIR}/_ext/113d9686/Counter.o: ../../source/kernel/simulator/Counter.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/Counter.o ../../source/kernel/simulator/Counter.cpp
@@ -703,6 +737,10 @@ ${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2.o: ../../source/kernel/s
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2.o ../../source/kernel/simulator/ModelPersistenceDefaultImpl2.cpp
 
+${OBJECTDIR}/_ext/113d9686/ModelProfiler.o: ../../source/kernel/simulator/ModelProfiler.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ModelProfiler.o ../../source/kernel/simulator/ModelProfiler.cpp
+
 ${OBJECTDIR}/_ext/113d9686/ModelSerializer.o: ../../source/kernel/simulator/ModelSerializer.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/ModelSerializer.o ../../source/kernel/simulator/ModelSerializer.cpp
@@ -759,6 +797,10 @@ ${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1.o: ../../source/kernel
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1.o ../../source/kernel/simulator/SimulationReporterDefaultImpl1.cpp
 
+${OBJECTDIR}/_ext/113d9686/SimulationResults.o: ../../source/kernel/simulator/SimulationResults.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/SimulationResults.o ../../source/kernel/simulator/SimulationResults.cpp
+
 ${OBJECTDIR}/_ext/113d9686/SimulationScenario.o: ../../source/kernel/simulator/SimulationScenario.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/113d9686/SimulationScenario.o ../../source/kernel/simulator/SimulationScenario.cpp
@@ -855,6 +897,78 @@ ${OBJECTDIR}/_ext/f13e5db9/CellularAutomata.o: ../../source/plugins/components/C
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/CellularAutomata.o ../../source/plugins/components/CellularAutomata.cpp
 
+${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o: ../../source/plugins/components/CellularAutomata/BoundaryCondition.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o ../../source/plugins/components/CellularAutomata/BoundaryCondition.cpp
+
+${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o: ../../source/plugins/components/CellularAutomata/Boundary_Closed.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o ../../source/plugins/components/CellularAutomata/Boundary_Closed.cpp
+
+${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o: ../../source/plugins/components/CellularAutomata/Boundary_Fixed.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o ../../source/plugins/components/CellularAutomata/Boundary_Fixed.cpp
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o: ../../source/plugins/components/CellularAutomata/CellularAutomataBase.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o ../../source/plugins/components/CellularAutomata/CellularAutomataBase.cpp
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o: ../../source/plugins/components/CellularAutomata/CellularAutomata_1DTimed.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o ../../source/plugins/components/CellularAutomata/CellularAutomata_1DTimed.cpp
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o: ../../source/plugins/components/CellularAutomata/CellularAutomata_Classic.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o ../../source/plugins/components/CellularAutomata/CellularAutomata_Classic.cpp
+
+${OBJECTDIR}/_ext/78795a70/Lattice.o: ../../source/plugins/components/CellularAutomata/Lattice.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Lattice.o ../../source/plugins/components/CellularAutomata/Lattice.cpp
+
+${OBJECTDIR}/_ext/78795a70/LocalRule.o: ../../source/plugins/components/CellularAutomata/LocalRule.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/LocalRule.o ../../source/plugins/components/CellularAutomata/LocalRule.cpp
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o: ../../source/plugins/components/CellularAutomata/LocalRule_Elementary.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o ../../source/plugins/components/CellularAutomata/LocalRule_Elementary.cpp
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o: ../../source/plugins/components/CellularAutomata/LocalRule_GameOfLife.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o ../../source/plugins/components/CellularAutomata/LocalRule_GameOfLife.cpp
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o: ../../source/plugins/components/CellularAutomata/LocalRule_Growty.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o ../../source/plugins/components/CellularAutomata/LocalRule_Growty.cpp
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o: ../../source/plugins/components/CellularAutomata/LocalRule_HPP.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o ../../source/plugins/components/CellularAutomata/LocalRule_HPP.cpp
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood.o: ../../source/plugins/components/CellularAutomata/Neighborhood.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Neighborhood.o ../../source/plugins/components/CellularAutomata/Neighborhood.cpp
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o: ../../source/plugins/components/CellularAutomata/Neighborhood_Center.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o ../../source/plugins/components/CellularAutomata/Neighborhood_Center.cpp
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o: ../../source/plugins/components/CellularAutomata/Neighborhood_Moore.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o ../../source/plugins/components/CellularAutomata/Neighborhood_Moore.cpp
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o: ../../source/plugins/components/CellularAutomata/Neighborhood_VonNeumann.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o ../../source/plugins/components/CellularAutomata/Neighborhood_VonNeumann.cpp
+
+${OBJECTDIR}/_ext/78795a70/StateSet.o: ../../source/plugins/components/CellularAutomata/StateSet.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/78795a70/StateSet.o ../../source/plugins/components/CellularAutomata/StateSet.cpp
+
+${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o: ../../source/plugins/components/CellularAutomataComp.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o ../../source/plugins/components/CellularAutomataComp.cpp
+
 ${OBJECTDIR}/_ext/f13e5db9/Clone.o: ../../source/plugins/components/Clone.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/Clone.o ../../source/plugins/components/Clone.cpp
@@ -871,6 +985,10 @@ ${OBJECTDIR}/_ext/f13e5db9/Decide.o: ../../source/plugins/components/Decide.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/Decide.o ../../source/plugins/components/Decide.cpp
 
+${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o: ../../source/plugins/components/DefaultModalModel.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o ../../source/plugins/components/DefaultModalModel.cpp
+
 ${OBJECTDIR}/_ext/f13e5db9/Delay.o: ../../source/plugins/components/Delay.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/Delay.o ../../source/plugins/components/Delay.cpp
@@ -1027,10 +1145,22 @@ ${OBJECTDIR}/_ext/f13e5db9/Write.o: ../../source/plugins/components/Write.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/f13e5db9/Write.o ../../source/plugins/components/Write.cpp
 
+${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o: ../../source/plugins/components/network/DefaultNode.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/553e2bd8
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o ../../source/plugins/components/network/DefaultNode.cpp
+
+${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o: ../../source/plugins/components/network/DefaultNodeTransitionTable.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/553e2bd8
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o ../../source/plugins/components/network/DefaultNodeTransitionTable.cpp
+
 ${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o: ../../source/plugins/data/AssignmentItem.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o ../../source/plugins/data/AssignmentItem.cpp
 
+${OBJECTDIR}/_ext/ccae408d/Conveyor.o: ../../source/plugins/data/Conveyor.cpp
+	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
+	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/ccae408d/Conveyor.o ../../source/plugins/data/Conveyor.cpp
+
 ${OBJECTDIR}/_ext/ccae408d/CppCompiler.o: ../../source/plugins/data/CppCompiler.cpp
 	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
 	$(COMPILE.cc) -g -I../../source/gtest -std=c++14 -o ${OBJECTDIR}/_ext/ccae408d/CppCompiler.o ../../source/plugins/data/CppCompiler.cpp
@@ -2169,6 +2299,18 @@ ${OBJECTDIR}/_ext/113d9686/Attribute_nomain.o: ${OBJECTDIR}/_ext/113d9686/Attrib
 	    ${CP} ${OBJECTDIR}/_ext/113d9686/Attribute.o ${OBJECTDIR}/_ext/113d9686/Attribute_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/113d9686/BinarySerializer_nomain.o: ${OBJECTDIR}/_ext/113d9686/BinarySerializer.o ../../source/kernel/simulator/BinarySerializer.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/BinarySerializer.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/113d9686/BinarySerializer_nomain.o ../../source/kernel/simulator/BinarySerializer.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/113d9686/BinarySerializer.o ${OBJECTDIR}/_ext/113d9686/BinarySerializer_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/113d9686/ComponentManager_nomain.o: ${OBJECTDIR}/_ext/113d9686/ComponentManager.o ../../source/kernel/simulator/ComponentManager.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/ComponentManager.o`; \
@@ -2193,6 +2335,18 @@ ${OBJECTDIR}/_ext/113d9686/ConnectionManager_nomain.o: ${OBJECTDIR}/_ext/113d968
 	    ${CP} ${OBJECTDIR}/_ext/113d9686/ConnectionManager.o ${OBJECTDIR}/_ext/113d9686/ConnectionManager_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator_nomain.o: ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o ../../source/kernel/simulator/ContinuousIntegrator.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator_nomain.o ../../source/kernel/simulator/ContinuousIntegrator.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator.o ${OBJECTDIR}/_ext/113d9686/ContinuousIntegrator_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/113d9686/Counter_nomain.o: ${OBJECTDIR}/_ext/113d9686/Counter.o ../../source/kernel/simulator/Counter.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/Counter.o`; \
@@ -2409,6 +2563,18 @@ ${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2_nomain.o: ${OBJECTDIR}/_
 	    ${CP} ${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2.o ${OBJECTDIR}/_ext/113d9686/ModelPersistenceDefaultImpl2_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/113d9686/ModelProfiler_nomain.o: ${OBJECTDIR}/_ext/113d9686/ModelProfiler.o ../../source/kernel/simulator/ModelProfiler.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/ModelProfiler.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/113d9686/ModelProfiler_nomain.o ../../source/kernel/simulator/ModelProfiler.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/113d9686/ModelProfiler.o ${OBJECTDIR}/_ext/113d9686/ModelProfiler_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/113d9686/ModelSerializer_nomain.o: ${OBJECTDIR}/_ext/113d9686/ModelSerializer.o ../../source/kernel/simulator/ModelSerializer.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/ModelSerializer.o`; \
@@ -2577,6 +2743,18 @@ ${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1_nomain.o: ${OBJECTDIR}
 	    ${CP} ${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1.o ${OBJECTDIR}/_ext/113d9686/SimulationReporterDefaultImpl1_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/113d9686/SimulationResults_nomain.o: ${OBJECTDIR}/_ext/113d9686/SimulationResults.o ../../source/kernel/simulator/SimulationResults.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/SimulationResults.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/113d9686/SimulationResults_nomain.o ../../source/kernel/simulator/SimulationResults.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/113d9686/SimulationResults.o ${OBJECTDIR}/_ext/113d9686/SimulationResults_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/113d9686/SimulationScenario_nomain.o: ${OBJECTDIR}/_ext/113d9686/SimulationScenario.o ../../source/kernel/simulator/SimulationScenario.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/113d9686
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/113d9686/SimulationScenario.o`; \
@@ -2865,6 +3043,222 @@ ${OBJECTDIR}/_ext/f13e5db9/CellularAutomata_nomain.o: ${OBJECTDIR}/_ext/f13e5db9
 	    ${CP} ${OBJECTDIR}/_ext/f13e5db9/CellularAutomata.o ${OBJECTDIR}/_ext/f13e5db9/CellularAutomata_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/78795a70/BoundaryCondition_nomain.o: ${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o ../../source/plugins/components/CellularAutomata/BoundaryCondition.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/BoundaryCondition_nomain.o ../../source/plugins/components/CellularAutomata/BoundaryCondition.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/BoundaryCondition.o ${OBJECTDIR}/_ext/78795a70/BoundaryCondition_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Boundary_Closed_nomain.o: ${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o ../../source/plugins/components/CellularAutomata/Boundary_Closed.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Boundary_Closed_nomain.o ../../source/plugins/components/CellularAutomata/Boundary_Closed.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Boundary_Closed.o ${OBJECTDIR}/_ext/78795a70/Boundary_Closed_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Boundary_Fixed_nomain.o: ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o ../../source/plugins/components/CellularAutomata/Boundary_Fixed.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed_nomain.o ../../source/plugins/components/CellularAutomata/Boundary_Fixed.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed.o ${OBJECTDIR}/_ext/78795a70/Boundary_Fixed_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomataBase_nomain.o: ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o ../../source/plugins/components/CellularAutomata/CellularAutomataBase.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase_nomain.o ../../source/plugins/components/CellularAutomata/CellularAutomataBase.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase.o ${OBJECTDIR}/_ext/78795a70/CellularAutomataBase_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed_nomain.o: ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o ../../source/plugins/components/CellularAutomata/CellularAutomata_1DTimed.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed_nomain.o ../../source/plugins/components/CellularAutomata/CellularAutomata_1DTimed.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed.o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_1DTimed_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic_nomain.o: ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o ../../source/plugins/components/CellularAutomata/CellularAutomata_Classic.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic_nomain.o ../../source/plugins/components/CellularAutomata/CellularAutomata_Classic.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic.o ${OBJECTDIR}/_ext/78795a70/CellularAutomata_Classic_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Lattice_nomain.o: ${OBJECTDIR}/_ext/78795a70/Lattice.o ../../source/plugins/components/CellularAutomata/Lattice.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Lattice.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Lattice_nomain.o ../../source/plugins/components/CellularAutomata/Lattice.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Lattice.o ${OBJECTDIR}/_ext/78795a70/Lattice_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_nomain.o: ${OBJECTDIR}/_ext/78795a70/LocalRule.o ../../source/plugins/components/CellularAutomata/LocalRule.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/LocalRule.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/LocalRule_nomain.o ../../source/plugins/components/CellularAutomata/LocalRule.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/LocalRule.o ${OBJECTDIR}/_ext/78795a70/LocalRule_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary_nomain.o: ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o ../../source/plugins/components/CellularAutomata/LocalRule_Elementary.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary_nomain.o ../../source/plugins/components/CellularAutomata/LocalRule_Elementary.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary.o ${OBJECTDIR}/_ext/78795a70/LocalRule_Elementary_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife_nomain.o: ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o ../../source/plugins/components/CellularAutomata/LocalRule_GameOfLife.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife_nomain.o ../../source/plugins/components/CellularAutomata/LocalRule_GameOfLife.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife.o ${OBJECTDIR}/_ext/78795a70/LocalRule_GameOfLife_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_Growty_nomain.o: ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o ../../source/plugins/components/CellularAutomata/LocalRule_Growty.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty_nomain.o ../../source/plugins/components/CellularAutomata/LocalRule_Growty.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty.o ${OBJECTDIR}/_ext/78795a70/LocalRule_Growty_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/LocalRule_HPP_nomain.o: ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o ../../source/plugins/components/CellularAutomata/LocalRule_HPP.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP_nomain.o ../../source/plugins/components/CellularAutomata/LocalRule_HPP.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP.o ${OBJECTDIR}/_ext/78795a70/LocalRule_HPP_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_nomain.o: ${OBJECTDIR}/_ext/78795a70/Neighborhood.o ../../source/plugins/components/CellularAutomata/Neighborhood.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Neighborhood.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_nomain.o ../../source/plugins/components/CellularAutomata/Neighborhood.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Neighborhood.o ${OBJECTDIR}/_ext/78795a70/Neighborhood_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_Center_nomain.o: ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o ../../source/plugins/components/CellularAutomata/Neighborhood_Center.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center_nomain.o ../../source/plugins/components/CellularAutomata/Neighborhood_Center.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center.o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Center_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore_nomain.o: ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o ../../source/plugins/components/CellularAutomata/Neighborhood_Moore.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore_nomain.o ../../source/plugins/components/CellularAutomata/Neighborhood_Moore.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore.o ${OBJECTDIR}/_ext/78795a70/Neighborhood_Moore_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann_nomain.o: ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o ../../source/plugins/components/CellularAutomata/Neighborhood_VonNeumann.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann_nomain.o ../../source/plugins/components/CellularAutomata/Neighborhood_VonNeumann.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann.o ${OBJECTDIR}/_ext/78795a70/Neighborhood_VonNeumann_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/78795a70/StateSet_nomain.o: ${OBJECTDIR}/_ext/78795a70/StateSet.o ../../source/plugins/components/CellularAutomata/StateSet.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/78795a70
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/78795a70/StateSet.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/78795a70/StateSet_nomain.o ../../source/plugins/components/CellularAutomata/StateSet.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/78795a70/StateSet.o ${OBJECTDIR}/_ext/78795a70/StateSet_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o ../../source/plugins/components/CellularAutomataComp.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp_nomain.o ../../source/plugins/components/CellularAutomataComp.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp.o ${OBJECTDIR}/_ext/f13e5db9/CellularAutomataComp_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/f13e5db9/Clone_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/Clone.o ../../source/plugins/components/Clone.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/f13e5db9/Clone.o`; \
@@ -2913,6 +3307,18 @@ ${OBJECTDIR}/_ext/f13e5db9/Decide_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/Decide.o
 	    ${CP} ${OBJECTDIR}/_ext/f13e5db9/Decide.o ${OBJECTDIR}/_ext/f13e5db9/Decide_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o ../../source/plugins/components/DefaultModalModel.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel_nomain.o ../../source/plugins/components/DefaultModalModel.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel.o ${OBJECTDIR}/_ext/f13e5db9/DefaultModalModel_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/f13e5db9/Delay_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/Delay.o ../../source/plugins/components/Delay.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/f13e5db9
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/f13e5db9/Delay.o`; \
@@ -3372,6 +3778,30 @@ ${OBJECTDIR}/_ext/f13e5db9/Write_nomain.o: ${OBJECTDIR}/_ext/f13e5db9/Write.o ..
 	    ${CP} ${OBJECTDIR}/_ext/f13e5db9/Write.o ${OBJECTDIR}/_ext/f13e5db9/Write_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/553e2bd8/DefaultNode_nomain.o: ${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o ../../source/plugins/components/network/DefaultNode.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/553e2bd8
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/553e2bd8/DefaultNode_nomain.o ../../source/plugins/components/network/DefaultNode.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/553e2bd8/DefaultNode.o ${OBJECTDIR}/_ext/553e2bd8/DefaultNode_nomain.o;\
+	fi
+
+${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable_nomain.o: ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o ../../source/plugins/components/network/DefaultNodeTransitionTable.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/553e2bd8
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable_nomain.o ../../source/plugins/components/network/DefaultNodeTransitionTable.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable.o ${OBJECTDIR}/_ext/553e2bd8/DefaultNodeTransitionTable_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/ccae408d/AssignmentItem_nomain.o: ${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o ../../source/plugins/data/AssignmentItem.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o`; \
@@ -3384,6 +3814,18 @@ ${OBJECTDIR}/_ext/ccae408d/AssignmentItem_nomain.o: ${OBJECTDIR}/_ext/ccae408d/A
 	    ${CP} ${OBJECTDIR}/_ext/ccae408d/AssignmentItem.o ${OBJECTDIR}/_ext/ccae408d/AssignmentItem_nomain.o;\
 	fi
 
+${OBJECTDIR}/_ext/ccae408d/Conveyor_nomain.o: ${OBJECTDIR}/_ext/ccae408d/Conveyor.o ../../source/plugins/data/Conveyor.cpp 
+	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/ccae408d/Conveyor.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    $(COMPILE.cc) -g -I../../source/gtest -std=c++14 -Dmain=__nomain -o ${OBJECTDIR}/_ext/ccae408d/Conveyor_nomain.o ../../source/plugins/data/Conveyor.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/_ext/ccae408d/Conveyor.o ${OBJECTDIR}/_ext/ccae408d/Conveyor_nomain.o;\
+	fi
+
 ${OBJECTDIR}/_ext/ccae408d/CppCompiler_nomain.o: ${OBJECTDIR}/_ext/ccae408d/CppCompiler.o ../../source/plugins/data/CppCompiler.cpp 
 	${MKDIR} -p ${OBJECTDIR}/_ext/ccae408d
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/_ext/ccae408d/CppCompiler.o`; \
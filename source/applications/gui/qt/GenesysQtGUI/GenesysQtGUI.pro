@@ -13,8 +13,10 @@ QMAKE_CXXFLAGS += -pedantic -Wno-unused -Wmissing-field-initializers
 
 SOURCES += \
     ../../../../kernel/simulator/Attribute.cpp \
+    ../../../../kernel/simulator/BinarySerializer.cpp \
     ../../../../kernel/simulator/ComponentManager.cpp \
     ../../../../kernel/simulator/ConnectionManager.cpp \
+    ../../../../kernel/simulator/ContinuousIntegrator.cpp \
     ../../../../kernel/simulator/Counter.cpp \
     ../../../../kernel/simulator/CppSerializer.cpp \
     ../../../../kernel/simulator/Entity.cpp \
@@ -33,6 +35,7 @@ SOURCES += \
     ../../../../kernel/simulator/ModelInfo.cpp \
     ../../../../kernel/simulator/ModelManager.cpp \
     ../../../../kernel/simulator/ModelPersistenceDefaultImpl2.cpp \
+    ../../../../kernel/simulator/ModelProfiler.cpp \
     ../../../../kernel/simulator/ModelSerializer.cpp \
     ../../../../kernel/simulator/ModelSimulation.cpp \
     ../../../../kernel/simulator/OnEventManager.cpp \
@@ -47,6 +50,7 @@ SOURCES += \
     ../../../../kernel/simulator/PluginManager.cpp \
     ../../../../kernel/simulator/SimulationExperiment.cpp \
     ../../../../kernel/simulator/SimulationReporterDefaultImpl1.cpp \
+    ../../../../kernel/simulator/SimulationResults.cpp \
     ../../../../kernel/simulator/SimulationScenario.cpp \
     ../../../../kernel/simulator/Simulator.cpp \
     ../../../../kernel/simulator/SinkModelComponent.cpp \
@@ -70,6 +74,24 @@ SOURCES += \
     ../../../../plugins/components/Assign.cpp \
     ../../../../plugins/components/Batch.cpp \
     ../../../../plugins/components/Buffer.cpp \
+    ../../../../plugins/components/CellularAutomata/BoundaryCondition.cpp \
+    ../../../../plugins/components/CellularAutomata/Boundary_Closed.cpp \
+    ../../../../plugins/components/CellularAutomata/Boundary_Fixed.cpp \
+    ../../../../plugins/components/CellularAutomata/CellularAutomataBase.cpp \
+    ../../../../plugins/components/CellularAutomata/CellularAutomata_1DTimed.cpp \
+    ../../../../plugins/components/CellularAutomata/CellularAutomata_Classic.cpp \
+    ../../../../plugins/components/CellularAutomata/Lattice.cpp \
+    ../../../../plugins/components/CellularAutomata/LocalRule.cpp \
+    ../../../../plugins/components/CellularAutomata/LocalRule_Elementary.cpp \
+    ../../../../plugins/components/CellularAutomata/LocalRule_GameOfLife.cpp \
+    ../../../../plugins/components/CellularAutomata/LocalRule_Growty.cpp \
+    ../../../../plugins/components/CellularAutomata/LocalRule_HPP.cpp \
+    ../../../../plugins/components/CellularAutomata/Neighborhood.cpp \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_Center.cpp \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_Moore.cpp \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_VonNeumann.cpp \
+    ../../../../plugins/components/CellularAutomata/StateSet.cpp \
+    ../../../../plugins/components/CellularAutomataComp.cpp \
     ../../../../plugins/components/Clone.cpp \
     ../../../../plugins/components/CppForG.cpp \
     ../../../../plugins/components/Create.cpp \
@@ -111,7 +133,9 @@ SOURCES += \
     ../../../../plugins/components/Unstore.cpp \
     ../../../../plugins/components/Write.cpp \
     ../../../../plugins/components/network/DefaultNode.cpp \
+    ../../../../plugins/components/network/DefaultNodeTransitionTable.cpp \
     ../../../../plugins/data/AssignmentItem.cpp \
+    ../../../../plugins/data/Conveyor.cpp \
     ../../../../plugins/data/CppCompiler.cpp \
     ../../../../plugins/data/DummyElement.cpp \
     ../../../../plugins/data/EntityGroup.cpp \
@@ -129,6 +153,8 @@ SOURCES += \
     ../../../../plugins/data/Station.cpp \
     ../../../../plugins/data/Storage.cpp \
     ../../../../plugins/data/Variable.cpp \
+    ../../../../tools/FactorialDesign/FactorialDesign.cpp \
+    ../../../../tools/FactorialDesign/FactorialDesignExperiment.cpp \
     ../../../../tools/FitterDummyImpl.cpp \
     ../../../../tools/HypothesisTesterDefaultImpl1.cpp \
     ../../../../tools/ProbabilityDistribution.cpp \
@@ -273,8 +299,10 @@ SOURCES += \
 HEADERS += \
     ../../../../kernel/TraitsKernel.h \
     ../../../../kernel/simulator/Attribute.h \
+    ../../../../kernel/simulator/BinarySerializer.h \
     ../../../../kernel/simulator/ComponentManager.h \
     ../../../../kernel/simulator/ConnectionManager.h \
+    ../../../../kernel/simulator/ContinuousIntegrator.h \
     ../../../../kernel/simulator/Counter.h \
     ../../../../kernel/simulator/CppSerializer.h \
     ../../../../kernel/simulator/DefineGetterSetter.h \
@@ -296,6 +324,7 @@ HEADERS += \
     ../../../../kernel/simulator/ModelInfo.h \
     ../../../../kernel/simulator/ModelManager.h \
     ../../../../kernel/simulator/ModelPersistenceDefaultImpl2.h \
+    ../../../../kernel/simulator/ModelProfiler.h \
     ../../../../kernel/simulator/ModelSerializer.h \
     ../../../../kernel/simulator/ModelSimulation.h \
     ../../../../kernel/simulator/OnEventManager.h \
@@ -316,6 +345,7 @@ HEADERS += \
     ../../../../kernel/simulator/SimulationExperiment.h \
     ../../../../kernel/simulator/SimulationReporterDefaultImpl1.h \
     ../../../../kernel/simulator/SimulationReporter_if.h \
+    ../../../../kernel/simulator/SimulationResults.h \
     ../../../../kernel/simulator/SimulationScenario.h \
     ../../../../kernel/simulator/Simulator.h \
     ../../../../kernel/simulator/SinkModelComponent.h \
@@ -335,6 +365,7 @@ HEADERS += \
     ../../../../kernel/statistics/StatisticsDataFile_if.h \
     ../../../../kernel/statistics/StatisticsDefaultImpl1.h \
     ../../../../kernel/statistics/Statistics_if.h \
+    ../../../../kernel/statistics/WeightedAccumulator.h \
     ../../../../kernel/util/Exact.h \
     ../../../../kernel/util/List.h \
     ../../../../kernel/util/ListObservable.h \
@@ -351,6 +382,24 @@ HEADERS += \
     ../../../../plugins/components/Assign.h \
     ../../../../plugins/components/Batch.h \
     ../../../../plugins/components/Buffer.h \
+    ../../../../plugins/components/CellularAutomata/BoundaryCondition.h \
+    ../../../../plugins/components/CellularAutomata/Boundary_Closed.h \
+    ../../../../plugins/components/CellularAutomata/Boundary_Fixed.h \
+    ../../../../plugins/components/CellularAutomata/CellularAutomataBase.h \
+    ../../../../plugins/components/CellularAutomata/CellularAutomata_1DTimed.h \
+    ../../../../plugins/components/CellularAutomata/CellularAutomata_Classic.h \
+    ../../../../plugins/components/CellularAutomata/Lattice.h \
+    ../../../../plugins/components/CellularAutomata/LocalRule.h \
+    ../../../../plugins/components/CellularAutomata/LocalRule_Elementary.h \
+    ../../../../plugins/components/CellularAutomata/LocalRule_GameOfLife.h \
+    ../../../../plugins/components/CellularAutomata/LocalRule_Growty.h \
+    ../../../../plugins/components/CellularAutomata/LocalRule_HPP.h \
+    ../../../../plugins/components/CellularAutomata/Neighborhood.h \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_Center.h \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_Moore.h \
+    ../../../../plugins/components/CellularAutomata/Neighborhood_VonNeumann.h \
+    ../../../../plugins/components/CellularAutomata/StateSet.h \
+    ../../../../plugins/components/CellularAutomataComp.h \
     ../../../../plugins/components/Clone.h \
     ../../../../plugins/components/CppForG.h \
     ../../../../plugins/components/Create.h \
@@ -392,7 +441,9 @@ HEADERS += \
     ../../../../plugins/components/Unstore.h \
     ../../../../plugins/components/Write.h \
     ../../../../plugins/components/network/DefaultNode.h \
+    ../../../../plugins/components/network/DefaultNodeTransitionTable.h \
     ../../../../plugins/data/AssignmentItem.h \
+    ../../../../plugins/data/Conveyor.h \
     ../../../../plugins/data/CppCompiler.h \
     ../../../../plugins/data/DummyElement.h \
     ../../../../plugins/data/EntityGroup.h \
@@ -411,6 +462,8 @@ HEADERS += \
     ../../../../plugins/data/Storage.h \
     ../../../../plugins/data/Variable.h \
     ../../../../tools/DataAnalyser_if.h \
+    ../../../../tools/FactorialDesign/FactorialDesign.h \
+    ../../../../tools/FactorialDesign/FactorialDesignExperiment.h \
     ../../../../tools/FitterDummyImpl.h \
     ../../../../tools/Fitter_if.h \
     ../../../../tools/HypothesisTesterDefaultImpl1.h \
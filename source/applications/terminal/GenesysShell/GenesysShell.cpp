@@ -183,6 +183,7 @@ void GenesysShell::defineCommands() {
 	_commands->insert(new ShellCommand("", "simul", "[-s|--start|-p|--step]", "Control simulation", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdSimulation)));
 	//_commands->insert(new ShellCommand("", "step", "", "Step simulation", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdSimulationStep)));
 	//_commands->insert(new ShellCommand("", "stop", "", "Stop simulation", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdSimulationStop)));
+	_commands->insert(new ShellCommand("", "top", "[-e|--enable] [-d|--disable] [-n|--number=<number of components>] [-f|--file=<snapshot filename>]", "Enable or disable profiling of the simulation, or show the components that took most time", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdTop)));
 	_commands->insert(new ShellCommand("", "config", "[-r|--replications=<number of repliations>] [-l|--length=<replication length>] [-t|--time=<replication time unit>] [-s|--show]", "Configure simulation", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdReplication)));
 	//_commands->insert(new ShellCommand("", "showsetup", "", "Show simulation info", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdSimulationInfo)));
 	//_commands->insert(new ShellCommand("", "showreport", "", "Show simulation report", DefineExecuterMember<GenesysShell>(this, &GenesysShell::cmdShowReport)));
@@ -463,6 +464,49 @@ void GenesysShell::cmdReplication() {
 	}
 }
 
+void GenesysShell::cmdTop() {
+	if (model==nullptr) {
+		cout<<"Error: There is no loaded model to profile."<<endl;
+		return;
+	}
+	ModelProfiler* profiler = model->getProfiler();
+	unsigned int number = 10;
+	bool show = true;
+	string parameter;
+	string key, value;
+	for (unsigned short i = 1; i<_typedWords->size(); i++) {
+		parameter = _typedWords->at(i);
+		key = "";
+		value = "";
+		Util::SepKeyVal(parameter, key, value);
+		if (key=="-e"||key=="--enable") {
+			cout<<"Profiling enabled. It is shown after the next simulation"<<endl;
+			profiler->setEnabled(true);
+			show = false;
+		} else if (key=="-d"||key=="--disable") {
+			cout<<"Profiling disabled"<<endl;
+			profiler->setEnabled(false);
+			show = false;
+		} else if (key=="-n"||key=="--number") {
+			number = stoi(value);
+		} else if (key=="-f"||key=="--file") {
+			cout<<"Setting snapshot file to "<<value<<endl;
+			profiler->setSnapshotFilename(value);
+			show = false;
+		} else {
+			cout<<"Syntax error on "<<parameter<<endl;
+			return;
+		}
+	}
+	if (show) {
+		if (!profiler->isEnabled()&&profiler->getNumberOfEvents()==0) {
+			cout<<"Profiling is disabled. Enable it with \"top -e\" and simulate"<<endl;
+		} else {
+			cout<<profiler->show(number);
+		}
+	}
+}
+
 void GenesysShell::cmdModel() {
 	if (_typedWords->size()!=2) {
 		cout<<"Wrong number of parameters"<<endl;
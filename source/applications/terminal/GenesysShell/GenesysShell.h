@@ -68,6 +68,7 @@ public: // commands
 	//void cmdSimulationStop();
 	//void cmdSimulationInfo();
 	void cmdReplication();
+	void cmdTop();
 	//void cmdShowReport();
 	void cmdModel();
 	//void cmdModelClose();
@@ -30,6 +30,9 @@
 #include "statistics/StatisticsDataFileDefaultImpl.h"
 #include "statistics/SamplerDefaultImpl1.h"
 
+#include "../tools/ProbabilityDistribution.h"
+#include "../tools/SolverDefaultImpl1.h"
+
 //namespace GenesysKernel {
 
 template <typename T>
@@ -96,6 +99,7 @@ template <> struct TraitsKernel<ModelPersistence_if> {
  */
 template <> struct TraitsKernel<Statistics_if> {
 	typedef double DataType; // TODO: not used yet. Change all classes that collect statistics to this type (so classes that deal with erros and bit limits can be assigned to it
+	typedef ProbabilityDistribution ProbabilityDistributionImplementation; // critical values of confidence intervals
 	static constexpr double SignificanceLevel = 0.05;
 };
 
@@ -114,6 +118,13 @@ template <> struct TraitsKernel<Collector_if> {
 	typedef CollectorDatafileDefaultImpl1 Implementation;
 	typedef double DataType; // TODO: not used yet. Change all classes that collect statistics to this type (so classes that deal with erros and bit limits can be assigned to it
 };
+
+/*
+ *  Continuous systems
+ */
+template <> struct TraitsKernel<Solver_if> {
+	typedef SolverDefaultImpl1 Implementation; // integrates continuous systems between events
+};
 //namespace\\}
 
 #endif /* TRAITSKERNEL_H */
@@ -0,0 +1,163 @@
+#include "BinarySerializer.h"
+
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+static const char MAGIC[] = {'G', 'E', 'N', 'B'};
+static const unsigned int VERSION = 1;
+
+BinarySerializer::BinarySerializer(Model *model) :
+_model(model) {
+	assert(model != nullptr);
+}
+
+PersistenceRecord* BinarySerializer::newPersistenceRecord() {
+	return new PersistenceRecord(*_model->getPersistence());
+}
+
+static void writeUInt(std::ostream& output, std::size_t value) {
+	do {
+		unsigned char byte = value & 0x7F;
+		value >>= 7;
+		output.put(value != 0 ? byte | 0x80 : byte);
+	} while (value != 0);
+}
+
+static std::size_t readUInt(std::streambuf* input) {
+	std::size_t value = 0;
+	for (unsigned int shift = 0; shift < 64; shift += 7) {
+		int byte = input->sbumpc();
+		if (byte == std::char_traits<char>::eof()) {
+			throw std::runtime_error("invalid binary model: unexpected end of file");
+		}
+		value |= static_cast<std::size_t> (byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) return value;
+	}
+	throw std::runtime_error("invalid binary model: malformed integer");
+}
+
+bool BinarySerializer::dump(std::ostream& output) {
+	// interns all strings, and translates records to indexes
+	std::unordered_map<std::string, std::size_t> indexes;
+	std::vector<const std::string*> strings;
+	const auto intern = [&](const std::string & str) {
+		auto it = indexes.find(str);
+		if (it != indexes.end()) return it->second;
+		std::size_t index = strings.size();
+		strings.push_back(&(indexes.emplace(str, index).first->first));
+		return index;
+	};
+	std::vector<std::vector<std::size_t>> records;
+	records.reserve(_components.size());
+	for_each([&](const std::string & name) {
+		PersistenceRecord* fields = _components.at(name).get();
+		std::vector<std::size_t> record;
+		record.reserve(3 * fields->size());
+		for (auto& it : *fields) {
+			record.push_back(intern(it.second.first));
+			record.push_back(it.second.kind);
+			record.push_back(intern(it.second.second));
+		}
+		records.push_back(std::move(record));
+		return 0;
+	});
+
+	// then writes them
+	output.write(MAGIC, sizeof (MAGIC));
+	writeUInt(output, VERSION);
+	writeUInt(output, strings.size());
+	for (const std::string* str : strings) {
+		writeUInt(output, str->size());
+		output.write(str->data(), str->size());
+	}
+	writeUInt(output, records.size());
+	for (auto& record : records) {
+		writeUInt(output, record.size() / 3);
+		for (std::size_t i = 0; i < record.size(); i += 3) {
+			writeUInt(output, record[i]);
+			output.put(static_cast<char> (record[i + 1]));
+			writeUInt(output, record[i + 2]);
+		}
+	}
+	return output.good();
+}
+
+bool BinarySerializer::load(std::istream& input) {
+	std::streambuf* buffer = input.rdbuf();
+	try {
+		char magic[sizeof (MAGIC)];
+		if (buffer->sgetn(magic, sizeof (MAGIC)) != sizeof (MAGIC) || !std::equal(magic, magic + sizeof (MAGIC), MAGIC)) {
+			throw std::runtime_error("invalid binary model: not a GenESyS binary model");
+		}
+		std::size_t version = readUInt(buffer);
+		if (version > VERSION) {
+			throw std::runtime_error("invalid binary model: unsupported version " + std::to_string(version));
+		}
+		std::vector<std::string> strings(readUInt(buffer));
+		for (std::string& str : strings) {
+			str.resize(readUInt(buffer));
+			if (buffer->sgetn(&str[0], str.size()) != static_cast<std::streamsize> (str.size())) {
+				throw std::runtime_error("invalid binary model: unexpected end of file");
+			}
+		}
+		const auto string = [&](std::size_t index) -> const std::string& {
+			if (index >= strings.size()) throw std::runtime_error("invalid binary model: string index out of range");
+			return strings[index];
+		};
+		auto fields = std::unique_ptr<PersistenceRecord>(newPersistenceRecord());
+		for (std::size_t numRecords = readUInt(buffer); numRecords > 0; numRecords--) {
+			fields->clear();
+			for (std::size_t numFields = readUInt(buffer); numFields > 0; numFields--) {
+				const std::string& key = string(readUInt(buffer));
+				int kind = buffer->sbumpc();
+				const std::string& value = string(readUInt(buffer));
+				fields->insert({key, value, kind == PersistenceRecord::Entry::Kind::text ? PersistenceRecord::Entry::Kind::text : PersistenceRecord::Entry::Kind::numeric});
+			}
+			std::string type = fields->loadField("typename", "");
+			if (type == "") throw std::runtime_error("invalid binary model: record without typename");
+			Util::identification id = fields->loadField("id", 0);
+			std::string name = id == 0 ? type : fields->loadField("name", "_" + std::to_string(id));
+			put(name, type, id, fields.get());
+		}
+	} catch (const std::runtime_error& e) {
+		_model->getTracer()->traceError(e.what());
+		return false;
+	}
+	return true;
+}
+
+bool BinarySerializer::get(const std::string& name, PersistenceRecord *entry) {
+	assert(entry != nullptr);
+	auto it = _components.find(name);
+	if (it == _components.end()) return false;
+	entry->insert(it->second->begin(), it->second->end());
+	return true;
+}
+
+bool BinarySerializer::put(const std::string name, const std::string type, const Util::identification id, PersistenceRecord *fields) {
+	assert(fields != nullptr);
+	auto saved = std::unique_ptr<PersistenceRecord>(this->newPersistenceRecord());
+	saved->insert(fields->begin(), fields->end());
+	if (id != 0) saved->saveField("name", name);
+	saved->saveField("typename", type);
+	saved->saveField("id", id);
+	_components[name] = std::move(saved);
+	return true;
+}
+
+int BinarySerializer::for_each(std::function<int(const std::string&) > delegate) {
+	// enfore id-order
+	std::vector<std::pair<int, std::string>> sorted;
+	sorted.reserve(_components.size());
+	for (auto& entry : _components) sorted.push_back({entry.second->loadField("id", -1), entry.first});
+	std::sort(sorted.begin(), sorted.end());
+
+	// then do the user-level iteration
+	for (auto& label : sorted) {
+		int stop = delegate(label.second);
+		if (stop) return stop;
+	}
+	return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef BINARYSERIALIZER_H
+#define BINARYSERIALIZER_H
+
+#include <unordered_map>
+#include<memory>
+
+#include "ModelSerializer.h"
+#include "Model.h"
+
+/*!
+ * @brief Compact binary model format.
+ *
+ * Every string (typenames, field keys and values) is written once, in a table at the beginning of the file, and records refer to them
+ * by index. Since most keys and many values repeat across components, files are small and loading is mostly reading integers.
+ *
+ * Layout (integers are unsigned LEB128 varints): "GENB", version, number of strings, each string (length and bytes), number of records,
+ * and each record (number of fields, and for each field the index of its key, its kind as one byte, and the index of its value).
+ */
+class BinarySerializer : public ModelSerializer {
+public:
+	explicit BinarySerializer(Model *model);
+
+public: // ModelSerializer interface
+	PersistenceRecord* newPersistenceRecord() override;
+	bool dump(std::ostream& output) override;
+	bool load(std::istream& input) override;
+	bool get(const std::string& name, PersistenceRecord *entry) override;
+	bool put(const std::string name, const std::string type, const Util::identification id, PersistenceRecord *fields) override;
+	int for_each(std::function<int(const std::string&) > delegate) override;
+
+private:
+	Model *_model{};
+	std::unordered_map<std::string, std::unique_ptr<PersistenceRecord>> _components
+	{
+	};
+};
+
+#endif // BINARYSERIALIZER_H
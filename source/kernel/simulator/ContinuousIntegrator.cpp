@@ -0,0 +1,270 @@
+#include "ContinuousIntegrator.h"
+#include <cmath>
+#include "Model.h"
+#include "../TraitsKernel.h"
+
+ContinuousIntegrator::ContinuousIntegrator(Model* model) {
+	_model = model;
+	_solver = new TraitsKernel<Solver_if>::Implementation();
+	_solver->setMaxSteps(1e9); // as many steps as needed to reach the next event
+}
+
+ContinuousIntegrator::~ContinuousIntegrator() {
+	clear();
+	delete _systems;
+	delete _zeroCrossings;
+	delete _solver;
+}
+
+void ContinuousIntegrator::addSystem(ContinuousSystem* system) {
+	_systems->insert(system);
+}
+
+List<ContinuousSystem*>* ContinuousIntegrator::getSystems() const {
+	return _systems;
+}
+
+List<ZeroCrossing*>* ContinuousIntegrator::getZeroCrossings() const {
+	return _zeroCrossings;
+}
+
+void ContinuousIntegrator::clear() {
+	for (ContinuousSystem* system : *_systems->list()) {
+		delete system;
+	}
+	_systems->clear();
+	for (ZeroCrossing* crossing : *_zeroCrossings->list()) {
+		delete crossing;
+	}
+	_zeroCrossings->clear();
+	_state.clear();
+	_time = 0.0;
+	_evaluations = 0;
+}
+
+bool ContinuousIntegrator::hasSystems() const {
+	return !_systems->empty();
+}
+
+double ContinuousIntegrator::getTime() const {
+	return _time;
+}
+
+unsigned int ContinuousIntegrator::getNumberOfEvaluations() const {
+	return _evaluations;
+}
+
+bool ContinuousIntegrator::advance(double time) {
+	if (_systems->empty() || time <= _time) {
+		return true;
+	}
+	// the state is read again, since discrete events may have changed it. Crossings are relative to the values after such changes
+	_loadState();
+	const unsigned int n = _state.size();
+	std::vector<double> values(_zeroCrossings->size());
+	_setState(_time, _state.data());
+	for (ZeroCrossing* crossing : *_zeroCrossings->list()) {
+		crossing->value = crossing->condition();
+	}
+	double lastTime = _time;
+	std::vector<double> lastState = _state, crossedState;
+	ZeroCrossing* crossed = nullptr;
+	double crossedTime = time;
+	std::vector<double> y = _state;
+	// crossings are checked at the end of every step of the solver, so each one is bracketed inside a step whatever the output interval
+	Solver_if::OdeObserver stepObserver = nullptr;
+	if (!_zeroCrossings->empty()) {
+		stepObserver = [this, n, &values, &lastTime, &lastState, &crossed, &crossedTime, &crossedState](double t, const double* yt) {
+			crossed = _checkZeroCrossings(t, yt, values);
+			if (crossed != nullptr) {
+				crossedTime = t;
+				crossedState.assign(yt, yt + n);
+				return false;
+			}
+			lastTime = t;
+			lastState.assign(yt, yt + n);
+			return true;
+		};
+	}
+	Solver_if::OdeObserver outputObserver = nullptr;
+	for (ContinuousSystem* system : *_systems->list()) {
+		if (system->observer != nullptr) {
+			outputObserver = [this](double t, const double* yt) {
+				_observe(t, yt);
+				return true;
+			};
+			break;
+		}
+	}
+	bool solved = _integrate(_time, time, y, outputObserver, stepObserver);
+	if (crossed == nullptr && !solved) {
+		_model->getTracer()->traceError("Continuous systems could not be integrated from time " + std::to_string(lastTime) + " up to " + std::to_string(time) + " within precision " + std::to_string(_solver->getPrecision()));
+		y = lastState;
+		time = lastTime;
+	}
+	if (crossed == nullptr) {
+		crossed = _checkZeroCrossings(time, y.data(), values);
+		crossedTime = time;
+		crossedState = y;
+	}
+	if (crossed == nullptr) {
+		_state = y;
+		_time = time;
+		_setState(_time, _state.data());
+		return true;
+	}
+	// finds when the condition crossed zero inside the step, and stops there. Outputs inside the step up to that time are observed
+	_time = _locateZeroCrossing(crossed, lastTime, lastState, crossedTime, crossedState);
+	if (outputObserver != nullptr && _time > lastTime) {
+		std::vector<double> observed = lastState;
+		_integrate(lastTime, _time, observed, outputObserver);
+	}
+	_state = crossedState;
+	_setState(_time, _state.data());
+	for (ZeroCrossing* crossing : *_zeroCrossings->list()) {
+		crossing->value = crossing->condition();
+	}
+	InternalEvent* event = new InternalEvent(_time, crossed->description);
+	crossed->setEventHandler(event);
+	_model->getFutureEvents()->insert(event);
+	_model->getTracer()->traceSimulation(crossed->owner, "Zero-crossing \"" + crossed->description + "\" found at time " + std::to_string(_time), TraceManager::Level::L7_internal);
+	return false;
+}
+
+void ContinuousIntegrator::_loadState() {
+	// all systems are integrated together, using the most demanding method and precision among them
+	unsigned int n = 0;
+	bool allFixedStep = true, anyStiff = false;
+	double precision = 1.0;
+	_outputInterval = 0.0;
+	for (ContinuousSystem* system : *_systems->list()) {
+		n += system->size;
+		allFixedStep &= system->method == Solver_if::OdeMethod::RungeKutta4;
+		anyStiff |= system->method == Solver_if::OdeMethod::BDF2;
+		precision = std::min(precision, system->precision);
+		if (system->outputInterval > 0.0 && (_outputInterval == 0.0 || system->outputInterval < _outputInterval)) {
+			_outputInterval = system->outputInterval;
+		}
+	}
+	if (anyStiff) {
+		_method = Solver_if::OdeMethod::BDF2;
+	} else if (allFixedStep && _outputInterval > 0.0) { // fixed steps are the output interval
+		_method = Solver_if::OdeMethod::RungeKutta4;
+	} else {
+		_method = Solver_if::OdeMethod::DormandPrince45;
+	}
+	_solver->setPrecision(precision);
+	_state.resize(n);
+	unsigned int offset = 0;
+	for (ContinuousSystem* system : *_systems->list()) {
+		system->getState(_state.data() + offset);
+		offset += system->size;
+	}
+}
+
+void ContinuousIntegrator::_setState(double time, const double* y) {
+	unsigned int offset = 0;
+	for (ContinuousSystem* system : *_systems->list()) {
+		system->setState(time, y + offset);
+		offset += system->size;
+	}
+}
+
+void ContinuousIntegrator::_derivatives(double time, const double* y, double* dydt) {
+	// the states of all systems are set before any derivative is evaluated, so systems may depend on each other
+	_evaluations++;
+	_setState(time, y);
+	unsigned int offset = 0;
+	for (ContinuousSystem* system : *_systems->list()) {
+		system->derivatives(time, y + offset, dydt + offset);
+		offset += system->size;
+	}
+}
+
+bool ContinuousIntegrator::_integrate(double initTime, double finalTime, std::vector<double>& y, Solver_if::OdeObserver observer, Solver_if::OdeObserver stepObserver) {
+	return _solver->solve(initTime, finalTime, y, [this](double t, const double* yt, double * dydt) {
+		_derivatives(t, yt, dydt);
+	}, _method, _outputInterval, observer, stepObserver);
+}
+
+void ContinuousIntegrator::_observe(double time, const double* y) {
+	unsigned int offset = 0;
+	for (ContinuousSystem* system : *_systems->list()) {
+		if (system->observer != nullptr) {
+			system->observer(time, y + offset);
+		}
+		offset += system->size;
+	}
+}
+
+/*!
+ * Evaluates all the conditions at the given state and returns the first one that crossed zero since the last accepted values. If none
+ * did, the new values become the last accepted ones.
+ */
+ZeroCrossing* ContinuousIntegrator::_checkZeroCrossings(double time, const double* y, std::vector<double>& values) {
+	if (_zeroCrossings->empty()) {
+		return nullptr;
+	}
+	_setState(time, y);
+	unsigned int i = 0;
+	for (ZeroCrossing* crossing : *_zeroCrossings->list()) {
+		values[i] = crossing->condition();
+		bool wasPositive = crossing->value > 0.0, isPositive = values[i] > 0.0;
+		bool rising = !wasPositive && isPositive, falling = wasPositive && !isPositive;
+		if ((rising && crossing->direction != ZeroCrossing::Direction::Falling) || (falling && crossing->direction != ZeroCrossing::Direction::Rising)) {
+			return crossing;
+		}
+		i++;
+	}
+	i = 0;
+	for (ZeroCrossing* crossing : *_zeroCrossings->list()) {
+		crossing->value = values[i++];
+	}
+	return nullptr;
+}
+
+/*!
+ * Illinois (modified regula falsi) method, falling back to bisection when the condition is not continuous (as boolean expressions).
+ * The condition at any time inside the bracket is evaluated by integrating again from the left end of the bracket. Returns the right end,
+ * where the crossing has already happened, and the state at that time.
+ */
+double ContinuousIntegrator::_locateZeroCrossing(ZeroCrossing* crossing, double leftTime, const std::vector<double>& leftState, double rightTime, std::vector<double>& state) {
+	const double tolerance = 1e-9 * std::max(1.0, std::abs(rightTime));
+	const bool leftPositive = crossing->value > 0.0;
+	double left = crossing->value;
+	_setState(rightTime, state.data());
+	double right = crossing->condition();
+	std::vector<double> leftY = leftState, y;
+	int retainedSide = 0;
+	for (unsigned int iteration = 0; iteration < 100 && rightTime - leftTime > tolerance; iteration++) {
+		double time = 0.5 * (leftTime + rightTime);
+		if (left != right && std::isfinite(left) && std::isfinite(right)) {
+			double secant = (leftTime * right - rightTime * left) / (right - left);
+			if (secant > leftTime + 0.5 * tolerance && secant < rightTime - 0.5 * tolerance) {
+				time = secant;
+			}
+		}
+		y = leftY;
+		_integrate(leftTime, time, y);
+		_setState(time, y.data());
+		double value = crossing->condition();
+		if ((value > 0.0) == leftPositive) {
+			leftTime = time;
+			left = value;
+			leftY = y;
+			if (retainedSide == 1) {
+				right *= 0.5;
+			}
+			retainedSide = 1;
+		} else {
+			rightTime = time;
+			right = value;
+			state = y;
+			if (retainedSide == -1) {
+				left *= 0.5;
+			}
+			retainedSide = -1;
+		}
+	}
+	return rightTime;
+}
@@ -0,0 +1,103 @@
+#ifndef CONTINUOUSINTEGRATOR_H
+#define CONTINUOUSINTEGRATOR_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include "Event.h"
+#include "../util/List.h"
+#include "../../tools/Solver_if.h"
+
+class Model;
+
+/*!
+ * A system of ordinary differential equations dy/dt=f(t,y) advanced in time by the ContinuousIntegrator. The owner keeps the state
+ * (usually in variables) and exchanges it with the integrator as contiguous vectors.
+ */
+struct ContinuousSystem {
+	ModelDataDefinition* owner = nullptr;
+	unsigned int size = 0;
+	std::function<void(double* y) > getState; //!< Copies the current state of the owner into y
+	std::function<void(double time, const double* y) > setState; //!< Sets the state of the owner, before evaluating derivatives or conditions
+	Solver_if::OdeSystem derivatives; //!< Evaluates dydt=f(t,y), for this system only
+	Solver_if::OdeMethod method = Solver_if::OdeMethod::DormandPrince45;
+	double precision = 1e-6;
+	double outputInterval = 0.0; //!< If greater than zero, the observer is invoked at the multiples of outputInterval
+	std::function<void(double time, const double* y) > observer = nullptr;
+};
+
+/*!
+ * A condition on the continuous state. When its value changes sign (in the given direction) inside a step of the solver, the crossing time
+ * is found by root finding inside that step and an InternalEvent is scheduled at that time.
+ */
+struct ZeroCrossing {
+
+	enum class Direction : int {
+		Rising = 0, Falling = 1, Both = 2, num_elements = 3
+	};
+	ModelDataDefinition* owner = nullptr;
+	std::string description;
+	std::function<double() > condition; //!< Evaluated after the states of all systems are set
+	Direction direction = Direction::Both;
+	std::function<void(InternalEvent* event) > setEventHandler; //!< Sets the handler of the event scheduled at the crossing time
+	double value = 0.0; //!< Value of the condition at the time the systems were last advanced to
+};
+
+/*!
+ * The ContinuousIntegrator is owned by ModelSimulation and advances all registered continuous systems together (so they can be coupled)
+ * between discrete events, with adaptive steps. Before each discrete event, the state is read back from the owners, since the event may
+ * have changed it. Systems and zero-crossings are registered by components when replications are initialized.
+ */
+class ContinuousIntegrator {
+public:
+	ContinuousIntegrator(Model* model);
+	virtual ~ContinuousIntegrator();
+public:
+	void addSystem(ContinuousSystem* system);
+
+	template<typename Class>
+	void addZeroCrossing(Class* object, std::string description, std::function<double() > condition, void (Class::*handler)(void*), void* parameter = nullptr, ZeroCrossing::Direction direction = ZeroCrossing::Direction::Both) {
+		ZeroCrossing* crossing = new ZeroCrossing();
+		crossing->owner = object;
+		crossing->description = description;
+		crossing->condition = condition;
+		crossing->direction = direction;
+		crossing->setEventHandler = [object, handler, parameter](InternalEvent * event) {
+			event->setEventHandler<Class>(object, handler, parameter);
+		};
+		_zeroCrossings->insert(crossing);
+	}
+	List<ContinuousSystem*>* getSystems() const;
+	List<ZeroCrossing*>* getZeroCrossings() const;
+	void clear(); //!< Removes all systems and zero-crossings and restarts time. Called when a replication is initialized
+	bool hasSystems() const;
+	/*!
+	 * \brief advance
+	 * \param time
+	 * \return false if a zero-crossing happened before time. Then systems are advanced just up to the crossing time and an InternalEvent
+	 * is scheduled at that time
+	 */
+	bool advance(double time);
+	double getTime() const;
+	unsigned int getNumberOfEvaluations() const;
+private:
+	void _loadState();
+	void _setState(double time, const double* y);
+	void _derivatives(double time, const double* y, double* dydt);
+	bool _integrate(double initTime, double finalTime, std::vector<double>& y, Solver_if::OdeObserver observer = nullptr, Solver_if::OdeObserver stepObserver = nullptr);
+	void _observe(double time, const double* y);
+	ZeroCrossing* _checkZeroCrossings(double time, const double* y, std::vector<double>& values);
+	double _locateZeroCrossing(ZeroCrossing* crossing, double leftTime, const std::vector<double>& leftState, double rightTime, std::vector<double>& state);
+private:
+	Model* _model;
+	Solver_if* _solver;
+	List<ContinuousSystem*>* _systems = new List<ContinuousSystem*>();
+	List<ZeroCrossing*>* _zeroCrossings = new List<ZeroCrossing*>();
+	std::vector<double> _state;
+	double _time = 0.0;
+	Solver_if::OdeMethod _method;
+	double _outputInterval;
+	unsigned int _evaluations = 0;
+};
+
+#endif /* CONTINUOUSINTEGRATOR_H */
@@ -22,10 +22,7 @@
 Entity::Entity(Model* model, std::string name, bool insertIntoModel) : ModelDataDefinition(model, Util::TypeOf<Entity>(), name, insertIntoModel) {
 	_entityNumber = Util::GetLastIdOfType(Util::TypeOf<Entity>());
 	unsigned int numAttributes = _parentModel->getDataManager()->getNumberOfDataDefinitions(Util::TypeOf<Attribute>());
-	for (unsigned i = 0; i < numAttributes; i++) {
-		std::map<std::string, double>* map = new std::map<std::string, double>();
-		_attributeValues->insert(map);
-	}
+	_attributeValues.resize(numAttributes);
 }
 
 void Entity::setEntityTypeName(std::string entityTypeName) {
@@ -54,25 +51,26 @@ std::string Entity::show() {
 		message += ",entityType=\"" + this->_entityType->getName() + "\"";
 	}
 	message += ",attributes=[";
-	_attributeValues->front();
-	for (unsigned int i = 0; i < _attributeValues->size(); i++) {
-		std::map<std::string, double>* map = _attributeValues->current();
+	for (unsigned int i = 0; i < _attributeValues.size(); i++) {
+		const AttributeValue& attribute = _attributeValues[i];
 		std::string attributeName = _parentModel->getDataManager()->getDataDefinitionList(Util::TypeOf<Attribute>())->getAtRank(i)->getName();
 		message += attributeName + "=";
-		if (map->size() == 0) { // scalar
-			message += "NaN;"; //std::to_string(map->begin()->second) + ";";
-		} else if (map->size() == 1) { // scalar
-			message += Util::StrTruncIfInt(std::to_string(map->begin()->second)) + ", ";
+		if (!attribute.assigned && attribute.indexed.empty()) {
+			message += "NaN;";
+		} else if (attribute.indexed.empty()) { // scalar
+			message += Util::StrTruncIfInt(std::to_string(attribute.value)) + ", ";
 		} else {
 			// array or matrix
 			message += "[";
-			for (std::pair<std::string, double> valIt : *map) {
+			if (attribute.assigned) {
+				message += "=>" + Util::StrTruncIfInt(std::to_string(attribute.value)) + ", ";
+			}
+			for (std::pair<std::string, double> valIt : attribute.indexed) {
 				message += valIt.first + "=>" + Util::StrTruncIfInt(std::to_string(valIt.second)) + ", ";
 			}
 			message = message.substr(0, message.length() - 2);
 			message += "];";
 		}
-		_attributeValues->next();
 	}
 	message = message.substr(0, message.length() - 1);
 	message += "]";
@@ -83,13 +81,15 @@ std::string Entity::show() {
 double Entity::getAttributeValue(std::string attributeName, std::string index) {
 	int rank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), attributeName);
 	if (rank >= 0) {
-		std::map<std::string, double>* map = this->_attributeValues->getAtRank(rank);
-		if (map == nullptr) {
-			map = new std::map<std::string, double>();
-			_attributeValues->setAtRank(rank, map);
+		if (rank >= (int) _attributeValues.size()) { // attribute created after the entity
+			return 0.0;
 		}
-		std::map<std::string, double>::iterator mapIt = map->find(index);
-		if (mapIt != map->end()) {//found
+		const AttributeValue& attribute = _attributeValues[rank];
+		if (index == "") {
+			return attribute.value;
+		}
+		std::map<std::string, double>::const_iterator mapIt = attribute.indexed.find(index);
+		if (mapIt != attribute.indexed.end()) {//found
 			return (*mapIt).second;
 		} else { // not found
 			return 0.0;
@@ -114,22 +114,16 @@ void Entity::setAttributeValue(std::string attributeName, double value, std::str
 		if (createIfNotFound) {
 			new Attribute(_parentModel, attributeName);
 			rank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), attributeName);
-			std::map<std::string, double>* map = new std::map<std::string, double>();
-			_attributeValues->setAtRank(rank, map);
 		} else
 			traceError("Attribute \"" + attributeName + "\" not found", TraceManager::Level::L3_errorRecover);
 	}
 	if (rank >= 0) {
-		std::map<std::string, double>* map = _attributeValues->getAtRank(rank);
-		if (map == nullptr) {
-			map = new std::map<std::string, double>();
-			_attributeValues->setAtRank(rank, map);
-		}
-		std::map<std::string, double>::iterator mapIt = map->find(index);
-		if (mapIt != map->end()) {//found
-			(*mapIt).second = value;
-		} else { // not found
-			map->insert({index, value}); // (map->end(), std::pair<std::string, double>(index, value));
+		AttributeValue* attribute = _attributeValue(rank);
+		if (index == "") {
+			attribute->value = value;
+			attribute->assigned = true;
+		} else {
+			attribute->indexed[index] = value;
 		}
 		//@ TODO: Check if it is a special attribute, eg Entity.Type
 	}
@@ -140,6 +134,47 @@ void Entity::setAttributeValue(Util::identification attributeID, double value, s
 	setAttributeValue(attrname, value, index);
 }
 
+double Entity::getAttributeValueByRank(unsigned int rank, const std::string& index) const {
+	if (rank >= _attributeValues.size()) { // attribute created after the entity
+		return 0.0;
+	}
+	const AttributeValue& attribute = _attributeValues[rank];
+	if (index == "") {
+		return attribute.value;
+	}
+	std::map<std::string, double>::const_iterator mapIt = attribute.indexed.find(index);
+	return mapIt != attribute.indexed.end() ? mapIt->second : 0.0;
+}
+
+void Entity::setAttributeValueByRank(unsigned int rank, double value, const std::string& index) {
+	AttributeValue* attribute = _attributeValue(rank);
+	if (index == "") {
+		attribute->value = value;
+		attribute->assigned = true;
+	} else {
+		attribute->indexed[index] = value;
+	}
+}
+
+void Entity::copyAttributeValuesFrom(const Entity* source) {
+	_attributeValues = source->_attributeValues;
+}
+
+void Entity::addAttributeValuesFrom(const Entity* source) {
+	if (_attributeValues.size() < source->_attributeValues.size()) {
+		_attributeValues.resize(source->_attributeValues.size());
+	}
+	AttributeValue* attribute = _attributeValues.data();
+	for (const AttributeValue& sourceAttribute : source->_attributeValues) {
+		attribute->value += sourceAttribute.value;
+		attribute->assigned |= sourceAttribute.assigned;
+		for (const std::pair<const std::string, double>& valIt : sourceAttribute.indexed) {
+			attribute->indexed[valIt.first] += valIt.second;
+		}
+		attribute++;
+	}
+}
+
 Util::identification Entity::entityNumber() const {
 	return _entityNumber;
 }
@@ -156,3 +191,10 @@ bool Entity::_check(std::string* errorMessage) {
 	*errorMessage += "";
 	return true;
 }
+
+Entity::AttributeValue* Entity::_attributeValue(int rank) {
+	if (rank >= (int) _attributeValues.size()) { // attribute created after the entity
+		_attributeValues.resize(rank + 1);
+	}
+	return &_attributeValues[rank];
+}
@@ -16,6 +16,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "../util/Util.h"
 #include "../util/List.h"
@@ -133,6 +134,30 @@ public:
 	 * \param value
 	 */
 	void setAttributeValue(Util::identification attributeID, double value, std::string index="");
+	/*!
+	 * \brief getAttributeValueByRank gets the value of the attribute at the rank (as given by ModelDataManager::getRankOf), without looking it up by name
+	 * \param rank
+	 * \param index
+	 * \return
+	 */
+	double getAttributeValueByRank(unsigned int rank, const std::string& index="") const;
+	/*!
+	 * \brief setAttributeValueByRank sets the value of the attribute at the rank (as given by ModelDataManager::getRankOf), without looking it up by name
+	 * \param rank
+	 * \param value
+	 * \param index
+	 */
+	void setAttributeValueByRank(unsigned int rank, double value, const std::string& index="");
+	/*!
+	 * \brief copyAttributeValuesFrom copies the values of every attribute of the source entity, including indexed ones, replacing those of this entity
+	 * \param source
+	 */
+	void copyAttributeValuesFrom(const Entity* source);
+	/*!
+	 * \brief addAttributeValuesFrom adds the values of every attribute of the source entity, including indexed ones, to those of this entity
+	 * \param source
+	 */
+	void addAttributeValuesFrom(const Entity* source);
 	/*!
 	 * \brief entityNumber
 	 * \return
@@ -142,10 +167,21 @@ protected:
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 	virtual bool _check(std::string* errorMessage);
+private:
+	/*!
+	 * Values of an attribute of the entity. The value without index is kept apart, so entities without array attributes hold a plain
+	 * block of values, copied at once
+	 */
+	struct AttributeValue {
+		double value = 0.0;
+		bool assigned = false;
+		std::map<std::string, double> indexed;
+	};
+	AttributeValue* _attributeValue(int rank);
 private:
 	Util::identification _entityNumber;
 	EntityType* _entityType = nullptr;
-	List< std::map<std::string, double>* >* _attributeValues = new List<std::map<std::string, double>*>();
+	std::vector<AttributeValue> _attributeValues; // by rank of the attribute
 };
 //namespace\\}
 #endif /* ENTITY_H */
@@ -12,13 +12,25 @@
  */
 
 #include "ExperimentManagerDefaultImpl1.h"
+#include "SimulationResults.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#ifndef _WIN32
+#include <csignal>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/wait.h>
+#endif
 
-ExperimentManagerDefaultImpl1::ExperimentManagerDefaultImpl1() {
+ExperimentManagerDefaultImpl1::ExperimentManagerDefaultImpl1(Simulator* simulator, unsigned int maxParallelScenarios) {
+	_simulator = simulator;
+	_maxParallelScenarios = maxParallelScenarios;
 }
 
 List<SimulationScenario*>* ExperimentManagerDefaultImpl1::getScenarios() const {
-	// @TODO: implement
-	return nullptr;
+	return _scenarios;
 }
 
 //List<PropertyBase*>* ExperimentManagerDefaultImpl1::getControls() const {
@@ -43,16 +55,264 @@ List<SimulationScenario*>* ExperimentManagerDefaultImpl1::getScenarios() const {
 //}
 
 void ExperimentManagerDefaultImpl1::startSimulationOfScenario(SimulationScenario* scenario) {
-	// @TODO: implement
+	_traceSimulationProcess("Scenario \"" + scenario->getScenarioName() + "\" is starting");
+	std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+	std::string errorMessage;
+	if (scenario->startSimulation(_simulator, &errorMessage)) {
+		std::chrono::duration<double> duration = std::chrono::system_clock::now() - start;
+		_traceSimulationProcess("Scenario \"" + scenario->getScenarioName() + "\" has finished. Elapsed time " + std::to_string(duration.count()) + " seconds.");
+	} else {
+		_numberOfFailedScenarios++;
+		_traceSimulationProcess("Scenario \"" + scenario->getScenarioName() + "\" has failed: " + errorMessage, TraceManager::Level::L1_errorFatal);
+	}
 }
 
 void ExperimentManagerDefaultImpl1::startExperiment() {
-	// @TODO: implement
+	_stopRequested = false;
+	_numberOfFailedScenarios = 0;
+	const unsigned int numScenarios = _scenarios->size();
+	const unsigned int maxWorkers = getMaxParallelScenarios();
+	std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+	_traceSimulationProcess("Experiment is starting: " + std::to_string(numScenarios) + " scenarios on up to " + std::to_string(maxWorkers) + " parallel workers", TraceManager::Level::L2_results);
+	unsigned int finished = 0;
+#ifdef _WIN32
+	// there is no fork, so scenarios are simulated one after the other in this process
+	for (SimulationScenario* scenario : *_scenarios->list()) {
+		if (_stopRequested) {
+			break;
+		}
+		startSimulationOfScenario(scenario);
+		finished++;
+	}
+#else
+	std::list<SimulationScenario*>::iterator nextScenario = _scenarios->list()->begin();
+	unsigned int started = 0;
+	std::list<Worker*> running;
+	while (true) {
+		// keep the pool full
+		while (!_stopRequested && nextScenario != _scenarios->list()->end() && running.size() < maxWorkers) {
+			SimulationScenario* scenario = (*nextScenario);
+			nextScenario++;
+			started++;
+			Worker* worker = new Worker();
+			if (_startWorker(scenario, started, worker)) {
+				running.push_back(worker);
+				_traceSimulationProcess("Scenario " + std::to_string(started) + " of " + std::to_string(numScenarios) + " (\"" + scenario->getScenarioName() + "\") is starting");
+			} else { // could not fork. Just simulate it here
+				delete worker;
+				startSimulationOfScenario(scenario);
+				finished++;
+			}
+		}
+		if (running.empty()) {
+			break;
+		}
+		// wait for responses of any running worker
+		std::vector<struct pollfd> fds;
+		for (Worker* worker : running) {
+			fds.push_back({worker->fd, POLLIN, 0});
+		}
+		if (poll(fds.data(), fds.size(), -1) < 0) {
+			continue; // interrupted by a signal
+		}
+		std::list<Worker*>::iterator it = running.begin();
+		for (struct pollfd& pfd : fds) {
+			Worker* worker = (*it);
+			it++;
+			if ((pfd.revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+				continue;
+			}
+			char buffer[4096];
+			ssize_t count = read(worker->fd, buffer, sizeof (buffer));
+			if (count > 0) {
+				worker->received.append(buffer, count);
+				continue;
+			}
+			// end of data. The worker is done
+			std::string errorMessage;
+			finished++;
+			if (_workerFinished(worker, &errorMessage)) {
+				_traceSimulationProcess("Scenario " + std::to_string(worker->number) + " of " + std::to_string(numScenarios) + " (\"" + worker->scenario->getScenarioName() + "\") has finished. " + std::to_string(finished) + " of " + std::to_string(numScenarios) + " scenarios done");
+			} else {
+				_numberOfFailedScenarios++;
+				_traceSimulationProcess("Scenario " + std::to_string(worker->number) + " of " + std::to_string(numScenarios) + " (\"" + worker->scenario->getScenarioName() + "\") has failed: " + errorMessage, TraceManager::Level::L1_errorFatal);
+			}
+			running.remove(worker);
+			delete worker;
+		}
+		if (_stopRequested) {
+			for (Worker* worker : running) {
+				kill(worker->pid, SIGTERM);
+			}
+		}
+	}
+#endif
+	std::chrono::duration<double> duration = std::chrono::system_clock::now() - start;
+	std::string message = "Experiment has " + std::string(_stopRequested ? "been stopped" : "finished") + " after simulating " + std::to_string(finished - _numberOfFailedScenarios) + " of " + std::to_string(numScenarios) + " scenarios";
+	if (_numberOfFailedScenarios > 0) {
+		message += " (" + std::to_string(_numberOfFailedScenarios) + " failed)";
+	}
+	_traceSimulationProcess(message + ". Elapsed time " + std::to_string(duration.count()) + " seconds.", TraceManager::Level::L2_results);
+	_stopRequested = false;
 }
 
 void ExperimentManagerDefaultImpl1::stopExperiment() {
-	// @TODO: implement
+	_stopRequested = true;
 }
 
 void ExperimentManagerDefaultImpl1::addTraceSimulationHandler(traceSimulationProcessListener traceSimulationProcessListener) {
+	_traceSimulationProcessHandlers->insert(traceSimulationProcessListener);
+}
+
+void ExperimentManagerDefaultImpl1::setMaxParallelScenarios(unsigned int maxParallelScenarios) {
+	_maxParallelScenarios = maxParallelScenarios;
+}
+
+unsigned int ExperimentManagerDefaultImpl1::getMaxParallelScenarios() const {
+	if (_maxParallelScenarios > 0) {
+		return _maxParallelScenarios;
+	}
+	unsigned int hardwareThreads = std::thread::hardware_concurrency();
+	return hardwareThreads > 0 ? hardwareThreads : 1;
+}
+
+unsigned int ExperimentManagerDefaultImpl1::getNumberOfFailedScenarios() const {
+	return _numberOfFailedScenarios;
+}
+
+#ifndef _WIN32
+
+bool ExperimentManagerDefaultImpl1::_startWorker(SimulationScenario* scenario, unsigned int number, Worker* worker) {
+	int pipefd[2];
+	if (pipe(pipefd) != 0) {
+		return false;
+	}
+	std::cout.flush(); // otherwise buffered output would be written again by the worker
+	fflush(nullptr);
+	// workers never write into the same results file. Each one has its own, appended by this process (see _workerFinished)
+	worker->resultsFilename = std::string(P_tmpdir) + "/genesys" + std::to_string(getpid()) + "_" + std::to_string(number) + ".results";
+	pid_t pid = fork();
+	if (pid < 0) {
+		close(pipefd[0]);
+		close(pipefd[1]);
+		return false;
+	}
+	if (pid == 0) { // the worker
+		close(pipefd[0]);
+		_runWorker(scenario, worker->resultsFilename, pipefd[1]);
+		// never returns
+	}
+	close(pipefd[1]);
+	worker->pid = pid;
+	worker->fd = pipefd[0];
+	worker->number = number;
+	worker->scenario = scenario;
+	return true;
+}
+
+/*!
+ * Runs in the worker process. The responses are sent back as lines "<value>\t<response name>", after a first line that is
+ * "OK" or "ERROR <message>". Values of responses at the end of each replication are sent as lines "*<value>\t<response name>".
+ * If the model has a results file, results are written into resultsFilename instead, and the results file of the model is sent as a
+ * line "#<results filename>".
+ */
+void ExperimentManagerDefaultImpl1::_runWorker(SimulationScenario* scenario, std::string resultsFilename, int fd) {
+	_simulator->getTraceManager()->setTraceLevel(TraceManager::Level::L0_noTraces);
+	scenario->setResultsFilename(resultsFilename);
+	std::string errorMessage;
+	bool success = false;
+	try {
+		success = scenario->startSimulation(_simulator, &errorMessage);
+	} catch (const std::exception& e) {
+		errorMessage = e.what();
+	}
+	std::string message;
+	if (success) {
+		message = "OK\n";
+		if (scenario->getModelResultsFilename() != "") {
+			message += "#" + scenario->getModelResultsFilename() + "\n";
+		}
+		char value[32];
+		for (std::pair<std::string, double>* response : *scenario->getResponseValues()) {
+			snprintf(value, sizeof (value), "%.17g", response->second);
+			message += std::string(value) + "\t" + response->first + "\n";
+		}
+		for (std::pair<std::string, double>* response : *scenario->getReplicationResponseValues()) {
+			snprintf(value, sizeof (value), "%.17g", response->second);
+			message += "*" + std::string(value) + "\t" + response->first + "\n";
+		}
+	} else {
+		message = "ERROR " + errorMessage + "\n";
+	}
+	const char* data = message.c_str();
+	size_t remaining = message.length();
+	while (remaining > 0) {
+		ssize_t written = write(fd, data, remaining);
+		if (written <= 0) {
+			break;
+		}
+		data += written;
+		remaining -= written;
+	}
+	close(fd);
+	_exit(success ? 0 : 1); // no destructors nor atexit handlers of the parent process
+}
+
+bool ExperimentManagerDefaultImpl1::_workerFinished(Worker* worker, std::string* errorMessage) {
+	close(worker->fd);
+	int status = 0;
+	waitpid(worker->pid, &status, 0);
+	const bool succeeded = _readWorkerResponses(worker, status, errorMessage);
+	std::remove(worker->resultsFilename.c_str());
+	std::remove(SimulationResults::IndexFilename(worker->resultsFilename).c_str());
+	return succeeded;
+}
+
+bool ExperimentManagerDefaultImpl1::_readWorkerResponses(Worker* worker, int status, std::string* errorMessage) {
+	std::string& received = worker->received;
+	if (received.compare(0, 6, "ERROR ") == 0) {
+		*errorMessage = Util::Trim(received.substr(6));
+		return false;
+	}
+	if (received.compare(0, 3, "OK\n") != 0) {
+		if (WIFSIGNALED(status)) {
+			*errorMessage = "worker process was terminated by signal " + std::to_string(WTERMSIG(status));
+		} else {
+			*errorMessage = "worker process exited with status " + std::to_string(WEXITSTATUS(status)) + " without sending responses";
+		}
+		return false;
+	}
+	worker->scenario->getResponseValues()->clear();
+	worker->scenario->getReplicationResponseValues()->clear();
+	size_t pos = 3, endOfLine;
+	while ((endOfLine = received.find('\n', pos)) != std::string::npos) {
+		size_t tab = received.find('\t', pos);
+		if (received[pos] == '#') { // the worker wrote results, to be appended to the results file of the model
+			SimulationResultsWriter writer(received.substr(pos + 1, endOfLine - pos - 1));
+			if (!writer.open(errorMessage) || !writer.append(worker->resultsFilename, errorMessage)) {
+				return false;
+			}
+		} else if (tab != std::string::npos && tab < endOfLine) {
+			bool ofReplication = received[pos] == '*';
+			size_t begin = ofReplication ? pos + 1 : pos;
+			double value = std::strtod(received.substr(begin, tab - begin).c_str(), nullptr);
+			std::string name = received.substr(tab + 1, endOfLine - tab - 1);
+			if (ofReplication) {
+				worker->scenario->addReplicationResponseValue(name, value);
+			} else {
+				worker->scenario->setResponseValue(name, value);
+			}
+		}
+		pos = endOfLine + 1;
+	}
+	return true;
+}
+
+#endif
+
+void ExperimentManagerDefaultImpl1::_traceSimulationProcess(std::string text, TraceManager::Level level) {
+	TraceSimulationProcess e(text, level);
+	for (traceSimulationProcessListener handler : *_traceSimulationProcessHandlers->list()) {
+		handler(e);
+	}
 }
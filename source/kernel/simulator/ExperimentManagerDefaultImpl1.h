@@ -17,9 +17,16 @@
 #include "ExperimetManager_if.h"
 #include "SimulationScenario.h"
 
+/*!
+ * Simulates a set of scenarios concurrently. Each scenario is simulated by a worker process (forked from the current one, so it
+ * shares the already loaded plugins) that loads its own instance of the model, sets the controls, simulates and sends the
+ * responses back. Since parser, ids and indentation are global to the process, a process (and not a thread) is the unit of
+ * parallelism. At most getMaxParallelScenarios() workers run at the same time. On Windows, where there is no fork, scenarios are
+ * simulated one after the other in the current process.
+ */
 class ExperimentManagerDefaultImpl1 : public ExperimentManager_if {
 public:
-	ExperimentManagerDefaultImpl1();
+	ExperimentManagerDefaultImpl1(Simulator* simulator, unsigned int maxParallelScenarios = 0);
 	virtual ~ExperimentManagerDefaultImpl1() = default;
 public:
 	virtual List<SimulationScenario*>* getScenarios() const;
@@ -27,11 +34,37 @@ public:
 	//virtual List<PropertyBase*>* getResponses() const;
 	//virtual List<PropertyBase*>* extractControlsFromModel(std::string modelFilename) const;
 	//virtual List<PropertyBase*>* extractResponsesFromModel(std::string modelFilename) const;
-	virtual void startSimulationOfScenario(SimulationScenario* scenario);
-	virtual void startExperiment();
-	virtual void stopExperiment();
+	virtual void startSimulationOfScenario(SimulationScenario* scenario); //!< Simulates a single scenario in the current process
+	virtual void startExperiment(); //!< Simulates all scenarios in parallel worker processes and returns when all of them have finished
+	virtual void stopExperiment(); //!< Usually invoked by a trace handler. Scenarios not yet started are not simulated and running workers are terminated
 	virtual void addTraceSimulationHandler(traceSimulationProcessListener traceSimulationProcessListener);
+public:
+	void setMaxParallelScenarios(unsigned int maxParallelScenarios); //!< 0 means the number of hardware threads
+	unsigned int getMaxParallelScenarios() const;
+	unsigned int getNumberOfFailedScenarios() const;
+private:
+	struct Worker {
+		int pid;
+		int fd;
+		unsigned int number;
+		SimulationScenario* scenario;
+		std::string received;
+		std::string resultsFilename; //!< where the worker writes results, appended to the results file of the model when it finishes
+	};
+#ifndef _WIN32
+	bool _startWorker(SimulationScenario* scenario, unsigned int number, Worker* worker);
+	void _runWorker(SimulationScenario* scenario, std::string resultsFilename, int fd);
+	bool _workerFinished(Worker* worker, std::string* errorMessage);
+	bool _readWorkerResponses(Worker* worker, int status, std::string* errorMessage);
+#endif
+	void _traceSimulationProcess(std::string text, TraceManager::Level level = TraceManager::Level::L5_event);
 private:
+	Simulator* _simulator;
+	unsigned int _maxParallelScenarios;
+	unsigned int _numberOfFailedScenarios = 0;
+	bool _stopRequested = false;
+	List<SimulationScenario*>* _scenarios = new List<SimulationScenario*>();
+	List<traceSimulationProcessListener>* _traceSimulationProcessHandlers = new List<traceSimulationProcessListener>();
 	//List<PropertyBase*>* _controls = new List<PropertyBase*>();
 };
 
@@ -1,7 +1,7 @@
 #include "GenSerializer.h"
 
 #include <cassert>
-#include <regex>
+#include <cctype>
 #include <vector>
 #include <algorithm>
 
@@ -95,79 +95,87 @@ std::string GenSerializer::linearize(PersistenceRecord *fields) {
 	return line;
 };
 
+/*!
+ * Returns the value between begin and end, removing the quotes of a "quoted text" (that may be unterminated at the end of the line)
+ * or replacing "\_" by blanks otherwise.
+ */
+static std::string fieldValue(const char* begin, const char* end, PersistenceRecord::Entry::Kind* kind) {
+	if (begin < end && *begin == '"') {
+		const char* closing = std::find(begin + 1, end, '"');
+		if (closing >= end - 1) {
+			*kind = PersistenceRecord::Entry::Kind::text;
+			return std::string(begin + 1, closing);
+		}
+	}
+	*kind = PersistenceRecord::Entry::Kind::numeric;
+	std::string value;
+	value.reserve(end - begin);
+	for (const char* c = begin; c < end; c++) {
+		if (*c == '\\' && c + 1 < end && *(c + 1) == '_') {
+			value += ' ';
+			c++;
+		} else {
+			value += *c;
+		}
+	}
+	return value;
+}
+
 bool GenSerializer::load(std::istream& input) {
+	// each line is tokenized in a single pass. Fields are separated by blanks (except inside "quoted texts"), and each one is either
+	// key=value or positional (id, typename and name, in this order)
 	bool res = true;
 	std::string line;
-	while (std::getline(input, line) && res) {
-		line = Util::Trim(line);
-		if (line.substr(0, 1) == "#" || line.empty()) continue;
+	auto fields = std::unique_ptr<PersistenceRecord>(this->newPersistenceRecord());
+	while (res && std::getline(input, line)) {
+		const char* pos = line.data();
+		const char* const end = pos + line.size();
+		while (pos < end && std::isspace(static_cast<unsigned char> (*pos))) pos++;
+		if (pos == end || *pos == '#') continue;
 		_model->getTracer()->trace(TraceManager::Level::L9_mostDetailed, line);
-
-		// replaces every "quoted" string by {stringX}
-		std::regex regexQuoted("\"([^\"]*)\"");
-		auto matches_begin = std::sregex_iterator(line.begin(), line.end(), regexQuoted);
-		auto matches_end = std::sregex_iterator();
-		std::unordered_map<std::string, std::string> strings{};
-		int i = 0;
-		for (std::sregex_iterator it = matches_begin; it != matches_end; it++, i++) {
-			std::string match_str = (*it).str();
-			std::string subst = "{string" + std::to_string(i) + "}";
-			strings[subst] = match_str;
-		}
-		for (auto& it : strings) {
-			std::string match_str = it.second;
-			unsigned int pos = line.find(match_str, 0);
-			line.replace(pos, match_str.length(), it.first);
-		}
-
-		// split on " "
-		std::regex regex{R"([\s]+)"};
-		std::sregex_token_iterator tit{line.begin(), line.end(), regex, -1};
-		std::vector<std::string> lstfields{tit,{}};
-		auto fields = std::unique_ptr<PersistenceRecord>(this->newPersistenceRecord());
-		// for each field, separate key and value and form a record
-		regex = {R"([=]+)"};
-		i = 0;
-		for (auto it = lstfields.begin(); it != lstfields.end(); it++, i++) {
-			std::string key, val;
-			// 
-			tit = {(*it).begin(), (*it).end(), regex, -1};
-			std::vector<std::string> veckeyval = {tit,{}};
-			veckeyval[0] = Util::Trim((veckeyval[0]));
-			if (veckeyval[0] != "") {
-				if (veckeyval.size() > 1) {
-					veckeyval[1] = Util::Trim((veckeyval[1]));
-					if (veckeyval[1].substr(0, 1) == "\"" && veckeyval[1].substr(veckeyval[1].length() - 1, 1) == "\"") { // remove ""
-						veckeyval[1] = veckeyval[1].substr(1, veckeyval[1].length() - 2);
+		fields->clear();
+		for (unsigned int i = 0; ; i++) {
+			while (pos < end && std::isspace(static_cast<unsigned char> (*pos))) pos++;
+			if (pos == end) break;
+			const char* keyBegin = pos;
+			const char* keyEnd = nullptr;
+			const char* valueBegin = pos;
+			const char* valueEnd = nullptr;
+			while (pos < end && !std::isspace(static_cast<unsigned char> (*pos))) {
+				if (*pos == '"') { // blanks and '=' are part of quoted texts
+					const char* closing = std::find(pos + 1, end, '"');
+					pos = closing < end ? closing + 1 : end;
+				} else if (*pos == '=') {
+					if (keyEnd == nullptr) { // the first "=" (or "==") separates key and value
+						keyEnd = pos;
+						while (pos < end && *pos == '=') pos++;
+						valueBegin = pos;
+					} else { // and a second one ends the value
+						if (valueEnd == nullptr) valueEnd = pos;
+						pos++;
 					}
-					veckeyval[1] = std::regex_replace(veckeyval[1], std::regex("\\\\_"), " ");
-					key = veckeyval[0];
-					val = veckeyval[1];
 				} else {
-					if (i == 0) {
-						key = "id";
-						val = veckeyval[0];
-					} else if (i == 1) {
-						key = "typename";
-						val = veckeyval[0];
-					} else if (i == 2) {
-						key = "name";
-						val = veckeyval[0];
-					} else {
-						key = veckeyval[0];
-						val = "";
-					}
+					pos++;
 				}
 			}
-			// replaces back {stringX} by the strings themselves before saving
-			auto sit = strings.find(val);
-			if (sit != strings.end()) {
-				auto& str = sit->second;
-				val = str.substr(1, str.length() - 2);
-				fields->insert({key, val, PersistenceRecord::Entry::Kind::text});
-			} else {
-				fields->insert({key, val, PersistenceRecord::Entry::Kind::numeric});
+			if (valueEnd == nullptr) valueEnd = pos;
+			std::string key;
+			if (keyEnd != nullptr) {
+				key.assign(keyBegin, keyEnd);
+				if (key.empty()) continue;
+			} else if (i == 0) {
+				key = "id";
+			} else if (i == 1) {
+				key = "typename";
+			} else if (i == 2) {
+				key = "name";
+			} else { // a key without value
+				fields->insert({std::string(keyBegin, valueEnd), "", PersistenceRecord::Entry::Kind::numeric});
+				continue;
 			}
+			PersistenceRecord::Entry::Kind kind;
+			std::string value = fieldValue(valueBegin, valueEnd, &kind);
+			fields->insert({std::move(key), std::move(value), kind});
 		}
 
 		// then, save each record
@@ -201,16 +209,15 @@ bool GenSerializer::put(const std::string name, const std::string type, const Ut
 
 int GenSerializer::for_each(std::function<int(const std::string&) > delegate) {
 	// enfore id-order
-	std::vector<std::string> sorted;
+	// (ids are read once, instead of on every comparison)
+	std::vector<std::pair<int, std::string>> sorted;
 	sorted.reserve(_components.size());
-	for (auto& entry : _components) sorted.push_back(entry.first);
-	std::sort(sorted.begin(), sorted.end(), [&](auto& a, auto& b) {
-		return this->_components.at(a)->loadField("id", -1) < this->_components.at(b)->loadField("id", -1);
-	});
+	for (auto& entry : _components) sorted.push_back({entry.second->loadField("id", -1), entry.first});
+	std::sort(sorted.begin(), sorted.end());
 
 	// then do the user-level iteration
 	for (auto& label : sorted) {
-		int stop = delegate(label);
+		int stop = delegate(label.second);
 		if (stop) return stop;
 	}
 	return 0;
@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <utility>
+#include <tuple>
 
 #define INDENT "\t"
 
@@ -112,11 +113,7 @@ bool JsonSerializer::dump(std::ostream& output) {
 	<elements>  ::= & | <json> <elements_>
 	<elements_> ::= & | ',' <elements>
  */
-// see below for token regex definitions
-static const std::regex::flag_type FLAGS = std::regex_constants::optimize | std::regex_constants::ECMAScript;
-static const std::regex number_pattern("^(-?(?:[1-9]\\d+|\\d)(?:\\.\\d+)?(?:[eE][+-]?\\d+)?)", FLAGS);
-static const std::regex string_pattern("^(\"\"|\".*?[^\\\\]\")", FLAGS);
-
+// tokens are read straight from the input stream, one character at a time, so the file is never copied to memory
 struct Token {
 
 	enum Kind {
@@ -125,89 +122,105 @@ struct Token {
 	std::string str{}; // only if number of string
 };
 
-static Token lex(const std::string& input, std::size_t& pos) {
+struct JsonReader {
+	std::streambuf* buffer;
+
+	int peek() {
+		return buffer->sgetc();
+	}
+
+	int get() {
+		return buffer->sbumpc();
+	}
+};
+
+static const int END = std::char_traits<char>::eof();
+
+static void expect(JsonReader& input, const char* literal) {
+	for (const char* c = literal; *c != '\0'; c++) {
+		int found = input.get();
+		if (found != *c) {
+			throw std::runtime_error(
+					"invalid JSON: expected '" + std::string(1, *c) + "' in \"" + literal +
+					"\" but found " + (found == END ? "EOF" : "'" + std::string(1, (char) found) + "'")
+					);
+		}
+	}
+}
+
+static Token lex(JsonReader& input) {
 	// skip whitespace
-	while (pos < input.length() && std::isspace(input[pos])) ++pos;
-	if (pos >= input.length()) return { Token::Kind::eof, "\0"};
-
-	// helpers
-#define EXPECT(i, c) do { \
-		if ((i) >= input.length() || input[(i)] != (c)) { \
-			throw std::runtime_error( \
-				"invalid JSON: expected '" + std::to_string(c) + \
-				"' but found " + ((i) >= input.length() ? "EOF" : "'" + std::to_string(input[(i)]) + "'") \
-			); \
-		} \
-	} while (0) 
+	int c = input.peek();
+	while (c != END && std::isspace(c)) {
+		input.get();
+		c = input.peek();
+	}
+	if (c == END) return { Token::Kind::eof, "\0"};
 
 	// switch on prefix
-	switch (input[pos]) {
+	switch (c) {
 		case '[':
-			pos += 1;
+			input.get();
 			return { Token::Kind::lbracket, "["};
 		case ']':
-			pos += 1;
+			input.get();
 			return { Token::Kind::rbracket, "]"};
 		case '{':
-			pos += 1;
+			input.get();
 			return { Token::Kind::lbrace, "{"};
 		case '}':
-			pos += 1;
+			input.get();
 			return { Token::Kind::rbrace, "}"};
 		case ',':
-			pos += 1;
+			input.get();
 			return { Token::Kind::comma, ","};
 		case ':':
-			pos += 1;
+			input.get();
 			return { Token::Kind::colon, ":"};
 		case 'n':
-			EXPECT(pos + 0, 'n');
-			EXPECT(pos + 1, 'u');
-			EXPECT(pos + 2, 'l');
-			EXPECT(pos + 3, 'l');
-			pos += 4;
+			expect(input, "null");
 			return { Token::Kind::null, "null"};
 		case 'f':
-			EXPECT(pos + 0, 'f');
-			EXPECT(pos + 1, 'a');
-			EXPECT(pos + 2, 'l');
-			EXPECT(pos + 3, 's');
-			EXPECT(pos + 4, 'e');
-			pos += 5;
+			expect(input, "false");
 			return { Token::Kind::f, "false"};
 		case 't':
-			EXPECT(pos + 0, 't');
-			EXPECT(pos + 1, 'r');
-			EXPECT(pos + 2, 'u');
-			EXPECT(pos + 3, 'e');
-			pos += 4;
+			expect(input, "true");
 			return { Token::Kind::t, "true"};
 		case '"':
 		{
-			std::smatch match;
-			if (!std::regex_search(input.begin() + pos, input.end(), match, string_pattern)) {
-				throw std::runtime_error("invalid JSON string: \"" + input.substr(pos) + "\"");
+			input.get();
+			std::string unescaped;
+			for (c = input.get(); c != '"'; c = input.get()) {
+				if (c == END) {
+					throw std::runtime_error("invalid JSON string: \"" + unescaped + "\" is unterminated");
+				}
+				if (c == '\\') { // only inner quotes and the escape char itself are escaped
+					c = input.get();
+					if (c == END) continue;
+					if (c != '"' && c != '\\') unescaped += '\\';
+				}
+				unescaped += (char) c;
 			}
-			std::string unescaped = match[1];
-			pos += unescaped.length(); // move cursor
-			unescaped = unescaped.substr(1, unescaped.length() - 2); // remove outer quotes
-			unescaped = std::regex_replace(unescaped, std::regex("\\\\\""), "\""); // unescape inner quotes
-			unescaped = std::regex_replace(unescaped, std::regex("\\\\\\\\"), "\\"); // unescape escape char
 			return { Token::Kind::string, unescaped};
 		}
 		default:
 		{
-			std::smatch match;
-			if (!std::regex_search(input.begin() + pos, input.end(), match, number_pattern)) {
-				throw std::runtime_error("invalid JSON number: \"" + input.substr(pos) + "\"");
+			std::string literal;
+			while (c != END && (std::isdigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+				literal += (char) input.get();
+				c = input.peek();
+			}
+			std::size_t length = 0;
+			try {
+				std::stod(literal, &length);
+			} catch (const std::exception& e) {
+			}
+			if (literal.empty() || length != literal.length()) {
+				throw std::runtime_error("invalid JSON number: \"" + literal + (c == END ? "" : std::string(1, (char) c)) + "\"");
 			}
-			std::string literal = match[1];
-			pos += literal.length(); // move cursor
 			return { Token::Kind::number, literal};
 		}
 	}
-
-#undef EXPECT
 }
 
 struct Json {
@@ -217,7 +230,7 @@ struct Json {
 	} kind;
 	// used for booleans (0 = false) and numbers
 	double value;
-	// only for strings
+	// only for strings (and the literal of numbers)
 	std::string text;
 	// only for arrays
 	std::vector<std::unique_ptr<Json>> sequence
@@ -240,40 +253,41 @@ static void check(Token::Kind expected, const Token& tok) {
 }
 
 // forward decls
-static Json json(const std::string& input, std::size_t& pos, Token& lookahead);
-static Json object(const std::string& input, std::size_t& pos, Token& lookahead);
-static void members(const std::string& input, std::size_t& pos, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields);
-static void members_(const std::string& input, std::size_t& pos, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields);
-static Json array(const std::string& input, std::size_t& pos, Token& lookahead);
-static void elements(const std::string& input, std::size_t& pos, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq);
-static void elements_(const std::string& input, std::size_t& pos, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq);
-
-static Json json(const std::string& input, std::size_t& pos, Token& lookahead) {
+static Json json(JsonReader& input, Token& lookahead);
+static Json object(JsonReader& input, Token& lookahead);
+static void members(JsonReader& input, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields);
+static void members_(JsonReader& input, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields);
+static Json array(JsonReader& input, Token& lookahead);
+static void elements(JsonReader& input, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq);
+static void elements_(JsonReader& input, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq);
+
+static Json json(JsonReader& input, Token& lookahead) {
 	switch (lookahead.kind) {
 		case Token::Kind::f: // <json> ::= false
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return { Json::Kind::boolean, .value = 0};
 		case Token::Kind::lbrace: // <json> ::= <object>
-			return object(input, pos, lookahead);
+			return object(input, lookahead);
 		case Token::Kind::lbracket: // <json> ::= <array>
-			return array(input, pos, lookahead);
+			return array(input, lookahead);
 		case Token::Kind::null: // <json> ::= null
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return { Json::Kind::null};
 		case Token::Kind::number:
 		{ // <json> ::= number
 			auto value = std::stod(lookahead.str);
-			lookahead = lex(input, pos);
-			return { Json::Kind::number, .value = value};
+			auto literal = lookahead.str;
+			lookahead = lex(input);
+			return { Json::Kind::number, .value = value, .text = literal};
 		}
 		case Token::Kind::string:
 		{ // <json> ::= string
 			auto text = lookahead.str;
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return { Json::Kind::string, .text = text};
 		}
 		case Token::Kind::t: // <json> ::= true
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return { Json::Kind::boolean, .value = 1};
 		default:
 			halt("unexpected token at `json` rule");
@@ -281,15 +295,15 @@ static Json json(const std::string& input, std::size_t& pos, Token& lookahead) {
 	}
 }
 
-static Json object(const std::string& input, std::size_t& pos, Token& lookahead) {
+static Json object(JsonReader& input, Token& lookahead) {
 	switch (lookahead.kind) {
 		case Token::Kind::lbrace:
 		{ // <object> ::= lbrace <members> rbrace
 			Json obj = {Json::Kind::object};
-			lookahead = lex(input, pos);
-			members(input, pos, lookahead, obj.fields);
+			lookahead = lex(input);
+			members(input, lookahead, obj.fields);
 			check(Token::Kind::rbrace, lookahead);
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return obj;
 		}
 		default:
@@ -298,17 +312,17 @@ static Json object(const std::string& input, std::size_t& pos, Token& lookahead)
 	}
 }
 
-static void members(const std::string& input, std::size_t& pos, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields) {
+static void members(JsonReader& input, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields) {
 	switch (lookahead.kind) {
 		case Token::Kind::string:
 		{ // <members> ::= string colon <json> <members_>
 			auto key = lookahead.str;
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			check(Token::Kind::colon, lookahead);
-			lookahead = lex(input, pos);
-			auto value = json(input, pos, lookahead);
+			lookahead = lex(input);
+			auto value = json(input, lookahead);
 			fields[key] = std::make_unique<Json>(std::move(value));
-			return members_(input, pos, lookahead, fields);
+			return members_(input, lookahead, fields);
 		}
 		case Token::Kind::rbrace: // <members> ::= ε
 			return;
@@ -318,12 +332,12 @@ static void members(const std::string& input, std::size_t& pos, Token& lookahead
 	}
 }
 
-static void members_(const std::string& input, std::size_t& pos, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields) {
+static void members_(JsonReader& input, Token& lookahead, std::unordered_map<std::string, std::unique_ptr<Json>>&fields) {
 	switch (lookahead.kind) {
 		case Token::Kind::comma:
 		{ // <members_> ::= comma <members>
-			lookahead = lex(input, pos);
-			return members(input, pos, lookahead, fields);
+			lookahead = lex(input);
+			return members(input, lookahead, fields);
 		}
 		case Token::Kind::rbrace: // <members_> ::= ε
 			return;
@@ -333,15 +347,15 @@ static void members_(const std::string& input, std::size_t& pos, Token& lookahea
 	}
 }
 
-static Json array(const std::string& input, std::size_t& pos, Token& lookahead) {
+static Json array(JsonReader& input, Token& lookahead) {
 	switch (lookahead.kind) {
 		case Token::Kind::lbracket:
 		{ // <array> ::= lbracket <elements> rbracket
 			Json seq = {Json::Kind::array};
-			lookahead = lex(input, pos);
-			elements(input, pos, lookahead, seq.sequence);
+			lookahead = lex(input);
+			elements(input, lookahead, seq.sequence);
 			check(Token::Kind::rbracket, lookahead);
-			lookahead = lex(input, pos);
+			lookahead = lex(input);
 			return seq;
 		}
 		default:
@@ -350,7 +364,7 @@ static Json array(const std::string& input, std::size_t& pos, Token& lookahead)
 	}
 }
 
-static void elements(const std::string& input, std::size_t& pos, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq) {
+static void elements(JsonReader& input, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq) {
 	switch (lookahead.kind) {
 		case Token::Kind::rbracket: // <elements> ::= ε
 			return;
@@ -363,9 +377,9 @@ static void elements(const std::string& input, std::size_t& pos, Token& lookahea
 		case Token::Kind::string:
 		case Token::Kind::t:
 		{
-			auto element = json(input, pos, lookahead);
+			auto element = json(input, lookahead);
 			seq.push_back(std::make_unique<Json>(std::move(element)));
-			elements_(input, pos, lookahead, seq);
+			elements_(input, lookahead, seq);
 			return;
 		}
 		default:
@@ -374,11 +388,11 @@ static void elements(const std::string& input, std::size_t& pos, Token& lookahea
 	}
 }
 
-static void elements_(const std::string& input, std::size_t& pos, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq) {
+static void elements_(JsonReader& input, Token& lookahead, std::vector<std::unique_ptr<Json>>&seq) {
 	switch (lookahead.kind) {
 		case Token::Kind::comma: // <elements_> ::= comma <elements>
-			lookahead = lex(input, pos);
-			return elements(input, pos, lookahead, seq);
+			lookahead = lex(input);
+			return elements(input, lookahead, seq);
 		case Token::Kind::rbracket: // <elements_> ::= ε
 			return;
 		default:
@@ -388,14 +402,6 @@ static void elements_(const std::string& input, std::size_t& pos, Token& lookahe
 }
 
 bool JsonSerializer::load(std::istream& input) {
-	// read the entire file
-	std::string src;
-	{
-		std::stringstream buffer;
-		buffer << input.rdbuf();
-		src = buffer.str();
-	}
-
 	const auto json2fields = [](PersistenceRecord *fields, std::string name, const Json & js) {
 		// ensure we're dealing with an object
 		if (js.kind != Json::Kind::object) halt("expected an object to describe component \"" + name + "\"");
@@ -411,7 +417,7 @@ bool JsonSerializer::load(std::istream& input) {
 					fields->saveField(key, (val->value != 0));
 					break;
 				case Json::Kind::number:
-					fields->saveField(key, val->value);
+					fields->insert({key, val->text, PersistenceRecord::Entry::Kind::numeric}); // the literal, since there is no saveField for doubles without default
 					break;
 				case Json::Kind::string:
 					fields->saveField(key, val->text);
@@ -428,13 +434,13 @@ bool JsonSerializer::load(std::istream& input) {
 								halt("invalid type for field \"" + indexedKey + "\"");
 								break;
 							case Json::Kind::boolean:
-								fields->saveField(key, (element->value != 0));
+								fields->saveField(indexedKey, (element->value != 0));
 								break;
 							case Json::Kind::number:
-								fields->saveField(key, element->value);
+								fields->insert({indexedKey, element->text, PersistenceRecord::Entry::Kind::numeric});
 								break;
 							case Json::Kind::string:
-								fields->saveField(key, element->text);
+								fields->saveField(indexedKey, element->text);
 								break;
 						}
 						++index;
@@ -447,9 +453,9 @@ bool JsonSerializer::load(std::istream& input) {
 
 	try {
 		// parse JSON
-		std::size_t pos = 0;
-		auto lookahead = lex(src, pos);
-		Json js = std::move(json(src, pos, lookahead));
+		JsonReader reader{input.rdbuf()};
+		auto lookahead = lex(reader);
+		Json js = std::move(json(reader, lookahead));
 		check(Token::Kind::eof, lookahead); // ensures the entire input was processed
 
 		// now we interpret it
@@ -523,24 +529,16 @@ bool JsonSerializer::put(const std::string name, const std::string type, const U
 }
 
 int JsonSerializer::for_each(std::function<int(const std::string&) > delegate) {
-	// enfore id-order
-	std::vector < std::pair<bool, std::string>> sorted;
+	// enfore id-order (metatypes < components, and ids are read once, instead of on every comparison)
+	std::vector<std::tuple<bool, int, std::string>> sorted;
 	sorted.reserve(_metaobjects.size() + _components.size());
-	for (auto& entry : _metaobjects) sorted.push_back({true, entry.first});
-	for (auto& entry : _components) sorted.push_back({false, entry.first});
-	std::sort(sorted.begin(), sorted.end(), [&](auto& a, auto& b) {
-		if (a.first && b.first) { // both metatypes
-			return this->_metaobjects.at(a.second)->loadField("id", 0) < this->_metaobjects.at(b.second)->loadField("id", 0);
-		} else if (!a.first && !b.first) {
-			return this->_components.at(a.second)->loadField("id", -1) < this->_components.at(b.second)->loadField("id", -1);
-		} else /* different origins? metatypes < components */ {
-			return a.first && !b.first;
-		}
-	});
+	for (auto& entry : _metaobjects) sorted.push_back(std::make_tuple(false, entry.second->loadField("id", 0), entry.first));
+	for (auto& entry : _components) sorted.push_back(std::make_tuple(true, entry.second->loadField("id", -1), entry.first));
+	std::sort(sorted.begin(), sorted.end());
 
 	// then do the user-level iteration
 	for (auto& e : sorted) {
-		int stop = delegate(e.second);
+		int stop = delegate(std::get<2>(e));
 		if (stop) return stop;
 	}
 	return 0;
@@ -48,6 +48,7 @@ Model::Model(Simulator* simulator, unsigned int level) {
 	_modeldataManager = new ModelDataManager(this);
 	_componentManager = new ComponentManager(this);
 	_simulation = new ModelSimulation(this);
+	_profiler = new ModelProfiler(this);
 	// 1:1 associations (Traits)
 	_parser = new TraitsKernel<Parser_if>::Implementation(this, new TraitsKernel<Sampler_if>::Implementation());
 	_modelChecker = new TraitsKernel<ModelChecker_if>::Implementation(this);
@@ -138,6 +139,12 @@ bool Model::load(std::string filename) {
 }
 
 double Model::parseExpression(const std::string expression) {
+	if (_profiler->isEnabled()) {
+		bool success;
+		std::string errorMessage;
+		double res = parseExpression(expression, &success, &errorMessage); // evaluation is counted there
+		return success ? res : 0.0;
+	}
 	try {
 		double res = _parser->parse(expression);
 		//yy::location l;
@@ -178,6 +185,12 @@ void Model::checkReferencesToDataDefinitions(std::string expression, std::map<st
 }
 
 double Model::parseExpression(const std::string expression, bool* success, std::string* errorMessage) {
+	if (_profiler->isEnabled()) {
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		double value = _parser->parse(expression, success, errorMessage);
+		_profiler->addEvaluation(expression, begin);
+		return value;
+	}
 	double value = _parser->parse(expression, success, errorMessage);
 	//yy::location l/
 	//std::string m;
@@ -378,6 +391,18 @@ bool Model::check() {
 	return res;
 }
 
+void Model::setCheckIncremental(bool incremental) {
+	_modelChecker->setIncremental(incremental);
+}
+
+bool Model::isCheckIncremental() const {
+	return _modelChecker->isIncremental();
+}
+
+void Model::setChangedSinceCheck(ModelDataDefinition* elemOrComp) {
+	_modelChecker->setChanged(elemOrComp);
+}
+
 //bool Model::verifySymbol(std::string componentName, std::string expressionName, std::string expression, std::string expressionResult, bool mandatory) {
 //    return this->_modelChecker->verifySymbol(componentName, expressionName, expression, expressionResult, mandatory);
 //}
@@ -461,6 +486,10 @@ ModelSimulation*Model::getSimulation() const {
 	return _simulation;
 }
 
+ModelProfiler* Model::getProfiler() const {
+	return _profiler;
+}
+
 Util::identification Model::getId() const {
 	return _id;
 }
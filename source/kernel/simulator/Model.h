@@ -28,6 +28,7 @@
 #include "OnEventManager.h"
 #include "ModelInfo.h"
 #include "ModelSimulation.h"
+#include "ModelProfiler.h"
 //for PAN
 #include "PropertyGenesys.h"
 
@@ -63,6 +64,21 @@ public: // model control
 	 * \return
 	 */
 	bool check(); //!< Checks the integrity and consistency of the model, possibly corrects some inconsistencies, and returns if the model is in position to the simulated.
+	/*!
+	 * \brief setCheckIncremental
+	 * \param incremental
+	 */
+	void setCheckIncremental(bool incremental); //!< When true, checking the model again only checks the symbols of ModelComponents and ModelDataDefinitions inserted or changed (see setChangedSinceCheck) since the last successful check. Removing any of them checks all again
+	/*!
+	 * \brief isCheckIncremental
+	 * \return
+	 */
+	bool isCheckIncremental() const;
+	/*!
+	 * \brief setChangedSinceCheck
+	 * \param elemOrComp
+	 */
+	void setChangedSinceCheck(ModelDataDefinition* elemOrComp); //!< Tells that a ModelDataDefinition or ModelComponent changed and must be checked again by an incremental check
 	/*!
 	 * \brief clear
 	 */
@@ -184,6 +200,11 @@ public: // only gets
 	 * \return
 	 */
 	ModelSimulation* getSimulation() const; //!< Provides access to the class that manages the model simulation.
+	/*!
+	 * \brief getProfiler
+	 * \return
+	 */
+	ModelProfiler* getProfiler() const; //!< Provides access to the class that measures where the simulation spends its time (when enabled).
 	// 1:n
 	/*!
 	 * \brief getFutureEvents
@@ -255,6 +276,7 @@ private: // read only public access (gets)
 	ComponentManager* _componentManager;
 	ModelInfo* _modelInfo;
 	ModelSimulation* _simulation;
+	ModelProfiler* _profiler;
 	ModelPersistence_if* _modelPersistence;
 
 	// 1:n
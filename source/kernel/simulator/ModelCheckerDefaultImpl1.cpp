@@ -18,6 +18,7 @@
 #include "Simulator.h"
 
 #include <assert.h>
+#include <vector>
 
 //using namespace GenesysKernel;
 
@@ -27,9 +28,13 @@ ModelCheckerDefaultImpl1::ModelCheckerDefaultImpl1(Model* model) {
 
 bool ModelCheckerDefaultImpl1::checkAll() {
 	bool res = true;
+	_pluginInformations.clear();
 	res &= checkSymbols();
 	if (res)
 		res = checkOrphaned();
+	if (res && _incremental) {
+		_rememberChecked(); // symbols do not depend on limits or connections
+	}
 	if (res)
 		res &= checkLimits();
 	if (res)
@@ -37,6 +42,23 @@ bool ModelCheckerDefaultImpl1::checkAll() {
 	return res;
 }
 
+void ModelCheckerDefaultImpl1::setIncremental(bool incremental) {
+	_incremental = incremental;
+	_hasSucceeded = false;
+	_checked.clear();
+	_changed.clear();
+}
+
+bool ModelCheckerDefaultImpl1::isIncremental() const {
+	return _incremental;
+}
+
+void ModelCheckerDefaultImpl1::setChanged(ModelDataDefinition* datadefinition) {
+	if (_incremental) {
+		_changed.insert(datadefinition);
+	}
+}
+
 //bool ModelCheckerDefaultImpl1::checkAndAddInternalLiterals() {
 //    /*  @TODO: +-: not implemented yet */
 //    return true;
@@ -52,66 +74,94 @@ void ModelCheckerDefaultImpl1::_showResult(bool result, std::string checking) {
 	_model->getTracer()->trace(msgResult);
 }
 
-void ModelCheckerDefaultImpl1::_recursiveConnectedTo(PluginManager* pluginManager, ModelComponent* comp, List<ModelComponent*>* visited, List<ModelComponent*>* unconnected, bool* drenoFound) {
-	visited->insert(comp);
-	_model->getTracer()->trace("Connected to \"" + comp->getName() + "\"");
-	Plugin* plugin = pluginManager->find(comp->getClassname());
-	assert(plugin != nullptr);
-	if (plugin->getPluginInfo()->isSink() || (plugin->getPluginInfo()->isSendTransfer() && comp->getConnectionManager()->size() == 0)) {//(dynamic_cast<SinkModelComponent*> (comp) != nullptr) {
-		// it is a sink OR it can send entities throught a transfer and has no nextConnections
-		*drenoFound = true;
-	} else { // it is not a sink
-		if (comp->getConnectionManager()->size() == 0) {
-			unconnected->insert(comp);
-			_model->getTracer()->traceError("Component \"" + comp->getName() + "\" is unconnected (not a sink with no next componentes connected to)");
+PluginInformation* ModelCheckerDefaultImpl1::_pluginInformation(ModelComponent* comp) {
+	std::unordered_map<std::string, PluginInformation*>::iterator it = _pluginInformations.find(comp->getClassname());
+	if (it == _pluginInformations.end()) {
+		Plugin* plugin = _model->getParentSimulator()->getPluginManager()->find(comp->getClassname());
+		assert(plugin != nullptr);
+		it = _pluginInformations.insert({comp->getClassname(), plugin->getPluginInfo()}).first;
+	}
+	return it->second;
+}
+
+/*!
+ * A sink, or a component that can send entities throught a transfer and has no next components
+ */
+bool ModelCheckerDefaultImpl1::_isDreno(ModelComponent* comp) {
+	PluginInformation* info = _pluginInformation(comp);
+	return info->isSink() || (info->isSendTransfer() && comp->getConnectionManager()->size() == 0);
+}
+
+/*!
+ * Depth-first traversal from a source, with its own stack so long chains of components do not overflow the call stack. Visits and
+ * traces components in the same order, and leaves drenoFound as the recursive traversal did: as set by the last component or connection
+ * reached
+ */
+void ModelCheckerDefaultImpl1::_connectedFrom(ModelComponent* source, std::unordered_set<ModelComponent*>* visited, bool* drenoFound) {
+	std::vector<std::pair<ModelComponent*, std::map<unsigned int, Connection*>::iterator>> path;
+	ModelComponent* entering = source;
+	while (entering != nullptr || !path.empty()) {
+		if (entering != nullptr) {
+			const bool isNext = !path.empty();
+			visited->insert(entering);
+			_model->getTracer()->trace("Connected to \"" + entering->getName() + "\"");
+			if (_isDreno(entering)) {
+				*drenoFound = true;
+			} else if (entering->getConnectionManager()->size() == 0) {
+				_model->getTracer()->traceError("Component \"" + entering->getName() + "\" is unconnected (not a sink with no next componentes connected to)");
+				*drenoFound = false;
+			} else {
+				path.push_back({entering, entering->getConnectionManager()->connections()->begin()});
+				entering = nullptr;
+				continue;
+			}
+			if (isNext) {
+				Util::DecIndent();
+			}
+			entering = nullptr;
+			continue;
+		}
+		std::pair<ModelComponent*, std::map<unsigned int, Connection*>::iterator>& last = path.back();
+		if (last.second == last.first->getConnectionManager()->connections()->end()) {
+			path.pop_back();
+			if (!path.empty()) {
+				Util::DecIndent();
+			}
+			continue;
+		}
+		ModelComponent* nextComp = last.second->second->component;
+		last.second++;
+		Util::IncIndent();
+		if (visited->find(nextComp) == visited->end()) { // not visited yet
 			*drenoFound = false;
+			entering = nextComp;
 		} else {
-			ModelComponent* nextComp;
-			for (std::map<unsigned int, Connection*>::iterator it = comp->getConnectionManager()->connections()->begin(); it != comp->getConnectionManager()->connections()->end(); it++) {
-				nextComp = (*it).second->component;
-				if (visited->find(nextComp) == visited->list()->end()) { // not visited yet
-					*drenoFound = false;
-					Util::IncIndent();
-					this->_recursiveConnectedTo(pluginManager, nextComp, visited, unconnected, drenoFound);
-					Util::DecIndent();
-				} else {
-					Util::IncIndent();
-					_model->getTracer()->trace("Connected to " + nextComp->getName());
-					Util::DecIndent();
-					*drenoFound = true;
-				}
-			}
+			_model->getTracer()->trace("Connected to " + nextComp->getName());
+			Util::DecIndent();
+			*drenoFound = true;
 		}
 	}
 }
 
 bool ModelCheckerDefaultImpl1::checkConnected() {
-	/*  @TODO: +-: not implemented yet */
 	_model->getTracer()->trace("Checking connected", TraceManager::Level::L7_internal);
 	bool resultAll = true;
-	PluginManager* pluginManager = this->_model->getParentSimulator()->getPluginManager();
-	Plugin* plugin;
 	Util::IncIndent();
 	{
-		List<ModelComponent*>* visited = new List<ModelComponent*>();
-		List<ModelComponent*>* unconnected = new List<ModelComponent*>();
-		ModelComponent* comp;
-		for (std::list<ModelComponent*>::iterator it = _model->getComponentManager()->begin(); it != _model->getComponentManager()->end(); it++) {
-			comp = (*it);
-			plugin = pluginManager->find(comp->getClassname());
-			assert(plugin != nullptr);
-			if (plugin->getPluginInfo()->isSource() || plugin->getPluginInfo()->isReceiveTransfer()) { //(dynamic_cast<SourceModelComponent*> (comp) != nullptr) {
+		std::unordered_set<ModelComponent*> visited;
+		for (ModelComponent* comp : *_model->getComponentManager()->getAllComponents()) {
+			PluginInformation* info = _pluginInformation(comp);
+			if (info->isSource() || info->isReceiveTransfer()) {
 				// it is a source component OR it can receive enetities from transfer
 				bool drenoFound = false;
-				_recursiveConnectedTo(pluginManager, comp, visited, unconnected, &drenoFound);
+				_connectedFrom(comp, &visited, &drenoFound);
 				if (!drenoFound)
 					resultAll = false;
 			}
 		}
 		// check if any component remains unconnected
-		for (std::list<ModelComponent*>::iterator it = _model->getComponentManager()->begin(); it != _model->getComponentManager()->end(); it++) {
-			comp = (*it);
-			if (visited->find(comp) == visited->list()->end()) { //not found
+		for (ModelComponent* comp : *_model->getComponentManager()->getAllComponents()) {
+			if (visited.find(comp) == visited.end()) { //not found
 				resultAll = false;
 				_model->getTracer()->traceError("Component \"" + comp->getName() + "\" is unconnected.");
 			}
@@ -124,7 +174,8 @@ bool ModelCheckerDefaultImpl1::checkConnected() {
 
 bool ModelCheckerDefaultImpl1::checkSymbols() {
 	bool res = true;
-	_model->getTracer()->trace("Checking symbols", TraceManager::Level::L7_internal);
+	const bool incremental = _incremental && _hasSucceeded && !_anyCheckedRemoved();
+	_model->getTracer()->trace(incremental ? "Checking symbols inserted or changed since the last check" : "Checking symbols", TraceManager::Level::L7_internal);
 	Util::IncIndent();
 	{
 		// check components
@@ -133,7 +184,9 @@ bool ModelCheckerDefaultImpl1::checkSymbols() {
 		{
 			//List<ModelComponent*>* components = _model->getComponents();
 			for (std::list<ModelComponent*>::iterator it = _model->getComponentManager()->begin(); it != _model->getComponentManager()->end(); it++) {
-				res &= (*it)->Check((*it));
+				if (!incremental || _mustCheck(*it)) {
+					res &= (*it)->Check((*it));
+				}
 			}
 		}
 		Util::DecIndent();
@@ -153,6 +206,9 @@ bool ModelCheckerDefaultImpl1::checkSymbols() {
 					List<ModelDataDefinition*>* elements = _model->getDataManager()->getDataDefinitionList(elementType);
 					for (std::list<ModelDataDefinition*>::iterator it = elements->list()->begin(); it != elements->list()->end(); it++) {
 						modeldatum = (*it);
+						if (incremental && !_mustCheck(modeldatum)) {
+							continue;
+						}
 						// copyed from modelCOmponent. It is not inside the ModelDataDefinition::Check because ModelDataDefinition has no access to Model to call Tracer
 						_model->getTracer()->trace("Checking " + modeldatum->getClassname() + ": \"" + modeldatum->getName() + "\" (id " + std::to_string(modeldatum->getId()) + ")"); //std::to_string(component->_id));
 						Util::IncIndent();
@@ -170,6 +226,7 @@ bool ModelCheckerDefaultImpl1::checkSymbols() {
 						Util::DecIndent();
 					}
 				}
+				delete elementTypes;
 			}
 			Util::DecIndent();
 		}
@@ -226,71 +283,125 @@ bool ModelCheckerDefaultImpl1::checkLimits() {
 	return res;
 }
 
+/*!
+ * Orphans are removed as if checking again after each removal, since removing some may create other orphans. The number of references
+ * each ModelDataDefinition has from others not removed is counted once, and decreased as those referring to it are removed
+ */
 bool ModelCheckerDefaultImpl1::checkOrphaned() {
 	bool res = true;
-	_model->getTracer()->trace("Checking Orphaned DataDefinitions", TraceManager::Level::L7_internal);
+	TraceManager* tracer = _model->getTracer();
+	const bool traceReferences = static_cast<int> (tracer->getTraceLevel()) >= static_cast<int> (TraceManager::Level::L8_detailed);
+	tracer->trace("Checking Orphaned DataDefinitions", TraceManager::Level::L7_internal);
 	Util::IncIndent();
 	{
-		std::list<ModelDataDefinition*>* orphaned = new std::list<ModelDataDefinition*>();
-		// Start by including all elements as orphaned
-		for (std::string ddtypename : *_model->getDataManager()->getDataDefinitionClassnames()) {
+		std::vector<ModelDataDefinition*> datadefinitions;
+		std::unordered_map<ModelDataDefinition*, unsigned int> referencesFromData;
+		std::list<std::string>* ddtypenames = _model->getDataManager()->getDataDefinitionClassnames();
+		for (std::string ddtypename : *ddtypenames) {
 			for (ModelDataDefinition* element : *_model->getDataManager()->getDataDefinitionList(ddtypename)->list()) {
-				orphaned->insert(orphaned->end(), element);
+				datadefinitions.push_back(element);
+				referencesFromData.insert({element, 0});
 			}
 		}
-		// now exclude all those are refered by someone.
-		ModelDataDefinition* mdd;
-		// ... by someone (ModelDataDefinition).
-		for (std::string ddtypename : *_model->getDataManager()->getDataDefinitionClassnames()) {
-			for (ModelDataDefinition* element : *_model->getDataManager()->getDataDefinitionList(ddtypename)->list()) {
-				for (std::pair<std::string, ModelDataDefinition*> pairInternal : *element->getInternalData()) {
-					mdd = pairInternal.second;
-					orphaned->remove(mdd);
-					_model->getTracer()->trace("(" + element->getClassname() + ") " + element->getName() + " <#>--> " + "(" + mdd->getClassname() + ") " + mdd->getName());
-				}
-				for (std::pair<std::string, ModelDataDefinition*> pairAttached : *element->getAttachedData()) {
-					mdd = pairAttached.second;
-					orphaned->remove(mdd);
-					_model->getTracer()->trace("(" + element->getClassname() + ") " + element->getName() + " < >--> " + "(" + mdd->getClassname() + ") " + mdd->getName());
+		delete ddtypenames;
+		// count those refered by someone (ModelDataDefinition)
+		std::unordered_map<ModelDataDefinition*, unsigned int>::iterator refIt;
+		for (ModelDataDefinition* element : datadefinitions) {
+			for (std::map<std::string, ModelDataDefinition*>* references : {element->getInternalData(), element->getAttachedData()}) {
+				for (std::pair<std::string, ModelDataDefinition*> pairReference : *references) {
+					refIt = referencesFromData.find(pairReference.second);
+					if (refIt != referencesFromData.end()) {
+						refIt->second++;
+					}
+					if (traceReferences) {
+						const std::string arrow = references == element->getInternalData() ? " <#>--> " : " < >--> ";
+						tracer->trace("(" + element->getClassname() + ") " + element->getName() + arrow + "(" + pairReference.second->getClassname() + ") " + pairReference.second->getName());
+					}
 				}
 			}
 		}
-		// ... by someone (ModelComponent).
+		// those refered by someone (ModelComponent) are never orphaned
+		std::unordered_set<ModelDataDefinition*> referredByComponents;
 		for (ModelComponent* component : *_model->getComponentManager()->getAllComponents()) {
-			for (std::pair<std::string, ModelDataDefinition*> pairInternal : *component->getInternalData()) {
-				mdd = pairInternal.second;
-				orphaned->remove(mdd);
-				_model->getTracer()->trace("(" + component->getClassname() + ") " + component->getName() + " <#>--> " + "(" + mdd->getClassname() + ") " + mdd->getName());
+			for (std::map<std::string, ModelDataDefinition*>* references : {component->getInternalData(), component->getAttachedData()}) {
+				for (std::pair<std::string, ModelDataDefinition*> pairReference : *references) {
+					referredByComponents.insert(pairReference.second);
+					if (traceReferences) {
+						const std::string arrow = references == component->getInternalData() ? " <#>--> " : " < >--> ";
+						tracer->trace("(" + component->getClassname() + ") " + component->getName() + arrow + "(" + pairReference.second->getClassname() + ") " + pairReference.second->getName());
+					}
+				}
 			}
-			for (std::pair<std::string, ModelDataDefinition*> pairAttached : *component->getAttachedData()) {
-				mdd = pairAttached.second;
-				orphaned->remove(mdd);
-				_model->getTracer()->trace("(" + component->getClassname() + ") " + component->getName() + " < >--> " + "(" + mdd->getClassname() + ") " + mdd->getName());
+		}
+		std::vector<ModelDataDefinition*> orphaned;
+		for (ModelDataDefinition* element : datadefinitions) {
+			if (referencesFromData[element] == 0 && referredByComponents.find(element) == referredByComponents.end()) {
+				orphaned.push_back(element);
 			}
 		}
-		// every one in orphaned list now is really orphaned
-		if (orphaned->size() > 0) {
-			_model->getTracer()->trace("Orphaned DataDefinitions found and will be removed:", TraceManager::Level::L7_internal);
+		if (orphaned.size() > 0) {
+			tracer->trace("Orphaned DataDefinitions found and will be removed:", TraceManager::Level::L7_internal);
 			Util::IncIndent();
 			{
-				for (ModelDataDefinition* orphanElem : *orphaned) {
-					_model->getTracer()->trace("Orphan (" + orphanElem->getClassname() + ") " + orphanElem->getName() + "(id=" + std::to_string(orphanElem->getId()) + ") removed");
+				for (unsigned int i = 0; i < orphaned.size(); i++) {
+					ModelDataDefinition* orphanElem = orphaned[i];
+					for (std::map<std::string, ModelDataDefinition*>* references : {orphanElem->getInternalData(), orphanElem->getAttachedData()}) {
+						for (std::pair<std::string, ModelDataDefinition*> pairReference : *references) {
+							refIt = referencesFromData.find(pairReference.second);
+							if (refIt != referencesFromData.end() && --refIt->second == 0 && referredByComponents.find(refIt->first) == referredByComponents.end()) {
+								orphaned.push_back(refIt->first); // removing this orphan made it orphaned
+							}
+						}
+					}
+					tracer->trace("Orphan (" + orphanElem->getClassname() + ") " + orphanElem->getName() + "(id=" + std::to_string(orphanElem->getId()) + ") removed");
 					_model->getDataManager()->remove(orphanElem);
 				}
 			}
 			Util::DecIndent();
-			// inoke again, recursivelly (removing some datadefinitions may create some other orphans)
-			Util::IncIndent();
-			{
-				res = checkOrphaned();
-			}
-			Util::DecIndent();
 		} else {
-			_model->getTracer()->trace("No orphaned DataDefinitions found", TraceManager::Level::L7_internal);
-			res = true;
+			tracer->trace("No orphaned DataDefinitions found", TraceManager::Level::L7_internal);
 		}
 	}
 	_showResult(res, "Checking Orphaned");
 	Util::DecIndent();
 	return res;
 }
+
+bool ModelCheckerDefaultImpl1::_mustCheck(ModelDataDefinition* datadefinition) const {
+	std::unordered_map<ModelDataDefinition*, Util::identification>::const_iterator it = _checked.find(datadefinition);
+	return it == _checked.end() || it->second != datadefinition->getId() || datadefinition->hasChanged() || _changed.find(datadefinition) != _changed.end();
+}
+
+/*!
+ * Removing a ModelComponent or ModelDataDefinition may invalidate symbols of others, that are then checked again
+ */
+bool ModelCheckerDefaultImpl1::_anyCheckedRemoved() const {
+	unsigned int remaining = 0;
+	for (ModelComponent* component : *_model->getComponentManager()->getAllComponents()) {
+		remaining += _checked.find(component) != _checked.end() ? 1 : 0;
+	}
+	std::list<std::string>* ddtypenames = _model->getDataManager()->getDataDefinitionClassnames();
+	for (std::string ddtypename : *ddtypenames) {
+		for (ModelDataDefinition* element : *_model->getDataManager()->getDataDefinitionList(ddtypename)->list()) {
+			remaining += _checked.find(element) != _checked.end() ? 1 : 0;
+		}
+	}
+	delete ddtypenames;
+	return remaining < _checked.size();
+}
+
+void ModelCheckerDefaultImpl1::_rememberChecked() {
+	_checked.clear();
+	_changed.clear();
+	for (ModelComponent* component : *_model->getComponentManager()->getAllComponents()) {
+		_checked[component] = component->getId();
+	}
+	std::list<std::string>* ddtypenames = _model->getDataManager()->getDataDefinitionClassnames();
+	for (std::string ddtypename : *ddtypenames) {
+		for (ModelDataDefinition* element : *_model->getDataManager()->getDataDefinitionList(ddtypename)->list()) {
+			_checked[element] = element->getId();
+		}
+	}
+	delete ddtypenames;
+	_hasSucceeded = true;
+}
@@ -17,6 +17,8 @@
 #include "ModelChecker_if.h"
 #include "Model.h"
 #include "PluginManager.h"
+#include <unordered_map>
+#include <unordered_set>
 
 //namespace GenesysKernel {
 
@@ -31,11 +33,24 @@ public:
 	virtual bool checkActivationCode();
 	virtual bool checkLimits();
 	virtual bool checkOrphaned();
+	virtual void setIncremental(bool incremental);
+	virtual bool isIncremental() const;
+	virtual void setChanged(ModelDataDefinition* datadefinition);
 private:
-	void _recursiveConnectedTo(PluginManager* pluginManager, ModelComponent* comp, List<ModelComponent*>* visited, List<ModelComponent*>* unconnected, bool* drenoFound);
+	void _connectedFrom(ModelComponent* source, std::unordered_set<ModelComponent*>* visited, bool* drenoFound);
+	bool _isDreno(ModelComponent* comp);
+	PluginInformation* _pluginInformation(ModelComponent* comp);
+	bool _mustCheck(ModelDataDefinition* datadefinition) const;
+	bool _anyCheckedRemoved() const;
+	void _rememberChecked();
 	void _showResult(bool result, std::string checking);
 private:
 	Model* _model;
+	std::unordered_map<std::string, PluginInformation*> _pluginInformations; //!< by classname, to find plugins once per check
+	bool _incremental = false;
+	bool _hasSucceeded = false; //!< whether there was a successful check since incremental checking was set
+	std::unordered_map<ModelDataDefinition*, Util::identification> _checked; //!< ids of those in the last successful check, so reused addresses are not taken as checked
+	std::unordered_set<ModelDataDefinition*> _changed;
 };
 //namespace\\}
 #endif /* MODELCHECKERDEFAULTIMPL1_H */
@@ -19,6 +19,7 @@
 
 //#include "Model.h"
 //class Model;
+class ModelDataDefinition;
 
 /*!
  * The ModelChecker is responsable for verifying the model consistency, fixing inconsistencies wheneaver possible
@@ -55,6 +56,21 @@ public:
 	 * \return
 	 */
 	virtual bool checkOrphaned() = 0; /*!< Checks if there are ModelDataDefinitions not referred by any ModelComponent, which means they are orphan ModelDataDefinitions */
+	/*!
+	 * \brief setIncremental
+	 * \param incremental
+	 */
+	virtual void setIncremental(bool incremental) = 0; /*!< When incremental, checking symbols after a successful check only checks ModelComponents and ModelDataDefinitions inserted or changed since then */
+	/*!
+	 * \brief isIncremental
+	 * \return
+	 */
+	virtual bool isIncremental() const = 0;
+	/*!
+	 * \brief setChanged
+	 * \param datadefinition
+	 */
+	virtual void setChanged(ModelDataDefinition* datadefinition) = 0; /*!< Tells an incremental checker that a ModelComponent or ModelDataDefinition changed and must be checked again */
 };
 
 #endif /* MODELCHECKER_IF_H */
@@ -122,10 +122,21 @@ void ModelComponent::DispatchEvent(Event* event) {
 	component->traceSimulation(component, TraceManager::Level::L7_internal, msg); //:L6_arrival
 	*/
 	Util::IncIndent();
-	try {
-		component->_onDispatchEvent(entity, inputPortNumber);
-	} catch (const std::exception& e) {
-		component->traceError("Error executing component " + component->show(), e);
+	ModelProfiler* profiler = component->_parentModel->getProfiler();
+	if (profiler->isEnabled()) {
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		try {
+			component->_onDispatchEvent(entity, inputPortNumber);
+		} catch (const std::exception& e) {
+			component->traceError("Error executing component " + component->show(), e);
+		}
+		profiler->addDispatch(component, begin);
+	} else {
+		try {
+			component->_onDispatchEvent(entity, inputPortNumber);
+		} catch (const std::exception& e) {
+			component->traceError("Error executing component " + component->show(), e);
+		}
 	}
 	Util::DecIndent();
 }
@@ -34,6 +34,7 @@ bool ModelDataManager::insert(std::string datadefinitionTypename, ModelDataDefin
 	if (listElements->find(anElement) == listElements->list()->end()) { //not found
 		listElements->insert(anElement);
 		_hasChanged = true;
+		_numberOfChanges[datadefinitionTypename]++;
 		text = anElement->getClassname() + " \"" + anElement->getName() + "\"" + " successfully inserted.";
 		result = true;
 		//	} else {
@@ -54,6 +55,7 @@ void ModelDataManager::remove(ModelDataDefinition * anElement) {
 	List<ModelDataDefinition*>* listElements = getDataDefinitionList(datadefinitionTypename);
 	listElements->remove(anElement);
 	_hasChanged = true;
+	_numberOfChanges[datadefinitionTypename]++;
 	////trace("Element successfully removed.");
 
 }
@@ -61,6 +63,7 @@ void ModelDataManager::remove(ModelDataDefinition * anElement) {
 void ModelDataManager::remove(std::string datadefinitionTypename, ModelDataDefinition * anElement) {
 	List<ModelDataDefinition*>* listElements = getDataDefinitionList(datadefinitionTypename);
 	_hasChanged = true;
+	_numberOfChanges[datadefinitionTypename]++;
 	listElements->remove(anElement);
 }
 
@@ -89,6 +92,9 @@ bool ModelDataManager::check(std::string datadefinitionTypename, ModelDataDefini
 
 void ModelDataManager::clear() {
 	_hasChanged = true;
+	for (std::pair<std::string, List<ModelDataDefinition*>*> pair : *_datadefinitions) {
+		_numberOfChanges[pair.first]++;
+	}
 	this->_datadefinitions->clear();
 }
 
@@ -105,6 +111,11 @@ unsigned int ModelDataManager::getNumberOfDataDefinitions() {
 	return total;
 }
 
+unsigned long ModelDataManager::getNumberOfChanges(std::string datadefinitionTypename) const {
+	std::map<std::string, unsigned long>::const_iterator it = _numberOfChanges.find(datadefinitionTypename);
+	return it == _numberOfChanges.end() ? 0 : it->second;
+}
+
 void ModelDataManager::show() {
 	_parentModel->getTracer()->trace("Model Data Definitions:");
 	//std::map<std::string, List<ModelDataDefinition*>*>* _datadefinitions;
@@ -105,6 +105,12 @@ public:
 	 * \return
 	 */
 	unsigned int getNumberOfDataDefinitions();
+	/*!
+	 * \brief getNumberOfChanges
+	 * \param datadefinitionTypename
+	 * \return the number of insertions and removals of data definitions of that type so far, so those that keep data definitions of a type know when they are stale
+	 */
+	unsigned long getNumberOfChanges(std::string datadefinitionTypename) const;
 	/*!
 	 * \brief getRankOf
 	 * \param datadefinitionTypename
@@ -131,6 +137,7 @@ private:
 	std::map<std::string, List<ModelDataDefinition*>*>* _datadefinitions;
 	Model* _parentModel;
 	bool _hasChanged = false;
+	std::map<std::string, unsigned long> _numberOfChanges; //!< insertions and removals of each type of data definition
 };
 //namespace\\}
 #endif /* ELEMENTMANAGER_H */
@@ -15,6 +15,7 @@
 #include "XmlSerializer.h"
 #include "JsonSerializer.h"
 #include "CppSerializer.h"
+#include "BinarySerializer.h"
 
 ModelPersistenceDefaultImpl2::ModelPersistenceDefaultImpl2(Model* model) :
 _model(model) {
@@ -38,6 +39,9 @@ bool ModelPersistenceDefaultImpl2::save(std::string filename) {
 		} else if (extension == "cpp") {
 			_model->getTracer()->trace(TraceManager::Level::L7_internal, "Serializing as C++");
 			serializer = std::make_unique<CppSerializer>(_model);
+		} else if (extension == "genb") {
+			_model->getTracer()->trace(TraceManager::Level::L7_internal, "Serializing as GenESyS binary model");
+			serializer = std::make_unique<BinarySerializer>(_model);
 		} else { // default
 			_model->getTracer()->trace(TraceManager::Level::L7_internal, "Serializing as GenESyS simulation language");
 			serializer = std::make_unique<GenSerializer>(_model);
@@ -101,7 +105,7 @@ bool ModelPersistenceDefaultImpl2::save(std::string filename) {
 	// write contents to file
 	_model->getTracer()->trace(TraceManager::Level::L7_internal, "Saving file");
 	Util::IncIndent();
-	std::ofstream file{filename};
+	std::ofstream file{filename, std::ios::binary};
 	bool ok = serializer->dump(file);
 	file.close();
 	Util::DecIndent();
@@ -130,6 +134,9 @@ bool ModelPersistenceDefaultImpl2::load(std::string filename) {
 			_model->getTracer()->trace(TraceManager::Level::L4_warning, "Cannot parse C++");
 			Util::DecIndent();
 			return false;
+		} else if (extension == "genb") {
+			_model->getTracer()->trace(TraceManager::Level::L7_internal, "Parsing as GenESyS binary model");
+			parser = std::make_unique<BinarySerializer>(_model);
 		} else { // default
 			_model->getTracer()->trace(TraceManager::Level::L7_internal, "Parsing as GenESyS simulation language");
 			parser = std::make_unique<GenSerializer>(_model);
@@ -139,7 +146,7 @@ bool ModelPersistenceDefaultImpl2::load(std::string filename) {
 	// load file
 	bool ok = true;
 	try {
-		std::ifstream file(filename);
+		std::ifstream file(filename, std::ios::binary);
 		ok &= parser->load(file);
 		if (!ok) throw std::exception();
 	} catch (const std::exception& e) {
@@ -0,0 +1,201 @@
+#include "ModelProfiler.h"
+#include "Model.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+ModelProfiler::ModelProfiler(Model* model) {
+	_model = model;
+	clear();
+}
+
+void ModelProfiler::setEnabled(bool enabled) {
+	_enabled = enabled;
+}
+
+void ModelProfiler::clear() {
+	_componentIndexes.clear();
+	_components.clear();
+	_expressions.clear();
+	_samples.clear();
+	_events = 0;
+	_currentSamplingInterval = _samplingInterval;
+	_nextSample = _currentSamplingInterval;
+	_maximumFutureEvents = 0;
+	_maximumEntities = 0;
+	_lastSnapshot = std::chrono::steady_clock::now();
+}
+
+std::string ModelProfiler::show(unsigned int topComponents) const {
+	std::vector<ComponentProfile> components = getComponentProfiles();
+	double totalSeconds = 0.0;
+	for (const ComponentProfile& profile : components) {
+		totalSeconds += profile.seconds;
+	}
+	std::ostringstream text;
+	text << std::fixed;
+	text << "Profile of model \"" << _model->getInfos()->getName() << "\": " << _events << " events, " << std::setprecision(6) << totalSeconds << " seconds in components" << std::endl;
+	text << std::setw(6) << "rank" << std::setw(14) << "dispatches" << std::setw(12) << "seconds" << std::setw(8) << "%time" << std::setw(12) << "us/dispatch" << "  component" << std::endl;
+	for (unsigned int i = 0; i < components.size() && i < topComponents; i++) {
+		const ComponentProfile& profile = components[i];
+		text << std::setw(6) << i + 1 << std::setw(14) << profile.dispatches << std::setw(12) << std::setprecision(6) << profile.seconds
+				<< std::setw(8) << std::setprecision(2) << (totalSeconds > 0.0 ? 100.0 * profile.seconds / totalSeconds : 0.0)
+				<< std::setw(12) << std::setprecision(3) << (profile.dispatches > 0 ? 1e6 * profile.seconds / profile.dispatches : 0.0)
+				<< "  " << profile.component->getName() << " (" << profile.component->getClassname() << ")" << std::endl;
+	}
+	std::vector<ExpressionProfile> expressions = getExpressionProfiles();
+	if (!expressions.empty()) {
+		text << std::setw(6) << "rank" << std::setw(14) << "evaluations" << std::setw(12) << "seconds" << std::setw(8) << "" << std::setw(12) << "us/eval" << "  expression" << std::endl;
+		for (unsigned int i = 0; i < expressions.size() && i < topComponents; i++) {
+			const ExpressionProfile& profile = expressions[i];
+			text << std::setw(6) << i + 1 << std::setw(14) << profile.evaluations << std::setw(12) << std::setprecision(6) << profile.seconds
+					<< std::setw(8) << "" << std::setw(12) << std::setprecision(3) << (profile.evaluations > 0 ? 1e6 * profile.seconds / profile.evaluations : 0.0)
+					<< "  " << profile.expression << std::endl;
+		}
+	}
+	double futureEvents = 0.0, entities = 0.0;
+	for (const Sample& sample : _samples) {
+		futureEvents += sample.futureEvents;
+		entities += sample.entities;
+	}
+	if (!_samples.empty()) {
+		futureEvents /= _samples.size();
+		entities /= _samples.size();
+	}
+	text << std::setprecision(1) << "Future events: maximum " << _maximumFutureEvents << ", average " << futureEvents << ". Entities: maximum "
+			<< _maximumEntities << ", average " << entities << " (" << _samples.size() << " samples, one every " << _currentSamplingInterval << " events)" << std::endl;
+	return text.str();
+}
+
+bool ModelProfiler::writeSnapshot(std::string filename) const {
+	std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+	if (!file.is_open()) {
+		return false;
+	}
+	file << show(std::numeric_limits<unsigned int>::max());
+	file << "replication;simulatedTime;events;futureEvents;entities" << std::endl;
+	for (const Sample& sample : _samples) {
+		file << sample.replication << ";" << sample.simulatedTime << ";" << sample.events << ";" << sample.futureEvents << ";" << sample.entities << std::endl;
+	}
+	return true;
+}
+
+std::vector<ModelProfiler::ComponentProfile> ModelProfiler::getComponentProfiles() const {
+	std::vector<ComponentProfile> components = _components;
+	std::stable_sort(components.begin(), components.end(), [](const ComponentProfile& a, const ComponentProfile & b) {
+		return a.seconds > b.seconds;
+	});
+	return components;
+}
+
+std::vector<ModelProfiler::ExpressionProfile> ModelProfiler::getExpressionProfiles() const {
+	std::vector<ExpressionProfile> expressions;
+	for (const std::pair<const std::string, ExpressionProfile>& expression : _expressions) {
+		expressions.push_back(expression.second);
+	}
+	std::sort(expressions.begin(), expressions.end(), [](const ExpressionProfile& a, const ExpressionProfile & b) {
+		return a.seconds > b.seconds || (a.seconds == b.seconds && a.expression < b.expression);
+	});
+	return expressions;
+}
+
+const std::vector<ModelProfiler::Sample>& ModelProfiler::getSamples() const {
+	return _samples;
+}
+
+unsigned long ModelProfiler::getNumberOfEvents() const {
+	return _events;
+}
+
+unsigned int ModelProfiler::getMaximumFutureEvents() const {
+	return _maximumFutureEvents;
+}
+
+unsigned int ModelProfiler::getMaximumEntities() const {
+	return _maximumEntities;
+}
+
+void ModelProfiler::setSamplingInterval(unsigned long events) {
+	_samplingInterval = events > 0 ? events : 1;
+}
+
+unsigned long ModelProfiler::getSamplingInterval() const {
+	return _samplingInterval;
+}
+
+void ModelProfiler::setMaximumSamples(unsigned int maximumSamples) {
+	_maximumSamples = maximumSamples > 1 ? maximumSamples : 2;
+}
+
+unsigned int ModelProfiler::getMaximumSamples() const {
+	return _maximumSamples;
+}
+
+void ModelProfiler::setSnapshotFilename(std::string snapshotFilename) {
+	_snapshotFilename = snapshotFilename;
+}
+
+std::string ModelProfiler::getSnapshotFilename() const {
+	return _snapshotFilename;
+}
+
+void ModelProfiler::setSnapshotPeriod(double seconds) {
+	_snapshotPeriod = seconds;
+}
+
+double ModelProfiler::getSnapshotPeriod() const {
+	return _snapshotPeriod;
+}
+
+void ModelProfiler::addDispatch(ModelComponent* component, std::chrono::steady_clock::time_point begin) {
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	std::pair < std::unordered_map<ModelComponent*, unsigned int>::iterator, bool> inserted = _componentIndexes.insert({component, (unsigned int) _components.size()});
+	if (inserted.second) {
+		_components.push_back({component, 0, 0.0});
+	}
+	ComponentProfile& profile = _components[inserted.first->second];
+	profile.dispatches++;
+	profile.seconds += seconds;
+}
+
+void ModelProfiler::addEvaluation(const std::string& expression, std::chrono::steady_clock::time_point begin) {
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	std::unordered_map<std::string, ExpressionProfile>::iterator it = _expressions.find(expression);
+	if (it == _expressions.end()) {
+		it = _expressions.insert({expression, {expression, 0, 0.0}}).first;
+	}
+	it->second.evaluations++;
+	it->second.seconds += seconds;
+}
+
+void ModelProfiler::simulationEnded() {
+	if (_snapshotFilename != "") {
+		writeSnapshot(_snapshotFilename);
+	}
+}
+
+/*!
+ * Takes a sample and, when the maximum number of samples is reached, keeps every other one and doubles the interval, so samples
+ * always cover the whole simulation with bounded memory
+ */
+void ModelProfiler::_sample() {
+	const unsigned int futureEvents = _model->getFutureEvents()->size();
+	const unsigned int entities = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<Entity>())->size();
+	_maximumFutureEvents = std::max(_maximumFutureEvents, futureEvents);
+	_maximumEntities = std::max(_maximumEntities, entities);
+	if (_samples.size() >= _maximumSamples) {
+		for (unsigned int i = 1; 2 * i < _samples.size(); i++) {
+			_samples[i] = _samples[2 * i];
+		}
+		_samples.resize((_samples.size() + 1) / 2);
+		_currentSamplingInterval *= 2;
+	}
+	_samples.push_back({_model->getSimulation()->getCurrentReplicationNumber(), _model->getSimulation()->getSimulatedTime(), _events, futureEvents, entities});
+	_nextSample = _events + _currentSamplingInterval;
+	if (_snapshotFilename != "" && std::chrono::duration<double>(std::chrono::steady_clock::now() - _lastSnapshot).count() >= _snapshotPeriod) {
+		writeSnapshot(_snapshotFilename);
+		_lastSnapshot = std::chrono::steady_clock::now();
+	}
+}
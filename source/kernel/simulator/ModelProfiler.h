@@ -0,0 +1,105 @@
+#ifndef MODELPROFILER_H
+#define MODELPROFILER_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+
+class Model;
+class ModelComponent;
+
+/*!
+ * Measures where the simulation of a model spends its time: the number of events dispatched to each component and the wall time
+ * spent on them, the number of evaluations (and wall time) of each expression, and samples of the size of the future events list and
+ * of the entity population along the simulation. It is disabled by default, and when disabled the kernel only tests a flag.
+ * Measures are cleared when a simulation starts and accumulate over its replications. While simulating, a snapshot of the profile may
+ * be periodically written into a text file.
+ */
+class ModelProfiler {
+public:
+
+	struct ComponentProfile {
+		ModelComponent* component;
+		unsigned long dispatches;
+		double seconds;
+	};
+
+	struct ExpressionProfile {
+		std::string expression;
+		unsigned long evaluations;
+		double seconds;
+	};
+
+	struct Sample {
+		unsigned int replication;
+		double simulatedTime;
+		unsigned long events; //!< events processed since the simulation started
+		unsigned int futureEvents;
+		unsigned int entities;
+	};
+public:
+	ModelProfiler(Model* model);
+	virtual ~ModelProfiler() = default;
+public:
+	void setEnabled(bool enabled);
+	bool isEnabled() const {
+		return _enabled;
+	}
+	void clear();
+	std::string show(unsigned int topComponents = 10) const; //!< A "top" like profile, with the components that took most time first
+	bool writeSnapshot(std::string filename) const;
+public: // results
+	std::vector<ComponentProfile> getComponentProfiles() const; //!< sorted by time, the most expensive first
+	std::vector<ExpressionProfile> getExpressionProfiles() const; //!< sorted by time, the most expensive first
+	const std::vector<Sample>& getSamples() const;
+	unsigned long getNumberOfEvents() const;
+	unsigned int getMaximumFutureEvents() const;
+	unsigned int getMaximumEntities() const;
+public: // gets and sets
+	void setSamplingInterval(unsigned long events); //!< Samples are taken every that number of events (doubled whenever the maximum number of samples is reached)
+	unsigned long getSamplingInterval() const;
+	void setMaximumSamples(unsigned int maximumSamples);
+	unsigned int getMaximumSamples() const;
+	void setSnapshotFilename(std::string snapshotFilename); //!< When not empty, a snapshot is written every snapshot period and when the simulation ends
+	std::string getSnapshotFilename() const;
+	void setSnapshotPeriod(double seconds); //!< Wall time between snapshots
+	double getSnapshotPeriod() const;
+public: // called by the kernel, only when enabled
+	void addDispatch(ModelComponent* component, std::chrono::steady_clock::time_point begin);
+	void addEvaluation(const std::string& expression, std::chrono::steady_clock::time_point begin);
+	inline void eventProcessed() {
+		if (++_events >= _nextSample) {
+			_sample();
+		}
+	}
+	void simulationEnded();
+private:
+	void _sample();
+private:
+	Model* _model;
+	bool _enabled = false;
+	std::unordered_map<ModelComponent*, unsigned int> _componentIndexes;
+	std::vector<ComponentProfile> _components;
+	std::unordered_map<std::string, ExpressionProfile> _expressions;
+	std::vector<Sample> _samples;
+	unsigned long _events = 0;
+	unsigned long _nextSample;
+	unsigned long _currentSamplingInterval;
+	unsigned int _maximumFutureEvents = 0;
+	unsigned int _maximumEntities = 0;
+	std::chrono::steady_clock::time_point _lastSnapshot;
+private:
+
+	const struct DEFAULT_VALUES {
+		const unsigned long samplingInterval = 1000;
+		const unsigned int maximumSamples = 10000;
+		const double snapshotPeriod = 5.0;
+	} DEFAULT;
+	unsigned long _samplingInterval = DEFAULT.samplingInterval;
+	unsigned int _maximumSamples = DEFAULT.maximumSamples;
+	std::string _snapshotFilename = "";
+	double _snapshotPeriod = DEFAULT.snapshotPeriod;
+};
+
+#endif /* MODELPROFILER_H */
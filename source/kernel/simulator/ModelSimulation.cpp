@@ -32,6 +32,7 @@ ModelSimulation::ModelSimulation(Model* model) {
 		return a->getId()<b->getId();
 	});
 	_simulationReporter = new TraitsKernel<SimulationReporter_if>::Implementation(this, model, this->_cstatsAndCountersSimulation);
+	_continuousIntegrator = new ContinuousIntegrator(model);
 	// controls
 	//@TODO Add ReplicationLength, getReplicationLengthTimeUnit, getReplicationBaseTimeUnit, warmUpPeriod, ...
 	_model->getControls()->insert(new SimulationControlTimeUnit(
@@ -54,6 +55,10 @@ ModelSimulation::ModelSimulation(Model* model) {
 					 std::bind(&ModelSimulation::getNumberOfReplications, this),
 					 std::bind(&ModelSimulation::setNumberOfReplications, this, std::placeholders::_1),
 					 Util::TypeOf<ModelSimulation>(), "ModelSimulation", "NumberOfReplications"));
+	_model->getControls()->insert(new SimulationControlUInt(
+					 std::bind(&ModelSimulation::getMinimumNumberOfReplications, this),
+					 std::bind(&ModelSimulation::setMinimumNumberOfReplications, this, std::placeholders::_1),
+					 Util::TypeOf<ModelSimulation>(), "ModelSimulation", "MinimumNumberOfReplications"));
 	_model->getControls()->insert(new SimulationControlString(
 					 std::bind(&ModelSimulation::getTerminatingCondition, this),
 					 std::bind(&ModelSimulation::setTerminatingCondition, this, std::placeholders::_1),
@@ -139,9 +144,11 @@ void ModelSimulation::start() {
 			_model->getOnEventManager()->NotifyReplicationStartHandlers(_createSimulationEvent());
 			_model->getTracer()->traceSimulation(this, TraceManager::Level::L8_detailed, "Running Replication");
 		}
+		_advanceContinuousSystems();
 		replicationEnded = _isReplicationEndCondition();
 		while (!replicationEnded) { // this is the main simulation loop
 			_stepSimulation();
+			_advanceContinuousSystems();
 			replicationEnded = _isReplicationEndCondition();
 			if (_pauseRequested||_stopRequested) { //check this only after _stepSimulation() and not on loop entering conditin
 				break;
@@ -151,7 +158,7 @@ void ModelSimulation::start() {
 			Util::SetIndent(1); // force
 			_replicationEnded();
 			_currentReplicationNumber++;
-			if (_currentReplicationNumber<=_numberOfReplications) {
+			if (_currentReplicationNumber<=_numberOfReplications && !_halfWidthTargetsAchieved) {
 				if (_pauseOnReplication) {
 					_model->getTracer()->trace("End of replication. Simulation is paused.", TraceManager::Level::L7_internal);
 					_pauseRequested = true;
@@ -160,7 +167,7 @@ void ModelSimulation::start() {
 				_pauseRequested = false;
 			}
 		}
-	} while (_currentReplicationNumber<=_numberOfReplications && !(_pauseRequested||_stopRequested));
+	} while (_currentReplicationNumber<=_numberOfReplications && !_halfWidthTargetsAchieved && !(_pauseRequested||_stopRequested));
 	// all replications done (or paused during execution)
 	_isRunning = false;
 	if (!_pauseRequested) { // done or stopped
@@ -182,6 +189,14 @@ void ModelSimulation::_simulationEnded() {
 	_model->getOnEventManager()->NotifySimulationEndHandlers(_createSimulationEvent());
 	if (this->_showReportsAfterSimulation)
 		_simulationReporter->showSimulationStatistics(); //_cStatsSimulation);
+	if (_model->getProfiler()->isEnabled()) {
+		_model->getProfiler()->simulationEnded();
+	}
+	if (_resultsWriter!=nullptr) {
+		_writeResults(SimulationResults::BlockType::simulation);
+		delete _resultsWriter;
+		_resultsWriter = nullptr;
+	}
 	// clear current event
 	//_currentEntity = nullptr;
 	//_currentComponent = nullptr;
@@ -196,62 +211,140 @@ void ModelSimulation::_replicationEnded() {
 		_simulationReporter->showReplicationStatistics();
 	//_simulationReporter->showSimulationResponses();
 	_actualizeSimulationStatistics();
+	if (_resultsWriter!=nullptr) {
+		_writeResults(SimulationResults::BlockType::replication);
+	}
+	_halfWidthTargetsAchieved = _checkHalfWidthTargets();
 	_replicationIsInitiaded = false;
 }
 
+/*!
+ * Checks if the half width of the confidence interval (across the replications done so far) of every statistic with a target is
+ * no greater than its target. Half widths are those of the statistics for the whole simulation, based on Student t critical values.
+ */
+bool ModelSimulation::_checkHalfWidthTargets() {
+	if (_halfWidthTargets->empty() || _currentReplicationNumber<_minimumNumberOfReplications || _currentReplicationNumber<2) {
+		return false;
+	}
+	if (_halfWidthTargetStatistics.size()!=_halfWidthTargets->size() && !_resolveHalfWidthTargets()) {
+		return false;
+	}
+	bool achieved = true;
+	std::vector<StatisticsCollector*>::const_iterator cstatSimulation = _halfWidthTargetStatistics.begin();
+	for (HalfWidthTarget* target : *_halfWidthTargets->list()) {
+		Statistics_if* stat = (*cstatSimulation++)->getStatistics();
+		double halfWidth = stat->halfWidthConfidenceInterval();
+		double targetHalfWidth = target->relative ? target->halfWidth*std::abs(stat->average()) : target->halfWidth;
+		_model->getTracer()->traceSimulation(this, TraceManager::Level::L7_internal, "Half width of \""+target->statisticsName+"\" is "+std::to_string(halfWidth)+" (target "+std::to_string(targetHalfWidth)+"). About "+std::to_string(stat->newSampleSize(targetHalfWidth))+" replications are needed");
+		if (halfWidth>targetHalfWidth) {
+			achieved = false;
+		}
+	}
+	if (achieved) {
+		_model->getTracer()->traceSimulation(this, TraceManager::Level::L2_results, "Half width targets were achieved after "+std::to_string(_currentReplicationNumber)+" replications");
+	}
+	return achieved;
+}
+
+/*!
+ * Finds the statistics for the whole simulation of every half width target, once for the simulation (or when targets are added)
+ */
+bool ModelSimulation::_resolveHalfWidthTargets() {
+	_halfWidthTargetStatistics.clear();
+	std::map<std::string, StatisticsCollector*> cstatsByName;
+	for (ModelDataDefinition* datasim : *_cstatsAndCountersSimulation->list()) {
+		cstatsByName.insert({datasim->getName(), static_cast<StatisticsCollector*> (datasim)}); // the first one with such a name
+	}
+	for (HalfWidthTarget* target : *_halfWidthTargets->list()) {
+		std::map<std::string, StatisticsCollector*>::iterator it = cstatsByName.find(_cte_stCountSimulNamePrefix+target->statisticsName);
+		if (it==cstatsByName.end()) {
+			_model->getTracer()->traceError("Statistics \""+target->statisticsName+"\" of half width target does not exist");
+			_halfWidthTargetStatistics.clear();
+			return false;
+		}
+		_halfWidthTargetStatistics.push_back(it->second);
+	}
+	return true;
+}
+
 void ModelSimulation::_actualizeSimulationStatistics() {
 	//@TODO: should not be only CSTAT and COUNTER, but any modeldatum that generateReportInformation
-	const std::string UtilTypeOfStatisticsCollector = Util::TypeOf<StatisticsCollector>();
-	const std::string UtilTypeOfCounter = Util::TypeOf<Counter>();
+	ModelDataManager* dataManager = _model->getDataManager();
+	if (dataManager->getNumberOfChanges(Util::TypeOf<StatisticsCollector>())!=_mappedCstatsChanges || dataManager->getNumberOfChanges(Util::TypeOf<Counter>())!=_mappedCountersChanges) {
+		// cstats or counters were inserted or removed during the last replication
+		_mapSimulationStatistics();
+	}
+	// actualize simulation cstat statistics by collecting the new value from the model/replication stat
+	for (const std::pair<StatisticsCollector*, StatisticsCollector*>& merge : _cstatsToMerge) {
+		merge.second->addValue(merge.first->getStatistics()->average());
+	}
+	for (const std::pair<Counter*, StatisticsCollector*>& merge : _countersToMerge) {
+		merge.second->addValue(merge.first->getCountValue());
+	}
+}
 
-	StatisticsCollector *cstatModel, *cstatSimulation;
-	// runs over all StatisticCollectors in the model and create the equivalent for the entire simulation
+/*!
+ * Maps every StatisticsCollector and Counter in the model to the StatisticsCollector that collects its results for the entire
+ * simulation, creating the ones not mapped yet, so the end of each replication just runs over the pairs
+ */
+void ModelSimulation::_mapSimulationStatistics() {
+	_cstatsToMerge.clear();
+	_countersToMerge.clear();
+	_mappedCstatsChanges = _model->getDataManager()->getNumberOfChanges(Util::TypeOf<StatisticsCollector>());
+	_mappedCountersChanges = _model->getDataManager()->getNumberOfChanges(Util::TypeOf<Counter>());
 	List<ModelDataDefinition*>* cstats = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<StatisticsCollector>());
 	for (ModelDataDefinition* data : *cstats->list()) {
-		cstatModel = dynamic_cast<StatisticsCollector*> (data); // ((*itMod));
-		cstatSimulation = nullptr;
-		//for (std::list<ModelDataDefinition*>::iterator itSim = _statsCountersSimulation->list()->begin(); itSim != _statsCountersSimulation->list()->end(); itSim++) {
-		for (ModelDataDefinition* datasim : *_cstatsAndCountersSimulation->list()) {
-			//if ((*itSim)->getClassname() == UtilTypeOfStatisticsCollector) {
-			if (datasim->getClassname()==UtilTypeOfStatisticsCollector) {
-				//if ((*itSim)->getName() == _cte_stCountSimulNamePrefix + sc->getName() && dynamic_cast<StatisticsCollector*> (*itSim)->getParent() == sc->getParent()) { // found
-				if (datasim->getName()==_cte_stCountSimulNamePrefix+cstatModel->getName()) {
-					if (dynamic_cast<StatisticsCollector*> (datasim)->getParent()==cstatModel->getParent()) { // found
-						cstatSimulation = dynamic_cast<StatisticsCollector*> (datasim); // (*itSim);
-						break;
-					}
-				}
-			}
+		StatisticsCollector* cstatModel = static_cast<StatisticsCollector*> (data);
+		_cstatsToMerge.push_back({cstatModel, _simulationStatisticsOf(cstatModel, cstatModel->getParent())});
+	}
+	// Counters in replication are converted into CStats in simulation. Each value counted in a replication is added in a CStat for Stats.
+	List<ModelDataDefinition*>* counters = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<Counter>());
+	for (ModelDataDefinition* data : *counters->list()) {
+		Counter* counterModel = static_cast<Counter*> (data);
+		_countersToMerge.push_back({counterModel, _simulationStatisticsOf(counterModel, counterModel->getParent())});
+	}
+	_resultsIds.clear();
+	if (_resultsWriter!=nullptr) {
+		for (const std::pair<StatisticsCollector*, StatisticsCollector*>& merge : _cstatsToMerge) {
+			_resultsIds.push_back(_resultsWriter->identify(merge.first, merge.first->getParent()));
 		}
-		if (cstatSimulation==nullptr) {
-			// this is a new cstat created during the last replication and didn't existed in simulation before
-			cstatSimulation = new StatisticsCollector(_model, _cte_stCountSimulNamePrefix+cstatModel->getName(), cstatModel->getParent(), false);
-			_cstatsAndCountersSimulation->insert(cstatSimulation);
+		for (const std::pair<Counter*, StatisticsCollector*>& merge : _countersToMerge) {
+			_resultsIds.push_back(_resultsWriter->identify(merge.first, merge.first->getParent()));
 		}
-		assert(cstatSimulation!=nullptr);
-		// actualize simulation cstat statistics by collecting the new value from the model/replication stat
-		cstatSimulation->getStatistics()->getCollector()->addValue(cstatModel->getStatistics()->average());
 	}
-	// runs over all Counters in the model and create the equivalent for the entire simulation
-	Counter *counterModel; //, *cntSim;
-	List<ModelDataDefinition*>* counters = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<Counter>());
-	for (ModelDataDefinition* countData : *counters->list()) {
-		counterModel = dynamic_cast<Counter*> (countData);
-		cstatSimulation = nullptr;
-		for (ModelDataDefinition* dataSim : *_cstatsAndCountersSimulation->list()) {
-			if (dataSim->getClassname()==UtilTypeOfStatisticsCollector) {
-				if (dataSim->getName()==_cte_stCountSimulNamePrefix+counterModel->getName()) {
-					if (dynamic_cast<StatisticsCollector*> (dataSim)->getParent()==counterModel->getParent()) {
-						cstatSimulation = dynamic_cast<StatisticsCollector*> (dataSim);
-						break;
-					}
-				}
-			}
+}
+
+/*!
+ * Appends a chunk with the statistics of the replication that just ended, or with those of the whole simulation, to the results file
+ */
+void ModelSimulation::_writeResults(SimulationResults::BlockType type) {
+	const bool replication = type==SimulationResults::BlockType::replication;
+	_resultsWriter->beginChunk(type, getResultsLabel(), replication ? _currentReplicationNumber : 0);
+	std::vector<unsigned int>::const_iterator id = _resultsIds.begin();
+	for (const std::pair<StatisticsCollector*, StatisticsCollector*>& merge : _cstatsToMerge) {
+		_resultsWriter->addRow(*id++, (replication ? merge.first : merge.second)->getStatistics());
+	}
+	for (const std::pair<Counter*, StatisticsCollector*>& merge : _countersToMerge) {
+		if (replication) {
+			_resultsWriter->addRow(*id++, merge.first->getCountValue());
+		} else {
+			_resultsWriter->addRow(*id++, merge.second->getStatistics());
 		}
-		assert(cstatSimulation!=nullptr);
-		// actualize simulation cstat statistics by collecting the new value from the model/replication stat
-		cstatSimulation->getStatistics()->getCollector()->addValue(counterModel->getCountValue());
 	}
+	_resultsWriter->endChunk();
+}
+
+StatisticsCollector* ModelSimulation::_simulationStatisticsOf(ModelDataDefinition* cstatOrCounter, ModelDataDefinition* parent) {
+	const std::string name = _cte_stCountSimulNamePrefix+cstatOrCounter->getName();
+	std::map<ModelDataDefinition*, ModelDataDefinition*>::iterator it = _cstatsAndCountersMapSimulation->find(cstatOrCounter);
+	if (it!=_cstatsAndCountersMapSimulation->end() && it->second->getName()==name) { // name differs if a removed one was replaced at the same address
+		return static_cast<StatisticsCollector*> (it->second);
+	}
+	// this new CSat should NOT be inserted into the model (so the false as last argument)
+	StatisticsCollector* cstatSimulation = new StatisticsCollector(_model, name, parent, false);
+	_cstatsAndCountersSimulation->insert(cstatSimulation);
+	(*_cstatsAndCountersMapSimulation)[cstatOrCounter] = cstatSimulation;
+	return cstatSimulation;
 }
 
 void ModelSimulation::_showSimulationHeader() {
@@ -301,29 +394,25 @@ void ModelSimulation::_initSimulation() {
 	// copy all CStats and Counters (used in a replication) to CStats and counters for the whole simulation
 	// @TODO: Should not be CStats and Counters, but any modeldatum that generates report importation
 	this->_cstatsAndCountersSimulation->clear();
-	StatisticsCollector* cstat;
-	List<ModelDataDefinition*>* cstats = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<StatisticsCollector>());
-	for (ModelDataDefinition* cstatData : *cstats->list()) {
-		cstat = dynamic_cast<StatisticsCollector*> (cstatData);
-		// this new CSat should NOT be inserted into the model (so the false as last argument)
-		StatisticsCollector* newCStatSimulation = new StatisticsCollector(_model, _cte_stCountSimulNamePrefix+cstat->getName(), cstat->getParent(), false);
-		this->_cstatsAndCountersSimulation->insert(newCStatSimulation);
-	}
-	// copy all Counters (used in a replication) to Counters for the whole simulation
-	// @TODO: Counters in replication should be converted into CStats in simulation. Each value counted in a replication should be added in a CStat for Stats.
-	Counter* counter;
-	List<ModelDataDefinition*>* counters = _model->getDataManager()->getDataDefinitionList(Util::TypeOf<Counter>());
-	for (ModelDataDefinition* counterData : *counters->list()) {
-		counter = dynamic_cast<Counter*> (counterData);
-		/* // we do NOT add a counter in the simulation. We add a CStat that collect statistics about the Counter
-		Counter* newCountSimul = new Counter(_cte_stCountSimulNamePrefix + counter->getName(), counter->getParent());
-		this->_statsCountersSimulation->insert(newCountSimul);
-		 */
-		// addin a cstat (to stat the counts)
-		StatisticsCollector* newCStatSimulation = new StatisticsCollector(_model, _cte_stCountSimulNamePrefix+counter->getName(), counter->getParent(), false);
-		this->_cstatsAndCountersSimulation->insert(newCStatSimulation);
+	this->_cstatsAndCountersMapSimulation->clear();
+	_halfWidthTargetStatistics.clear();
+	if (_resultsWriter!=nullptr) { // a previous simulation was stopped
+		delete _resultsWriter;
+		_resultsWriter = nullptr;
+	}
+	if (_resultsFilename!="") {
+		std::string errorMessage;
+		_resultsWriter = new SimulationResultsWriter(_resultsFilename);
+		if (!_resultsWriter->open(&errorMessage)) {
+			_model->getTracer()->traceError(errorMessage+"Results will not be written.");
+			delete _resultsWriter;
+			_resultsWriter = nullptr;
+		}
 	}
+	_mapSimulationStatistics();
+	_model->getProfiler()->clear();
 	_simulationIsInitiated = true; // @TODO Check the uses of _simulationIsInitiated and when it should be set to false
+	_halfWidthTargetsAchieved = false;
 	_replicationIsInitiaded = false;
 	_currentReplicationNumber = 1;
 }
@@ -336,6 +425,7 @@ void ModelSimulation::_initReplication() {
 	_model->getFutureEvents()->clear();
 	_model->getDataManager()->getDataDefinitionList("Entity")->clear();
 	_simulatedTime = 0.0;
+	_continuousIntegrator->clear(); // components register their continuous systems again
 	// init all components between replications
 	Util::IncIndent();
 	tm->traceSimulation(this, TraceManager::Level::L8_detailed, "Initing Replication");
@@ -417,6 +507,9 @@ void ModelSimulation::_stepSimulation() {
 				_model->getTracer()->traceError("Error on processing event ("+nextEvent->show()+")", e);
 			}
 			_model->getOnEventManager()->NotifyAfterProcessEventHandlers(_createSimulationEvent());
+			if (_model->getProfiler()->isEnabled()) {
+				_model->getProfiler()->eventProcessed();
+			}
 			if (_pauseOnEvent) {
 				_pauseRequested = true;
 			}
@@ -427,6 +520,21 @@ void ModelSimulation::_stepSimulation() {
 	}
 }
 
+/*!
+ * Continuous systems are advanced up to the next event (or to the end of the replication), unless a zero-crossing happens before. In that
+ * case an internal event is scheduled at the crossing time, and it is the next one.
+ */
+void ModelSimulation::_advanceContinuousSystems() {
+	if (!_continuousIntegrator->hasSystems()) {
+		return;
+	}
+	double time = _replicationLength*_replicationTimeScaleFactorToBase;
+	if (!_model->getFutureEvents()->empty()) {
+		time = std::min(time, _model->getFutureEvents()->front()->getTime());
+	}
+	_continuousIntegrator->advance(time);
+}
+
 void ModelSimulation::_dispatchEvent(Event* event) {
 	InternalEvent* intEvent = dynamic_cast<InternalEvent*> (event);
 	if (intEvent==nullptr) {
@@ -573,6 +681,10 @@ SimulationReporter_if* ModelSimulation::getReporter() const {
 	return _simulationReporter;
 }
 
+ContinuousIntegrator* ModelSimulation::getContinuousIntegrator() const {
+	return _continuousIntegrator;
+}
+
 void ModelSimulation::setShowReportsAfterReplication(bool showReportsAfterReplication) {
 	this->_showReportsAfterReplication = showReportsAfterReplication;
 }
@@ -614,6 +726,28 @@ unsigned int ModelSimulation::getNumberOfReplications() const {
 	return _numberOfReplications;
 }
 
+void ModelSimulation::addHalfWidthTarget(std::string statisticsName, double halfWidth, bool relative) {
+	_halfWidthTargets->insert(new HalfWidthTarget{statisticsName, halfWidth, relative});
+	_hasChanged = true;
+}
+
+List<HalfWidthTarget*>* ModelSimulation::getHalfWidthTargets() const {
+	return _halfWidthTargets;
+}
+
+void ModelSimulation::setMinimumNumberOfReplications(unsigned int minimumNumberOfReplications) {
+	this->_minimumNumberOfReplications = minimumNumberOfReplications;
+	_hasChanged = true;
+}
+
+unsigned int ModelSimulation::getMinimumNumberOfReplications() const {
+	return _minimumNumberOfReplications;
+}
+
+bool ModelSimulation::isHalfWidthTargetsAchieved() const {
+	return _halfWidthTargetsAchieved;
+}
+
 //void ModelSimulation::setReplicationLength(double _replicationLength) {
 //	this->_replicationLength = _replicationLength;
 //	_hasChanged = true;
@@ -673,6 +807,23 @@ std::string ModelSimulation::getTerminatingCondition() const {
 	return _terminatingCondition;
 }
 
+void ModelSimulation::setResultsFilename(std::string resultsFilename) {
+	this->_resultsFilename = resultsFilename;
+	_hasChanged = true;
+}
+
+std::string ModelSimulation::getResultsFilename() const {
+	return _resultsFilename;
+}
+
+void ModelSimulation::setResultsLabel(std::string resultsLabel) {
+	this->_resultsLabel = resultsLabel;
+}
+
+std::string ModelSimulation::getResultsLabel() const {
+	return _resultsLabel!="" ? _resultsLabel : _info->getName();
+}
+
 void ModelSimulation::loadInstance(PersistenceRecord *fields) {
 	this->_numberOfReplications = fields->loadField("numberOfReplications", DEFAULT.numberOfReplications);
 	this->_replicationLength = fields->loadField("replicationLength", DEFAULT.replicationLength);
@@ -685,6 +836,16 @@ void ModelSimulation::loadInstance(PersistenceRecord *fields) {
 	this->_showReportsAfterSimulation = fields->loadField("showReportsAfterSimulation", DEFAULT.showReportsAfterSimulation);
 	this->_showSimulationControlsInReport = fields->loadField("showSimulationControlsInReport", DEFAULT.showSimulationControlsInReport);
 	this->_showSimulationResposesInReport = fields->loadField("showSimulationResposesInReport", DEFAULT.showSimulationResposesInReport);
+	this->_minimumNumberOfReplications = fields->loadField("minimumNumberOfReplications", DEFAULT.minimumNumberOfReplications);
+	this->_resultsFilename = fields->loadField("resultsFilename", DEFAULT.resultsFilename);
+	this->_halfWidthTargets->clear();
+	unsigned int numTargets = fields->loadField("halfWidthTargets", 0u);
+	for (unsigned int i = 0; i<numTargets; i++) {
+		std::string statisticsName = fields->loadField("halfWidthTargetStatistics"+Util::StrIndex(i), "");
+		double halfWidth = fields->loadField("halfWidthTarget"+Util::StrIndex(i), 0.0);
+		bool relative = fields->loadField("halfWidthTargetRelative"+Util::StrIndex(i), false);
+		this->_halfWidthTargets->insert(new HalfWidthTarget{statisticsName, halfWidth, relative});
+	}
 	// not a field of ModelSimulation, but I'll load it here
 	TraceManager::Level traceLevel = static_cast<TraceManager::Level> (fields->loadField("traceLevel", static_cast<int> (TraitsKernel<Model>::traceLevel)));
 	this->_model->getTracer()->setTraceLevel(traceLevel);
@@ -707,6 +868,16 @@ void ModelSimulation::saveInstance(PersistenceRecord *fields, bool saveDefaults)
 	fields->saveField("showReportsAfterSimulation", _showReportsAfterSimulation, DEFAULT.showReportsAfterSimulation, saveDefaults);
 	fields->saveField("showSimulationControlsInReport", _showSimulationControlsInReport, DEFAULT.showSimulationControlsInReport, saveDefaults);
 	fields->saveField("showSimulationResposesInReport", _showSimulationResposesInReport, DEFAULT.showSimulationResposesInReport, saveDefaults);
+	fields->saveField("minimumNumberOfReplications", _minimumNumberOfReplications, DEFAULT.minimumNumberOfReplications, saveDefaults);
+	fields->saveField("resultsFilename", _resultsFilename, DEFAULT.resultsFilename, saveDefaults);
+	fields->saveField("halfWidthTargets", _halfWidthTargets->size(), 0u, saveDefaults);
+	unsigned int i = 0;
+	for (HalfWidthTarget* target : *_halfWidthTargets->list()) {
+		fields->saveField("halfWidthTargetStatistics"+Util::StrIndex(i), target->statisticsName);
+		fields->saveField("halfWidthTarget"+Util::StrIndex(i), target->halfWidth, 0.0, true);
+		fields->saveField("halfWidthTargetRelative"+Util::StrIndex(i), target->relative, false, saveDefaults);
+		i++;
+	}
 	// @TODO not a field of ModelSimulation, but I'll save it here for now
 	fields->saveField("traceLevel", static_cast<int> (_model->getTracer()->getTraceLevel()), static_cast<int> (TraitsKernel<Model>::traceLevel));
 	_hasChanged = false;
@@ -15,16 +15,31 @@
 #define MODELSIMULATION_H
 
 #include <chrono>
+#include <vector>
 #include "Event.h"
 #include "Entity.h"
 #include "ModelInfo.h"
 #include "SimulationReporter_if.h"
 #include "OnEventManager.h"
+#include "ContinuousIntegrator.h"
+#include "SimulationResults.h"
 //#include "Counter.h"
 //namespace GenesysKernel {
 
 //#include "Model.h" // for friend functions
 class Model;
+class StatisticsCollector;
+class Counter;
+
+/*!
+ * A target for the half width of the confidence interval of a statistic across replications. The statistic is identified by the
+ * name of a StatisticsCollector or Counter (such as "Queue_1.TimeInQueue"). A relative target is a fraction of the average.
+ */
+struct HalfWidthTarget {
+	std::string statisticsName;
+	double halfWidth;
+	bool relative;
+};
 
 /*!
  * The ModelSimulation controls the simulation of a model, alowing to start, pause, resume e stop a simulation, composed by
@@ -58,6 +73,12 @@ public: // old modelInfos
 	Util::TimeUnit getWarmUpPeriodTimeUnit() const;
 	void setTerminatingCondition(std::string _terminatingCondition);
 	std::string getTerminatingCondition() const;
+public: // sequential replication control
+	void addHalfWidthTarget(std::string statisticsName, double halfWidth, bool relative = false); //!< When there are targets, NumberOfReplications is the maximum and the simulation ends as soon as all targets are achieved
+	List<HalfWidthTarget*>* getHalfWidthTargets() const;
+	void setMinimumNumberOfReplications(unsigned int minimumNumberOfReplications); //!< Targets are checked only after this number of replications
+	unsigned int getMinimumNumberOfReplications() const;
+	bool isHalfWidthTargetsAchieved() const;
 public: // gets and sets
 	void setPauseOnEvent(bool _pauseOnEvent);
 	bool isPauseOnEvent() const;
@@ -72,6 +93,7 @@ public: // gets and sets
 public: // gets and sets ModelSubParts
 	void setReporter(SimulationReporter_if* _simulationReporter);
 	SimulationReporter_if* getReporter() const;
+	ContinuousIntegrator* getContinuousIntegrator() const; //!< Advances continuous systems (ODEs) between events
 public: // only gets
 	double getSimulatedTime() const; /*! The current time in the model being simulated, i.e., the instant when the current event was triggered */
 	bool isRunning() const;
@@ -92,6 +114,10 @@ public:
 	bool isShowSimulationResposesInReport() const;
 	void setShowSimulationControlsInReport(bool _showSimulationControlsInReport);
 	bool isShowSimulationControlsInReport() const;
+	void setResultsFilename(std::string resultsFilename); //!< When not empty, statistics of every replication and of the simulation are appended to this SimulationResults file
+	std::string getResultsFilename() const;
+	void setResultsLabel(std::string resultsLabel); //!< Identifies the results of this simulation (a scenario) in the results file. The model name by default
+	std::string getResultsLabel() const;
 	/*
 	 * PRIVATE
 	 */
@@ -101,6 +127,7 @@ private: // simulation control
 	void _clearStatistics(); //!<
 	void _checkWarmUpTime(Event* nextEvent); //!<
 	void _stepSimulation(); //!<
+	void _advanceContinuousSystems(); //!<
 	void _replicationEnded(); //!<
 	void _simulationEnded(); //!<
 private:
@@ -108,6 +135,11 @@ private:
 	bool _checkBreakpointAt(Event* event); //!<
 	bool _isReplicationEndCondition(); //!<
 	void _actualizeSimulationStatistics(); //!<
+	void _mapSimulationStatistics(); //!<
+	StatisticsCollector* _simulationStatisticsOf(ModelDataDefinition* cstatOrCounter, ModelDataDefinition* parent); //!<
+	void _writeResults(SimulationResults::BlockType type); //!<
+	bool _checkHalfWidthTargets(); //!<
+	bool _resolveHalfWidthTargets(); //!<
 	void _showSimulationHeader(); //!<
 	void _traceReplicationEnded(); //!<
 private:
@@ -133,10 +165,12 @@ private:
 	bool _simulationIsInitiated = false;
 	bool _replicationIsInitiaded = false;
 	bool _hasChanged = false;
+	bool _halfWidthTargetsAchieved = false;
 private:
 
 	const struct DEFAULT_VALUES {
 		const unsigned int numberOfReplications = 1;
+		const unsigned int minimumNumberOfReplications = 5;
 		const double replicationLength = 60.0; // by default, 60s = 1min
 		const Util::TimeUnit replicationLengthTimeUnit = Util::TimeUnit::second;
 		const Util::TimeUnit replicationBeseTimeUnit = Util::TimeUnit::second;
@@ -150,8 +184,10 @@ private:
 		const bool showReportsAfterReplication = true;
 		const bool showSimulationControlsInReport = true;
 		const bool showSimulationResposesInReport = false;
+		const std::string resultsFilename = "";
 	} DEFAULT;
 	unsigned int _numberOfReplications = DEFAULT.numberOfReplications;
+	unsigned int _minimumNumberOfReplications = DEFAULT.minimumNumberOfReplications;
 	double _replicationLength = DEFAULT.replicationLength;
 	Util::TimeUnit _replicationLengthTimeUnit = DEFAULT.replicationLengthTimeUnit;
 	Util::TimeUnit _replicationBaseTimeUnit = DEFAULT.replicationReportBaseTimeUnit;
@@ -162,6 +198,8 @@ private:
 	bool _showReportsAfterReplication = DEFAULT.showReportsAfterReplication;
 	bool _showSimulationControlsInReport = DEFAULT.showSimulationControlsInReport;
 	bool _showSimulationResposesInReport = DEFAULT.showSimulationResposesInReport;
+	std::string _resultsFilename = DEFAULT.resultsFilename;
+	std::string _resultsLabel = "";
 	//
 	double _replicationTimeScaleFactorToBase; // a scale that converts ReplicationLenghtTimeUnit to ReplicationBaseTimeUnit. Future events are in "times" of unit ReplicationBaseTimeUnit
 	std::chrono::system_clock::time_point _startRealSimulationTimeSimulation;
@@ -175,9 +213,17 @@ private:
 	Model* _model;
 	ModelInfo* _info;
 	SimulationReporter_if* _simulationReporter;
-	//@TODO Change List below to a MAP, associating every CstatOuCounter in the replication to the equivalent in the simulation
+	ContinuousIntegrator* _continuousIntegrator;
 	List<ModelDataDefinition*>* _cstatsAndCountersSimulation = new List<ModelDataDefinition*>();
-	std::map<ModelDataDefinition*, ModelDataDefinition*>* _cstatsAndCountersMapSimulation = new std::map<ModelDataDefinition*, ModelDataDefinition*>();
+	std::map<ModelDataDefinition*, ModelDataDefinition*>* _cstatsAndCountersMapSimulation = new std::map<ModelDataDefinition*, ModelDataDefinition*>(); //!< every CStat or Counter in the replication to the equivalent CStat in the simulation
+	std::vector<std::pair<StatisticsCollector*, StatisticsCollector*>> _cstatsToMerge; //!< pairs of the map, in the order of the model, merged at the end of every replication
+	std::vector<std::pair<Counter*, StatisticsCollector*>> _countersToMerge;
+	unsigned long _mappedCstatsChanges = 0; //!< changes of cstats and of counters in the data manager when they were mapped, so they are mapped again after any insertion or removal
+	unsigned long _mappedCountersChanges = 0;
+	SimulationResultsWriter* _resultsWriter = nullptr; //!< open only while simulating, if there is a results filename
+	std::vector<unsigned int> _resultsIds; //!< ids in the results file of the cstats and then of the counters to merge
+	List<HalfWidthTarget*>* _halfWidthTargets = new List<HalfWidthTarget*>();
+	std::vector<StatisticsCollector*> _halfWidthTargetStatistics; //!< statistics for the whole simulation of each target, in the same order
 	List<double>* _breakpointsOnTime = new List<double>();
 	List<ModelComponent*>* _breakpointsOnComponent = new List<ModelComponent*>();
 	List<Entity*>* _breakpointsOnEntity = new List<Entity*>();
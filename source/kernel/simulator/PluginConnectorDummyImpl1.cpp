@@ -12,6 +12,7 @@
  */
 
 #include "PluginConnectorDummyImpl1.h"
+#include <unordered_map>
 
 // Model Components
 
@@ -19,9 +20,11 @@
 #include "../../plugins/components/Assign.h"
 #include "../../plugins/components/Batch.h"
 #include "../../plugins/components/Buffer.h"
+#include "../../plugins/components/CellularAutomataComp.h"
 #include "../../plugins/components/Clone.h"
 #include "../../plugins/components/CppForG.h"
 #include "../../plugins/components/Create.h"
+#include "../../plugins/components/DefaultModalModel.h"
 #include "../../plugins/components/Decide.h"
 #include "../../plugins/components/Delay.h"
 #include "../../plugins/components/DiffEquations.h"
@@ -74,7 +77,7 @@
 #include "../../plugins/data/Storage.h"
 #include "../../plugins/data/Variable.h"
 //#include "../../plugins/data/Expression.h"
-//#include "../../plugins/data/Conveyor.h"
+#include "../../plugins/data/Conveyor.h"
 //#include "../../plugins/data/Segment.h"
 
 #include "../util/Util.h"
@@ -101,269 +104,123 @@ bool PluginConnectorDummyImpl1::disconnect(Plugin* plugin) {
 	return true;
 }
 
-//Plugin* PluginConnectorDummyImpl1::_connectModelDefinitions(const std::string dynamicLibraryFilename){
-//    StaticGetPluginInformation GetInfo = nullptr;
-//}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectBasic(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "assign.so")
-        GetInfo = &Assign::GetPluginInformation;
-    else if (fn == "buffer.so")
-        GetInfo = &Buffer::GetPluginInformation;
-    else if (fn == "create.so")
-        GetInfo = &Create::GetPluginInformation;
-    else if (fn == "dispose.so")
-        GetInfo = &Dispose::GetPluginInformation;
-    else if (fn == "dummy.so")
-        GetInfo = &DummyComponent::GetPluginInformation;
-    else if (fn == "entitygroup.so")
-        GetInfo = &EntityGroup::GetPluginInformation;
-    else if (fn == "failure.so")
-        GetInfo = &Failure::GetPluginInformation;
-    else if (fn == "formula.so")
-        GetInfo = &Formula::GetPluginInformation;
-    else if (fn == "label.so")
-        GetInfo = &Label::GetPluginInformation;
-    else if (fn == "queue.so")
-        GetInfo = &Queue::GetPluginInformation;
-    else if (fn == "resource.so")
-        GetInfo = &Resource::GetPluginInformation;
-    else if (fn == "variable.so")
-        GetInfo = &Variable::GetPluginInformation;
-    return GetInfo;
-}
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectDiscrete(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "batch.so")
-        GetInfo = &Batch::GetPluginInformation;
-    else if (fn == "clone.so")
-        GetInfo = &Clone::GetPluginInformation;
-    else if (fn == "decide.so")
-        GetInfo = &Decide::GetPluginInformation;
-    else if (fn == "delay.so")
-        GetInfo = &Delay::GetPluginInformation;
-    else if (fn == "dropoff.so")
-        GetInfo = &DropOff::GetPluginInformation;
-    else if (fn == "hold.so")
-        GetInfo = &Wait::GetPluginInformation;
-    else if (fn == "match.so")
-        GetInfo = &Match::GetPluginInformation;
-    else if (fn == "process.so")
-        GetInfo = &Process::GetPluginInformation;
-    else if (fn == "pickup.so")
-        GetInfo = &PickUp::GetPluginInformation;
-    else if (fn == "remove.so")
-        GetInfo = &Remove::GetPluginInformation;
-    else if (fn == "record.so")
-        GetInfo = &Record::GetPluginInformation;
-    else if (fn == "release.so")
-        GetInfo = &Release::GetPluginInformation;
-    else if (fn == "storage.so")
-        GetInfo = &Storage::GetPluginInformation;
-    else if (fn == "separate.so")
-        GetInfo = &Separate::GetPluginInformation;
-    //else if (fn == "submodel.so")
-    //    GetInfo = &Submodel::GetPluginInformation;
-    else if (fn == "seize.so")
-        GetInfo = &Seize::GetPluginInformation;
-    else if (fn == "search.so")
-        GetInfo = &Search::GetPluginInformation;
-    else if (fn == "signal.so")
-        GetInfo = &Signal::GetPluginInformation;
-    else if (fn == "store.so")
-        GetInfo = &Store::GetPluginInformation;
-    else if (fn == "unstore.so")
-        GetInfo = &Unstore::GetPluginInformation;
-    else if (fn == "storage.so")
-        GetInfo = &Storage::GetPluginInformation;
-    else if (fn == "set.so")
-        GetInfo = &Set::GetPluginInformation;
-    else if (fn == "schedule.so")
-        GetInfo = &Schedule::GetPluginInformation;
-    else if (fn == "signaldata.so")
-        GetInfo = &SignalData::GetPluginInformation;
-    return GetInfo;
-}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectContinuos(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "diffequations.so")
-        GetInfo = &DiffEquations::GetPluginInformation;
-    else if (fn == "lsode.so")
-        GetInfo = &LSODE::GetPluginInformation;
-    //else if (fn == "finiteelement.so")
-    //    GetInfo = &LSODE::GetPluginInformation;
-    //else if (fn == "finitevolume.so")
-    //    GetInfo = &LSODE::GetPluginInformation;
-    return GetInfo;
-}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectIntegrations(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "cppcompiler.so")
-        GetInfo = &CppCompiler::GetPluginInformation;
-    else if (fn == "cppforg.so")
-        GetInfo = &CppForG::GetPluginInformation;
-    else if (fn == "spicecircuit.so")
-        GetInfo = &SPICECircuit::GetPluginInformation;
-    else if (fn == "spicenode.so")
-        GetInfo = &SPICENode::GetPluginInformation;
-    else if (fn == "spicerunner.so")
-        GetInfo = &SPICERunner::GetPluginInformation;
-    //else if (fn == "octave.so")
-    //	GetInfo = &Octave::GetPluginInformation;
-    return GetInfo;
-}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectInputOutput(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "file.so")
-        GetInfo = &File::GetPluginInformation;
-    //else if (fn == "read.so")
-    //    GetInfo = &Read::GetPluginInformation;
-    else if (fn == "write.so")
-        GetInfo = &Write::GetPluginInformation;
-    return GetInfo;
-}
-
-
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectTransfer(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "access.so")
-        GetInfo = &Access::GetPluginInformation;
-    else if (fn == "enter.so")
-        GetInfo = &Enter::GetPluginInformation;
-    else if (fn == "exit.so")
-        GetInfo = &Exit::GetPluginInformation;
-    else if (fn == "leave.so")
-        GetInfo = &Leave::GetPluginInformation;
-    else if (fn == "pickstation.so")
-        GetInfo = &PickStation::GetPluginInformation;
-    else if (fn == "route.so")
-        GetInfo = &Route::GetPluginInformation;
-    else if (fn == "start.so")
-        GetInfo = &Start::GetPluginInformation;
-    else if (fn == "stop.so")
-        GetInfo = &Stop::GetPluginInformation;
-    else if (fn == "station.so")
-        GetInfo = &Station::GetPluginInformation;
-    else if (fn == "sequence.so")
-        GetInfo = &Sequence::GetPluginInformation;
-    return GetInfo;
-}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectNetwork(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    //if (fn == "cellularautomata.so")
-    //    GetInfo = &CellularAutomataComp::GetPluginInformation;
-    //else
-    /*
-    if (fn == "efsmData.so")
-        GetInfo = &ExtendedFSM::GetPluginInformation;
-    else if (fn == "efsm.so")
-        GetInfo = &OLD_FiniteStateMachine::GetPluginInformation;
-    else if (fn == "fsm_state.so")
-        GetInfo = &FSM_State::GetPluginInformation;
-    else if (fn == "fsm_transition.so")
-        GetInfo = &FSM_Transition::GetPluginInformation;
-    else if (fn == "fsm_modalmodel.so")
-        GetInfo = &FSM_ModalModel::GetPluginInformation;
-    else
-    */
-    if (fn == "markovchain.so")
-        GetInfo = &MarkovChain::GetPluginInformation;
-
-    // boolean networks
-
-    // petri nets
-
-    // finite elements
-
-    return GetInfo;
-}
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectElectronicDomain(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-    if (fn == "resistor.so")
-        GetInfo = &Resistor::GetPluginInformation;
-    else if (fn == "vsource.so")
-        GetInfo = &Vsource::GetPluginInformation;
-    else if (fn == "vpulse.so")
-        GetInfo = &Vpulse::GetPluginInformation;
-    else if (fn == "vsine.so")
-        GetInfo = &Vsine::GetPluginInformation;
-    else if (fn == "capacitor.so")
-        GetInfo = &Capacitor::GetPluginInformation;
-    else if (fn == "diode.so")
-        GetInfo = &Diode::GetPluginInformation;
-    else if (fn == "pmos.so")
-        GetInfo = &PMOS::GetPluginInformation;
-    else if (fn == "nmos.so")
-        GetInfo = &NMOS::GetPluginInformation;
-    else if (fn == "not.so")
-        GetInfo = &NOT::GetPluginInformation;
-    else if (fn == "nor.so")
-        GetInfo = &NOR::GetPluginInformation;
-    else if (fn == "nand.so")
-        GetInfo = &NAND::GetPluginInformation;
-    else if (fn == "and.so")
-        GetInfo = &AND::GetPluginInformation;
-    else if (fn == "or.so")
-        GetInfo = &OR::GetPluginInformation;
-    else if (fn == "xor.so")
-        GetInfo = &XOR::GetPluginInformation;
-    else if (fn == "xnor.so")
-        GetInfo = &XNOR::GetPluginInformation;
-    return GetInfo;
-}
-
-
-StaticGetPluginInformation PluginConnectorDummyImpl1::_connectBiochemicalDomain(const std::string fn){
-    StaticGetPluginInformation GetInfo = nullptr;
-
-    return GetInfo;
+const PluginConnectorDummyImpl1::Registration PluginConnectorDummyImpl1::_registrations[] = {
+	// basic
+	{"assign.so", &Assign::GetPluginInformation},
+	{"buffer.so", &Buffer::GetPluginInformation},
+	{"create.so", &Create::GetPluginInformation},
+	{"dispose.so", &Dispose::GetPluginInformation},
+	{"dummy.so", &DummyComponent::GetPluginInformation},
+	{"entitygroup.so", &EntityGroup::GetPluginInformation},
+	{"failure.so", &Failure::GetPluginInformation},
+	{"formula.so", &Formula::GetPluginInformation},
+	{"label.so", &Label::GetPluginInformation},
+	{"queue.so", &Queue::GetPluginInformation},
+	{"resource.so", &Resource::GetPluginInformation},
+	{"variable.so", &Variable::GetPluginInformation},
+	// discrete
+	{"batch.so", &Batch::GetPluginInformation},
+	{"clone.so", &Clone::GetPluginInformation},
+	{"decide.so", &Decide::GetPluginInformation},
+	{"delay.so", &Delay::GetPluginInformation},
+	{"dropoff.so", &DropOff::GetPluginInformation},
+	{"hold.so", &Wait::GetPluginInformation},
+	{"match.so", &Match::GetPluginInformation},
+	{"process.so", &Process::GetPluginInformation},
+	{"pickup.so", &PickUp::GetPluginInformation},
+	{"remove.so", &Remove::GetPluginInformation},
+	{"record.so", &Record::GetPluginInformation},
+	{"release.so", &Release::GetPluginInformation},
+	{"storage.so", &Storage::GetPluginInformation},
+	{"separate.so", &Separate::GetPluginInformation},
+	//{"submodel.so", &Submodel::GetPluginInformation},
+	{"seize.so", &Seize::GetPluginInformation},
+	{"search.so", &Search::GetPluginInformation},
+	{"signal.so", &Signal::GetPluginInformation},
+	{"store.so", &Store::GetPluginInformation},
+	{"unstore.so", &Unstore::GetPluginInformation},
+	{"set.so", &Set::GetPluginInformation},
+	{"schedule.so", &Schedule::GetPluginInformation},
+	{"signaldata.so", &SignalData::GetPluginInformation},
+	// continuous
+	{"diffequations.so", &DiffEquations::GetPluginInformation},
+	{"lsode.so", &LSODE::GetPluginInformation},
+	//{"finiteelement.so", &LSODE::GetPluginInformation},
+	//{"finitevolume.so", &LSODE::GetPluginInformation},
+	// transfer
+	{"access.so", &Access::GetPluginInformation},
+	{"conveyor.so", &Conveyor::GetPluginInformation},
+	{"enter.so", &Enter::GetPluginInformation},
+	{"exit.so", &Exit::GetPluginInformation},
+	{"leave.so", &Leave::GetPluginInformation},
+	{"pickstation.so", &PickStation::GetPluginInformation},
+	{"route.so", &Route::GetPluginInformation},
+	{"start.so", &Start::GetPluginInformation},
+	{"stop.so", &Stop::GetPluginInformation},
+	{"station.so", &Station::GetPluginInformation},
+	{"sequence.so", &Sequence::GetPluginInformation},
+	// integrations
+	{"cppcompiler.so", &CppCompiler::GetPluginInformation},
+	{"cppforg.so", &CppForG::GetPluginInformation},
+	{"spicecircuit.so", &SPICECircuit::GetPluginInformation},
+	{"spicenode.so", &SPICENode::GetPluginInformation},
+	{"spicerunner.so", &SPICERunner::GetPluginInformation},
+	//{"octave.so", &Octave::GetPluginInformation},
+	// input and output
+	{"file.so", &File::GetPluginInformation},
+	//{"read.so", &Read::GetPluginInformation},
+	{"write.so", &Write::GetPluginInformation},
+	// network
+	{"cellularautomata.so", &CellularAutomataComp::GetPluginInformation},
+	//{"efsmData.so", &ExtendedFSM::GetPluginInformation},
+	//{"efsm.so", &OLD_FiniteStateMachine::GetPluginInformation},
+	//{"fsm_state.so", &FSM_State::GetPluginInformation},
+	//{"fsm_transition.so", &FSM_Transition::GetPluginInformation},
+	//{"fsm_modalmodel.so", &FSM_ModalModel::GetPluginInformation},
+	{"markovchain.so", &MarkovChain::GetPluginInformation},
+	{"defaultnode.so", &DefaultNode::GetPluginInformation},
+	{"defaultmodalmodel.so", &DefaultModalModel::GetPluginInformation},
+	// boolean networks, petri nets and finite elements are still to come
+	// electronic domain
+	{"resistor.so", &Resistor::GetPluginInformation},
+	{"vsource.so", &Vsource::GetPluginInformation},
+	{"vpulse.so", &Vpulse::GetPluginInformation},
+	{"vsine.so", &Vsine::GetPluginInformation},
+	{"capacitor.so", &Capacitor::GetPluginInformation},
+	{"diode.so", &Diode::GetPluginInformation},
+	{"pmos.so", &PMOS::GetPluginInformation},
+	{"nmos.so", &NMOS::GetPluginInformation},
+	{"not.so", &NOT::GetPluginInformation},
+	{"nor.so", &NOR::GetPluginInformation},
+	{"nand.so", &NAND::GetPluginInformation},
+	{"and.so", &AND::GetPluginInformation},
+	{"or.so", &OR::GetPluginInformation},
+	{"xor.so", &XOR::GetPluginInformation},
+	{"xnor.so", &XNOR::GetPluginInformation}
+	// biochemical domain is still to come
+};
+
+StaticGetPluginInformation PluginConnectorDummyImpl1::_registered(const std::string filename) {
+	// the table is constant, so its index is built at the first connection and then shared (C++14 has no constant hash tables)
+	static const std::unordered_map<std::string, StaticGetPluginInformation> index = [] {
+		std::unordered_map<std::string, StaticGetPluginInformation> registrations;
+		for (const Registration& registration : _registrations) {
+			registrations.insert({registration.dynamicLibraryFilename, registration.getInformation});
+		}
+		return registrations;
+	}();
+	std::unordered_map<std::string, StaticGetPluginInformation>::const_iterator it = index.find(filename);
+	return it != index.end() ? it->second : nullptr;
 }
 
 Plugin* PluginConnectorDummyImpl1::connect(const std::string dynamicLibraryFilename) {
-	std::string fn = Util::FilenameFromFullFilename(dynamicLibraryFilename);
-	StaticGetPluginInformation GetInfo = nullptr;
-    // @TODO: Dummy connections basically does nothing but give access to PluginInformation already compiled
-
-    GetInfo = this->_connectBasic(fn);
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectDiscrete(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectContinuos(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectTransfer(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectIntegrations(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectInputOutput(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectNetwork(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectElectronicDomain(fn);
-    }
-    if (GetInfo==nullptr) {
-        GetInfo = this->_connectBiochemicalDomain(fn);
-    }
-
-    Plugin* pluginResult = nullptr;
-    if (GetInfo != nullptr) {
+	// @TODO: Dummy connections basically does nothing but give access to PluginInformation already compiled
+	StaticGetPluginInformation GetInfo = _registered(Util::FilenameFromFullFilename(dynamicLibraryFilename));
+	Plugin* pluginResult = nullptr;
+	if (GetInfo != nullptr) {
 		pluginResult = new Plugin(GetInfo);
-    }
+	}
 	return pluginResult;
 }
 
-
-
 //namespace\\}
@@ -27,16 +27,13 @@ public:
 	virtual bool disconnect(const std::string dynamicLibraryFilename);
 	virtual bool disconnect(Plugin* plugin);
 private:
-    //StaticGetPluginInformation _connectModelDefinitions(const std::string fn);
-    StaticGetPluginInformation _connectBasic(const std::string fn);
-    StaticGetPluginInformation _connectContinuos(const std::string fn);
-    StaticGetPluginInformation _connectDiscrete(const std::string fn);
-    StaticGetPluginInformation _connectInputOutput(const std::string fn);
-    StaticGetPluginInformation _connectIntegrations(const std::string fn);
-    StaticGetPluginInformation _connectNetwork(const std::string fn);
-    StaticGetPluginInformation _connectTransfer(const std::string fn);
-    StaticGetPluginInformation _connectElectronicDomain(const std::string fn);
-    StaticGetPluginInformation _connectBiochemicalDomain(const std::string fn);
+
+	struct Registration {
+		const char* dynamicLibraryFilename;
+		StaticGetPluginInformation getInformation;
+	};
+	static const Registration _registrations[]; //!< Plugins compiled with the kernel, by the filename of their dynamic library, grouped by domain
+	static StaticGetPluginInformation _registered(const std::string filename); //!< Finds a plugin of the table by a hash index, built once for every connector
 };
 //namespace\\}
 #endif /* PLUGINCONNECTORDUMMYIMPL1_H */
@@ -179,7 +179,8 @@ void PluginInformation::setFields(std::map<std::string, std::string>* _fields) {
 	this->_fields = _fields;
 }
 
-std::map<std::string, std::string>* PluginInformation::getFields() const {
+std::map<std::string, std::string>* PluginInformation::getFields() {
+	_complete();
 	return _fields;
 }
 
@@ -187,10 +188,23 @@ void PluginInformation::setLanguageTemplate(std::string _languageTemplate) {
 	this->_languageTemplate = _languageTemplate;
 }
 
-std::string PluginInformation::getLanguageTemplate() const {
+std::string PluginInformation::getLanguageTemplate() {
+	_complete();
 	return _languageTemplate;
 }
 
+void PluginInformation::setCompleter(PluginInformationCompleter completer) {
+	_completer = completer;
+}
+
+void PluginInformation::_complete() {
+	if (_completer != nullptr) {
+		PluginInformationCompleter completer = _completer;
+		_completer = nullptr; // the completer itself gets fields and template
+		completer(this);
+	}
+}
+
 void PluginInformation::setCategory(std::string _category) {
 	this->_category = _category;
 }
@@ -17,6 +17,7 @@
 #include <map>
 #include <list>
 #include <string>
+#include <functional>
 
 //namespace GenesysKernel {
 class ModelDataDefinition;
@@ -30,6 +31,7 @@ typedef ModelDataDefinition* (*StaticLoaderDataDefinitionInstance)(Model*, Persi
 typedef ModelDataDefinition* (*StaticConstructorDataDefinitionInstance)(Model*, std::string);
 class PluginInformation;
 typedef PluginInformation* (*StaticGetPluginInformation)();
+typedef std::function<void(PluginInformation*)> PluginInformationCompleter;
 
 class PluginInformation {
 public:
@@ -75,12 +77,14 @@ public:
 	void setDescriptionHelp(std::string _descriptionHelp);
 	std::string getDescriptionHelp() const;
 	void setFields(std::map<std::string, std::string>* _fiewlds);
-	std::map<std::string, std::string>* getFields() const;
+	std::map<std::string, std::string>* getFields(); //!< Completed at the first use, if there is a completer
 	void setLanguageTemplate(std::string _languageTemplate);
-	std::string getLanguageTemplate() const;
+	std::string getLanguageTemplate(); //!< Completed at the first use, if there is a completer
+	void setCompleter(PluginInformationCompleter completer); //!< Completes fields and language template when they are first used, instead of when the plugin is inserted
 	void setCategory(std::string _category);
 	std::string getCategory() const;
-public:
+private:
+	void _complete();
 private:
 	std::string _author = "prof. Dr. Ing. Rafael Luiz Cancian";
 	std::string _date = "01/08/2018";
@@ -106,6 +110,7 @@ private:
 	StaticLoaderComponentInstance _componentloader;
 	StaticLoaderDataDefinitionInstance _elementloader;
 	StaticConstructorDataDefinitionInstance _elementConstructor;
+	PluginInformationCompleter _completer = nullptr;
 };
 //namespace\\}
 
@@ -52,7 +52,8 @@ bool PluginManager::autoInsertPlugins(const std::string pluginsListFilename) {
 			}
 		}
 		file.close();
-		completePluginsFieldsAndTemplates();
+		// fields and templates of plugins are completed when first used, but models still number elements of each type from the first
+		Util::ResetAllIds();
 	} else {
 		_simulator->getTraceManager()->traceError("Could not open file \""+pluginsListFilename+"\" (\""+fullFilename+"\")");
 		return false;
@@ -73,13 +74,21 @@ std::string PluginManager::show() {
 void PluginManager::_insertDefaultKernelElements() {
 	StaticGetPluginInformation GetInfo;
 	GetInfo = &EntityType::GetPluginInformation;
-	_plugins->insert(new Plugin(GetInfo));
+	_indexAndComplete(new Plugin(GetInfo));
 	GetInfo = &Attribute::GetPluginInformation;
-	_plugins->insert(new Plugin(GetInfo));
+	_indexAndComplete(new Plugin(GetInfo));
 	GetInfo = &Counter::GetPluginInformation;
-	_plugins->insert(new Plugin(GetInfo));
+	_indexAndComplete(new Plugin(GetInfo));
 	GetInfo = &StatisticsCollector::GetPluginInformation;
-	_plugins->insert(new Plugin(GetInfo));
+	_indexAndComplete(new Plugin(GetInfo));
+}
+
+void PluginManager::_indexAndComplete(Plugin* plugin) {
+	_plugins->insert(plugin);
+	_pluginsByTypename[plugin->getPluginInfo()->getPluginTypename()] = plugin;
+	plugin->getPluginInfo()->setCompleter([this](PluginInformation * info) {
+		_simulator->_completePluginFieldsAndTemplate(info);
+	});
 }
 
 bool PluginManager::completePluginsFieldsAndTemplates() {
@@ -126,7 +135,7 @@ bool PluginManager::_insert(Plugin * plugin) {
 			Util::DecIndent();
 			return false;
 		}
-		_plugins->insert(plugin);
+		_indexAndComplete(plugin);
 		Util::IncIndent();
 		this->_simulator->getTraceManager()->trace(TraceManager::Level::L2_results, "Plugin successfully inserted");
 		Util::DecIndent();
@@ -151,30 +160,51 @@ bool PluginManager::check(std::string dynamicLibraryFilename) {
 }
 
 Plugin * PluginManager::insert(std::string dynamicLibraryFilename) {
+	const std::string filename = Util::FilenameFromFullFilename(dynamicLibraryFilename);
+	std::unordered_map<std::string, Plugin*>::iterator it = _pluginsByFilename.find(filename);
+	if (it != _pluginsByFilename.end()) { // already inserted, probably as a dependency of another plugin
+		return it->second;
+	}
 	Plugin* plugin;
 	try {
 		plugin = _pluginConnector->connect(dynamicLibraryFilename);
-		if (plugin != nullptr)
-			_insert(plugin);
-		else {
+		if (plugin != nullptr) {
+			const bool valid = plugin->isIsValidPlugin() && plugin->getPluginInfo() != nullptr;
+			const std::string pluginTypename = valid ? plugin->getPluginInfo()->getPluginTypename() : "";
+			if (_insert(plugin)) {
+				_pluginsByFilename[filename] = plugin;
+			} else if (valid) { // the same plugin was inserted from another dynamic library, or its dependencies were not
+				delete plugin;
+				plugin = find(pluginTypename);
+				if (plugin != nullptr) {
+					_pluginsByFilename[filename] = plugin;
+				}
+			} else {
+				plugin = nullptr; // invalid plugins were already deleted
+			}
+		} else {
 			_simulator->getTraceManager()->traceError("Plugin from file \"" + dynamicLibraryFilename + "\" could not be loaded.", TraceManager::Level::L3_errorRecover);
 		}
 	} catch (...) {
 
 		return nullptr;
 	}
-	return plugin; //@TODO Use of memory after it is freed
+	return plugin;
 }
 
 bool PluginManager::remove(std::string dynamicLibraryFilename) {
-
-	Plugin* pi = this->find(dynamicLibraryFilename);
+	std::unordered_map<std::string, Plugin*>::iterator it = _pluginsByFilename.find(Util::FilenameFromFullFilename(dynamicLibraryFilename));
+	Plugin* pi = it != _pluginsByFilename.end() ? it->second : this->find(dynamicLibraryFilename);
 	return remove(pi);
 }
 
 bool PluginManager::remove(Plugin * plugin) {
 	if (plugin != nullptr) {
 		_plugins->remove(plugin);
+		_pluginsByTypename.erase(plugin->getPluginInfo()->getPluginTypename());
+		for (std::unordered_map<std::string, Plugin*>::iterator it = _pluginsByFilename.begin(); it != _pluginsByFilename.end();) {
+			it = it->second == plugin ? _pluginsByFilename.erase(it) : std::next(it);
+		}
 		try {
 			_pluginConnector->disconnect(plugin);
 		} catch (...) {
@@ -188,13 +218,8 @@ bool PluginManager::remove(Plugin * plugin) {
 }
 
 Plugin * PluginManager::find(std::string pluginTypeName) {
-	for (std::list<Plugin*>::iterator it = this->_plugins->list()->begin(); it != _plugins->list()->end(); it++) {
-		if ((*it)->getPluginInfo()->getPluginTypename() == pluginTypeName) {
-
-			return (*it);
-		}
-	}
-	return nullptr;
+	std::unordered_map<std::string, Plugin*>::iterator it = _pluginsByTypename.find(pluginTypeName);
+	return it != _pluginsByTypename.end() ? it->second : nullptr;
 }
 
 Plugin * PluginManager::front() {
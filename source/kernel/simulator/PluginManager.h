@@ -14,6 +14,7 @@
 #ifndef PLUGINMANAGER_H
 #define PLUGINMANAGER_H
 
+#include <unordered_map>
 #include "../util/List.h"
 //#include "Simulator.h"
 #include "Plugin.h"
@@ -35,7 +36,7 @@ public:
 	Plugin* insert(const std::string dynamicLibraryFilename);
 	bool remove(const std::string dynamicLibraryFilename);
 	bool remove(Plugin* plugin);
-	Plugin* find(std::string pluginTypeName);
+	Plugin* find(std::string pluginTypeName); //!< By a hash index of typenames
 	bool autoInsertPlugins(const std::string pluginsListFilename);
 public:
 	Plugin* front();
@@ -48,17 +49,12 @@ public:
 
 	template <typename T>T* newInstance(Model* model, std::string name = "") {
 		name = Util::StrReplace(name, " ", "_");
-		Plugin* plugin;
-		std::string pluginTypename = Util::TypeOf<T>();
-		//@TODO: Use Find method??
-		for (unsigned short i = 0; i < _plugins->size(); i++) {
-			plugin = _plugins->getAtRank(i);
-			if (plugin->getPluginInfo()->getPluginTypename() == pluginTypename) {
-				T* instance;
-				StaticConstructorDataDefinitionInstance constructor = plugin->getPluginInfo()->getDataDefinitionConstructor();
-				instance = static_cast<T*> (constructor(model, name));
-				return instance;
-			}
+		Plugin* plugin = find(Util::TypeOf<T>());
+		if (plugin != nullptr) {
+			T* instance;
+			StaticConstructorDataDefinitionInstance constructor = plugin->getPluginInfo()->getDataDefinitionConstructor();
+			instance = static_cast<T*> (constructor(model, name));
+			return instance;
 		}
 		// innvalid use of incomplete class
 		///_simulator->getTracer()->traceError(TraceManager::Level::L1_errorFatal, "Error: Could not find any plugin with Typename \"" + pluginTypename + "\"");
@@ -67,8 +63,11 @@ public:
 private:
 	bool _insert(Plugin* plugin);
 	void _insertDefaultKernelElements();
+	void _indexAndComplete(Plugin* plugin); //!< Indexes an inserted plugin by its typename, and completes its fields and template when first used
 private:
 	List<Plugin*>* _plugins = new List<Plugin*>();
+	std::unordered_map<std::string, Plugin*> _pluginsByTypename;
+	std::unordered_map<std::string, Plugin*> _pluginsByFilename; //!< Plugins inserted from each dynamic library, also as dependencies, that are not connected again
 	Simulator* _simulator;
 	PluginConnector_if* _pluginConnector;
 };
@@ -160,6 +160,7 @@ public:
 public:
 	virtual std::string getValue() const override { return std::to_string(_getter()); }
     virtual void setValue(std::string value, bool remove=false) override { _setter(std::stod(value)); };
+	double getDoubleValue() const { return _getter(); } //!< The value with full precision (getValue() is limited to 6 decimal places)
 private:
 	GetterDouble _getter;
 	SetterDouble _setter;
@@ -0,0 +1,441 @@
+#include "SimulationResults.h"
+#include "ModelDataDefinition.h"
+#include "Counter.h"
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+const char SimulationResults::Magic[8] = {'G', 'E', 'N', 'R', 'S', 'L', 'T', 'S'};
+
+std::string SimulationResults::IndexFilename(std::string filename) {
+	return filename + ".index";
+}
+
+std::string SimulationResults::StatisticsKey(std::string name, std::string parentClassname, std::string parentName) {
+	return name + "\n" + parentClassname + "\n" + parentName;
+}
+
+//
+// SimulationResultsWriter
+//
+
+SimulationResultsWriter::SimulationResultsWriter(std::string filename) {
+	_filename = filename;
+}
+
+SimulationResultsWriter::~SimulationResultsWriter() {
+	close();
+}
+
+bool SimulationResultsWriter::open(std::string* errorMessage) {
+	close();
+	_idsByKey.clear();
+	std::ifstream existing(_filename, std::ifstream::binary | std::ifstream::ate);
+	const bool appending = existing.is_open() && existing.tellg() > 0;
+	existing.close();
+	if (appending) { // continue the ids of the statistics already there
+		SimulationResultsReader reader(_filename);
+		if (!reader.open(errorMessage)) {
+			return false;
+		}
+		for (const SimulationResults::Statistics& statistics : reader.getStatistics()) {
+			_idsByKey[SimulationResults::StatisticsKey(statistics.name, statistics.parentClassname, statistics.parentName)] = statistics.id;
+		}
+	}
+	_file.open(_filename, std::ofstream::binary | std::ofstream::out | std::ofstream::app);
+	_index.open(SimulationResults::IndexFilename(_filename), std::ofstream::out | std::ofstream::app);
+	if (!_file.is_open() || !_index.is_open()) {
+		errorMessage->append("Results file \"" + _filename + "\" could not be opened for writing. ");
+		close();
+		return false;
+	}
+	if (!appending) {
+		const unsigned int version = SimulationResults::Version;
+		_file.write(SimulationResults::Magic, sizeof (SimulationResults::Magic));
+		_file.write(reinterpret_cast<const char*> (&version), sizeof (version));
+		_file.flush();
+	}
+	return true;
+}
+
+void SimulationResultsWriter::close() {
+	if (_file.is_open()) {
+		_file.close();
+	}
+	if (_index.is_open()) {
+		_index.close();
+	}
+}
+
+bool SimulationResultsWriter::isOpen() const {
+	return _file.is_open();
+}
+
+std::string SimulationResultsWriter::getFilename() const {
+	return _filename;
+}
+
+unsigned int SimulationResultsWriter::identify(ModelDataDefinition* statisticsOrCounter, ModelDataDefinition* parent) {
+	return _identify(dynamic_cast<Counter*> (statisticsOrCounter) != nullptr, statisticsOrCounter->getName(),
+			parent != nullptr ? parent->getClassname() : "", parent != nullptr ? parent->getName() : "");
+}
+
+/*!
+ * Worker processes of an experiment write into files of their own, which are appended by the parent process when they finish, so a
+ * results file is never written by more than one process. Ids of the statistics of the other file are mapped to ids of this one.
+ */
+bool SimulationResultsWriter::append(std::string filename, std::string* errorMessage) {
+	SimulationResultsReader reader(filename);
+	if (!reader.open(errorMessage)) {
+		return false;
+	}
+	std::vector<unsigned int> ids;
+	for (const SimulationResults::Statistics& statistics : reader.getStatistics()) {
+		ids.push_back(_identify(statistics.counter, statistics.name, statistics.parentClassname, statistics.parentName));
+	}
+	SimulationResults::Chunk chunk;
+	for (unsigned int index = 0; index < reader.getNumberOfChunks(); index++) {
+		if (!reader.readChunk(index, &chunk)) {
+			errorMessage->append("Results file \"" + filename + "\" is corrupted. ");
+			return false;
+		}
+		beginChunk(chunk.info.type, chunk.info.label, chunk.info.replication);
+		for (unsigned int row = 0; row < chunk.info.rows; row++) {
+			if (chunk.ids[row] >= ids.size()) {
+				errorMessage->append("Results file \"" + filename + "\" is corrupted. ");
+				return false;
+			}
+			addRow(ids[chunk.ids[row]], chunk.columns[0][row], chunk.columns[1][row], chunk.columns[2][row], chunk.columns[3][row],
+					chunk.columns[4][row], chunk.columns[5][row], chunk.columns[6][row], chunk.columns[7][row]);
+		}
+		endChunk();
+	}
+	return true;
+}
+
+unsigned int SimulationResultsWriter::_identify(bool counter, std::string name, std::string parentClassname, std::string parentName) {
+	const std::string key = SimulationResults::StatisticsKey(name, parentClassname, parentName);
+	std::map<std::string, unsigned int>::iterator it = _idsByKey.find(key);
+	if (it != _idsByKey.end()) {
+		return it->second;
+	}
+	const unsigned int id = _idsByKey.size();
+	_idsByKey[key] = id;
+	const char type = static_cast<char> (SimulationResults::BlockType::statistics);
+	const char isCounter = counter;
+	const std::streamoff offset = _file.tellp();
+	_file.write(&type, 1);
+	_file.write(reinterpret_cast<const char*> (&id), sizeof (id));
+	_file.write(&isCounter, 1);
+	_writeString(name);
+	_writeString(parentClassname);
+	_writeString(parentName);
+	_file.flush();
+	_writeIndex(SimulationResults::BlockType::statistics, offset, id, 0, name);
+	return id;
+}
+
+void SimulationResultsWriter::beginChunk(SimulationResults::BlockType type, std::string label, unsigned int replication) {
+	_chunkType = type;
+	_chunkLabel = label;
+	_chunkReplication = replication;
+	_ids.clear();
+	for (std::vector<double>& column : _columns) {
+		column.clear();
+	}
+}
+
+void SimulationResultsWriter::endChunk() {
+	const char type = static_cast<char> (_chunkType);
+	const unsigned int rows = _ids.size();
+	const std::streamoff offset = _file.tellp();
+	_file.write(&type, 1);
+	_writeString(_chunkLabel);
+	_file.write(reinterpret_cast<const char*> (&_chunkReplication), sizeof (_chunkReplication));
+	_file.write(reinterpret_cast<const char*> (&rows), sizeof (rows));
+	_file.write(reinterpret_cast<const char*> (_ids.data()), rows * sizeof (unsigned int));
+	for (const std::vector<double>& column : _columns) {
+		_file.write(reinterpret_cast<const char*> (column.data()), rows * sizeof (double));
+	}
+	_file.flush();
+	_writeIndex(_chunkType, offset, _chunkReplication, rows, _chunkLabel);
+}
+
+void SimulationResultsWriter::_writeString(std::string text) {
+	const unsigned int length = text.length();
+	_file.write(reinterpret_cast<const char*> (&length), sizeof (length));
+	_file.write(text.data(), length);
+}
+
+void SimulationResultsWriter::_writeIndex(SimulationResults::BlockType type, std::streamoff offset, unsigned int replication, unsigned int rows, std::string label) {
+	for (char& c : label) {
+		if (c == '\n' || c == '\r') {
+			c = ' ';
+		}
+	}
+	_index << static_cast<char> (type) << ";" << offset << ";" << _file.tellp() << ";" << replication << ";" << rows << ";" << label << "\n";
+	_index.flush();
+}
+
+//
+// SimulationResultsReader
+//
+
+SimulationResultsReader::SimulationResultsReader(std::string filename) {
+	_filename = filename;
+}
+
+bool SimulationResultsReader::open(std::string* errorMessage) {
+	_statistics.clear();
+	_idsByName.clear();
+	_chunks.clear();
+	_file.close();
+	_file.clear();
+	_file.open(_filename, std::ifstream::binary | std::ifstream::in);
+	if (!_file.is_open()) {
+		errorMessage->append("Results file \"" + _filename + "\" could not be opened. ");
+		return false;
+	}
+	char magic[sizeof (SimulationResults::Magic)];
+	unsigned int version = 0;
+	_file.read(magic, sizeof (magic));
+	_file.read(reinterpret_cast<char*> (&version), sizeof (version));
+	if (!_file || std::memcmp(magic, SimulationResults::Magic, sizeof (magic)) != 0 || version != SimulationResults::Version) {
+		errorMessage->append("File \"" + _filename + "\" is not a results file of this version. ");
+		return false;
+	}
+	const std::streamoff begin = _file.tellg();
+	_file.seekg(0, std::ifstream::end);
+	const std::streamoff end = _file.tellg();
+	if (!_readIndex()) { // no index, or it does not cover the file (as when a simulation was interrupted)
+		_statistics.clear();
+		_idsByName.clear();
+		_chunks.clear();
+		if (!_scan(begin, end)) {
+			errorMessage->append("Results file \"" + _filename + "\" is corrupted. ");
+			return false;
+		}
+	}
+	return true;
+}
+
+const std::vector<SimulationResults::Statistics>& SimulationResultsReader::getStatistics() const {
+	return _statistics;
+}
+
+int SimulationResultsReader::getStatisticsId(std::string name) const {
+	std::map<std::string, unsigned int>::const_iterator it = _idsByName.find(name);
+	return it == _idsByName.end() ? -1 : (int) it->second;
+}
+
+int SimulationResultsReader::getStatisticsId(std::string name, std::string parentClassname, std::string parentName) const {
+	for (const SimulationResults::Statistics& statistics : _statistics) {
+		if (statistics.name == name && statistics.parentClassname == parentClassname && statistics.parentName == parentName) {
+			return statistics.id;
+		}
+	}
+	return -1;
+}
+
+std::vector<std::string> SimulationResultsReader::getLabels() const {
+	std::vector<std::string> labels;
+	for (const SimulationResults::ChunkInfo& info : _chunks) {
+		bool found = false;
+		for (const std::string& label : labels) {
+			if (label == info.label) {
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			labels.push_back(info.label);
+		}
+	}
+	return labels;
+}
+
+unsigned int SimulationResultsReader::getNumberOfChunks() const {
+	return _chunks.size();
+}
+
+const SimulationResults::ChunkInfo& SimulationResultsReader::getChunkInfo(unsigned int index) const {
+	return _chunks[index];
+}
+
+bool SimulationResultsReader::readChunk(unsigned int index, SimulationResults::Chunk* chunk) {
+	const SimulationResults::ChunkInfo& info = _chunks[index];
+	chunk->info = info;
+	chunk->ids.resize(info.rows);
+	_file.clear();
+	_file.seekg(info.dataOffset);
+	_file.read(reinterpret_cast<char*> (chunk->ids.data()), info.rows * sizeof (unsigned int));
+	for (std::vector<double>& column : chunk->columns) {
+		column.resize(info.rows);
+		_file.read(reinterpret_cast<char*> (column.data()), info.rows * sizeof (double));
+	}
+	return (bool) _file;
+}
+
+std::vector<double> SimulationResultsReader::getReplicationValues(std::string label, std::string statisticsName, SimulationResults::Column column) {
+	std::vector<double> values;
+	const int id = getStatisticsId(statisticsName);
+	if (id < 0) {
+		return values;
+	}
+	double value;
+	for (const SimulationResults::ChunkInfo& info : _chunks) {
+		if (info.type == SimulationResults::BlockType::replication && info.label == label && _readValue(info, id, column, &value)) {
+			values.push_back(value);
+		}
+	}
+	return values;
+}
+
+double SimulationResultsReader::getSimulationValue(std::string label, std::string statisticsName, SimulationResults::Column column) {
+	double value = std::numeric_limits<double>::quiet_NaN();
+	const int id = getStatisticsId(statisticsName);
+	if (id < 0) {
+		return value;
+	}
+	for (std::vector<SimulationResults::ChunkInfo>::reverse_iterator it = _chunks.rbegin(); it != _chunks.rend(); it++) {
+		if (it->type == SimulationResults::BlockType::simulation && it->label == label && _readValue(*it, id, column, &value)) {
+			break;
+		}
+	}
+	return value;
+}
+
+/*!
+ * Takes the chunks from the index, with no need to read them, as long as the blocks listed in the index follow each other up to the end
+ * of the file. Statistics blocks are few, and are read.
+ */
+bool SimulationResultsReader::_readIndex() {
+	std::ifstream index(SimulationResults::IndexFilename(_filename));
+	if (!index.is_open()) {
+		return false;
+	}
+	_file.clear();
+	_file.seekg(0, std::ifstream::end);
+	const std::streamoff fileEnd = _file.tellg();
+	std::streamoff end = sizeof (SimulationResults::Magic) + sizeof (unsigned int);
+	std::string line;
+	try {
+		while (std::getline(index, line)) {
+			std::istringstream fields(line);
+			std::string type, offset, blockEnd, replication, rows, label;
+			if (!std::getline(fields, type, ';') || !std::getline(fields, offset, ';') || !std::getline(fields, blockEnd, ';')
+					|| !std::getline(fields, replication, ';') || !std::getline(fields, rows, ';') || type.length() != 1 || std::stoll(offset) != end) {
+				return false;
+			}
+			std::getline(fields, label);
+			const std::streamoff next = std::stoll(blockEnd);
+			if (type[0] == static_cast<char> (SimulationResults::BlockType::statistics)) {
+				std::streamoff statisticsEnd;
+				if (!_readBlockAt(end, &statisticsEnd) || statisticsEnd != next) {
+					return false;
+				}
+			} else if (type[0] == static_cast<char> (SimulationResults::BlockType::replication) || type[0] == static_cast<char> (SimulationResults::BlockType::simulation)) {
+				SimulationResults::ChunkInfo info;
+				info.type = static_cast<SimulationResults::BlockType> (type[0]);
+				info.label = label;
+				info.replication = std::stoul(replication);
+				info.rows = std::stoul(rows);
+				info.dataOffset = end + 1 + 3 * sizeof (unsigned int) + label.length();
+				if (info.dataOffset + (std::streamoff) (info.rows * (sizeof (unsigned int) + SimulationResults::NumberOfColumns * sizeof (double))) != next) {
+					return false;
+				}
+				_chunks.push_back(info);
+			} else {
+				return false;
+			}
+			end = next;
+		}
+	} catch (...) { // a number could not be converted
+		return false;
+	}
+	return end == fileEnd;
+}
+
+bool SimulationResultsReader::_scan(std::streamoff from, std::streamoff end) {
+	std::streamoff next;
+	while (from < end) {
+		if (!_readBlockAt(from, &next)) {
+			return false;
+		}
+		from = next;
+	}
+	return true;
+}
+
+/*!
+ * Reads the header of the block at the offset (and the whole block, if it is a statistics one) and keeps it
+ */
+bool SimulationResultsReader::_readBlockAt(std::streamoff offset, std::streamoff* next) {
+	_file.clear();
+	_file.seekg(offset);
+	char type;
+	_file.read(&type, 1);
+	if (type == static_cast<char> (SimulationResults::BlockType::statistics)) {
+		SimulationResults::Statistics statistics;
+		char counter;
+		_file.read(reinterpret_cast<char*> (&statistics.id), sizeof (statistics.id));
+		_file.read(&counter, 1);
+		statistics.counter = counter != 0;
+		statistics.name = _readString();
+		statistics.parentClassname = _readString();
+		statistics.parentName = _readString();
+		if (!_file || statistics.id != _statistics.size()) {
+			return false;
+		}
+		_statistics.push_back(statistics);
+		_idsByName.insert({statistics.name, statistics.id}); // the first one with the name
+		*next = _file.tellg();
+		return true;
+	}
+	if (type != static_cast<char> (SimulationResults::BlockType::replication) && type != static_cast<char> (SimulationResults::BlockType::simulation)) {
+		return false;
+	}
+	SimulationResults::ChunkInfo info;
+	info.type = static_cast<SimulationResults::BlockType> (type);
+	info.label = _readString();
+	_file.read(reinterpret_cast<char*> (&info.replication), sizeof (info.replication));
+	_file.read(reinterpret_cast<char*> (&info.rows), sizeof (info.rows));
+	if (!_file) {
+		return false;
+	}
+	info.dataOffset = _file.tellg();
+	_chunks.push_back(info);
+	*next = info.dataOffset + (std::streamoff) info.rows * (sizeof (unsigned int) + SimulationResults::NumberOfColumns * sizeof (double));
+	return true;
+}
+
+/*!
+ * Finds the row of the statistics in the ids of the chunk, and then reads only its value in the column
+ */
+bool SimulationResultsReader::_readValue(const SimulationResults::ChunkInfo& info, unsigned int id, SimulationResults::Column column, double* value) {
+	std::vector<unsigned int> ids(info.rows);
+	_file.clear();
+	_file.seekg(info.dataOffset);
+	_file.read(reinterpret_cast<char*> (ids.data()), info.rows * sizeof (unsigned int));
+	for (unsigned int row = 0; row < info.rows; row++) {
+		if (ids[row] == id) {
+			const std::streamoff columnOffset = info.rows * sizeof (unsigned int) + (std::streamoff) static_cast<unsigned int> (column) * info.rows * sizeof (double);
+			_file.seekg(info.dataOffset + columnOffset + row * sizeof (double));
+			_file.read(reinterpret_cast<char*> (value), sizeof (double));
+			return (bool) _file;
+		}
+	}
+	return false;
+}
+
+std::string SimulationResultsReader::_readString() {
+	unsigned int length = 0;
+	_file.read(reinterpret_cast<char*> (&length), sizeof (length));
+	if (!_file || length > 1 << 20) {
+		_file.setstate(std::ifstream::failbit);
+		return "";
+	}
+	std::string text(length, '\0');
+	_file.read(&text[0], length);
+	return text;
+}
@@ -0,0 +1,147 @@
+#ifndef SIMULATIONRESULTS_H
+#define SIMULATIONRESULTS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include "../statistics/Statistics_if.h"
+
+class ModelDataDefinition;
+
+/*!
+ * Results of simulations stored in an append-only file, so tools (such as experiments and factorial designs) can read statistics of
+ * many replications and scenarios without scraping reports. The file starts with a header and is a sequence of blocks:
+ *  - a statistics block ('N') gives an id to a StatisticsCollector or Counter, identified by its name, parent classname and parent name;
+ *  - a replication block ('R') or a simulation block ('S') is a chunk of rows of a scenario (a label), stored by columns: the ids of
+ *    the statistics of its rows, then the values of each column for every row.
+ * Numbers are binary in the byte order of the machine, and strings are preceded by their length. Each block is also listed in a
+ * text index (the filename followed by ".index"), with a line "type;offset;end;replication;rows;label", so a single value can be
+ * read seeking straight to its column.
+ */
+class SimulationResults {
+public:
+
+	enum class Column : unsigned int {
+		elements = 0, min = 1, max = 2, average = 3, variance = 4, stddeviation = 5, variationCoef = 6, halfWidth = 7
+	};
+	static const unsigned int NumberOfColumns = 8;
+
+	enum class BlockType : char {
+		statistics = 'N', replication = 'R', simulation = 'S'
+	};
+
+	struct Statistics {
+		unsigned int id;
+		bool counter;
+		std::string name;
+		std::string parentClassname;
+		std::string parentName;
+	};
+
+	struct ChunkInfo {
+		BlockType type;
+		std::string label;
+		unsigned int replication; //!< 0 for simulation chunks
+		unsigned int rows;
+		std::streamoff dataOffset; //!< where the ids of the rows start
+	};
+
+	struct Chunk {
+		ChunkInfo info;
+		std::vector<unsigned int> ids;
+		std::vector<double> columns[NumberOfColumns];
+	};
+public:
+	static const char Magic[8];
+	static const unsigned int Version = 1;
+	static std::string IndexFilename(std::string filename);
+	static std::string StatisticsKey(std::string name, std::string parentClassname, std::string parentName);
+};
+
+/*!
+ * Streams chunks of results to a SimulationResults file. Rows are kept by columns in memory until the chunk ends, and then each
+ * column is written at once, with no text formatting. Opening an existing file appends to it, keeping the ids of its statistics.
+ */
+class SimulationResultsWriter {
+public:
+	SimulationResultsWriter(std::string filename);
+	virtual ~SimulationResultsWriter();
+public:
+	bool open(std::string* errorMessage);
+	void close();
+	bool isOpen() const;
+	std::string getFilename() const;
+public:
+	unsigned int identify(ModelDataDefinition* statisticsOrCounter, ModelDataDefinition* parent); //!< Id of a StatisticsCollector or Counter, written as a new statistics block the first time it (its name and parent) is seen
+	bool append(std::string filename, std::string* errorMessage); //!< Appends the chunks of another results file (such as the one of a worker process), identifying its statistics again
+	void beginChunk(SimulationResults::BlockType type, std::string label, unsigned int replication);
+	inline void addRow(unsigned int id, Statistics_if* statistics) {
+		addRow(id, statistics->numElements(), statistics->min(), statistics->max(), statistics->average(), statistics->variance(),
+				statistics->stddeviation(), statistics->variationCoef(), statistics->halfWidthConfidenceInterval());
+	}
+	inline void addRow(unsigned int id, double count) { //!< a Counter in a replication
+		addRow(id, 1, count, count, count, 0.0, 0.0, 0.0, 0.0);
+	}
+	inline void addRow(unsigned int id, double elements, double min, double max, double average, double variance, double stddeviation, double variationCoef, double halfWidth) {
+		_ids.push_back(id);
+		_columns[0].push_back(elements);
+		_columns[1].push_back(min);
+		_columns[2].push_back(max);
+		_columns[3].push_back(average);
+		_columns[4].push_back(variance);
+		_columns[5].push_back(stddeviation);
+		_columns[6].push_back(variationCoef);
+		_columns[7].push_back(halfWidth);
+	}
+	void endChunk(); //!< Writes the chunk and its index line, and flushes both, so results of finished replications survive a crash
+private:
+	unsigned int _identify(bool counter, std::string name, std::string parentClassname, std::string parentName);
+	void _writeString(std::string text);
+	void _writeIndex(SimulationResults::BlockType type, std::streamoff offset, unsigned int replication, unsigned int rows, std::string label);
+private:
+	std::string _filename;
+	std::ofstream _file;
+	std::ofstream _index;
+	std::map<std::string, unsigned int> _idsByKey; //!< ids by SimulationResults::StatisticsKey
+	SimulationResults::BlockType _chunkType;
+	std::string _chunkLabel;
+	unsigned int _chunkReplication = 0;
+	std::vector<unsigned int> _ids;
+	std::vector<double> _columns[SimulationResults::NumberOfColumns];
+};
+
+/*!
+ * Reads a SimulationResults file through its index (or scanning its blocks, if the index is missing or does not cover the file).
+ * Chunks are read whole or, for a single statistics, only the column of interest.
+ */
+class SimulationResultsReader {
+public:
+	SimulationResultsReader(std::string filename);
+	virtual ~SimulationResultsReader() = default;
+public:
+	bool open(std::string* errorMessage);
+	const std::vector<SimulationResults::Statistics>& getStatistics() const;
+	int getStatisticsId(std::string name) const; //!< The first statistics with such name (of any parent), or -1 if there is none
+	int getStatisticsId(std::string name, std::string parentClassname, std::string parentName) const; //!< -1 if there is no such statistics
+	std::vector<std::string> getLabels() const; //!< Labels (scenarios) in the order they were first written
+	unsigned int getNumberOfChunks() const;
+	const SimulationResults::ChunkInfo& getChunkInfo(unsigned int index) const;
+	bool readChunk(unsigned int index, SimulationResults::Chunk* chunk);
+	std::vector<double> getReplicationValues(std::string label, std::string statisticsName, SimulationResults::Column column = SimulationResults::Column::average); //!< One value per replication of the scenario, in the order they were simulated
+	double getSimulationValue(std::string label, std::string statisticsName, SimulationResults::Column column = SimulationResults::Column::average); //!< The value of the last simulation of the scenario, or NaN
+private:
+	bool _readIndex();
+	bool _scan(std::streamoff from, std::streamoff end);
+	bool _readBlockAt(std::streamoff offset, std::streamoff* next);
+	bool _readValue(const SimulationResults::ChunkInfo& info, unsigned int id, SimulationResults::Column column, double* value);
+	std::string _readString();
+private:
+	std::string _filename;
+	std::ifstream _file;
+	std::vector<SimulationResults::Statistics> _statistics;
+	std::map<std::string, unsigned int> _idsByName;
+	std::vector<SimulationResults::ChunkInfo> _chunks;
+};
+
+#endif /* SIMULATIONRESULTS_H */
@@ -12,14 +12,110 @@
  */
 
 #include "SimulationScenario.h"
+#include <memory>
 
 SimulationScenario::SimulationScenario() = default;
 
 bool SimulationScenario::startSimulation(Simulator *sim, std::string* errorMessage) {
-	// @TODO: To implement!
-	// *Simulator??????s
 	*errorMessage = ""; // just clean the error message
-	return false;
+	// the scenario runs under the trace level of the caller, not the one saved into the model file
+	TraceManager::Level traceLevel = sim->getTraceManager()->getTraceLevel();
+	std::unique_ptr<Model> ownedModel(new Model(sim)); // deleted on every return
+	Model* model = ownedModel.get();
+	bool loaded = model->load(_modelFilename);
+	sim->getTraceManager()->setTraceLevel(traceLevel);
+	if (!loaded) {
+		*errorMessage = "Model \"" + _modelFilename + "\" could not be loaded";
+		return false;
+	}
+	// set controls
+	for (std::pair<std::string, double>* controlValue : *_controlValues) {
+		SimulationControl* control = _findProperty(model->getControls(), controlValue->first);
+		if (control == nullptr) {
+			*errorMessage = "Control \"" + controlValue->first + "\" does not exist in model \"" + _modelFilename + "\"";
+			return false;
+		}
+		if (control->isReadOnly()) {
+			*errorMessage = "Control \"" + controlValue->first + "\" is read only";
+			return false;
+		}
+		control->setValue(Util::StrTruncIfInt(std::to_string(controlValue->second)));
+	}
+	// results written into a results file (if the model has one) are identified by the scenario
+	if (_scenarioName != "") {
+		model->getSimulation()->setResultsLabel(_scenarioName);
+	}
+	_modelResultsFilename = model->getSimulation()->getResultsFilename();
+	if (_modelResultsFilename != "" && _resultsFilename != "") {
+		model->getSimulation()->setResultsFilename(_resultsFilename);
+	}
+	// simulate. Selected responses are also collected at the end of each replication
+	_responseValues->clear();
+	_replicationResponseValues->clear();
+	if (!_selectedResponses->empty()) {
+		_model = model;
+		model->getOnEventManager()->addOnReplicationEndHandler(this, &SimulationScenario::_onReplicationEnd);
+	}
+	model->getSimulation()->start();
+	_model = nullptr;
+	// get responses. If a response is not selected, all of them are collected
+	if (_selectedResponses->empty()) {
+		for (SimulationControl* response : *model->getResponses()->list()) {
+			std::string name = response->getElementName() + "." + response->getName();
+			if (_findProperty(model->getResponses(), name) == response) { // only the last one with such a name (see _findProperty)
+				setResponseValue(name, _propertyValue(response));
+			}
+		}
+	} else {
+		for (std::string name : *_selectedResponses) {
+			SimulationControl* response = _findProperty(model->getResponses(), name);
+			if (response == nullptr) {
+				*errorMessage = "Response \"" + name + "\" does not exist in model \"" + _modelFilename + "\"";
+				return false;
+			}
+			setResponseValue(name, _propertyValue(response));
+		}
+	}
+	return true;
+}
+
+/*!
+ * Finds a control or a response by its "ElementName.PropertyName". Statistics for the whole simulation are created after those of
+ * replications and share their names, so by default the LAST property with such name is returned, ie, the one that refers to all
+ * replications. The first one refers to the current replication.
+ */
+SimulationControl* SimulationScenario::_findProperty(List<SimulationControl*>* properties, const std::string& name, bool last) const {
+	SimulationControl* found = nullptr;
+	for (SimulationControl* property : *properties->list()) {
+		if (property->getElementName() + "." + property->getName() == name) {
+			found = property;
+			if (!last) {
+				break;
+			}
+		}
+	}
+	return found;
+}
+
+void SimulationScenario::_onReplicationEnd(SimulationEvent*) {
+	for (std::string name : *_selectedResponses) {
+		SimulationControl* response = _findProperty(_model->getResponses(), name, false);
+		if (response != nullptr) {
+			addReplicationResponseValue(name, _propertyValue(response));
+		}
+	}
+}
+
+double SimulationScenario::_propertyValue(SimulationControl* property) const {
+	SimulationControlDouble* propertyDouble = dynamic_cast<SimulationControlDouble*> (property);
+	if (propertyDouble != nullptr) {
+		return propertyDouble->getDoubleValue();
+	}
+	try {
+		return std::stod(property->getValue());
+	} catch (...) {
+		return 0.0;
+	}
 }
 
 void SimulationScenario::setScenarioName(std::string _name) {
@@ -38,6 +134,18 @@ std::string SimulationScenario::getModelFilename() const {
 	return _modelFilename;
 }
 
+void SimulationScenario::setResultsFilename(std::string resultsFilename) {
+	_resultsFilename = resultsFilename;
+}
+
+std::string SimulationScenario::getResultsFilename() const {
+	return _resultsFilename;
+}
+
+std::string SimulationScenario::getModelResultsFilename() const {
+	return _modelResultsFilename;
+}
+
 std::list<std::string>* SimulationScenario::getSelectedResponses() const {
 	return _selectedResponses;
 }
@@ -58,6 +166,14 @@ std::list<std::pair<std::string, double> *> *SimulationScenario::getResponseValu
 	return _responseValues;
 }
 
+void SimulationScenario::addReplicationResponseValue(std::string name, double value) const {
+	_replicationResponseValues->push_back(new std::pair<std::string, double>(name, value));
+}
+
+std::list<std::pair<std::string, double> *> *SimulationScenario::getReplicationResponseValues() const {
+	return _replicationResponseValues;
+}
+
 std::list<std::pair<std::string, double> *> *SimulationScenario::getControlValues() const {
 	return _controlValues;
 }
@@ -80,6 +196,16 @@ double SimulationScenario::getControlValue(const std::string& controlName) {
 	throw std::invalid_argument("Control does not exist");
 }
 
+void SimulationScenario::setResponseValue(std::string name, double value) const {
+	for (auto const& r : *_responseValues) {
+		if (r->first == name) {
+			r->second = value;
+			return;
+		}
+	}
+	_responseValues->push_back(new std::pair<std::string, double>(name, value));
+}
+
 void SimulationScenario::setControl(std::string name, double value) const {
 	auto aux = new std::pair<std::string, double>(name, value);
 	_controlValues->push_back(aux);
@@ -27,8 +27,11 @@ public:
 	SimulationScenario();
 	virtual ~SimulationScenario() = default;
 public: // results
-	bool startSimulation(Simulator *sim, std::string* errorMessage);
+	bool startSimulation(Simulator *sim, std::string* errorMessage); //!< Loads its own instance of the model, applies the control values, simulates it and collects the selected responses
+	void setResponseValue(std::string name, double value) const;
 	std::list<std::pair<std::string, double>*>* getResponseValues() const; /*!< The final result of the simulationScenario */
+	void addReplicationResponseValue(std::string name, double value) const;
+	std::list<std::pair<std::string, double>*>* getReplicationResponseValues() const; /*!< Values of the selected responses at the end of each replication, in the order they were simulated */
 	std::list<std::pair<std::string, double>*>* getControlValues() const;
 	double getResponseValue(const std::string& responseName);
 public: // gets and sets
@@ -43,14 +46,25 @@ public: // gets and sets
 	std::list<std::string>* getSelectedResponses() const; // access to the list to insert or remove responses
 	void setSelectedControls(std::list<std::string>* selectedControls);
 	void setControl(std::string name, double value) const;
+	void setResultsFilename(std::string resultsFilename); //!< If not empty, results the model would write into its results file are written into this one instead
+	std::string getResultsFilename() const;
+	std::string getModelResultsFilename() const; //!< The results file of the model in the last simulation (empty if it has none)
+private:
+	SimulationControl* _findProperty(List<SimulationControl*>* properties, const std::string& name, bool last = true) const;
+	double _propertyValue(SimulationControl* property) const;
+	void _onReplicationEnd(SimulationEvent*);
 private:
 	std::string _scenarioName;
 	std::string _scenarioDescription;
 	std::string _modelFilename;
+	std::string _resultsFilename;
+	std::string _modelResultsFilename;
 	std::list<std::string>* _selectedControls = new std::list<std::string>(); /*!< a subset of SimulationControls available in the model (chosen by user)*/
 	std::list<std::string>* _selectedResponses = new std::list<std::string>(); /*!< a subset of SimulationResponses available in the model (chosen by user) */
-	std::list<std::pair<std::string, double>*>* _controlValues = reinterpret_cast<std::list<std::pair<std::string, double> *> *> (new std::list<std::pair<std::string, double>>());
-	std::list<std::pair<std::string, double>*>* _responseValues{}; /*!< stored values of the results returned by simulation <name of response, value returned>*/
+	std::list<std::pair<std::string, double>*>* _controlValues = new std::list<std::pair<std::string, double>*>(); /*!< <"ElementName.PropertyName" of a control, value to be set before simulating>*/
+	std::list<std::pair<std::string, double>*>* _responseValues = new std::list<std::pair<std::string, double>*>(); /*!< stored values of the results returned by simulation <"ElementName.PropertyName" of a response, value returned>*/
+	std::list<std::pair<std::string, double>*>* _replicationResponseValues = new std::list<std::pair<std::string, double>*>(); /*!< <"ElementName.PropertyName" of a selected response, value at the end of a replication>*/
+	Model* _model = nullptr; /*!< the model being simulated (only during startSimulation) */
 };
 
 #endif /* SIMULATIONSCENARIO_H */
@@ -90,58 +90,58 @@ LicenceManager* Simulator::getLicenceManager() const {
 }
 
 bool Simulator::_completePluginsFieldsAndTemplate() {
+	// plugins are completed when their fields or templates are first used, so this just uses them all
+	for (unsigned int i = 0; i < _pluginManager->size(); i++) {
+		_pluginManager->getAtRank(i)->getPluginInfo()->getFields();
+	}
+	return true;
+}
+
+void Simulator::_completePluginFieldsAndTemplate(PluginInformation* info) {
 	TraceManager::Level savedTraceLevel = _traceManager->getTraceLevel();
 	// this crap stuff should not been shown
-	_traceManager->trace("Completing plugins and templates", TraceManager::Level::L8_detailed);
+	_traceManager->trace("Completing plugin and template of \"" + info->getPluginTypename() + "\"", TraceManager::Level::L8_detailed);
 	_traceManager->setTraceLevel(TraceManager::Level::L0_noTraces); // this crap stuff should not been shown
-	Model* tempModel = new Model(this);
-	tempModel->getPersistence()->setOption(ModelPersistence_if::Options::SAVEDEFAULTS, true);
-	auto fields = std::make_unique<PersistenceRecord>(*tempModel->getPersistence());
-	Plugin* plugin;
-	PluginInformation* info;
-	//std::map<std::string, std::string>* fields = new std::map<std::string, std::string>();
+	// instances created to complete the plugin do not count in the ids of types of models
+	std::map<std::string, Util::identification> savedLastIdsOfTypes = Util::GetLastIdsOfTypes();
+	if (_pluginsModel == nullptr) {
+		_pluginsModel = new Model(this);
+		_pluginsModel->getPersistence()->setOption(ModelPersistence_if::Options::SAVEDEFAULTS, true);
+	}
+	auto fields = std::make_unique<PersistenceRecord>(*_pluginsModel->getPersistence());
 	ModelDataDefinition* datum;
 	ModelComponent* comp;
-	std::string text;
-	bool result = true;
-	for (unsigned int i = 0; i < _pluginManager->size(); i++) {
-		try {
-			plugin = _pluginManager->getAtRank(i);
-			info = plugin->getPluginInfo();
-			if (info->getFields()->size() == 0) {
-				fields->clear();
-				try {
-					if (info->isComponent()) {
-						comp = dynamic_cast<ModelComponent*> (plugin->loadNew(tempModel, fields.get()));
-						comp->setName("name");
-						while (comp->getConnectionManager()->size() < info->getMinimumOutputs()) {
-							comp->getConnectionManager()->insert(comp);
-						}
-						fields->clear();
-						comp->SaveInstance(fields.get(), comp);
-					} else {
-						datum = plugin->loadNew(tempModel, fields.get());
-						datum->setName("name");
-						fields->clear();
-						datum->SaveInstance(fields.get(), datum);
+	try {
+		if (info->getFields()->size() == 0) {
+			try {
+				if (info->isComponent()) {
+					comp = info->GetComponentLoader()(_pluginsModel, fields.get());
+					comp->setName("name");
+					while (comp->getConnectionManager()->size() < info->getMinimumOutputs()) {
+						comp->getConnectionManager()->insert(comp);
 					}
-				} catch (...) {
-					//@TODO
-					//std::cout << "ERROR completing plugin " << info->getPluginTypename() << std::endl;
-				}
-				for (auto& field : *fields.get()) {
-					info->getFields()->insert({field.first, ""});
-				}
-				if (info->getLanguageTemplate() == "") {
-					std::string templateLanguage = tempModel->getPersistence()->getFormatedField(fields.get());
-					info->setLanguageTemplate(templateLanguage);
+					fields->clear();
+					comp->SaveInstance(fields.get(), comp);
+				} else {
+					datum = info->getDataDefinitionLoader()(_pluginsModel, fields.get());
+					datum->setName("name");
+					fields->clear();
+					datum->SaveInstance(fields.get(), datum);
 				}
+			} catch (...) {
+				//@TODO
+				//std::cout << "ERROR completing plugin " << info->getPluginTypename() << std::endl;
+			}
+			for (auto& field : *fields.get()) {
+				info->getFields()->insert({field.first, ""});
+			}
+			if (info->getLanguageTemplate() == "") {
+				std::string templateLanguage = _pluginsModel->getPersistence()->getFormatedField(fields.get());
+				info->setLanguageTemplate(templateLanguage);
 			}
-		} catch (...) {
-			result = false;
 		}
+	} catch (...) {
 	}
-	Util::ResetAllIds();
+	Util::SetLastIdsOfTypes(savedLastIdsOfTypes);
 	_traceManager->setTraceLevel(savedTraceLevel);
-	return result;
 }
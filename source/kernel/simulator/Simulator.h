@@ -93,6 +93,7 @@ public: // only get
 
 private:
 	bool _completePluginsFieldsAndTemplate();
+	void _completePluginFieldsAndTemplate(PluginInformation* info); //!< Completes a plugin when its fields or template are first used
 	friend class PluginManager; //@TODO: should be only member function PluginManager::completePluginsFieldsAndTemplate()
 
 private: // attributes 1:1 objects
@@ -102,6 +103,7 @@ private: // attributes 1:1 objects
 	TraceManager* _traceManager;
 	ParserManager* _parserManager;
 	ExperimentManager* _experimentManager;
+	Model* _pluginsModel = nullptr; //!< Where plugins are instantiated to complete their fields and templates, created at the first completion
 
 private: // attributes 1:1 native
 	const std::string _name = "GenESyS - GENeric and Expansible SYstem Simulator";
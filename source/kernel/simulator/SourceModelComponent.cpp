@@ -23,11 +23,11 @@ SourceModelComponent::SourceModelComponent(Model* model, std::string componentTy
 	SimulationControlGeneric<double>* propFirstCreation = new SimulationControlGeneric<double>(
 				std::bind(&SourceModelComponent::getFirstCreation, this),
 				std::bind(&SourceModelComponent::setFirstCreation, this, std::placeholders::_1),
-				className, name, "FirstCreation", "The instant when the first entity arrives");
+				className, getName(), "FirstCreation", "The instant when the first entity arrives");
 	SimulationControlGeneric<unsigned int>* propEntitiesPerCreation = new SimulationControlGeneric<unsigned int>(
 				std::bind(&SourceModelComponent::getEntitiesPerCreation, this),
 				std::bind(&SourceModelComponent::setEntitiesPerCreation, this, std::placeholders::_1),
-				className, name, "EntitiesPerCreation", "The amount of entities to be created on each arrival");
+				className, getName(), "EntitiesPerCreation", "The amount of entities to be created on each arrival");
 	// SimulationControlString* propMaxCreation = new SimulationControlString(
 	// 			std::bind(&SourceModelComponent::getMaxCreations, this),
 	// 			std::bind(&SourceModelComponent::setMaxCreations, this, std::placeholders::_1),
@@ -35,11 +35,11 @@ SourceModelComponent::SourceModelComponent(Model* model, std::string componentTy
 	SimulationControlGeneric<std::string>* propTimeBetweenCreations = new SimulationControlGeneric<std::string>(
 				std::bind(&SourceModelComponent::getTimeBetweenCreationsExpression, this),
 				std::bind(&SourceModelComponent::setTimeBetweenCreationsExpression, this, std::placeholders::_1, Util::TimeUnit::unknown),
-				className, name, "TimeBetweenArrivals", "Expression that defines the interval between two consecutive arrivals");
+				className, getName(), "TimeBetweenArrivals", "Expression that defines the interval between two consecutive arrivals");
     SimulationControlGenericEnum<Util::TimeUnit, Util>* propTimeUnit = new SimulationControlGenericEnum<Util::TimeUnit, Util>(
 				std::bind(&SourceModelComponent::getTimeUnit, this),
 				std::bind(&SourceModelComponent::setTimeUnit, this, std::placeholders::_1),
-				className, name, "TimeUnit", "The time unit of time between arrivals");
+				className, getName(), "TimeUnit", "The time unit of time between arrivals");
 
 
 	_parentModel->getControls()->insert(propFirstCreation);
@@ -52,6 +52,8 @@ StatisticsCollector::StatisticsCollector(Model* model, std::string name, ModelDa
 void StatisticsCollector::_initStaticsAndCollector() {
 	Collector_if* collector = new TraitsKernel<Model>::StatisticsCollector_CollectorImplementation();
 	_statistics = new StatisticsClass(collector);
+	_collector = collector;
+	_defaultCollector = dynamic_cast<CollectorDefaultImpl1*> (collector);
 }
 
 std::string StatisticsCollector::show() {
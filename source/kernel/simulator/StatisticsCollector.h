@@ -16,6 +16,7 @@
 
 #include "ModelDataDefinition.h"
 #include "../statistics/Statistics_if.h"
+#include "../statistics/CollectorDefaultImpl1.h"
 #include "ModelDataManager.h"
 #include "Plugin.h"
 
@@ -41,6 +42,24 @@ public:
 	 * \return
 	 */
 	Statistics_if* getStatistics() const;
+	/*!
+	 * \brief addValue collects a value. The same as getStatistics()->getCollector()->addValue(), but inlined when the collector is the default one.
+	 * The collector may be replaced through getStatistics()->setCollector(), so it is compared with the one last seen
+	 * \param value
+	 * \param weight
+	 */
+	inline void addValue(double value, double weight = 1.0) {
+		Collector_if* collector = _statistics->getCollector();
+		if (collector != _collector) {
+			_collector = collector;
+			_defaultCollector = dynamic_cast<CollectorDefaultImpl1*> (collector);
+		}
+		if (_defaultCollector != nullptr) {
+			_defaultCollector->collect(value, weight);
+		} else {
+			collector->addValue(value, weight);
+		}
+	}
 
 public:
 	static PluginInformation* GetPluginInformation();
@@ -58,6 +77,8 @@ private:
 private:
 	ModelDataDefinition* _parent;
 	Statistics_if* _statistics;
+	Collector_if* _collector = nullptr;
+	CollectorDefaultImpl1* _defaultCollector = nullptr; //!< the collector, when it is the default one
 };
 //namespace\\}
 #endif /* STATISTICSCOLLECTOR_H */
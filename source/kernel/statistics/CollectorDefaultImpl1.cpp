@@ -26,11 +26,7 @@ void CollectorDefaultImpl1::clear() {
 }
 
 void CollectorDefaultImpl1::addValue(double value, double weight) {
-	_lastValue = value;
-	_numElements++;
-	if (_addValueHandler != nullptr) {
-		_addValueHandler(value, weight);
-	}
+	collect(value, weight);
 }
 
 double CollectorDefaultImpl1::getLastValue() {
@@ -48,3 +44,7 @@ void CollectorDefaultImpl1::setAddValueHandler(CollectorAddValueHandler addValue
 void CollectorDefaultImpl1::setClearHandler(CollectorClearHandler clearHandler) {
 	_clearHandler = clearHandler;
 }
+
+void CollectorDefaultImpl1::setAccumulator(WeightedAccumulator* accumulator) {
+	_accumulator = accumulator;
+}
@@ -15,6 +15,7 @@
 #define COLLECTORDEFAULTIMPL1_H
 
 #include "Collector_if.h"
+#include "WeightedAccumulator.h"
 //namespace GenesysKernel {
 
 class CollectorDefaultImpl1 : public Collector_if {
@@ -29,11 +30,26 @@ public:
 public:
 	virtual void setAddValueHandler(CollectorAddValueHandler addValueHandler) override;
 	virtual void setClearHandler(CollectorClearHandler clearHandler) override;
+public:
+	/*! Values are added directly to the accumulator, instead of through the add value handler */
+	void setAccumulator(WeightedAccumulator* accumulator);
+
+	/*! The same as addValue, but not virtual, so callers that know the collector is this one have it inlined */
+	inline void collect(double value, double weight = 1) {
+		_lastValue = value;
+		_numElements++;
+		if (_accumulator != nullptr) {
+			_accumulator->add(value, weight);
+		} else if (_addValueHandler != nullptr) {
+			_addValueHandler(value, weight);
+		}
+	}
 private:
 	double _lastValue;
 	unsigned long _numElements = 0;
 	CollectorAddValueHandler _addValueHandler = nullptr;
 	CollectorClearHandler _clearHandler = nullptr;
+	WeightedAccumulator* _accumulator = nullptr;
 };
 //namespace\\}
 #endif /* COLLECTORDEFAULTIMPL1_H */
@@ -23,56 +23,34 @@
 StatisticsDefaultImpl1::StatisticsDefaultImpl1() {
 	//_collector = new TraitsKernel<Statistics_if>::CollectorImplementation();
 	_collector = new TraitsKernel<Model>::StatisticsCollector_CollectorImplementation();
-	_collector->setAddValueHandler(setCollectorAddValueHandler(&StatisticsDefaultImpl1::collectorAddHandler, this));
-	_collector->setClearHandler(setCollectorClearHandler(&StatisticsDefaultImpl1::collectorClearHandler, this));
-	//_collector->setAddValueHandler(std::bind(&StatisticsDefaultImpl1::collectorAddHandler, this, std::placeholders::_1));
+	_bindCollector();
 	this->initStatistics();
 }
 
 StatisticsDefaultImpl1::StatisticsDefaultImpl1(Collector_if* collector) {
 	_collector = collector;
-	_collector->setAddValueHandler(setCollectorAddValueHandler(&StatisticsDefaultImpl1::collectorAddHandler, this));
-	_collector->setClearHandler(setCollectorClearHandler(&StatisticsDefaultImpl1::collectorClearHandler, this));
-	//_collector->setAddValueHandler(std::bind(&StatisticsDefaultImpl1::collectorAddHandler, this, std::placeholders::_1));
+	_bindCollector();
 	this->initStatistics();
 }
 
-void StatisticsDefaultImpl1::collectorAddHandler(double newValue, double newWeight) {
-	_elems = _collector->numElements();
-	if (newValue < _min) {
-		_min = newValue;
-	}
-	if (newValue > _max) {
-		_max = newValue;
+/*!
+ * A default collector adds its values directly to the accumulator. Any other one notifies them through the add value handler
+ */
+void StatisticsDefaultImpl1::_bindCollector() {
+	CollectorDefaultImpl1* defaultCollector = dynamic_cast<CollectorDefaultImpl1*> (_collector);
+	if (defaultCollector != nullptr) {
+		defaultCollector->setAccumulator(&_accumulator);
+	} else {
+		_collector->setAddValueHandler(setCollectorAddValueHandler(&StatisticsDefaultImpl1::collectorAddHandler, this));
 	}
+	_collector->setClearHandler(setCollectorClearHandler(&StatisticsDefaultImpl1::collectorClearHandler, this));
+	//_collector->setAddValueHandler(std::bind(&StatisticsDefaultImpl1::collectorAddHandler, this, std::placeholders::_1));
+}
 
-	// alternative 1
-	// equally
-	//_sumData += newValue;
-	//double oldAverage = _average;
-	//_average = _sumData / _elems;
-	//_sumDataSquare += (newValue-oldAverage)*(newValue-_average);
-	//_unweightedvariance = _sumDataSquare/_elems;
-	//if (_elems>1) {
-	//	_unbiasedVariance =_sumDataSquare/(_elems-1);
-	//}
-	// Considering weight
-	_sumWeight += newWeight;
-	_sumWeightSquare += newWeight*newWeight;
-	double oldAverage = _average;
-	_average = oldAverage + (newWeight/_sumWeight)*(newValue-oldAverage);
-	_sumData += newWeight*(newValue-oldAverage)*(newValue-_average);
-	_variance = _sumWeight==1 ? 0 :_sumData/(_sumWeight-1);
-	_unbiasedVariance = _sumWeight==0 ? 0 : _sumData / (_sumWeight-_sumWeightSquare/_sumWeight);
-
-	// alternative 2 (numerical instability)
-	//_average = _average + (newValue - _average)/_elems;  // or bellow
-	//_average = (_average * (elems - 1) + newValue) / elems;  // this approach propagates the numeric error
-	//_variance = (_variance * (elems - 1) + pow(newValue - _average, 2)) / elems;  // this approach propagates the numeric error
-
-	_stddeviation = sqrt(_variance);
-	_variationCoef = (_average != 0 ? _stddeviation / _average : 0.0);
-	_halfWidth = _criticalTn_1 * (_stddeviation / std::sqrt(_elems));
+void StatisticsDefaultImpl1::collectorAddHandler(double newValue, double newWeight) {
+	// West's weighted update. Alternatives, as the equally weighted one or updating average and variance directly from the previous
+	// ones (numerically unstable), were dropped
+	_accumulator.add(newValue, newWeight);
 }
 
 void StatisticsDefaultImpl1::collectorClearHandler() {
@@ -80,20 +58,7 @@ void StatisticsDefaultImpl1::collectorClearHandler() {
 }
 
 void StatisticsDefaultImpl1::initStatistics() {
-	_elems = 0;
-	_min = +1e+99; //@TODO: Change by the double min and man
-	_max = -1e+99;
-	_sumData = 0.0;
-	_sumWeight = 0.0;
-	_sumWeightSquare = 0.0;
-	_sumDataSquare = 0.0;
-	_average = 0.0;
-	_variance = 0.0;
-	_unweightedvariance = 0.0;
-	_unbiasedVariance = 0.0;
-	_stddeviation = 0.0;
-	_variationCoef = 0.0;
-	_halfWidth = 0.0;
+	_accumulator.clear();
 }
 
 unsigned int StatisticsDefaultImpl1::numElements() {
@@ -101,52 +66,70 @@ unsigned int StatisticsDefaultImpl1::numElements() {
 }
 
 double StatisticsDefaultImpl1::min() {
-	if (_elems > 0)
-		return _min;
-	else
-		return 0.0;
+	return _accumulator.min();
 }
 
 double StatisticsDefaultImpl1::max() {
-	if (_elems > 0)
-		return _max;
-	else
-		return 0.0;
+	return _accumulator.max();
 }
 
 double StatisticsDefaultImpl1::average() {
-	return _average;
+	return _accumulator.average();
 }
 
 double StatisticsDefaultImpl1::variance() {
-	return _variance;
+	return _accumulator.variance();
 }
 
 double StatisticsDefaultImpl1::stddeviation() {
-	return _stddeviation;
+	return _accumulator.stddeviation();
 }
 
 double StatisticsDefaultImpl1::variationCoef() {
-	return _variationCoef;
+	return _accumulator.variationCoef();
 }
 
+/*!
+ * Half width of the confidence interval of the average, based on the Student t distribution with n-1 degrees of freedom.
+ * Since the critical value depends on the number of elements, it is calculated only when the half width is requested.
+ */
 double StatisticsDefaultImpl1::halfWidthConfidenceInterval() {
-	return _halfWidth;
+	if (_accumulator.numElements() < 2) {
+		return 0.0;
+	}
+	return _criticalTn_1Value() * (_accumulator.stddeviation() / std::sqrt(_accumulator.numElements()));
 }
 
 void StatisticsDefaultImpl1::setConfidenceLevel(double confidencelevel) {
 	_confidenceLevel = confidencelevel;
-	//Integrator_if* integrator = new TraitsKernel<Integrator_if>::Implementation();
-	_criticalTn_1 = 1.96; //integrator->integrate()
+	_criticalTn_1DegreeFreedom = 0; // critical value must be recalculated
+}
 
+double StatisticsDefaultImpl1::_criticalTn_1Value() {
+	unsigned long degreeFreedom = _accumulator.numElements() - 1;
+	if (degreeFreedom != _criticalTn_1DegreeFreedom) {
+		_criticalTn_1 = TraitsKernel<Statistics_if>::ProbabilityDistributionImplementation::inverseTStudent(1.0 - (1.0 - _confidenceLevel) / 2.0, 0.0, 1.0, degreeFreedom);
+		_criticalTn_1DegreeFreedom = degreeFreedom;
+	}
+	return _criticalTn_1;
 }
 
 double StatisticsDefaultImpl1::confidenceLevel() {
 	return _confidenceLevel;
 }
 
+/*!
+ * Estimates the number of elements needed to reduce the half width of the confidence interval to the given one, ie,
+ * n* = (t[n-1] * s / halfWidth)^2, using the current standard deviation and critical value. The current number of elements is
+ * returned if it is already enough or if there is no variability information yet (less than two elements).
+ */
 unsigned int StatisticsDefaultImpl1::newSampleSize(double halfWidth) {
-	return 0;
+	const unsigned long elems = _accumulator.numElements();
+	if (elems < 2 || halfWidth <= 0.0) {
+		return elems;
+	}
+	double size = std::ceil(std::pow(_criticalTn_1Value() * _accumulator.stddeviation() / halfWidth, 2));
+	return size > elems ? static_cast<unsigned int> (size) : elems;
 }
 
 Collector_if* StatisticsDefaultImpl1::getCollector() const {
@@ -155,4 +138,5 @@ Collector_if* StatisticsDefaultImpl1::getCollector() const {
 
 void StatisticsDefaultImpl1::setCollector(Collector_if* collector) {
 	this->_collector = collector;
+	_bindCollector();
 }
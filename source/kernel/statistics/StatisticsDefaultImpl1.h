@@ -16,6 +16,7 @@
 
 #include "Statistics_if.h"
 #include "Collector_if.h"
+#include "WeightedAccumulator.h"
 //namespace GenesysKernel {
 
 class StatisticsDefaultImpl1 : public Statistics_if {
@@ -42,24 +43,14 @@ private:
 	void collectorAddHandler(double newValue, double newWeight);
 	void collectorClearHandler();
 	void initStatistics();
+	void _bindCollector();
+	double _criticalTn_1Value();
 private:
 	Collector_if* _collector;
-	unsigned long _elems;
-	double _sumData;
-	double _sumDataSquare;
-	double _sumWeight;
-	double _sumWeightSquare;
-	double _min;
-	double _max;
-	double _average;
-	double _variance;
-	double _unweightedvariance;
-	double _unbiasedVariance;
-	double _stddeviation;
-	double _variationCoef;
+	WeightedAccumulator _accumulator; // derived statistics are computed only when read
 	double _confidenceLevel = 0.95;
 	double _criticalTn_1 = 1.96;
-	double _halfWidth;
+	unsigned long _criticalTn_1DegreeFreedom = 0; //!< degrees of freedom of the cached _criticalTn_1 (0 means not calculated)
 };
 //namespace\\}
 #endif /* STATISTICSDEFAULTIMPL1_H */
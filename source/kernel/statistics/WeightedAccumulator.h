@@ -0,0 +1,87 @@
+#ifndef WEIGHTEDACCUMULATOR_H
+#define WEIGHTEDACCUMULATOR_H
+
+#include <cmath>
+
+/*!
+ * Accumulates weighted values with West's update of the weighted mean and of the weighted sum of squared deviations, so each value
+ * costs a few multiplications and a division. Variance, standard deviation and variation coefficient are derived from those sums only
+ * when read. Values with weight zero (as those of time-persistent statistics that held for no time) count as elements and for minimum
+ * and maximum, but not for the average.
+ */
+class WeightedAccumulator {
+public:
+
+	inline void add(double value, double weight = 1.0) {
+		_elems++;
+		if (value < _min) {
+			_min = value;
+		}
+		if (value > _max) {
+			_max = value;
+		}
+		if (weight != 0.0) {
+			_sumWeight += weight;
+			_sumWeightSquare += weight * weight;
+			const double oldAverage = _average;
+			_average = oldAverage + (weight / _sumWeight) * (value - oldAverage);
+			_sumSquaredDeviations += weight * (value - oldAverage) * (value - _average);
+		}
+	}
+
+	inline void clear() {
+		_elems = 0;
+		_min = +1e+99;
+		_max = -1e+99;
+		_sumWeight = 0.0;
+		_sumWeightSquare = 0.0;
+		_average = 0.0;
+		_sumSquaredDeviations = 0.0;
+	}
+
+	unsigned long numElements() const {
+		return _elems;
+	}
+
+	double sumWeight() const {
+		return _sumWeight;
+	}
+
+	double min() const {
+		return _elems > 0 ? _min : 0.0;
+	}
+
+	double max() const {
+		return _elems > 0 ? _max : 0.0;
+	}
+
+	double average() const {
+		return _average;
+	}
+
+	double variance() const {
+		return _sumWeight == 0.0 || _sumWeight == 1.0 ? 0.0 : _sumSquaredDeviations / (_sumWeight - 1.0);
+	}
+
+	double unbiasedVariance() const { //!< Reliability-weighted unbiased variance
+		return _sumWeight == 0.0 ? 0.0 : _sumSquaredDeviations / (_sumWeight - _sumWeightSquare / _sumWeight);
+	}
+
+	double stddeviation() const {
+		return std::sqrt(variance());
+	}
+
+	double variationCoef() const {
+		return _average != 0.0 ? stddeviation() / _average : 0.0;
+	}
+private:
+	unsigned long _elems = 0;
+	double _min = +1e+99;
+	double _max = -1e+99;
+	double _sumWeight = 0.0;
+	double _sumWeightSquare = 0.0;
+	double _average = 0.0;
+	double _sumSquaredDeviations = 0.0;
+};
+
+#endif /* WEIGHTEDACCUMULATOR_H */
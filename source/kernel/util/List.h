@@ -53,8 +53,10 @@ public: // new methods
 	typename std::list<T>::iterator find(T element);
 	//int rankOf(T modeldatum); //!< returns the position (1st position=0) of the modeldatum if found, or negative value if not found
 public: // improved (easier) methods
-	void insert(T element);
+	typename std::list<T>::iterator insert(T element); //!< Returns the position of the element, which is valid until it is removed
 	void remove(T element);
+	void erase(typename std::list<T>::iterator position); //!< Removes the element at the position, with no search
+	std::list<T> removeRange(unsigned int firstRank, unsigned int lastRank); //!< Removes elements from firstRank to lastRank (both included, as far as there are elements) in one pass, and returns them in order
 	void setAtRank(unsigned int rank, T element);
 	T getAtRank(unsigned int rank);
 	T next();
@@ -117,8 +119,12 @@ std::string List<T>::show() {
 }
 
 template <typename T>
-void List<T>::insert(T element) {
-	_list->insert(std::upper_bound(_list->begin(), _list->end(), element, _sortFunc), element);
+typename std::list<T>::iterator List<T>::insert(T element) {
+	// elements not sorting before the last one are appended (always, by the default function) without traversing the list
+	if (_list->empty() || !_sortFunc(element, _list->back())) {
+		return _list->insert(_list->end(), element);
+	}
+	return _list->insert(std::upper_bound(_list->begin(), _list->end(), element, _sortFunc), element);
 }
 
 template <typename T>
@@ -143,6 +149,15 @@ void List<T>::remove(T element) {
 	}
 }
 
+template <typename T>
+void List<T>::erase(typename std::list<T>::iterator position) {
+	const bool current = _it == position;
+	_list->erase(position);
+	if (current) {
+		_it = _list->begin(); // it pointed to the removed modeldatum
+	}
+}
+
 template <typename T>
 T List<T>::create() {
 	return new T();
@@ -153,6 +168,21 @@ void List<T>::clear() {
 	_list->clear();
 }
 
+template <typename T>
+std::list<T> List<T>::removeRange(unsigned int firstRank, unsigned int lastRank) {
+	std::list<T> removed;
+	if (firstRank > lastRank || firstRank >= _list->size()) {
+		return removed;
+	}
+	typename std::list<T>::iterator first = _list->begin();
+	std::advance(first, firstRank);
+	typename std::list<T>::iterator last = first;
+	std::advance(last, std::min<unsigned int>(lastRank, _list->size() - 1) - firstRank + 1);
+	removed.splice(removed.end(), *_list, first, last);
+	_it = _list->begin(); // it may point to a removed element
+	return removed;
+}
+
 template <typename T>
 T List<T>::getAtRank(unsigned int rank) {
 	unsigned int thisRank = 0;
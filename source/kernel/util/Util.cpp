@@ -14,6 +14,7 @@
 #include "Util.h"
 #include <typeinfo>
 #include <map>
+#include <cstdlib>
 
 //using namespace GenesysKernel;
 
@@ -195,6 +196,14 @@ void Util::ResetAllIds() {
 	_S_lastIdOfType = std::map<std::string, Util::identification>();
 }
 
+std::map<std::string, Util::identification> Util::GetLastIdsOfTypes() {
+	return _S_lastIdOfType;
+}
+
+void Util::SetLastIdsOfTypes(std::map<std::string, Util::identification> lastIdsOfTypes) {
+	_S_lastIdOfType = lastIdsOfTypes;
+}
+
 double Util::TimeUnitConvert(Util::TimeUnit timeUnit1, Util::TimeUnit timeUnit2) {
 	double scaleValues[] = {1.0, 1000.0, 1000.0, 1000.0, 1000.0, 1000.0, 60.0, 60.0, 24.0, 7.0};
 	// picosecond = 1, nanosecond = 2, microsecond = 3, milisecond = 4, second = 5, minute = 6, hour = 7, day = 8, week = 9
@@ -238,6 +247,16 @@ std::string Util::Trim(std::string str) {
 	return str;
 }
 
+bool Util::StrToNumber(std::string text, double* value) {
+	text = Trim(text);
+	if (text.empty() || text.find_first_not_of("0123456789.eE+-") != std::string::npos) {
+		return false;
+	}
+	char* end;
+	*value = std::strtod(text.c_str(), &end);
+	return *end == '\0';
+}
+
 std::string Util::StrReplace(std::string text, std::string searchFor, std::string replaceBy) {
 	unsigned int pos = text.find(searchFor, 0);
 	while (pos < text.length()) {// != std::string::npos) {
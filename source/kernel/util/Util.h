@@ -111,6 +111,7 @@ public: // indentation and string
 	static std::string StrTruncIfInt(double value);
 	static std::string StrTruncIfInt(std::string strValue);
 	static std::string Trim(std::string str);
+	static bool StrToNumber(std::string text, double* value); //!< True if the text is a plain decimal number (as "12" or "-1.5e3"), which the parser would evaluate to the same value, stored in value
 	static std::string StrReplace(std::string text, std::string searchFor, std::string replaceBy);
 	static std::string StrReplaceSpecialChars(std::string text);
 	static std::string StrIndex(int index);
@@ -126,6 +127,8 @@ public: // identitification //@TODO: CHECK ALL, since some should be private and
 	static Util::identification GetLastIdOfType(std::string objtype);
 	static void ResetIdOfType(std::string objtype);
 	static void ResetAllIds();
+	static std::map<std::string, Util::identification> GetLastIdsOfTypes(); //!< To restore them by SetLastIdsOfTypes after creating elements that should not count, as when completing plugins
+	static void SetLastIdsOfTypes(std::map<std::string, Util::identification> lastIdsOfTypes);
 
 public: // simulation support
 	static double TimeUnitConvert(Util::TimeUnit timeUnit1, Util::TimeUnit timeUnit2);
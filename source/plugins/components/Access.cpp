@@ -14,6 +14,7 @@
 #include "Access.h"
 
 #include "../../kernel/simulator/Model.h"
+#include "../../kernel/simulator/Simulator.h"
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -27,10 +28,35 @@ ModelDataDefinition* Access::NewInstance(Model* model, std::string name) {
 }
 
 Access::Access(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<Access>(), name) {
+	SimulationControlGenericClass<Conveyor*, Model*, Conveyor>* propConveyor = new SimulationControlGenericClass<Conveyor*, Model*, Conveyor>(
+									_parentModel,
+									std::bind(&Access::getConveyor, this), std::bind(&Access::setConveyor, this, std::placeholders::_1),
+									Util::TypeOf<Access>(), getName(), "Conveyor", "");
+	SimulationControlGenericClass<Station*, Model*, Station>* propStation = new SimulationControlGenericClass<Station*, Model*, Station>(
+									_parentModel,
+									std::bind(&Access::getStation, this), std::bind(&Access::setStation, this, std::placeholders::_1),
+									Util::TypeOf<Access>(), getName(), "Station", "");
+	SimulationControlGeneric<std::string>* propCellsExpression = new SimulationControlGeneric<std::string>(
+									std::bind(&Access::getCellsExpression, this), std::bind(&Access::setCellsExpression, this, std::placeholders::_1),
+									Util::TypeOf<Access>(), getName(), "CellsExpression", "");
+
+	_parentModel->getControls()->insert(propConveyor);
+	_parentModel->getControls()->insert(propStation);
+	_parentModel->getControls()->insert(propCellsExpression);
+
+	// setting properties
+	_addProperty(propConveyor);
+	_addProperty(propStation);
+	_addProperty(propCellsExpression);
 }
 
 std::string Access::show() {
-	return ModelComponent::show() + "";
+	std::string msg = ModelComponent::show() + ",cellsExpression=\"" + _cellsExpression + "\"";
+	if (_conveyor != nullptr)
+		msg += ",conveyor=" + _conveyor->getName();
+	if (_station != nullptr)
+		msg += ",station=" + _station->getName();
+	return msg;
 }
 
 ModelComponent* Access::LoadInstance(Model* model, PersistenceRecord *fields) {
@@ -43,38 +69,178 @@ ModelComponent* Access::LoadInstance(Model* model, PersistenceRecord *fields) {
 	return newComponent;
 }
 
-void Access::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	traceSimulation(this, "I'm just a dummy model and I'll just send the entity forward");
-	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
+void Access::setConveyor(Conveyor* conveyor) {
+	_conveyor = conveyor;
+}
+
+Conveyor* Access::getConveyor() const {
+	return _conveyor;
+}
+
+void Access::setStation(Station* station) {
+	_station = station;
+}
+
+Station* Access::getStation() const {
+	return _station;
+}
+
+void Access::setStationName(std::string stationName) {
+	ModelDataDefinition* data = _parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Station>(), stationName);
+	if (data != nullptr) {
+		_station = dynamic_cast<Station*> (data);
+	} else {
+		_station = _parentModel->getParentSimulator()->getPluginManager()->newInstance<Station>(_parentModel, stationName);
+	}
+}
+
+void Access::setCellsExpression(std::string cellsExpression) {
+	_cellsExpression = cellsExpression;
+}
+
+std::string Access::getCellsExpression() const {
+	return _cellsExpression;
+}
+
+Queue* Access::getQueue() const {
+	return _queue;
+}
+
+void Access::_onDispatchEvent(Entity* entity, unsigned int) {
+	Util::identification stationId = static_cast<Util::identification> (entity->getAttributeValue("Entity.Station"));
+	Station* origin = dynamic_cast<Station*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Station>(), stationId));
+	if (origin == nullptr || _conveyor->getStationPosition(origin) < 0.0) {
+		origin = _conveyor->getStations()->front(); // entities that are not at a station of the conveyor access it at its start
+	}
+	unsigned int cells = static_cast<unsigned int> (_parentModel->parseExpression(_cellsExpression));
+	if (_queue->size() == 0 && _conveyor->access(entity, origin, _station, cells)) {
+		return; // the conveyor sends the entity to the destination station when it arrives
+	}
+	WaitingConveyor* waiting = new WaitingConveyor(entity, _parentModel->getSimulation()->getSimulatedTime(), origin, cells, this);
+	_queue->insertElement(waiting);
+	traceSimulation(this, entity->getName() + " is waiting for " + std::to_string(cells) + " cells of conveyor \"" + _conveyor->getName() + "\" in the queue \"" + _queue->getName() + "\"");
+	if (_queue->size() == 1) {
+		_scheduleRetry();
+	}
+}
+
+/*!
+ * Entities access the conveyor in the order they arrived, while there is space for them
+ */
+void Access::_accessWaiting() {
+	while (_queue->size() > 0) {
+		WaitingConveyor* waiting = static_cast<WaitingConveyor*> (_queue->getAtRank(0));
+		if (!_conveyor->access(waiting->getEntity(), waiting->getOrigin(), _station, waiting->getCells())) {
+			_scheduleRetry();
+			return;
+		}
+		_queue->removeElement(waiting);
+		delete waiting;
+	}
+}
+
+/*!
+ * Retries the first entity waiting when the cells it needs will have been cleared by the moving entities on them. If any of them is
+ * stopped, it is retried only when some entity exits the conveyor
+ */
+void Access::_scheduleRetry() {
+	WaitingConveyor* waiting = static_cast<WaitingConveyor*> (_queue->getAtRank(0));
+	double time = _conveyor->getSpaceTime(waiting->getOrigin(), waiting->getCells());
+	if (time < 0.0 || time == _retryTime) {
+		return;
+	}
+	_retryTime = time;
+	InternalEvent* intEvent = new InternalEvent(time, "Access Retry");
+	intEvent->setEventHandler<Access>(this, &Access::_onRetryEvent, nullptr);
+	_parentModel->getFutureEvents()->insert(intEvent);
+}
+
+void Access::_onRetryEvent(void*) {
+	if (_parentModel->getSimulation()->getSimulatedTime() != _retryTime) {
+		return;
+	}
+	_retryTime = -1.0;
+	_accessWaiting();
+}
+
+void Access::_handlerForConveyorEvent(Conveyor*) {
+	_accessWaiting();
 }
 
 bool Access::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_cellsExpression = fields->loadField("cellsExpression", DEFAULT.cellsExpression);
+		std::string conveyorName = fields->loadField("conveyor", "");
+		_conveyor = dynamic_cast<Conveyor*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Conveyor>(), conveyorName));
+		std::string stationName = fields->loadField("station", "");
+		_station = dynamic_cast<Station*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Station>(), stationName));
 	}
 	return res;
 }
 
-//void Access::_initBetweenReplications() {}
+void Access::_initBetweenReplications() {
+	_retryTime = -1.0;
+}
 
 void Access::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("cellsExpression", _cellsExpression, DEFAULT.cellsExpression, saveDefaultValues);
+	if (_conveyor != nullptr)
+		fields->saveField("conveyor", _conveyor->getName());
+	if (_station != nullptr)
+		fields->saveField("station", _station->getName());
 }
 
 bool Access::_check(std::string* errorMessage) {
 	bool resultAll = true;
-	// @TODO: not implemented yet
-	*errorMessage += "";
+	resultAll &= _parentModel->checkExpression(_cellsExpression, "Number of cells", errorMessage);
+	resultAll &= _parentModel->getDataManager()->check(Util::TypeOf<Conveyor>(), _conveyor, "Conveyor", errorMessage);
+	resultAll &= _parentModel->getDataManager()->check(Util::TypeOf<Station>(), _station, "Station", errorMessage);
+	if (resultAll) {
+		if (_conveyor->getStationPosition(_station) < 0.0) {
+			errorMessage->append("Station \"" + _station->getName() + "\" is not on conveyor \"" + _conveyor->getName() + "\". ");
+			resultAll = false;
+		} else if (_station->getEnterIntoStationComponent() == nullptr) {
+			errorMessage->append("Station has no component to enter into it. ");
+			resultAll = false;
+		}
+	}
 	return resultAll;
 }
 
+void Access::_createInternalAndAttachedData() {
+	PluginManager* pm = _parentModel->getParentSimulator()->getPluginManager();
+	// internal
+	if (_queue == nullptr) {
+		_queue = pm->newInstance<Queue>(_parentModel, getName() + ".Queue");
+	}
+	_internalDataInsert("Queue", _queue);
+	// attached
+	if (_conveyor == nullptr) {
+		_conveyor = pm->newInstance<Conveyor>(_parentModel);
+	}
+	if (_station == nullptr) {
+		_station = pm->newInstance<Station>(_parentModel);
+	}
+	_conveyor->addConveyorEventHandler(Conveyor::SetConveyorEventHandler<Access>(&Access::_handlerForConveyorEvent, this), this);
+	_attachedDataInsert("Conveyor", _conveyor);
+	_attachedDataInsert("Station", _station);
+	_attachedAttributesInsert({"Entity.Station"});
+}
+
 PluginInformation* Access::GetPluginInformation() {
 	PluginInformation* info = new PluginInformation(Util::TypeOf<Access>(), &Access::LoadInstance, &Access::NewInstance);
+	info->setSendTransfer(true);
 	info->setCategory("Material Handling");
-	info->setDescriptionHelp("//@TODO");
-	// ...
+	info->insertDynamicLibFileDependence("conveyor.so");
+	info->insertDynamicLibFileDependence("queue.so");
+	info->insertDynamicLibFileDependence("station.so");
+	std::string help = "The Access module allocates one or more cells of a conveyor to an entity for movement from one station to another.";
+	help += " When an entity arrives at an Access module, it will wait until the appropriate number of contiguous cells on the conveyor are empty and aligned with the entity’s station location.";
+	help += " Then it is conveyed to the destination station, where it is sent to the component that enters into that station.";
+	help += " TYPICAL USES: (1) Parts accessing a conveyor to be sent to a paint booth; (2) Glass accessing a conveyor to be transferred to a cutting station";
+	info->setDescriptionHelp(help);
 	return info;
 }
 
@@ -15,6 +15,38 @@
 #define ACCESS_H
 
 #include "../../kernel/simulator/ModelComponent.h"
+#include "../data/Conveyor.h"
+#include "../data/Queue.h"
+
+class WaitingConveyor : public Waiting {
+public:
+
+	WaitingConveyor(Entity* entity, double timeStartedWaiting, Station* origin, unsigned int cells, ModelComponent* thisComponent, unsigned int thisComponentOutputPort = 0) : Waiting(entity, timeStartedWaiting, thisComponent, thisComponentOutputPort) {
+		_origin = origin;
+		_cells = cells;
+	}
+
+	virtual ~WaitingConveyor() = default;
+public:
+
+	virtual std::string show() {
+		return Waiting::show() +
+				",origin=\"" + _origin->getName() + "\"" +
+				",cells=" + std::to_string(this->_cells);
+	}
+public:
+
+	Station* getOrigin() const {
+		return _origin;
+	}
+
+	unsigned int getCells() const {
+		return _cells;
+	}
+private:
+	Station* _origin;
+	unsigned int _cells;
+};
 
 /*!
 Access module
@@ -49,6 +81,9 @@ Attribute Name Defines the name of the attribute that stores the queue name to
 which entities will reside.
 Expression Defines the name of the expression that stores the queue name to
 which entities will reside.
+Entities access the conveyor at the station they are in (Entity.Station), or at its first station, and are conveyed by this module
+to the destination station, where they are sent to the component that enters into that station. Entities waiting for space are
+retried when the cells they need will have been cleared or, if those cells are held by stopped entities, when some entity exits.
  */
 class Access : public ModelComponent {
 public: // constructors
@@ -60,15 +95,39 @@ public: // static
 	static PluginInformation* GetPluginInformation();
 	static ModelComponent* LoadInstance(Model* model, PersistenceRecord *fields);
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
+public:
+	void setConveyor(Conveyor* conveyor);
+	Conveyor* getConveyor() const;
+	void setStation(Station* station); //!< Destination station
+	Station* getStation() const;
+	void setStationName(std::string stationName);
+	void setCellsExpression(std::string cellsExpression);
+	std::string getCellsExpression() const;
+	Queue* getQueue() const;
 protected: // virtual
 	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber);
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 protected: // virtual
-	//virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	virtual bool _check(std::string* errorMessage);
+	virtual void _createInternalAndAttachedData();
 private: // methods
+	void _accessWaiting();
+	void _scheduleRetry();
+	void _onRetryEvent(void* parameter);
+	void _handlerForConveyorEvent(Conveyor* conveyor);
 private: // attributes 1:1
+	const struct DEFAULT_VALUES {
+		const std::string cellsExpression = "1";
+	} DEFAULT;
+	std::string _cellsExpression = DEFAULT.cellsExpression;
+	double _retryTime = -1.0;
+private: // association
+	Conveyor* _conveyor = nullptr;
+	Station* _station = nullptr;
+private: // internal elements
+	Queue* _queue = nullptr;
 private: // attributes 1:n
 };
 
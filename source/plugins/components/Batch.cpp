@@ -213,9 +213,6 @@ void Batch::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 			representativeEnt->setEntityType(entity->getEntityType());
 		}
 		unsigned int groupIdKey = representativeEnt->getId(); // an "EntityGroup" is a MAP, with one LIST for every RepresentativeEntity ID as KEY
-		if (_batchType == Batch::BatchType::Temporary) {
-			representativeEnt->setAttributeValue("Entity.Group", _entityGroup->getId()); // The "Entity.Group" attribute is the EntityGroup Id (an internal modeldatum of Batch), while the ID of the representative entity is the KEY of the map of that EntityGroup
-		}
 		// remove all entities from the queue while storing attributes depending on representative
 		Entity* enqueuedEnt;
 		std::string txtEntsInGroup = "";
@@ -229,13 +226,10 @@ void Batch::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 					|| (i == (entitiesToGroup->size() - 1) && _groupedAttributes == Batch::GroupedAttribs::LastEntity)
 					|| (_groupedAttributes == Batch::GroupedAttribs::SumAttributes);
 			if (accumAttribs) {
-				std::string attribName;
-				double value;
-				for (ModelDataDefinition* attrib : *_parentModel->getDataManager()->getDataDefinitionList(Util::TypeOf<Attribute>())->list()) {
-					attribName = attrib->getName();
-					value = representativeEnt->getAttributeValue(attribName);
-					value += enqueuedEnt->getAttributeValue(attribName);
-					representativeEnt->setAttributeValue(attribName, value);
+				if (_groupedAttributes == Batch::GroupedAttribs::SumAttributes) {
+					representativeEnt->addAttributeValuesFrom(enqueuedEnt);
+				} else {
+					representativeEnt->copyAttributeValuesFrom(enqueuedEnt);
 				}
 			}
 			if (_batchType == Batch::BatchType::Temporary) {
@@ -247,6 +241,7 @@ void Batch::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 		}
 		txtEntsInGroup = txtEntsInGroup.substr(0, txtEntsInGroup.length() - 2);
 		if (_batchType == Batch::BatchType::Temporary) {
+			representativeEnt->setAttributeValue("Entity.Group", _entityGroup->getId()); // The "Entity.Group" attribute is the EntityGroup Id (an internal modeldatum of Batch), while the ID of the representative entity is the KEY of the map of that EntityGroup
 			traceSimulation(this, "Group key " + std::to_string(groupIdKey) + " was created containing entities: " + txtEntsInGroup + " and representative entity wih attribute 'Entity.Group'=" + std::to_string(_entityGroup->getId()), TraceManager::Level::L7_internal);
 		} else {
 			traceSimulation(this, "Entity \"" + representativeEnt->getName() + "\" id=" + std::to_string(groupIdKey) + " now represented the removed entities: " + txtEntsInGroup, TraceManager::Level::L7_internal);
@@ -15,6 +15,7 @@
 #include "../../kernel/simulator/Model.h"
 #include "../../kernel/simulator/Simulator.h"
 #include "../../kernel/simulator/PluginManager.h"
+#include <algorithm>
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -105,27 +106,33 @@ void Buffer::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	if (_advanceOn == AdvanceOn::NewArrivals) {
 		// just move on
 		Entity* first = _advance(entity);
-		_parentModel->sendEntityToComponent(first, _connections->getFrontConnection());
+		if (first != nullptr) {
+			_parentModel->sendEntityToComponent(first, _connections->getFrontConnection());
+		}
 	} else { // advance on signal. Do not move. Only check if buffer is full
-		if (_buffer->at(_capacity-1) != nullptr) { // full buffer
+		Entity*& last = _buffer->at(_slotOf(_capacity-1));
+		if (last != nullptr) { // full buffer
 			traceSimulation(this, "Entity arrived on a full buffer");
 			switch (_arrivalOnFullBufferRule) {
 				case ArrivalOnFullBufferRule::Dispose:
 					traceSimulation(this, "Disposing arriving entity "+entity->getName());
+					_parentModel->removeEntity(entity);
 					break;
 				case ArrivalOnFullBufferRule::SendToBulkPort:
 					traceSimulation(this, "Sending entity to the bulk port");
 					_parentModel->sendEntityToComponent(entity, _connections->getConnectionAtPort(1));
 					break;
 				case ArrivalOnFullBufferRule::ReplaceLastPosition:
-					Entity* replaced = _buffer->at(_capacity-1);
+					Entity* replaced = last;
 					traceSimulation(this, "Entity "+entity->getName()+" will replace entity "+replaced->getName()+" on the buffer");
-					traceSimulation(this, "Disposing replaced entity "+entity->getName());
+					traceSimulation(this, "Disposing replaced entity "+replaced->getName());
 					_parentModel->removeEntity(replaced);
+					last = entity;
 					break;
 			}
 		} else { // insert
-			_buffer->at(_capacity-1) = entity;
+			last = entity;
+			_numberOfEntities++;
 		}
 	}
 }
@@ -133,14 +140,30 @@ void Buffer::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 bool Buffer::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_capacity = fields->loadField("capacity", DEFAULT.capacity);
+		_advanceOn = static_cast<AdvanceOn> (fields->loadField("advanceOn", static_cast<int> (DEFAULT.advanceOn)));
+		_arrivalOnFullBufferRule = static_cast<ArrivalOnFullBufferRule> (fields->loadField("arrivalOnFullBufferRule", static_cast<int> (DEFAULT.arrivalOnFullBufferRule)));
+		std::string signalName = fields->loadField("signalData", "");
+		if (signalName != "") {
+			ModelDataDefinition* signal = _parentModel->getDataManager()->getDataDefinition(Util::TypeOf<SignalData>(), signalName);
+			if (signal != nullptr) {
+				_attachedSignal = static_cast<SignalData*> (signal);
+			} else { // signal is created with the name it had
+				_attachedSignal = _parentModel->getParentSimulator()->getPluginManager()->newInstance<SignalData>(_parentModel, signalName);
+			}
+		}
 	}
 	return res;
 }
 
 void Buffer::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("capacity", _capacity, DEFAULT.capacity, saveDefaultValues);
+	fields->saveField("advanceOn", static_cast<int> (_advanceOn), static_cast<int> (DEFAULT.advanceOn), saveDefaultValues);
+	fields->saveField("arrivalOnFullBufferRule", static_cast<int> (_arrivalOnFullBufferRule), static_cast<int> (DEFAULT.arrivalOnFullBufferRule), saveDefaultValues);
+	if (_attachedSignal != nullptr) {
+		fields->saveField("signalData", _attachedSignal->getName());
+	}
 }
 
 
@@ -150,7 +173,10 @@ void Buffer::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 
 bool Buffer::_check(std::string* errorMessage) {
 	bool resultAll = true;
-	//...
+	if (_capacity == 0) {
+		resultAll = false;
+		errorMessage->append("Capacity of buffer must be at least 1. ");
+	}
 	return resultAll;
 }
 
@@ -163,22 +189,32 @@ ParserChangesInformation* Buffer::_getParserChangesInformation() {
 }
 
 void Buffer::_initBetweenReplications() {
-	_buffer->clear();
-	_buffer->resize(_capacity);
+	_buffer->assign(_capacity, nullptr);
+	_head = 0;
+	_numberOfEntities = 0;
 }
 
+/*!
+ * Got a signal. Buffer advances as many positions as the limit of the signal in a single pass, and the entities in the positions passed
+ * by leave it, the first one first. Advancing the whole capacity or more empties the buffer
+ */
 unsigned int Buffer::_handlerForSignalDataEvent(SignalData* signalData) {
-	// got a signal. Buffer will advance
 	traceSimulation(this, "Buffer "+this->getName()+" received signal "+signalData->getName());
-	Entity* first = _advance(nullptr);
-	traceSimulation(this, "Buffer entities moved forward");
-	if (first != nullptr) {
-		traceSimulation(this, "Entity "+first->getName()+" was in the first position of the buffer");
-		_parentModel->sendEntityToComponent(first, this->getConnectionManager()->getFrontConnection());
-	} else {
-		traceSimulation(this, "First position of the buffer was empty");
+	const unsigned int positions = std::min(signalData->remainsToLimit(), _capacity);
+	unsigned int sent = 0;
+	for (unsigned int position = 0; position < positions && _numberOfEntities > 0; position++) {
+		Entity*& slot = _buffer->at(_slotOf(position));
+		if (slot != nullptr) {
+			traceSimulation(this, "Entity "+slot->getName()+" was in position "+std::to_string(position)+" of the buffer");
+			_parentModel->sendEntityToComponent(slot, this->getConnectionManager()->getFrontConnection());
+			slot = nullptr;
+			_numberOfEntities--;
+			sent++;
+		}
 	}
-	return 1;
+	_head = _slotOf(positions % _capacity);
+	traceSimulation(this, "Buffer entities moved forward "+std::to_string(positions)+" positions");
+	return sent;
 }
 
 
@@ -233,9 +269,35 @@ void Buffer::setArrivalOnFullBufferRule(Buffer::ArrivalOnFullBufferRule newArriv
 	_arrivalOnFullBufferRule = newArrivalOnFullBufferRule;
 }
 
+Entity* Buffer::getEntityAt(unsigned int position) const {
+	if (position >= _buffer->size()) {
+		return nullptr;
+	}
+	return _buffer->at(_slotOf(position));
+}
+
+unsigned int Buffer::getNumberOfEntities() const {
+	return _numberOfEntities;
+}
+
+/*!
+ * The first position leaves and becomes the last one, where the entering entity is
+ */
 Entity* Buffer::_advance(Entity* enteringEntity) {
-	Entity *result = _buffer->front();
-	_buffer->erase(_buffer->begin());
-	_buffer->push_back(enteringEntity);
+	Entity*& first = _buffer->at(_head);
+	Entity *result = first;
+	first = enteringEntity;
+	_head = _slotOf(1 % _capacity);
+	if (result != nullptr) {
+		_numberOfEntities--;
+	}
+	if (enteringEntity != nullptr) {
+		_numberOfEntities++;
+	}
 	return result;
 }
+
+unsigned int Buffer::_slotOf(unsigned int position) const {
+	const unsigned int slot = _head + position;
+	return slot < _capacity ? slot : slot - _capacity;
+}
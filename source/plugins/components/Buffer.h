@@ -18,7 +18,12 @@
 #include "../data/SignalData.h"
 
 /*!
- This component ...
+ This component holds entities in a fixed number of positions. When advancing, every entity moves one position forward and the entity in
+ the first position (if any) leaves the buffer. It advances on each new arrival, that enters the last position, or on signals, when
+ arrivals only enter the last position if it is empty (otherwise the rule for arrivals on a full buffer applies) and each signal advances
+ as many positions as its limit.
+ Positions are kept in a circular array, so advancing any number of positions, inserting and replacing the last entity take no time
+ proportional to the capacity.
  */
 class Buffer : public ModelComponent {
 public:
@@ -48,6 +53,8 @@ public:
 	void setCapacity(unsigned int newCapacity);
 	SignalData *getsignal() const;
 	void setSignal(SignalData *newSignal);
+	Entity* getEntityAt(unsigned int position) const; //!< The entity in the position (0 is the first one), or nullptr if it is empty
+	unsigned int getNumberOfEntities() const;
 
 protected: // must be overriden
 	virtual bool _loadInstance(PersistenceRecord *fields);
@@ -64,6 +71,7 @@ protected: // could be overriden by derived classes
 private: // methods
 	unsigned int _handlerForSignalDataEvent(SignalData* signalData);
 	Entity* _advance(Entity* enteringEntity);
+	unsigned int _slotOf(unsigned int position) const;
 private: // attributes 1:1
 
 	const struct DEFAULT_VALUES {
@@ -75,7 +83,9 @@ private: // attributes 1:1
 	AdvanceOn _advanceOn = DEFAULT.advanceOn;
 	unsigned int _capacity = DEFAULT.capacity;
 private:
-	std::vector<Entity*>* _buffer = new std::vector<Entity*>;
+	std::vector<Entity*>* _buffer = new std::vector<Entity*>; //!< circular, with the first position at _head
+	unsigned int _head = 0;
+	unsigned int _numberOfEntities = 0;
 private: // attached
 	SignalData* _attachedSignal = nullptr;
 };
@@ -44,7 +44,7 @@ ModelComponent* CellularAutomata::LoadInstance(Model* model, PersistenceRecord *
 
 void CellularAutomata::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	traceSimulation(this, "I'm just a dummy model and I'll just send the entity forward");
-	this->_parentModel->sendEntityToComponent(entity, this->getConnections()->getFrontConnection());
+	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
 bool CellularAutomata::_loadInstance(PersistenceRecord *fields) {
@@ -0,0 +1,21 @@
+#include "BoundaryCondition.h"
+
+void BoundaryCondition::setLattice(Lattice* lattice) {
+	_lattice = lattice;
+}
+
+Lattice* BoundaryCondition::getLattice() const {
+	return _lattice;
+}
+
+void BoundaryCondition::setNeighborhood(Neighborhood* neighborhood) {
+	_neighborhood = neighborhood;
+}
+
+Neighborhood* BoundaryCondition::getNeighborhood() const {
+	return _neighborhood;
+}
+
+double BoundaryCondition::getValue() const {
+	return 0.0;
+}
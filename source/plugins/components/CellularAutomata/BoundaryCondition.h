@@ -0,0 +1,29 @@
+#ifndef BOUNDARYCONDITION_H
+#define BOUNDARYCONDITION_H
+
+class Lattice;
+class Neighborhood;
+
+/*!
+ * Defines the state of neighbors that fall outside the lattice, either by mapping them to a cell inside the lattice or by giving them a
+ * fixed state.
+ */
+class BoundaryCondition {
+public:
+	BoundaryCondition() = default;
+	virtual ~BoundaryCondition() = default;
+public:
+	void setLattice(Lattice* lattice);
+	Lattice* getLattice() const;
+	void setNeighborhood(Neighborhood* neighborhood);
+	Neighborhood* getNeighborhood() const;
+public:
+	/*! Maps the coordinates of a cell outside the lattice to a cell inside it and returns true, or returns false if the state of that cell is getValue() */
+	virtual bool resolve(int* x, int* y) const = 0;
+	virtual double getValue() const;
+protected:
+	Lattice* _lattice = nullptr;
+	Neighborhood* _neighborhood = nullptr;
+};
+
+#endif /* BOUNDARYCONDITION_H */
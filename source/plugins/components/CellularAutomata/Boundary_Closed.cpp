@@ -0,0 +1,15 @@
+#include "Boundary_Closed.h"
+#include "Lattice.h"
+
+bool Boundary_Closed::resolve(int* x, int* y) const {
+	const int width = _lattice->getWidth(), height = _lattice->getHeight();
+	*x %= width;
+	if (*x < 0) {
+		*x += width;
+	}
+	*y %= height;
+	if (*y < 0) {
+		*y += height;
+	}
+	return true;
+}
@@ -0,0 +1,18 @@
+#ifndef BOUNDARY_CLOSED_H
+#define BOUNDARY_CLOSED_H
+
+#include "BoundaryCondition.h"
+
+/*!
+ * Closed (periodic) boundary: the lattice wraps around, so the neighbor past the last cell of a row is its first cell (a ring in one
+ * dimension and a torus in two).
+ */
+class Boundary_Closed : public BoundaryCondition {
+public:
+	Boundary_Closed() = default;
+	virtual ~Boundary_Closed() = default;
+public:
+	virtual bool resolve(int* x, int* y) const override;
+};
+
+#endif /* BOUNDARY_CLOSED_H */
@@ -0,0 +1,17 @@
+#include "Boundary_Fixed.h"
+
+Boundary_Fixed::Boundary_Fixed(double value) {
+	_value = value;
+}
+
+void Boundary_Fixed::setValue(double value) {
+	_value = value;
+}
+
+double Boundary_Fixed::getValue() const {
+	return _value;
+}
+
+bool Boundary_Fixed::resolve(int*, int*) const {
+	return false;
+}
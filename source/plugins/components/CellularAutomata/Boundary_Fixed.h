@@ -0,0 +1,21 @@
+#ifndef BOUNDARY_FIXED_H
+#define BOUNDARY_FIXED_H
+
+#include "BoundaryCondition.h"
+
+/*!
+ * Fixed boundary: every cell outside the lattice is in the same state (0 by default).
+ */
+class Boundary_Fixed : public BoundaryCondition {
+public:
+	Boundary_Fixed(double value = 0.0);
+	virtual ~Boundary_Fixed() = default;
+public:
+	void setValue(double value);
+	virtual double getValue() const override;
+	virtual bool resolve(int* x, int* y) const override;
+private:
+	double _value;
+};
+
+#endif /* BOUNDARY_FIXED_H */
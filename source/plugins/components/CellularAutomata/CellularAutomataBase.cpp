@@ -0,0 +1,264 @@
+#include "CellularAutomataBase.h"
+#include <thread>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// below this, starting a thread costs more than updating its cells
+static const unsigned int MIN_CELLS_PER_THREAD = 1 << 16;
+static const unsigned int MIN_BITPACKED_CELLS_PER_THREAD = 1 << 20;
+
+CellularAutomataBase::CellularAutomataBase() {
+	_numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+void CellularAutomataBase::setLattice(Lattice* lattice) {
+	_lattice = lattice;
+}
+
+Lattice* CellularAutomataBase::getLattice() const {
+	return _lattice;
+}
+
+void CellularAutomataBase::setNeighborhood(Neighborhood* neighborhood) {
+	_neighborhood = neighborhood;
+}
+
+Neighborhood* CellularAutomataBase::getNeighborhood() const {
+	return _neighborhood;
+}
+
+void CellularAutomataBase::setLocalRule(LocalRule* localRule) {
+	_localRule = localRule;
+}
+
+LocalRule* CellularAutomataBase::getLocalRule() const {
+	return _localRule;
+}
+
+void CellularAutomataBase::setStateSet(StateSet* stateSet) {
+	_stateSet = stateSet;
+}
+
+StateSet* CellularAutomataBase::getStateSet() const {
+	return _stateSet;
+}
+
+void CellularAutomataBase::setInitializer(Initializer initializer) {
+	_initializer = initializer;
+}
+
+void CellularAutomataBase::setNumberOfThreads(unsigned int numberOfThreads) {
+	_numberOfThreads = std::max(1u, numberOfThreads);
+}
+
+unsigned int CellularAutomataBase::getNumberOfThreads() const {
+	return _numberOfThreads;
+}
+
+void CellularAutomataBase::init() {
+	_lattice->setBitPacked(_stateSet->isBitBased());
+	_lattice->allocate();
+	_neighborhood->build(_lattice);
+	_bitwise = _lattice->isBitPacked() && _localRule->hasBitwiseForm() && _neighborhood->getReachX() < 64;
+	_fixedRow.assign(_lattice->getWordsPerRow(), _neighborhood->getBoundary()->getValue() != 0.0 ? ~uint64_t(0) : 0);
+	std::mt19937 generator(_stateSet->getSeed());
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	std::uniform_int_distribution<unsigned int> nonZeroState(1, std::max(1u, _stateSet->getNumberOfStates() - 1));
+	for (unsigned int y = 0; y < _lattice->getHeight(); y++) {
+		for (unsigned int x = 0; x < _lattice->getWidth(); x++) {
+			double state = 0.0;
+			if (_initializer != nullptr) {
+				state = _initializer(x, y);
+			} else if (uniform(generator) < _stateSet->getInitialDensity()) {
+				state = _stateSet->isContinuous() ? uniform(generator) : nonZeroState(generator);
+			}
+			_lattice->setState(state, x, y);
+		}
+	}
+	_generation = 0;
+	_cellUpdates = 0;
+	_elapsedSeconds = 0.0;
+	_lastStepSeconds = 0.0;
+}
+
+void CellularAutomataBase::step() {
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	_step();
+	_lastStepSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	_elapsedSeconds += _lastStepSeconds;
+	_cellUpdates += _lattice->getNumberOfCells();
+	_generation++;
+}
+
+unsigned long long CellularAutomataBase::getGeneration() const {
+	return _generation;
+}
+
+unsigned long long CellularAutomataBase::getCellUpdates() const {
+	return _cellUpdates;
+}
+
+double CellularAutomataBase::getCellUpdatesPerSecond() const {
+	return _elapsedSeconds > 0.0 ? _cellUpdates / _elapsedSeconds : 0.0;
+}
+
+double CellularAutomataBase::getLastStepCellUpdatesPerSecond() const {
+	return _lastStepSeconds > 0.0 ? _lattice->getNumberOfCells() / _lastStepSeconds : 0.0;
+}
+
+void CellularAutomataBase::_updateCells() {
+	if (_bitwise) {
+		_fillBorderBits();
+		_forEachBand([this](unsigned int firstRow, unsigned int lastRow) {
+			_updateWords(firstRow, lastRow);
+		});
+	} else if (!_lattice->isBitPacked()) {
+		_forEachBand([this](unsigned int firstRow, unsigned int lastRow) {
+			_updateDense(firstRow, lastRow);
+		});
+	} else {
+		_forEachBand([this](unsigned int firstRow, unsigned int lastRow) {
+			_updateGeneric(firstRow, lastRow);
+		});
+	}
+}
+
+void CellularAutomataBase::_forEachBand(std::function<void(unsigned int, unsigned int) > update) {
+	const unsigned int height = _lattice->getHeight();
+	const unsigned int minCells = _bitwise ? MIN_BITPACKED_CELLS_PER_THREAD : MIN_CELLS_PER_THREAD;
+	const unsigned int threads = std::min({_numberOfThreads, height, std::max(1u, _lattice->getNumberOfCells() / minCells)});
+	if (threads <= 1) {
+		update(0, height);
+		return;
+	}
+	// bands are disjoint sets of rows, and bit-packed rows do not share words, so threads never write the same memory
+	const unsigned int band = (height + threads - 1) / threads;
+	std::vector<std::thread> workers;
+	for (unsigned int firstRow = band; firstRow < height; firstRow += band) {
+		workers.emplace_back(update, firstRow, std::min(firstRow + band, height));
+	}
+	update(0, band);
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+/*!
+ * The state of a cell, which may be outside the lattice
+ */
+double CellularAutomataBase::_neighborState(int x, int y) const {
+	if (x >= 0 && y >= 0 && x < (int) _lattice->getWidth() && y < (int) _lattice->getHeight()) {
+		return _lattice->getState(x, y);
+	}
+	BoundaryCondition* boundary = _neighborhood->getBoundary();
+	if (boundary->resolve(&x, &y)) {
+		return _lattice->getState(x, y);
+	}
+	return boundary->getValue();
+}
+
+void CellularAutomataBase::_updateDense(unsigned int firstRow, unsigned int lastRow) {
+	const unsigned int width = _lattice->getWidth(), height = _lattice->getHeight();
+	const unsigned int reachX = _neighborhood->getReachX(), reachY = _neighborhood->getReachY();
+	const double* cells = _lattice->getCells();
+	double* next = _lattice->getNextCells();
+	std::vector<double> neighbors(_neighborhood->getNumberOfNeighbors());
+	std::vector<long> distances(neighbors.size());
+	for (unsigned int y = firstRow; y < lastRow; y++) {
+		const std::vector<Neighborhood::Offset>& offsets = _neighborhood->getOffsets(y);
+		const unsigned int n = offsets.size();
+		for (unsigned int k = 0; k < n; k++) {
+			distances[k] = offsets[k].dy * (long) width + offsets[k].dx;
+		}
+		const bool innerRow = y >= reachY && y + reachY < height;
+		const double* row = cells + (std::size_t) y * width;
+		double* nextRow = next + (std::size_t) y * width;
+		for (unsigned int x = 0; x < width; x++) {
+			if (innerRow && x >= reachX && x + reachX < width) {
+				const double* cell = row + x;
+				for (unsigned int k = 0; k < n; k++) {
+					neighbors[k] = cell[distances[k]];
+				}
+			} else {
+				for (unsigned int k = 0; k < n; k++) {
+					neighbors[k] = _neighborState(x + offsets[k].dx, y + offsets[k].dy);
+				}
+			}
+			nextRow[x] = _localRule->apply(row[x], neighbors.data(), n);
+		}
+	}
+}
+
+void CellularAutomataBase::_updateGeneric(unsigned int firstRow, unsigned int lastRow) {
+	std::vector<double> neighbors(_neighborhood->getNumberOfNeighbors());
+	for (unsigned int y = firstRow; y < lastRow; y++) {
+		const std::vector<Neighborhood::Offset>& offsets = _neighborhood->getOffsets(y);
+		const unsigned int n = offsets.size();
+		for (unsigned int x = 0; x < _lattice->getWidth(); x++) {
+			for (unsigned int k = 0; k < n; k++) {
+				neighbors[k] = _neighborState(x + offsets[k].dx, y + offsets[k].dy);
+			}
+			_lattice->setNextState(_localRule->apply(_lattice->getState(x, y), neighbors.data(), n), x, y);
+		}
+	}
+}
+
+/*!
+ * Places the cells just outside each side of every row in the extra words of the row, so shifted words of a row include the neighbors
+ * across the left and right borders
+ */
+void CellularAutomataBase::_fillBorderBits() {
+	const int width = _lattice->getWidth(), reachX = _neighborhood->getReachX();
+	for (unsigned int y = 0; y < _lattice->getHeight(); y++) {
+		uint64_t* row = _lattice->getRow(y);
+		for (int i = 1; i <= reachX; i++) {
+			Lattice::SetBit(row, -i, _neighborState(-i, y) != 0.0);
+			Lattice::SetBit(row, width - 1 + i, _neighborState(width - 1 + i, y) != 0.0);
+		}
+	}
+}
+
+/*!
+ * Word of a bit-packed row whose bit k is the state of the cell dx cells away from the cell of bit k of the j-th word
+ */
+static inline uint64_t alignedWord(const uint64_t* row, unsigned int j, int dx) {
+	if (dx > 0) {
+		return (row[j] >> dx) | (row[j + 1] << (64 - dx));
+	} else if (dx < 0) {
+		return (row[j] << -dx) | (row[j - 1] >> (64 + dx));
+	}
+	return row[j];
+}
+
+void CellularAutomataBase::_updateWords(unsigned int firstRow, unsigned int lastRow) {
+	const int height = _lattice->getHeight();
+	const unsigned int words = _lattice->getWordsPerRow();
+	const uint64_t lastWordMask = _lattice->getLastWordMask();
+	BoundaryCondition* boundary = _neighborhood->getBoundary();
+	std::vector<const uint64_t*> rows(_neighborhood->getNumberOfNeighbors());
+	std::vector<int> shifts(rows.size());
+	std::vector<uint64_t> aligned(rows.size());
+	for (unsigned int y = firstRow; y < lastRow; y++) {
+		const std::vector<Neighborhood::Offset>& offsets = _neighborhood->getOffsets(y);
+		const unsigned int n = offsets.size();
+		for (unsigned int k = 0; k < n; k++) {
+			int x = 0, neighborY = (int) y + offsets[k].dy;
+			if ((neighborY >= 0 && neighborY < height) || boundary->resolve(&x, &neighborY)) {
+				rows[k] = _lattice->getRow(neighborY);
+			} else {
+				rows[k] = _fixedRow.data();
+			}
+			shifts[k] = offsets[k].dx;
+		}
+		const uint64_t* row = _lattice->getRow(y);
+		uint64_t* nextRow = _lattice->getNextRow(y);
+		for (unsigned int j = 1; j + 1 < words; j++) {
+			for (unsigned int k = 0; k < n; k++) {
+				aligned[k] = alignedWord(rows[k], j, shifts[k]);
+			}
+			nextRow[j] = _localRule->applyBits(row[j], aligned.data(), n);
+		}
+		nextRow[words - 2] &= lastWordMask;
+	}
+}
@@ -0,0 +1,73 @@
+#ifndef CELLULARAUTOMATABASE_H
+#define CELLULARAUTOMATABASE_H
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include "Lattice.h"
+#include "Neighborhood.h"
+#include "StateSet.h"
+#include "LocalRule.h"
+#include "BoundaryCondition.h"
+
+/*!
+ * Cellular automaton made of a lattice, a set of states, a neighborhood (with its boundary condition) and a local rule. Derived classes
+ * define how a step (a generation) updates the cells, using the update kernels here:
+ * - bit-packed lattices whose rule has a bitwise form are updated 64 cells at a time;
+ * - other lattices are updated cell by cell, from the current buffer into the next one, with neighbors of cells away from the border
+ *   read directly by their distance in the buffer.
+ * Either way the lattice is split in bands of rows updated by concurrent threads.
+ */
+class CellularAutomataBase {
+public:
+	/*! Gives the initial state of the cell at (x,y) */
+	typedef std::function<double(unsigned int, unsigned int)> Initializer;
+public:
+	CellularAutomataBase();
+	virtual ~CellularAutomataBase() = default;
+public:
+	void setLattice(Lattice* lattice);
+	Lattice* getLattice() const;
+	void setNeighborhood(Neighborhood* neighborhood);
+	Neighborhood* getNeighborhood() const;
+	void setLocalRule(LocalRule* localRule);
+	LocalRule* getLocalRule() const;
+	void setStateSet(StateSet* stateSet);
+	StateSet* getStateSet() const;
+	void setInitializer(Initializer initializer); //!< By default cells are initialized at random, as defined by the state set
+	void setNumberOfThreads(unsigned int numberOfThreads); //!< Threads updating the lattice. Defaults to the number of hardware threads
+	unsigned int getNumberOfThreads() const;
+public:
+	virtual void init(); //!< Allocates the lattice and sets the initial states of the cells
+	void step(); //!< Computes the next generation
+	unsigned long long getGeneration() const;
+	unsigned long long getCellUpdates() const; //!< Cells updated since init()
+	double getCellUpdatesPerSecond() const; //!< Throughput since init()
+	double getLastStepCellUpdatesPerSecond() const;
+protected:
+	virtual void _step() = 0;
+	void _updateCells(); //!< Writes the next state of every cell into the next buffer of the lattice
+private:
+	void _forEachBand(std::function<void(unsigned int, unsigned int) > update);
+	void _updateWords(unsigned int firstRow, unsigned int lastRow);
+	void _updateDense(unsigned int firstRow, unsigned int lastRow);
+	void _updateGeneric(unsigned int firstRow, unsigned int lastRow);
+	void _fillBorderBits();
+	double _neighborState(int x, int y) const;
+protected:
+	Lattice* _lattice = nullptr;
+	Neighborhood* _neighborhood = nullptr;
+	LocalRule* _localRule = nullptr;
+	StateSet* _stateSet = nullptr;
+	Initializer _initializer = nullptr;
+	unsigned int _numberOfThreads;
+	unsigned long long _generation = 0;
+	unsigned long long _cellUpdates = 0;
+	double _elapsedSeconds = 0.0;
+	double _lastStepSeconds = 0.0;
+private:
+	std::vector<uint64_t> _fixedRow; // bit-packed row of cells in the fixed state of the boundary
+	bool _bitwise = false;
+};
+
+#endif /* CELLULARAUTOMATABASE_H */
@@ -0,0 +1,35 @@
+#include "CellularAutomata_1DTimed.h"
+
+void CellularAutomata_1DTimed::setHistoryLength(unsigned int historyLength) {
+	_historyLength = historyLength;
+}
+
+unsigned int CellularAutomata_1DTimed::getHistoryLength() const {
+	return _historyLength;
+}
+
+const std::deque<std::vector<double>>& CellularAutomata_1DTimed::getHistory() const {
+	return _history;
+}
+
+void CellularAutomata_1DTimed::init() {
+	CellularAutomata_Classic::init();
+	_history.clear();
+	_record();
+}
+
+void CellularAutomata_1DTimed::_step() {
+	CellularAutomata_Classic::_step();
+	_record();
+}
+
+void CellularAutomata_1DTimed::_record() {
+	std::vector<double> states(_lattice->getWidth());
+	for (unsigned int x = 0; x < states.size(); x++) {
+		states[x] = _lattice->getState(x);
+	}
+	_history.push_back(std::move(states));
+	if (_historyLength > 0 && _history.size() > _historyLength) {
+		_history.pop_front();
+	}
+}
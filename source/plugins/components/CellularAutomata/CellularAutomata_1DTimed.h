@@ -0,0 +1,29 @@
+#ifndef CELLULARAUTOMATA_1DTIMED_H
+#define CELLULARAUTOMATA_1DTIMED_H
+
+#include <deque>
+#include "CellularAutomata_Classic.h"
+
+/*!
+ * Synchronous one dimensional cellular automaton that keeps the states of its last generations, so they can be shown as a space-time
+ * diagram (one row per generation, the oldest first).
+ */
+class CellularAutomata_1DTimed : public CellularAutomata_Classic {
+public:
+	CellularAutomata_1DTimed() = default;
+	virtual ~CellularAutomata_1DTimed() = default;
+public:
+	void setHistoryLength(unsigned int historyLength); //!< Generations kept (0 keeps all of them)
+	unsigned int getHistoryLength() const;
+	const std::deque<std::vector<double>>& getHistory() const;
+	virtual void init() override;
+protected:
+	virtual void _step() override;
+private:
+	void _record();
+private:
+	unsigned int _historyLength = 1000;
+	std::deque<std::vector<double>> _history;
+};
+
+#endif /* CELLULARAUTOMATA_1DTIMED_H */
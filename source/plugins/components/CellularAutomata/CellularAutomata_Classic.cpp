@@ -0,0 +1,6 @@
+#include "CellularAutomata_Classic.h"
+
+void CellularAutomata_Classic::_step() {
+	_updateCells();
+	_lattice->swap();
+}
@@ -0,0 +1,17 @@
+#ifndef CELLULARAUTOMATA_CLASSIC_H
+#define CELLULARAUTOMATA_CLASSIC_H
+
+#include "CellularAutomataBase.h"
+
+/*!
+ * Classic (synchronous) cellular automaton: at each step every cell is updated from the states of the previous generation.
+ */
+class CellularAutomata_Classic : public CellularAutomataBase {
+public:
+	CellularAutomata_Classic() = default;
+	virtual ~CellularAutomata_Classic() = default;
+protected:
+	virtual void _step() override;
+};
+
+#endif /* CELLULARAUTOMATA_CLASSIC_H */
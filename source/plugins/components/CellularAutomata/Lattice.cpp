@@ -0,0 +1,139 @@
+#include "Lattice.h"
+
+Lattice::Lattice(CellularAutomataBase* cellularAutomata) {
+	_cellularAutomata = cellularAutomata;
+}
+
+CellularAutomataBase* Lattice::getCellularAutomata() const {
+	return _cellularAutomata;
+}
+
+void Lattice::setDimensions(std::vector<unsigned int> dimensions) {
+	_dimensions = dimensions;
+}
+
+std::vector<unsigned int> Lattice::getDimensions() const {
+	return _dimensions;
+}
+
+unsigned int Lattice::getWidth() const {
+	return _dimensions.empty() ? 0 : _dimensions[0];
+}
+
+unsigned int Lattice::getHeight() const {
+	if (_dimensions.empty()) {
+		return 0;
+	}
+	return _dimensions.size() == 1 ? 1 : _dimensions[1];
+}
+
+unsigned int Lattice::getNumberOfCells() const {
+	return getWidth() * getHeight();
+}
+
+bool Lattice::isOneDimensional() const {
+	return _dimensions.size() == 1;
+}
+
+void Lattice::setHexagonal(bool hexagonal) {
+	_hexagonal = hexagonal;
+}
+
+bool Lattice::isHexagonal() const {
+	return _hexagonal;
+}
+
+void Lattice::setBitPacked(bool bitPacked) {
+	_bitPacked = bitPacked;
+}
+
+bool Lattice::isBitPacked() const {
+	return _bitPacked;
+}
+
+void Lattice::allocate() {
+	_cells.clear();
+	_nextCells.clear();
+	_words.clear();
+	_nextWords.clear();
+	if (_bitPacked) {
+		_wordsPerRow = (getWidth() + 63) / 64 + 2;
+		_words.assign(_wordsPerRow * getHeight(), 0);
+		_nextWords.assign(_wordsPerRow * getHeight(), 0);
+	} else {
+		_wordsPerRow = 0;
+		_cells.assign(getNumberOfCells(), 0.0);
+		_nextCells.assign(getNumberOfCells(), 0.0);
+	}
+}
+
+void Lattice::swap() {
+	_cells.swap(_nextCells);
+	_words.swap(_nextWords);
+}
+
+double Lattice::getState(unsigned int x, unsigned int y) const {
+	if (_bitPacked) {
+		return GetBit(&_words[y * _wordsPerRow], x) ? 1.0 : 0.0;
+	}
+	return _cells[y * getWidth() + x];
+}
+
+void Lattice::setState(double state, unsigned int x, unsigned int y) {
+	if (_bitPacked) {
+		SetBit(&_words[y * _wordsPerRow], x, state != 0.0);
+	} else {
+		_cells[y * getWidth() + x] = state;
+	}
+}
+
+void Lattice::setNextState(double state, unsigned int x, unsigned int y) {
+	if (_bitPacked) {
+		SetBit(&_nextWords[y * _wordsPerRow], x, state != 0.0);
+	} else {
+		_nextCells[y * getWidth() + x] = state;
+	}
+}
+
+unsigned long long Lattice::getPopulation() const {
+	unsigned long long population = 0;
+	if (_bitPacked) {
+		const uint64_t lastMask = getLastWordMask();
+		for (unsigned int y = 0; y < getHeight(); y++) {
+			const uint64_t* row = &_words[y * _wordsPerRow];
+			for (unsigned int j = 1; j + 1 < _wordsPerRow; j++) {
+				population += __builtin_popcountll(j + 2 == _wordsPerRow ? row[j] & lastMask : row[j]);
+			}
+		}
+	} else {
+		for (double state : _cells) {
+			population += state != 0.0;
+		}
+	}
+	return population;
+}
+
+const double* Lattice::getCells() const {
+	return _cells.data();
+}
+
+double* Lattice::getNextCells() {
+	return _nextCells.data();
+}
+
+unsigned int Lattice::getWordsPerRow() const {
+	return _wordsPerRow;
+}
+
+uint64_t* Lattice::getRow(unsigned int y) {
+	return &_words[y * _wordsPerRow];
+}
+
+uint64_t* Lattice::getNextRow(unsigned int y) {
+	return &_nextWords[y * _wordsPerRow];
+}
+
+uint64_t Lattice::getLastWordMask() const {
+	const unsigned int used = getWidth() % 64;
+	return used == 0 ? ~uint64_t(0) : (uint64_t(1) << used) - 1;
+}
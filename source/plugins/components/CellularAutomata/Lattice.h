@@ -0,0 +1,78 @@
+#ifndef LATTICE_H
+#define LATTICE_H
+
+#include <vector>
+#include <cstdint>
+
+class CellularAutomataBase;
+
+/*!
+ * One or two dimensional lattice of cells, double-buffered: the local rule reads the current states and writes the next ones, which
+ * become current by swap(). Cells are laid out row by row (x is the column and y the row; one dimensional lattices have a single row).
+ *
+ * Bit-packed lattices keep one bit per cell in 64-bit words, so rules can update 64 cells with a few bitwise operations. Each row has
+ * an extra word at each side (cell x is bit x+64 of the row), where the boundary condition places the cells just outside the lattice.
+ * Other lattices keep one double per cell.
+ *
+ * Hexagonal lattices use "odd-r" offset coordinates: odd rows are shifted half a cell to the right.
+ */
+class Lattice {
+public:
+	Lattice(CellularAutomataBase* cellularAutomata);
+	virtual ~Lattice() = default;
+public:
+	CellularAutomataBase* getCellularAutomata() const;
+	void setDimensions(std::vector<unsigned int> dimensions); //!< {width} or {width, height}
+	std::vector<unsigned int> getDimensions() const;
+	unsigned int getWidth() const;
+	unsigned int getHeight() const;
+	unsigned int getNumberOfCells() const;
+	bool isOneDimensional() const;
+	void setHexagonal(bool hexagonal);
+	bool isHexagonal() const;
+	void setBitPacked(bool bitPacked);
+	bool isBitPacked() const;
+	void allocate(); //!< Sizes both buffers for the current dimensions and representation, with all cells in state 0
+	void swap(); //!< Next states become the current ones
+public: // cell access
+	double getState(unsigned int x, unsigned int y = 0) const;
+	void setState(double state, unsigned int x, unsigned int y = 0);
+	void setNextState(double state, unsigned int x, unsigned int y = 0);
+	unsigned long long getPopulation() const; //!< Number of cells not in state 0
+public: // raw access, used by the update kernels
+	const double* getCells() const;
+	double* getNextCells();
+	unsigned int getWordsPerRow() const; //!< Words of each bit-packed row, including the one at each side
+	uint64_t* getRow(unsigned int y);
+	uint64_t* getNextRow(unsigned int y);
+	uint64_t getLastWordMask() const; //!< Bits of the last word of a row that are cells of the lattice
+	static bool GetBit(const uint64_t* row, int x);
+	static void SetBit(uint64_t* row, int x, bool value);
+private:
+	CellularAutomataBase* _cellularAutomata;
+	std::vector<unsigned int> _dimensions{10, 10};
+	bool _hexagonal = false;
+	bool _bitPacked = false;
+	unsigned int _wordsPerRow = 0;
+	std::vector<double> _cells;
+	std::vector<double> _nextCells;
+	std::vector<uint64_t> _words;
+	std::vector<uint64_t> _nextWords;
+};
+
+inline bool Lattice::GetBit(const uint64_t* row, int x) {
+	const unsigned int position = x + 64;
+	return (row[position >> 6] >> (position & 63)) & 1;
+}
+
+inline void Lattice::SetBit(uint64_t* row, int x, bool value) {
+	const unsigned int position = x + 64;
+	const uint64_t bit = uint64_t(1) << (position & 63);
+	if (value) {
+		row[position >> 6] |= bit;
+	} else {
+		row[position >> 6] &= ~bit;
+	}
+}
+
+#endif /* LATTICE_H */
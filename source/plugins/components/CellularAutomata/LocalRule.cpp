@@ -0,0 +1,25 @@
+#include "LocalRule.h"
+
+LocalRule::LocalRule(CellularAutomataBase* cellularAutomata) {
+	_cellularAutomata = cellularAutomata;
+}
+
+CellularAutomataBase* LocalRule::getCellularAutomata() const {
+	return _cellularAutomata;
+}
+
+void LocalRule::setStateSet(StateSet* stateSet) {
+	_stateSet = stateSet;
+}
+
+StateSet* LocalRule::getStateSet() const {
+	return _stateSet;
+}
+
+bool LocalRule::hasBitwiseForm() const {
+	return false;
+}
+
+uint64_t LocalRule::applyBits(uint64_t states, const uint64_t*, unsigned int) const {
+	return states;
+}
@@ -0,0 +1,33 @@
+#ifndef LOCALRULE_H
+#define LOCALRULE_H
+
+#include <cstdint>
+
+class CellularAutomataBase;
+class StateSet;
+
+/*!
+ * Gives the next state of a cell from its current state and the states of its neighbors. Cells are updated concurrently, so applying a
+ * rule must not change it.
+ */
+class LocalRule {
+public:
+	LocalRule(CellularAutomataBase* cellularAutomata);
+	virtual ~LocalRule() = default;
+public:
+	CellularAutomataBase* getCellularAutomata() const;
+	void setStateSet(StateSet* stateSet);
+	StateSet* getStateSet() const;
+public:
+	/*! Next state of a cell, given its state and the states of its neighbors, in the order of the offsets of the neighborhood */
+	virtual double apply(double state, const double* neighbors, unsigned int numNeighbors) const = 0;
+	/*! Whether applyBits() is implemented. Otherwise bit-packed cells are updated one by one with apply() */
+	virtual bool hasBitwiseForm() const;
+	/*! Next states of 64 bit-packed cells, given their states and, for each neighbor, a word with the state of that neighbor of each cell */
+	virtual uint64_t applyBits(uint64_t states, const uint64_t* neighbors, unsigned int numNeighbors) const;
+protected:
+	CellularAutomataBase* _cellularAutomata;
+	StateSet* _stateSet = nullptr;
+};
+
+#endif /* LOCALRULE_H */
@@ -0,0 +1,40 @@
+#include "LocalRule_Elementary.h"
+
+LocalRule_Elementary::LocalRule_Elementary(CellularAutomataBase* cellularAutomata, unsigned long long rule) : LocalRule(cellularAutomata) {
+	_rule = rule;
+}
+
+void LocalRule_Elementary::setRule(unsigned long long rule) {
+	_rule = rule;
+}
+
+unsigned long long LocalRule_Elementary::getRule() const {
+	return _rule;
+}
+
+double LocalRule_Elementary::apply(double, const double* neighbors, unsigned int numNeighbors) const {
+	unsigned int pattern = 0;
+	for (unsigned int i = 0; i < numNeighbors; i++) {
+		pattern = (pattern << 1) | (neighbors[i] != 0.0);
+	}
+	return pattern < 64 ? (_rule >> pattern) & 1 : 0.0;
+}
+
+bool LocalRule_Elementary::hasBitwiseForm() const {
+	return true;
+}
+
+uint64_t LocalRule_Elementary::applyBits(uint64_t, const uint64_t* neighbors, unsigned int numNeighbors) const {
+	// sum of products: the cells whose neighbors match any pattern that the rule maps to 1
+	uint64_t result = 0;
+	for (unsigned int pattern = 0; pattern < 64 && pattern >> numNeighbors == 0; pattern++) {
+		if ((_rule >> pattern) & 1) {
+			uint64_t match = ~uint64_t(0);
+			for (unsigned int i = 0; i < numNeighbors; i++) {
+				match &= (pattern >> (numNeighbors - 1 - i)) & 1 ? neighbors[i] : ~neighbors[i];
+			}
+			result |= match;
+		}
+	}
+	return result;
+}
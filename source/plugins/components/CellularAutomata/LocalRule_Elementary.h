@@ -0,0 +1,23 @@
+#ifndef LOCALRULE_ELEMENTARY_H
+#define LOCALRULE_ELEMENTARY_H
+
+#include "LocalRule.h"
+
+/*!
+ * Elementary (Wolfram) rule for two-state automata. Neighbors, usually the centered neighborhood, form a binary number (the first neighbor is the most significant bit) and the next state is that bit of the rule number. With radius 1 there are 256 rules, from 0 to 255 (as the rule 30 or the rule 110).
+ */
+class LocalRule_Elementary : public LocalRule {
+public:
+	LocalRule_Elementary(CellularAutomataBase* cellularAutomata, unsigned long long rule = 30);
+	virtual ~LocalRule_Elementary() = default;
+public:
+	void setRule(unsigned long long rule);
+	unsigned long long getRule() const;
+	virtual double apply(double state, const double* neighbors, unsigned int numNeighbors) const override;
+	virtual bool hasBitwiseForm() const override;
+	virtual uint64_t applyBits(uint64_t states, const uint64_t* neighbors, unsigned int numNeighbors) const override;
+private:
+	unsigned long long _rule;
+};
+
+#endif /* LOCALRULE_ELEMENTARY_H */
@@ -0,0 +1,31 @@
+#include "LocalRule_GameOfLife.h"
+
+LocalRule_GameOfLife::LocalRule_GameOfLife(CellularAutomataBase* cellularAutomata) : LocalRule(cellularAutomata) {
+}
+
+double LocalRule_GameOfLife::apply(double state, const double* neighbors, unsigned int numNeighbors) const {
+	unsigned int alive = 0;
+	for (unsigned int i = 0; i < numNeighbors; i++) {
+		alive += neighbors[i] != 0.0;
+	}
+	if (alive == 3) {
+		return state != 0.0 ? state : 1.0;
+	}
+	return alive == 2 ? state : 0.0;
+}
+
+bool LocalRule_GameOfLife::hasBitwiseForm() const {
+	return true;
+}
+
+uint64_t LocalRule_GameOfLife::applyBits(uint64_t states, const uint64_t* neighbors, unsigned int numNeighbors) const {
+	// counts the alive neighbors of the 64 cells at once, in two bit planes and a flag for 4 or more
+	uint64_t ones = 0, twos = 0, many = 0;
+	for (unsigned int i = 0; i < numNeighbors; i++) {
+		const uint64_t carry = ones & neighbors[i];
+		ones ^= neighbors[i];
+		many |= twos & carry;
+		twos ^= carry;
+	}
+	return ~many & twos & (ones | states);
+}
@@ -0,0 +1,19 @@
+#ifndef LOCALRULE_GAMEOFLIFE_H
+#define LOCALRULE_GAMEOFLIFE_H
+
+#include "LocalRule.h"
+
+/*!
+ * Conway's Game of Life: a cell in state 0 becomes 1 when exactly 3 neighbors are not in state 0, and any other cell stays in its state when 2 or 3 of them are not, becoming 0 otherwise. Usually applied with the Moore neighborhood.
+ */
+class LocalRule_GameOfLife : public LocalRule {
+public:
+	LocalRule_GameOfLife(CellularAutomataBase* cellularAutomata);
+	virtual ~LocalRule_GameOfLife() = default;
+public:
+	virtual double apply(double state, const double* neighbors, unsigned int numNeighbors) const override;
+	virtual bool hasBitwiseForm() const override;
+	virtual uint64_t applyBits(uint64_t states, const uint64_t* neighbors, unsigned int numNeighbors) const override;
+};
+
+#endif /* LOCALRULE_GAMEOFLIFE_H */
@@ -0,0 +1,25 @@
+#include "LocalRule_Growty.h"
+
+LocalRule_Growty::LocalRule_Growty(CellularAutomataBase* cellularAutomata) : LocalRule(cellularAutomata) {
+}
+
+double LocalRule_Growty::apply(double state, const double* neighbors, unsigned int numNeighbors) const {
+	// neighborhoods are small, so counting each candidate is cheaper than a histogram of all states
+	double winner = state;
+	unsigned int winnerCount = 1;
+	for (unsigned int i = 0; i < numNeighbors; i++) {
+		winnerCount += neighbors[i] == state;
+	}
+	for (unsigned int i = 0; i < numNeighbors; i++) {
+		const double candidate = neighbors[i];
+		unsigned int count = candidate == state;
+		for (unsigned int j = 0; j < numNeighbors; j++) {
+			count += neighbors[j] == candidate;
+		}
+		if (count > winnerCount || (count == winnerCount && candidate > winner)) {
+			winner = candidate;
+			winnerCount = count;
+		}
+	}
+	return winner;
+}
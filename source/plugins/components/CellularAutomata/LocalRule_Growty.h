@@ -0,0 +1,17 @@
+#ifndef LOCALRULE_GROWTY_H
+#define LOCALRULE_GROWTY_H
+
+#include "LocalRule.h"
+
+/*!
+ * Biased competition: the next state of a cell is the most frequent state among the cell and its neighbors, and ties are won by the greatest state. States grow over their neighbors, smoothing the borders between them.
+ */
+class LocalRule_Growty : public LocalRule {
+public:
+	LocalRule_Growty(CellularAutomataBase* cellularAutomata);
+	virtual ~LocalRule_Growty() = default;
+public:
+	virtual double apply(double state, const double* neighbors, unsigned int numNeighbors) const override;
+};
+
+#endif /* LOCALRULE_GROWTY_H */
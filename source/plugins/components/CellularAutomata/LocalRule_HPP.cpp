@@ -0,0 +1,23 @@
+#include "LocalRule_HPP.h"
+
+LocalRule_HPP::LocalRule_HPP(CellularAutomataBase* cellularAutomata) : LocalRule(cellularAutomata) {
+}
+
+unsigned int LocalRule_HPP::_collide(unsigned int particles) {
+	if (particles == 5) { // east and west
+		return 10;
+	} else if (particles == 10) { // north and south
+		return 5;
+	}
+	return particles;
+}
+
+double LocalRule_HPP::apply(double state, const double* neighbors, unsigned int numNeighbors) const {
+	if (numNeighbors != 4) {
+		return state;
+	}
+	// each particle comes from the neighbor opposite to its direction, after colliding there
+	const unsigned int north = _collide((unsigned int) neighbors[0]), east = _collide((unsigned int) neighbors[1]);
+	const unsigned int south = _collide((unsigned int) neighbors[2]), west = _collide((unsigned int) neighbors[3]);
+	return (west & 1) | (south & 2) | (east & 4) | (north & 8);
+}
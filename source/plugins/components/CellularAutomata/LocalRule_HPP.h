@@ -0,0 +1,19 @@
+#ifndef LOCALRULE_HPP_H
+#define LOCALRULE_HPP_H
+
+#include "LocalRule.h"
+
+/*!
+ * HPP (Hardy, Pomeau and de Pazzis) lattice gas. Each cell holds up to four particles, one moving in each direction, as the bits of its state (1 east, 2 north, 4 west, 8 south), so there are 16 states. Two particles colliding head-on leave at right angles, and then every particle moves to the next cell. Requires the von Neumann neighborhood with radius 1 (neighbors are north, east, south and west).
+ */
+class LocalRule_HPP : public LocalRule {
+public:
+	LocalRule_HPP(CellularAutomataBase* cellularAutomata);
+	virtual ~LocalRule_HPP() = default;
+public:
+	virtual double apply(double state, const double* neighbors, unsigned int numNeighbors) const override;
+private:
+	static unsigned int _collide(unsigned int particles);
+};
+
+#endif /* LOCALRULE_HPP_H */
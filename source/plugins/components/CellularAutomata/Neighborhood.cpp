@@ -0,0 +1,82 @@
+#include "Neighborhood.h"
+#include <cstdlib>
+#include <algorithm>
+#include "Lattice.h"
+
+Neighborhood::Neighborhood(CellularAutomataBase* cellularAutomata) {
+	_cellularAutomata = cellularAutomata;
+}
+
+CellularAutomataBase* Neighborhood::getCellularAutomata() const {
+	return _cellularAutomata;
+}
+
+void Neighborhood::setRadius(unsigned int radius) {
+	_radius = radius;
+}
+
+unsigned int Neighborhood::getRadius() const {
+	return _radius;
+}
+
+void Neighborhood::setBoundary(BoundaryCondition* boundary) {
+	_boundary = boundary;
+}
+
+BoundaryCondition* Neighborhood::getBoundary() const {
+	return _boundary;
+}
+
+void Neighborhood::build(Lattice* lattice) {
+	_offsets[0].clear();
+	_offsets[1].clear();
+	_hexagonal = lattice->isHexagonal() && !lattice->isOneDimensional() && _hasHexagonalForm();
+	if (_hexagonal) {
+		_buildHexagonalOffsets(0, &_offsets[0]);
+		_buildHexagonalOffsets(1, &_offsets[1]);
+	} else {
+		_buildOffsets(lattice->isOneDimensional(), &_offsets[0]);
+	}
+	_reachX = _reachY = 0;
+	for (unsigned int parity = 0; parity < 2; parity++) {
+		for (const Offset& offset : _offsets[parity]) {
+			_reachX = std::max(_reachX, (unsigned int) std::abs(offset.dx));
+			_reachY = std::max(_reachY, (unsigned int) std::abs(offset.dy));
+		}
+	}
+}
+
+const std::vector<Neighborhood::Offset>& Neighborhood::getOffsets(unsigned int y) const {
+	return _offsets[_hexagonal ? y & 1 : 0];
+}
+
+unsigned int Neighborhood::getNumberOfNeighbors() const {
+	return _offsets[0].size();
+}
+
+unsigned int Neighborhood::getReachX() const {
+	return _reachX;
+}
+
+unsigned int Neighborhood::getReachY() const {
+	return _reachY;
+}
+
+bool Neighborhood::_hasHexagonalForm() const {
+	return true;
+}
+
+void Neighborhood::_buildHexagonalOffsets(unsigned int parity, std::vector<Offset>* offsets) const {
+	// converts "odd-r" offsets to axial coordinates (q,r), where the distance is (|q|+|r|+|q+r|)/2. The cell itself is at q=0
+	const int radius = _radius;
+	for (int dy = -radius; dy <= radius; dy++) {
+		for (int dx = -radius - 1; dx <= radius + 1; dx++) {
+			const int y = parity + dy;
+			const int q = dx - (y - (y & 1)) / 2;
+			const int distance = (std::abs(q) + std::abs(dy) + std::abs(q + dy)) / 2;
+			if (distance > 0 && distance <= radius) {
+				offsets->push_back({dx, dy});
+			}
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef NEIGHBORHOOD_H
+#define NEIGHBORHOOD_H
+
+#include <vector>
+
+class CellularAutomataBase;
+class BoundaryCondition;
+class Lattice;
+
+/*!
+ * The cells whose states determine the next state of a cell, as offsets from it. Local rules receive the states of the neighbors in the
+ * order of the offsets. On hexagonal lattices neighbors are the cells up to getRadius() hexagonal steps away, whatever the kind of
+ * neighborhood, and offsets depend on the parity of the row.
+ */
+class Neighborhood {
+public:
+
+	struct Offset {
+		int dx;
+		int dy;
+	};
+public:
+	Neighborhood(CellularAutomataBase* cellularAutomata);
+	virtual ~Neighborhood() = default;
+public:
+	CellularAutomataBase* getCellularAutomata() const;
+	void setRadius(unsigned int radius);
+	unsigned int getRadius() const;
+	void setBoundary(BoundaryCondition* boundary);
+	BoundaryCondition* getBoundary() const;
+	void build(Lattice* lattice); //!< Computes the offsets for the lattice. Called when the automaton is initialized
+	const std::vector<Offset>& getOffsets(unsigned int y) const; //!< Offsets of neighbors of cells in row y
+	unsigned int getNumberOfNeighbors() const;
+	unsigned int getReachX() const; //!< Largest horizontal distance to a neighbor
+	unsigned int getReachY() const; //!< Largest vertical distance to a neighbor
+protected:
+	/*! Offsets on square lattices (or on the single row of one dimensional ones) */
+	virtual void _buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const = 0;
+	/*! Whether the neighborhood is replaced by the hexagonal one on hexagonal lattices */
+	virtual bool _hasHexagonalForm() const;
+protected:
+	CellularAutomataBase* _cellularAutomata;
+	unsigned int _radius = 1;
+	BoundaryCondition* _boundary = nullptr;
+private:
+	void _buildHexagonalOffsets(unsigned int parity, std::vector<Offset>* offsets) const;
+private:
+	std::vector<Offset> _offsets[2]; // for even and odd rows
+	bool _hexagonal = false;
+	unsigned int _reachX = 0;
+	unsigned int _reachY = 0;
+};
+
+#endif /* NEIGHBORHOOD_H */
@@ -0,0 +1,15 @@
+#include "Neighborhood_Center.h"
+
+Neighborhood_Center::Neighborhood_Center(CellularAutomataBase* cellularAutomata) : Neighborhood(cellularAutomata) {
+}
+
+void Neighborhood_Center::_buildOffsets(bool, std::vector<Offset>* offsets) const {
+	const int radius = _radius;
+	for (int dx = -radius; dx <= radius; dx++) {
+		offsets->push_back({dx, 0});
+	}
+}
+
+bool Neighborhood_Center::_hasHexagonalForm() const {
+	return false;
+}
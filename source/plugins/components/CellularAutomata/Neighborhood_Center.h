@@ -0,0 +1,18 @@
+#ifndef NEIGHBORHOOD_CENTER_H
+#define NEIGHBORHOOD_CENTER_H
+
+#include "Neighborhood.h"
+
+/*!
+ * Centered neighborhood: the cell itself and the getRadius() cells at each side of it in its row, from left to right (the neighborhood of elementary cellular automata when the radius is 1). It has no hexagonal form.
+ */
+class Neighborhood_Center : public Neighborhood {
+public:
+	Neighborhood_Center(CellularAutomataBase* cellularAutomata);
+	virtual ~Neighborhood_Center() = default;
+protected:
+	virtual void _buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const override;
+	virtual bool _hasHexagonalForm() const override;
+};
+
+#endif /* NEIGHBORHOOD_CENTER_H */
@@ -0,0 +1,15 @@
+#include "Neighborhood_Moore.h"
+
+Neighborhood_Moore::Neighborhood_Moore(CellularAutomataBase* cellularAutomata) : Neighborhood(cellularAutomata) {
+}
+
+void Neighborhood_Moore::_buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const {
+	const int radius = _radius, radiusY = oneDimensional ? 0 : radius;
+	for (int dy = -radiusY; dy <= radiusY; dy++) {
+		for (int dx = -radius; dx <= radius; dx++) {
+			if (dx != 0 || dy != 0) {
+				offsets->push_back({dx, dy});
+			}
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef NEIGHBORHOOD_MOORE_H
+#define NEIGHBORHOOD_MOORE_H
+
+#include "Neighborhood.h"
+
+/*!
+ * Moore neighborhood: the cells whose horizontal and vertical distances are both up to getRadius() (the 8 surrounding cells when the radius is 1), row by row, without the cell itself.
+ */
+class Neighborhood_Moore : public Neighborhood {
+public:
+	Neighborhood_Moore(CellularAutomataBase* cellularAutomata);
+	virtual ~Neighborhood_Moore() = default;
+protected:
+	virtual void _buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const override;
+};
+
+#endif /* NEIGHBORHOOD_MOORE_H */
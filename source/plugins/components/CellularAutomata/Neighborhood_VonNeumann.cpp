@@ -0,0 +1,27 @@
+#include "Neighborhood_VonNeumann.h"
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+Neighborhood_VonNeumann::Neighborhood_VonNeumann(CellularAutomataBase* cellularAutomata) : Neighborhood(cellularAutomata) {
+}
+
+void Neighborhood_VonNeumann::_buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const {
+	const int radius = _radius, radiusY = oneDimensional ? 0 : radius;
+	for (int dy = -radiusY; dy <= radiusY; dy++) {
+		for (int dx = -radius; dx <= radius; dx++) {
+			if ((dx != 0 || dy != 0) && std::abs(dx) + std::abs(dy) <= radius) {
+				offsets->push_back({dx, dy});
+			}
+		}
+	}
+	// y grows southwards, so the clockwise angle from the north is atan2(dx, -dy)
+	const auto angle = [](const Offset & offset) {
+		double angle = std::atan2((double) offset.dx, (double) -offset.dy);
+		return angle < 0.0 ? angle + 2.0 * M_PI : angle;
+	};
+	std::stable_sort(offsets->begin(), offsets->end(), [&angle](const Offset& a, const Offset & b) {
+		const int distanceA = std::abs(a.dx) + std::abs(a.dy), distanceB = std::abs(b.dx) + std::abs(b.dy);
+		return distanceA != distanceB ? distanceA < distanceB : angle(a) < angle(b);
+	});
+}
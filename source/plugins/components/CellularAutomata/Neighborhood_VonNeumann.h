@@ -0,0 +1,17 @@
+#ifndef NEIGHBORHOOD_VONNEUMANN_H
+#define NEIGHBORHOOD_VONNEUMANN_H
+
+#include "Neighborhood.h"
+
+/*!
+ * Von Neumann neighborhood: the cells up to getRadius() horizontal plus vertical steps away, without the cell itself. Neighbors are ordered by distance and then clockwise from the north, so with radius 1 they are north, east, south and west.
+ */
+class Neighborhood_VonNeumann : public Neighborhood {
+public:
+	Neighborhood_VonNeumann(CellularAutomataBase* cellularAutomata);
+	virtual ~Neighborhood_VonNeumann() = default;
+protected:
+	virtual void _buildOffsets(bool oneDimensional, std::vector<Offset>* offsets) const override;
+};
+
+#endif /* NEIGHBORHOOD_VONNEUMANN_H */
@@ -0,0 +1,56 @@
+#include "StateSet.h"
+
+StateSet::StateSet(CellularAutomataBase* cellularAutomata) {
+	_cellularAutomata = cellularAutomata;
+}
+
+CellularAutomataBase* StateSet::getCellularAutomata() const {
+	return _cellularAutomata;
+}
+
+void StateSet::setBitBased(bool bitBased) {
+	_bitBased = bitBased;
+	if (bitBased) {
+		_continuous = false;
+		_numberOfStates = 2;
+	}
+}
+
+bool StateSet::isBitBased() const {
+	return _bitBased;
+}
+
+void StateSet::setContinuous(bool continuous) {
+	_continuous = continuous;
+	if (continuous) {
+		_bitBased = false;
+	}
+}
+
+bool StateSet::isContinuous() const {
+	return _continuous;
+}
+
+void StateSet::setNumberOfStates(unsigned int numberOfStates) {
+	_numberOfStates = _bitBased ? 2 : numberOfStates;
+}
+
+unsigned int StateSet::getNumberOfStates() const {
+	return _numberOfStates;
+}
+
+void StateSet::setInitialDensity(double initialDensity) {
+	_initialDensity = initialDensity;
+}
+
+double StateSet::getInitialDensity() const {
+	return _initialDensity;
+}
+
+void StateSet::setSeed(unsigned int seed) {
+	_seed = seed;
+}
+
+unsigned int StateSet::getSeed() const {
+	return _seed;
+}
@@ -0,0 +1,35 @@
+#ifndef STATESET_H
+#define STATESET_H
+
+class CellularAutomataBase;
+
+/*!
+ * The set of states a cell may be in. States are always numbers: integers from 0 to getNumberOfStates()-1 (enumerated, integer and
+ * bit based sets), or real numbers in [0,1) (continuous sets). Bit based sets have just two states and are kept bit-packed in the lattice.
+ */
+class StateSet {
+public:
+	StateSet(CellularAutomataBase* cellularAutomata);
+	virtual ~StateSet() = default;
+public:
+	CellularAutomataBase* getCellularAutomata() const;
+	void setBitBased(bool bitBased);
+	bool isBitBased() const;
+	void setContinuous(bool continuous);
+	bool isContinuous() const;
+	void setNumberOfStates(unsigned int numberOfStates);
+	unsigned int getNumberOfStates() const;
+	void setInitialDensity(double initialDensity); //!< Probability of a cell not being in state 0 when the automaton is initialized
+	double getInitialDensity() const;
+	void setSeed(unsigned int seed); //!< Seed used to initialize the cells, so every replication starts from the same states
+	unsigned int getSeed() const;
+private:
+	CellularAutomataBase* _cellularAutomata;
+	bool _bitBased = false;
+	bool _continuous = false;
+	unsigned int _numberOfStates = 2;
+	double _initialDensity = 0.5;
+	unsigned int _seed = 0;
+};
+
+#endif /* STATESET_H */
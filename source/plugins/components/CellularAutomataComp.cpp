@@ -20,6 +20,7 @@
 #include "CellularAutomata/LocalRule_Elementary.h"
 #include "CellularAutomata/LocalRule_GameOfLife.h"
 #include "CellularAutomata/LocalRule_Growty.h"
+#include "CellularAutomata/LocalRule_HPP.h"
 #include "CellularAutomata/Neighborhood_Center.h"
 #include "CellularAutomata/Neighborhood_Moore.h"
 #include "CellularAutomata/Neighborhood_VonNeumann.h"
@@ -36,10 +37,35 @@ ModelDataDefinition* CellularAutomataComp::NewInstance(Model* model, std::string
 }
 
 CellularAutomataComp::CellularAutomataComp(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<CellularAutomataComp>(), name) {
+	setCellularAutomataType(DEFAULT.cellularAutomataType);
+	setLatticeType(DEFAULT.latticeType);
+	setNeighboorhoodType(DEFAULT.neighboorhoodType);
+	setBoundaryType(DEFAULT.boundaryType);
+	setStateSetType(DEFAULT.stateSetType);
+	setLocalRuleType(DEFAULT.localRuleType);
+}
+
+CellularAutomataComp::~CellularAutomataComp() {
+	delete _cellularAutomata;
+	delete _lattice;
+	delete _neighboorhood;
+	delete _boundary;
+	delete _stateSet;
+	delete _localRule;
 }
 
 std::string CellularAutomataComp::show() {
-	return ModelComponent::show() + "";
+	std::string text = ModelComponent::show() +
+			",cellularAutomataType=" + std::to_string(static_cast<int> (_cellularAutomataType)) +
+			",latticeType=" + std::to_string(static_cast<int> (_latticeType)) +
+			",neighboorhoodType=" + std::to_string(static_cast<int> (_neighboorhoodType)) +
+			",boundaryType=" + std::to_string(static_cast<int> (_boundaryType)) +
+			",stateSetType=" + std::to_string(static_cast<int> (_stateSetType)) +
+			",localRuleType=" + std::to_string(static_cast<int> (_localRuleType));
+	if (_cellularAutomata != nullptr) {
+		text += ",generation=" + std::to_string(_cellularAutomata->getGeneration()) + ",cellUpdatesPerSecond=" + std::to_string(_cellularAutomata->getCellUpdatesPerSecond());
+	}
+	return text;
 }
 
 
@@ -53,26 +79,102 @@ ModelComponent* CellularAutomataComp::LoadInstance(Model* model, PersistenceReco
 	return newComponent;
 }
 
-void CellularAutomataComp::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+void CellularAutomataComp::_onDispatchEvent(Entity* entity, unsigned int) {
 	_cellularAutomata->step();
-	_parentModel->sendEntityToComponent(entity, this->getConnections()->getFrontConnection());
+	traceSimulation(this, "Generation " + std::to_string(_cellularAutomata->getGeneration()) + " computed (" + std::to_string(_cellularAutomata->getLastStepCellUpdatesPerSecond()) + " cell-updates/second)");
+	_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
 bool CellularAutomataComp::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		setCellularAutomataType(static_cast<CellularAutomataType> (fields->loadField("cellularAutomataType", static_cast<int> (DEFAULT.cellularAutomataType))));
+		setLatticeType(static_cast<LatticeType> (fields->loadField("latticeType", static_cast<int> (DEFAULT.latticeType))));
+		setNeighboorhoodType(static_cast<NeighboorhoodType> (fields->loadField("neighboorhoodType", static_cast<int> (DEFAULT.neighboorhoodType))));
+		setBoundaryType(static_cast<BoundaryType> (fields->loadField("boundaryType", static_cast<int> (DEFAULT.boundaryType))));
+		setStateSetType(static_cast<StateSetType> (fields->loadField("stateSetType", static_cast<int> (DEFAULT.stateSetType))));
+		setLocalRuleType(static_cast<LocalRuleType> (fields->loadField("localRuleType", static_cast<int> (DEFAULT.localRuleType))));
+		unsigned int numDimensions = fields->loadField("dimensions", 0u);
+		if (numDimensions > 0) {
+			std::vector<unsigned int> dimensions;
+			for (unsigned int i = 0; i < numDimensions; i++) {
+				dimensions.push_back(fields->loadField("dimension" + Util::StrIndex(i), 1u));
+			}
+			_lattice->setDimensions(dimensions);
+		}
+		if (_neighboorhood != nullptr) {
+			_neighboorhood->setRadius(fields->loadField("radius", 1u));
+		}
+		_stateSet->setNumberOfStates(fields->loadField("numberOfStates", 2u));
 	}
 	return res;
 }
 
 void CellularAutomataComp::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("cellularAutomataType", static_cast<int> (_cellularAutomataType), static_cast<int> (DEFAULT.cellularAutomataType), saveDefaultValues);
+	fields->saveField("latticeType", static_cast<int> (_latticeType), static_cast<int> (DEFAULT.latticeType), saveDefaultValues);
+	fields->saveField("neighboorhoodType", static_cast<int> (_neighboorhoodType), static_cast<int> (DEFAULT.neighboorhoodType), saveDefaultValues);
+	fields->saveField("boundaryType", static_cast<int> (_boundaryType), static_cast<int> (DEFAULT.boundaryType), saveDefaultValues);
+	fields->saveField("stateSetType", static_cast<int> (_stateSetType), static_cast<int> (DEFAULT.stateSetType), saveDefaultValues);
+	fields->saveField("localRuleType", static_cast<int> (_localRuleType), static_cast<int> (DEFAULT.localRuleType), saveDefaultValues);
+	std::vector<unsigned int> dimensions = _lattice->getDimensions();
+	fields->saveField("dimensions", (unsigned int) dimensions.size(), 0u, saveDefaultValues);
+	for (unsigned int i = 0; i < dimensions.size(); i++) {
+		fields->saveField("dimension" + Util::StrIndex(i), dimensions[i], 1u, saveDefaultValues);
+	}
+	if (_neighboorhood != nullptr) {
+		fields->saveField("radius", _neighboorhood->getRadius(), 1u, saveDefaultValues);
+	}
+	fields->saveField("numberOfStates", _stateSet->getNumberOfStates(), 2u, saveDefaultValues);
 }
 
 bool CellularAutomataComp::_check(std::string* errorMessage) {
-	*errorMessage += "";
+	bool resultAll = true;
+	if (_cellularAutomata == nullptr) {
+		*errorMessage += "Cellular automata type " + std::to_string(static_cast<int> (_cellularAutomataType)) + " is not supported. ";
+		resultAll = false;
+	}
+	if (_latticeType != LatticeType::RETICULAR && _latticeType != LatticeType::HEXAGONAL) {
+		*errorMessage += "Lattice type " + std::to_string(static_cast<int> (_latticeType)) + " is not supported. ";
+		resultAll = false;
+	}
+	if (_neighboorhood == nullptr) {
+		*errorMessage += "Neighboorhood type " + std::to_string(static_cast<int> (_neighboorhoodType)) + " is not supported. ";
+		resultAll = false;
+	}
+	if (_boundary == nullptr) {
+		*errorMessage += "Boundary type " + std::to_string(static_cast<int> (_boundaryType)) + " is not supported. ";
+		resultAll = false;
+	}
+	if (_localRule == nullptr) {
+		*errorMessage += "Local rule type " + std::to_string(static_cast<int> (_localRuleType)) + " is not supported. ";
+		resultAll = false;
+	}
+	if (_lattice->getNumberOfCells() == 0 || _lattice->getDimensions().size() > 2) {
+		*errorMessage += "Lattice must have one or two non null dimensions. ";
+		resultAll = false;
+	}
+	if (_cellularAutomataType == CellularAutomataType::TIMED_1D && !_lattice->isOneDimensional()) {
+		*errorMessage += "Timed 1D cellular automata requires an one dimensional lattice. ";
+		resultAll = false;
+	}
+	if (_localRuleType == LocalRuleType::HPP && (_neighboorhoodType != NeighboorhoodType::VONNEUMANN || _neighboorhood->getRadius() != 1 || _stateSetType == StateSetType::BITBASED)) {
+		*errorMessage += "HPP rule requires von Neumann neighboorhood with radius 1 and 16 states. ";
+		resultAll = false;
+	}
+	if (resultAll) {
+		_connectParts();
+	}
+	return resultAll;
+}
+
+void CellularAutomataComp::_initBetweenReplications() {
+	_connectParts();
+	_cellularAutomata->init();
+}
+
+void CellularAutomataComp::_connectParts() {
 	_cellularAutomata->setLattice(_lattice);
 	_cellularAutomata->setLocalRule(_localRule);
 	_cellularAutomata->setNeighborhood(_neighboorhood);
@@ -81,11 +183,6 @@ bool CellularAutomataComp::_check(std::string* errorMessage) {
 	_neighboorhood->setBoundary(_boundary);
 	_boundary->setLattice(_lattice);
 	_boundary->setNeighborhood(_neighboorhood);
-	return true;
-}
-
-void CellularAutomataComp::_initBetweenReplications() {
-	_cellularAutomata->init();
 }
 
 LocalRule *CellularAutomataComp::getlocalRule() const
@@ -109,6 +206,12 @@ void CellularAutomataComp::setLocalRuleType(CellularAutomataComp::LocalRuleType
 		_localRule = new LocalRule_GameOfLife(_cellularAutomata);
 	} else if (_localRuleType == LocalRuleType::BIASED_COMPETITION) {
 		_localRule = new LocalRule_Growty(_cellularAutomata);
+	} else if (_localRuleType == LocalRuleType::HPP) {
+		_localRule = new LocalRule_HPP(_cellularAutomata);
+		if (_stateSet != nullptr)
+			_stateSet->setNumberOfStates(16); // a particle for each direction
+	} else {
+		_localRule = nullptr;
 	}
 }
 
@@ -117,6 +220,8 @@ void CellularAutomataComp::setStateSetType(CellularAutomataComp::StateSetType ne
 	_stateSetType = newStateSetType;
 	if (_stateSet == nullptr)
 		_stateSet = new StateSet(_cellularAutomata);
+	_stateSet->setBitBased(_stateSetType == StateSetType::BITBASED);
+	_stateSet->setContinuous(_stateSetType == StateSetType::DOUBLEBASED);
 }
 
 
@@ -125,9 +230,9 @@ CellularAutomataComp::StateSetType CellularAutomataComp::getStateSetType() const
 	return _stateSetType;
 }
 
-//CellularAutomataBase *CellularAutomataComp::getcellularAutomata() const{
-//	return _cellularAutomata;
-//}
+CellularAutomataBase *CellularAutomataComp::getcellularAutomata() const{
+	return _cellularAutomata;
+}
 
 Lattice *CellularAutomataComp::getlattice() const
 {
@@ -139,9 +244,9 @@ Neighborhood *CellularAutomataComp::getNeighboorhood() const
 	return _neighboorhood;
 }
 
-//BoundaryCondition *CellularAutomataComp::getBoundary() const{
-//	return _boundary;
-//}
+BoundaryCondition *CellularAutomataComp::getBoundary() const{
+	return _boundary;
+}
 
 StateSet *CellularAutomataComp::getStateSet() const
 {
@@ -157,11 +262,13 @@ void CellularAutomataComp::setCellularAutomataType(CellularAutomataComp::Cellula
 {
 	_cellularAutomataType = newCellularAutomataType;
 	if (_cellularAutomata != nullptr)
-		_cellularAutomata->~CellularAutomataBase();
+		delete _cellularAutomata;
 	if (_cellularAutomataType == CellularAutomataType::CLASSIC)
 		_cellularAutomata = new CellularAutomata_Classic();
 	else if (_cellularAutomataType == CellularAutomataType::TIMED_1D)
 		_cellularAutomata = new CellularAutomata_1DTimed();
+	else
+		_cellularAutomata = nullptr;
 }
 
 CellularAutomataComp::LatticeType CellularAutomataComp::getLatticeType() const
@@ -174,6 +281,7 @@ void CellularAutomataComp::setLatticeType(CellularAutomataComp::LatticeType newL
 	_latticeType = newLatticeStructure;
 	if (_lattice == nullptr)
 		_lattice = new Lattice(_cellularAutomata);
+	_lattice->setHexagonal(_latticeType == LatticeType::HEXAGONAL);
 }
 
 CellularAutomataComp::NeighboorhoodType CellularAutomataComp::getNeighboorhoodType() const
@@ -192,6 +300,8 @@ void CellularAutomataComp::setNeighboorhoodType(CellularAutomataComp::Neighboorh
 		_neighboorhood = new Neighborhood_Moore(_cellularAutomata);
 	else if (_neighboorhoodType == NeighboorhoodType::VONNEUMANN)
 		_neighboorhood = new Neighborhood_VonNeumann(_cellularAutomata);
+	else
+		_neighboorhood = nullptr;
 }
 
 CellularAutomataComp::BoundaryType CellularAutomataComp::geBoundaryType() const
@@ -208,12 +318,15 @@ void CellularAutomataComp::setBoundaryType(CellularAutomataComp::BoundaryType ne
 		_boundary = new Boundary_Closed();
 	else if (_boundaryType == BoundaryType::FIXED)
 		_boundary = new Boundary_Fixed();
+	else
+		_boundary = nullptr;
 }
 
 PluginInformation* CellularAutomataComp::GetPluginInformation() {
 	PluginInformation* info = new PluginInformation(Util::TypeOf<CellularAutomataComp>(), &CellularAutomataComp::LoadInstance, &CellularAutomataComp::NewInstance);
 	info->setCategory("Logic");
-	info->setDescriptionHelp("//@TODO");
+	info->setDescriptionHelp("Cellular automaton that computes a new generation of its cells each time an entity arrives. "
+			"Lattices may be one or two dimensional, reticular or hexagonal, and two-state (bit based) lattices are updated 64 cells at a time. ");
 	return info;
 }
 
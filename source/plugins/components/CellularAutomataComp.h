@@ -22,7 +22,9 @@
 class BoundaryCondition;
 
 /*!
- This component ...
+ This component is a cellular automaton that computes a new generation each time an entity arrives, and then sends the entity forward.
+ The automaton is assembled from the chosen types of lattice, neighborhood, boundary condition, state set and local rule, and it is
+ reinitialized at the beginning of each replication.
  */
 class CellularAutomataComp : public ModelComponent {
 public: //! enums
@@ -56,7 +58,7 @@ public: //! enums
 	
 public: //! constructors
 	CellularAutomataComp(Model* model, std::string name = "");
-	virtual ~CellularAutomataComp() = default;
+	virtual ~CellularAutomataComp();
 
 public: //! new public user methods for this component
 	CellularAutomataComp::CellularAutomataType getCellularAutomataType() const;
@@ -74,11 +76,11 @@ public: //! new public user methods for this component
 	CellularAutomataComp::StateSetType getStateSetType() const;
 	void setStateSetType(CellularAutomataComp::StateSetType newStateSetType);
 
-	//CellularAutomataBase *getcellularAutomata() const;
+	CellularAutomataBase *getcellularAutomata() const;
 	Lattice *getlattice() const;
 	Neighborhood *getNeighboorhood() const;
-	//BoundaryCondition *getBoundary() const;
-	StateSet *getStateSet() const;	
+	BoundaryCondition *getBoundary() const;
+	StateSet *getStateSet() const;
 
 public: //! virtual public methods
 	virtual std::string show();
@@ -111,7 +113,7 @@ protected: //! virtual protected methods that could be overriden by derived clas
 	// virtual void _addProperty(PropertyBase* property);
 
 private: //! new private user methods
-	// ...
+	void _connectParts(); //!< Connects the parts of the automaton to each other, since any of them may have been replaced
 
 private: //! Attributes that should be loaded or saved with this component (Persistent Fields)
 
@@ -80,16 +80,10 @@ PluginInformation* Clone::GetPluginInformation() {
 void Clone::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	unsigned int numClones = _parentModel->parseExpression(_numClonesExpression);
 	traceSimulation(this, TraceManager::Level::L7_internal, "Clonig " + std::to_string(numClones) + " entities.  // " + _numClonesExpression);
-	std::string attribName;
-	double value;
 	for (unsigned int i = 0; i < numClones; i++) {
 		Entity* newEntity = _parentModel->createEntity(entity->getEntityType()->getName() + "_%", true);
 		newEntity->setEntityType(entity->getEntityType());
-		for (ModelDataDefinition* attrib : *_parentModel->getDataManager()->getDataDefinitionList(Util::TypeOf<Attribute>())->list()) {
-			attribName = attrib->getName();
-			value = entity->getAttributeValue(attribName);
-			newEntity->setAttributeValue(attribName, value);
-		}
+		newEntity->copyAttributeValuesFrom(entity);
 		traceSimulation(this, TraceManager::Level::L8_detailed, "Entity \"" + entity->getName() + "\" was cloned to " + newEntity->getName());
 		_parentModel->sendEntityToComponent(newEntity, this->getConnectionManager()->getConnectionAtPort(1)); // port 1 is the clone output port
 	}
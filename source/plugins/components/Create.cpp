@@ -15,6 +15,7 @@
 #include "../../kernel/simulator/Model.h"
 #include "../../kernel/simulator/EntityType.h"
 #include "../../kernel/simulator/ModelDataManager.h"
+#include "../../kernel/TraitsKernel.h"
 #include <cassert>
 
 #ifdef PLUGINCONNECT_DYNAMIC
@@ -60,6 +61,13 @@ Create::Create(Model* model, std::string name) : SourceModelComponent(model, Uti
 	// setting properties
 	_addProperty(propTimeBetweenCreationsFormula);
 	_addProperty(propTimeBetweenCreationsSchedule);
+	// each Create draws its own stream, so arrivals of rate scheduled ones are not the same
+	TraitsKernel<Sampler_if>::Implementation* sampler = new TraitsKernel<Sampler_if>::Implementation();
+	TraitsKernel<Sampler_if>::Parameters* parameters = new TraitsKernel<Sampler_if>::Parameters();
+	parameters->seed += 7919u * getId();
+	sampler->setRNGparameters(parameters);
+	sampler->reset();
+	_sampler = sampler;
 }
 
 std::string Create::show() {
@@ -73,30 +81,23 @@ void Create::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	entity->setAttributeValue("Entity.Type", (double) entity->getEntityType()->getId());
 	//entity->setAttributeValue("Entity.Picture", 1);
 	double timeBetweenCreations, timeScale, newArrivalTime;
-	unsigned int _maxCreations = _parentModel->parseExpression(this->_maxCreationsExpression);
 	if (tnow != _lastArrival) {
 		_lastArrival = tnow;
-		if (_timeBetweenCreationsExpression != "") {
-			timeBetweenCreations = _parentModel->parseExpression(_timeBetweenCreationsExpression);
-		} else if (_timeBetweenCreationsSchedule != nullptr) {
-			timeBetweenCreations = _parentModel->parseExpression(_timeBetweenCreationsSchedule->getExpression());
-		} else if (_timeBetweenCreationsFormula != nullptr) {
-			timeBetweenCreations = _parentModel->parseExpression(_timeBetweenCreationsFormula->getExpression());
+		if (_isArrivalRateScheduled()) {
+			_pendingArrivalWork = _sampler->sampleExponential(1.0);
+			_scheduleArrivalByRate(tnow);
 		} else {
-			//Never could get here
-			assert(false);
-		}
-		timeScale = Util::TimeUnitConvert(this->_timeBetweenCreationsTimeUnit, _parentModel->getSimulation()->getReplicationBaseTimeUnit());
-		newArrivalTime = std::max<double>(tnow + timeBetweenCreations*timeScale, tnow); // force no time travel to past. Not sure if it should really be avoided
-		for (unsigned int i = 0; i<this->_entitiesPerCreation; i++) {
-			if (_entitiesCreatedSoFar < _maxCreations) {
-				_entitiesCreatedSoFar++;
-				Entity* newEntity = _parentModel->createEntity(entity->getEntityType()->getName() + "_%", false);
-				newEntity->setEntityType(entity->getEntityType());
-				Event* newEvent = new Event(newArrivalTime, newEntity, this);
-				_parentModel->getFutureEvents()->insert(newEvent);
-				traceSimulation(this, "Arrival of "/*entity " + std::to_string(newEntity->entityNumber())*/ + newEntity->getName() + " scheduled for time " + std::to_string(newArrivalTime) + Util::StrTimeUnitShort(_parentModel->getSimulation()->getReplicationBaseTimeUnit()));
+			if (_timeBetweenCreationsExpression != "") {
+				timeBetweenCreations = _parentModel->parseExpression(_timeBetweenCreationsExpression);
+			} else if (_timeBetweenCreationsFormula != nullptr) {
+				timeBetweenCreations = _parentModel->parseExpression(_timeBetweenCreationsFormula->getExpression());
+			} else {
+				//Never could get here
+				assert(false);
 			}
+			timeScale = Util::TimeUnitConvert(this->_timeBetweenCreationsTimeUnit, _parentModel->getSimulation()->getReplicationBaseTimeUnit());
+			newArrivalTime = std::max<double>(tnow + timeBetweenCreations*timeScale, tnow); // force no time travel to past. Not sure if it should really be avoided
+			_scheduleArrival(entity->getEntityType(), newArrivalTime);
 		}
 	}
 	if (_reportStatistics)
@@ -104,6 +105,71 @@ void Create::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
+void Create::_scheduleArrival(EntityType* entityType, double arrivalTime) {
+	unsigned int _maxCreations = _parentModel->parseExpression(this->_maxCreationsExpression);
+	for (unsigned int i = 0; i<this->_entitiesPerCreation; i++) {
+		if (_entitiesCreatedSoFar < _maxCreations) {
+			_entitiesCreatedSoFar++;
+			Entity* newEntity = _parentModel->createEntity(entityType->getName() + "_%", false);
+			newEntity->setEntityType(entityType);
+			Event* newEvent = new Event(arrivalTime, newEntity, this);
+			_parentModel->getFutureEvents()->insert(newEvent);
+			traceSimulation(this, "Arrival of "/*entity " + std::to_string(newEntity->entityNumber())*/ + newEntity->getName() + " scheduled for time " + std::to_string(arrivalTime) + Util::StrTimeUnitShort(_parentModel->getSimulation()->getReplicationBaseTimeUnit()));
+		}
+	}
+}
+
+/*!
+ * When there is no time between creations expression, the schedule gives the arrival rate (entities per time unit), as the mean of
+ * exponential times between creations that change along the time
+ */
+bool Create::_isArrivalRateScheduled() const {
+	return _timeBetweenCreationsExpression == "" && _timeBetweenCreationsSchedule != nullptr;
+}
+
+void Create::_scheduleRateChange(double time) {
+	double breakpoint;
+	SchedulableItem* item;
+	if (_timeBetweenCreationsSchedule->getNextBreakpoint(time, &breakpoint, &item)) {
+		_nextRateChange = breakpoint;
+		InternalEvent* intEvent = new InternalEvent(breakpoint, "Create Arrival Rate Change");
+		intEvent->setEventHandler<Create>(this, &Create::_onRateChangeEvent, item);
+		_parentModel->getFutureEvents()->insert(intEvent);
+	} else {
+		_nextRateChange = std::numeric_limits<double>::infinity();
+	}
+}
+
+void Create::_onRateChangeEvent(void* parameter) {
+	if (_entitiesCreatedSoFar >= (unsigned int) _parentModel->parseExpression(_maxCreationsExpression)) { // no more arrivals, so no more rate changes
+		_nextRateChange = std::numeric_limits<double>::infinity();
+		return;
+	}
+	SchedulableItem* item = static_cast<SchedulableItem*> (parameter);
+	double tnow = _parentModel->getSimulation()->getSimulatedTime();
+	double timeScale = Util::TimeUnitConvert(this->_timeBetweenCreationsTimeUnit, _parentModel->getSimulation()->getReplicationBaseTimeUnit());
+	_arrivalRate = std::max<double>(_parentModel->parseExpression(item->getExpression()) / timeScale, 0.0);
+	_scheduleRateChange(_nextRateChange);
+	if (_pendingArrivalWork >= 0.0) {
+		_scheduleArrivalByRate(tnow);
+	}
+}
+
+/*!
+ * Arrivals of a non-stationary Poisson process by inversion of its cumulative rate: the next arrival happens when the integral of the
+ * rate from the last one reaches a unit exponential work. As the rate is constant between breakpoints, the arrival is scheduled if it
+ * happens before the next breakpoint; otherwise the work done until it is discounted and the arrival waits for the rate change there
+ */
+void Create::_scheduleArrivalByRate(double from) {
+	if (_arrivalRate > 0.0 && from + _pendingArrivalWork / _arrivalRate <= _nextRateChange) {
+		double arrivalTime = from + _pendingArrivalWork / _arrivalRate;
+		_pendingArrivalWork = -1.0;
+		_scheduleArrival(getEntityType(), arrivalTime);
+	} else if (_arrivalRate > 0.0) {
+		_pendingArrivalWork -= (_nextRateChange - from) * _arrivalRate;
+	}
+}
+
 PluginInformation* Create::GetPluginInformation() {
 	PluginInformation* info = new PluginInformation(Util::TypeOf<Create>(), &Create::LoadInstance, &Create::NewInstance);
 	info->setSource(true);
@@ -141,7 +207,20 @@ bool Create::_loadInstance(PersistenceRecord *fields) {
 }
 
 void Create::_initBetweenReplications() {
-	SourceModelComponent::_initBetweenReplications();
+	_lastArrival = -1.0;
+	if (!_isArrivalRateScheduled()) {
+		SourceModelComponent::_initBetweenReplications();
+		return;
+	}
+	// the first creation does not apply, and arrivals follow the rate since time zero
+	_entitiesCreatedSoFar = 0;
+	_timeBetweenCreationsSchedule->compile();
+	SchedulableItem* item = _timeBetweenCreationsSchedule->getItemAt(0.0);
+	double timeScale = Util::TimeUnitConvert(this->_timeBetweenCreationsTimeUnit, _parentModel->getSimulation()->getReplicationBaseTimeUnit());
+	_arrivalRate = item != nullptr ? std::max<double>(_parentModel->parseExpression(item->getExpression()) / timeScale, 0.0) : 0.0;
+	_scheduleRateChange(0.0);
+	_pendingArrivalWork = _sampler->sampleExponential(1.0);
+	_scheduleArrivalByRate(0.0);
 }
 
 void Create::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
@@ -149,7 +228,15 @@ void Create::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 }
 
 bool Create::_check(std::string* errorMessage) {
-	bool resultAll = SourceModelComponent::_check(errorMessage);
+	bool resultAll;
+	if (_isArrivalRateScheduled()) { // there is no time between creations expression to check
+		resultAll = _parentModel->getDataManager()->check(Util::TypeOf<EntityType>(), getEntityType(), "entitytype", errorMessage);
+		for (SchedulableItem* item : *_timeBetweenCreationsSchedule->getSchedulableItems()->list()) {
+			resultAll &= _parentModel->checkExpression(item->getExpression(), "arrival rate", errorMessage);
+		}
+	} else {
+		resultAll = SourceModelComponent::_check(errorMessage);
+	}
 	// @TODO Check expression with Schedule and Formula all together
 	return resultAll;
 }
@@ -163,4 +250,7 @@ void Create::_createInternalAndAttachedData() {
 		this->_internalDataClear();
 		_numberOut = nullptr;
 	}
+	if (_timeBetweenCreationsSchedule != nullptr) {
+		_attachedDataInsert("TimeBetweenCreationsSchedule", _timeBetweenCreationsSchedule);
+	}
 }
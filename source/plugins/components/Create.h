@@ -20,6 +20,7 @@
 #include "../../kernel/simulator/EntityType.h"
 #include "../../kernel/simulator/Counter.h"
 #include "../../kernel/simulator/Plugin.h"
+#include "../../kernel/statistics/Sampler_if.h"
 
 #include "../../plugins/data/Formula.h"
 #include "../../plugins/data/Schedule.h"
@@ -93,8 +94,19 @@ protected:
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 	virtual bool _check(std::string* errorMessage);
 	virtual void _createInternalAndAttachedData();
+private:
+	void _scheduleArrival(EntityType* entityType, double arrivalTime);
+	bool _isArrivalRateScheduled() const;
+	void _scheduleRateChange(double time);
+	void _onRateChangeEvent(void* parameter);
+	void _scheduleArrivalByRate(double from);
 private:
 	double _lastArrival = -1.0;
+	Sampler_if* _sampler;
+private: // arrivals whose rate is given by the schedule (non-stationary Poisson process)
+	double _arrivalRate = 0.0; //!< entities per base time unit, changed by an InternalEvent at each breakpoint
+	double _nextRateChange = 0.0;
+	double _pendingArrivalWork = -1.0; //!< unit exponential work left to the next arrival, while it is beyond the next breakpoint (negative if none)
 private: // internal elements
 	Counter* _numberOut = nullptr; // internal modeldatum
 private: // attached elements
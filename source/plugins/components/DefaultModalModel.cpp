@@ -13,8 +13,7 @@
 
 #include "DefaultModalModel.h"
 #include "../../kernel/simulator/Model.h"
-//#include "../../kernel/simulator/Simulator.h"
-//#include "../../kernel/simulator/PluginManager.h"
+#include "../../kernel/TraitsKernel.h"
 
 
 
@@ -31,6 +30,16 @@ extern "C" StaticGetPluginInformation GetPluginInformation() {
 //
 
 DefaultModalModel::DefaultModalModel(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<DefaultModalModel>(), name) {
+	_sampler = new TraitsKernel<Sampler_if>::Implementation();
+
+	SimulationControlGeneric<unsigned int>* propStepsPerEntity = new SimulationControlGeneric<unsigned int>(
+									std::bind(&DefaultModalModel::getStepsPerEntity, this), std::bind(&DefaultModalModel::setStepsPerEntity, this, std::placeholders::_1),
+									Util::TypeOf<DefaultModalModel>(), getName(), "StepsPerEntity", "");
+
+	_parentModel->getControls()->insert(propStepsPerEntity);
+
+	// setting properties
+	_addProperty(propStepsPerEntity);
 }
 
 
@@ -50,7 +59,47 @@ void DefaultModalModel::addTransition(DefaultNodeTransition* transition){
 void DefaultModalModel::removeTransition(DefaultNodeTransition* transition){
     _transitions->remove(transition);
 }
-// ...
+
+List<DefaultNode*>* DefaultModalModel::getNodes() const {
+	return _nodes;
+}
+
+List<DefaultNodeTransition*>* DefaultModalModel::getTransitions() const {
+	return _transitions;
+}
+
+void DefaultModalModel::setInitialNode(DefaultNode* initialNode) {
+	_initialNode = initialNode;
+}
+
+DefaultNode* DefaultModalModel::getInitialNode() const {
+	return _initialNode;
+}
+
+void DefaultModalModel::setStepsPerEntity(unsigned int stepsPerEntity) {
+	_stepsPerEntity = stepsPerEntity;
+}
+
+unsigned int DefaultModalModel::getStepsPerEntity() const {
+	return _stepsPerEntity;
+}
+
+DefaultNode* DefaultModalModel::getCurrentNode() const {
+	return _currentNode >= 0 ? _table.getNode(_currentNode) : nullptr;
+}
+
+unsigned long DefaultModalModel::getNumberOfVisits(DefaultNode* node) const {
+	int index = _table.getIndex(node);
+	return index >= 0 && index < (int) _visits.size() ? _visits[index] : 0;
+}
+
+unsigned long DefaultModalModel::getNumberOfTransitionsTaken() const {
+	return _transitionsTaken;
+}
+
+DefaultNodeTransitionTable* DefaultModalModel::getTransitionTable() {
+	return &_table;
+}
 
 
 //
@@ -58,7 +107,7 @@ void DefaultModalModel::removeTransition(DefaultNodeTransition* transition){
 //
 
 std::string DefaultModalModel::show() {
-	return ModelComponent::show() + "";
+	return ModelComponent::show() + ",nodes=" + std::to_string(_nodes->size()) + ",transitions=" + std::to_string(_transitions->size()) + ",stepsPerEntity=" + std::to_string(_stepsPerEntity);
 }
 
 
@@ -68,20 +117,9 @@ std::string DefaultModalModel::show() {
 
 PluginInformation* DefaultModalModel::GetPluginInformation() {
     PluginInformation* info = new PluginInformation(Util::TypeOf<DefaultModalModel>(), &DefaultModalModel::LoadInstance, &DefaultModalModel::NewInstance);
-	//info->setCategory("Discrete Processing");
-	//info->setMinimumInputs(1);
-	//info->setMinimumOutputs(1);
-	//info->setMaximumInputs(1);
-	//info->setMaximumOutputs(1);
-	//info->setSource(false);
-	//info->setSink(false);
-	//info->setSendTransfer(false);
-	//info->setReceiveTransfer(false);
-	//info->insertDynamicLibFileDependence("...");
-	//info->setDescriptionHelp("//@TODO");
-	//info->setAuthor("...");
-	//info->setDate("...");
-	//info->setObservation("...");
+	info->setCategory("Network");
+	info->insertDynamicLibFileDependence("defaultnode.so");
+	info->setDescriptionHelp("A finite state machine or Markov chain whose states are nodes. Each entity that arrives makes the model take a number of transitions from its current node, chosen among the enabled ones (whose guards are true) with probability proportional to their probabilities, and then goes to the next component.");
 	return info;
 }
 
@@ -106,18 +144,67 @@ ModelDataDefinition* DefaultModalModel::NewInstance(Model* model, std::string na
 bool DefaultModalModel::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_stepsPerEntity = fields->loadField("stepsPerEntity", DEFAULT.stepsPerEntity);
+		_loadedInitialNode = fields->loadField("initialNode", "");
+		_loadedNodes.clear();
+		unsigned int size = fields->loadField("nodes", 0u);
+		for (unsigned int i = 0; i < size; i++) {
+			_loadedNodes.push_back(fields->loadField("node" + Util::StrIndex(i), ""));
+		}
+		_loadedTransitions.clear();
+		size = fields->loadField("transitions", 0u);
+		for (unsigned int i = 0; i < size; i++) {
+			LoadedTransition transition;
+			transition.source = fields->loadField("transitionSource" + Util::StrIndex(i), "");
+			transition.destination = fields->loadField("transitionDestination" + Util::StrIndex(i), "");
+			transition.probability = fields->loadField("transitionProbability" + Util::StrIndex(i), 1.0);
+			transition.guardExpression = fields->loadField("transitionGuard" + Util::StrIndex(i), "");
+			_loadedTransitions.push_back(transition);
+		}
 	}
 	return res;
 }
 
 void DefaultModalModel::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	_resolveNames();
+	fields->saveField("stepsPerEntity", _stepsPerEntity, DEFAULT.stepsPerEntity, saveDefaultValues);
+	fields->saveField("initialNode", _initialNode != nullptr ? _initialNode->getName() : _loadedInitialNode, "", saveDefaultValues);
+	std::vector<std::string> nodes;
+	for (DefaultNode* node : *_nodes->list()) {
+		nodes.push_back(node->getName());
+	}
+	nodes.insert(nodes.end(), _loadedNodes.begin(), _loadedNodes.end());
+	fields->saveField("nodes", (unsigned int) nodes.size(), 0u, saveDefaultValues);
+	for (unsigned int i = 0; i < nodes.size(); i++) {
+		fields->saveField("node" + Util::StrIndex(i), nodes[i]);
+	}
+	std::vector<LoadedTransition> transitions;
+	for (DefaultNodeTransition* transition : *_transitions->list()) {
+		transitions.push_back({transition->getSource()->getName(), transition->getDestination()->getName(), transition->getProbability(), transition->getGuardExpression()});
+	}
+	transitions.insert(transitions.end(), _loadedTransitions.begin(), _loadedTransitions.end());
+	fields->saveField("transitions", (unsigned int) transitions.size(), 0u, saveDefaultValues);
+	for (unsigned int i = 0; i < transitions.size(); i++) {
+		fields->saveField("transitionSource" + Util::StrIndex(i), transitions[i].source);
+		fields->saveField("transitionDestination" + Util::StrIndex(i), transitions[i].destination);
+		fields->saveField("transitionProbability" + Util::StrIndex(i), transitions[i].probability, 1.0, saveDefaultValues);
+		fields->saveField("transitionGuard" + Util::StrIndex(i), transitions[i].guardExpression, "", saveDefaultValues);
+	}
 }
 
 void DefaultModalModel::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	traceSimulation(this, "I'm just a dummy model and I'll just send the entity forward");
+	for (unsigned int step = 0; step < _stepsPerEntity && _currentNode >= 0; step++) {
+		const int next = _table.next(_currentNode, _parentModel, _sampler->random());
+		if (next < 0) {
+			traceSimulation(this, "No transition enabled from node \"" + _table.getNode(_currentNode)->getName() + "\"");
+			break;
+		}
+		traceSimulation(this, "Transition from node \"" + _table.getNode(_currentNode)->getName() + "\" to node \"" + _table.getNode(next)->getName() + "\"");
+		_currentNode = next;
+		_visits[next]++;
+		_transitionsTaken++;
+	}
 	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
@@ -126,14 +213,24 @@ void DefaultModalModel::_onDispatchEvent(Entity* entity, unsigned int inputPortN
 // protected: /// virtual methods that could be overriden by derived classes, if needed
 //
 
-/*
 bool DefaultModalModel::_check(std::string* errorMessage) {
+	_resolveNames();
 	bool resultAll = true;
-	resultAll &= _someString != "";
-	resultAll &= _someUint > 0;
+	for (std::string name : _loadedNodes) {
+		errorMessage->append("Node \"" + name + "\" not found. ");
+		resultAll = false;
+	}
+	for (LoadedTransition& transition : _loadedTransitions) {
+		errorMessage->append("Transition from node \"" + transition.source + "\" to node \"" + transition.destination + "\" refers to a node not found. ");
+		resultAll = false;
+	}
+	if (_loadedInitialNode != "") {
+		errorMessage->append("Initial node \"" + _loadedInitialNode + "\" not found. ");
+		resultAll = false;
+	}
+	resultAll &= DefaultNodeTransitionTable::Check(_transitions, _parentModel, errorMessage);
 	return resultAll;
 }
-*/
 
 /*
 ParserChangesInformation* DefaultModalModel::_getParserChangesInformation() {
@@ -151,12 +248,17 @@ ParserChangesInformation* DefaultModalModel::_getParserChangesInformation() {
 }
 */
 
-/*
 void DefaultModalModel::_initBetweenReplications() {
-	_someString = "Test";
-	_someUint = 1;
+	_table.compile(_nodes, _transitions);
+	_currentNode = -1;
+	if (_initialNode != nullptr) {
+		_currentNode = _table.getIndex(_initialNode);
+	} else if (_table.getNumberOfNodes() > 0) {
+		_currentNode = 0;
+	}
+	_visits.assign(_table.getNumberOfNodes(), 0);
+	_transitionsTaken = 0;
 }
-*/
 
 /*
 void DefaultModalModel::_createInternalAndAttachedData() {
@@ -177,3 +279,38 @@ void DefaultModalModel::_createInternalAndAttachedData() {
 void DefaultModalModel::_addProperty(PropertyBase* property) {
 }
 */
+
+//
+// private: /// new private user methods
+//
+
+void DefaultModalModel::_resolveNames() {
+	ComponentManager* components = _parentModel->getComponentManager();
+	std::vector<std::string> unresolvedNodes;
+	for (std::string name : _loadedNodes) {
+		DefaultNode* node = dynamic_cast<DefaultNode*> (components->find(name));
+		if (node != nullptr) {
+			_nodes->insert(node);
+		} else {
+			unresolvedNodes.push_back(name);
+		}
+	}
+	_loadedNodes = unresolvedNodes;
+	std::vector<LoadedTransition> unresolvedTransitions;
+	for (LoadedTransition& transition : _loadedTransitions) {
+		DefaultNode* source = dynamic_cast<DefaultNode*> (components->find(transition.source));
+		DefaultNode* destination = dynamic_cast<DefaultNode*> (components->find(transition.destination));
+		if (source != nullptr && destination != nullptr) {
+			_transitions->insert(new DefaultNodeTransition(source, destination, transition.probability, transition.guardExpression));
+		} else {
+			unresolvedTransitions.push_back(transition);
+		}
+	}
+	_loadedTransitions = unresolvedTransitions;
+	if (_loadedInitialNode != "") {
+		_initialNode = dynamic_cast<DefaultNode*> (components->find(_loadedInitialNode));
+		if (_initialNode != nullptr) {
+			_loadedInitialNode = "";
+		}
+	}
+}
@@ -15,8 +15,12 @@
 
 #include "../../kernel/simulator/ModelComponent.h"
 #include "network/DefaultNode.h"
+#include "network/DefaultNodeTransitionTable.h"
 /*!
- This component ...
+ A finite state machine, or a Markov chain, whose states are nodes. The model has a current node, initially the initial node (or the
+ first one). Each entity that arrives at the model makes it take a number of transitions from its current node, chosen as described in
+ DefaultNodeTransition, and then goes to the next component. Transitions are compiled into a DefaultNodeTransitionTable when the
+ replication starts, so taking one is a lookup and a single random draw, even for thousands of nodes.
  */
 class     DefaultModalModel : public ModelComponent {
 public: /// constructors
@@ -28,7 +32,17 @@ public: /// new public user methods for this component
     virtual void removeNode(DefaultNode* node);
     virtual void addTransition(DefaultNodeTransition* transition);
     virtual void removeTransition(DefaultNodeTransition* transition);
-    // ...
+    List<DefaultNode*>* getNodes() const;
+    List<DefaultNodeTransition*>* getTransitions() const;
+    void setInitialNode(DefaultNode* initialNode);
+    DefaultNode* getInitialNode() const;
+    void setStepsPerEntity(unsigned int stepsPerEntity);
+    unsigned int getStepsPerEntity() const;
+public: /// simulation
+    DefaultNode* getCurrentNode() const;
+    unsigned long getNumberOfVisits(DefaultNode* node) const; //!< Transitions into the node in the current replication
+    unsigned long getNumberOfTransitionsTaken() const;
+    DefaultNodeTransitionTable* getTransitionTable();
 
 public: /// virtual public methods
 	virtual std::string show();
@@ -45,32 +59,48 @@ protected: /// virtual protected method that must be overriden
 
 protected: /// virtual protected methods that could be overriden by derived classes, if needed
 	/*! This method is called by ModelChecker during model check. The component should check itself to verify if user parameters are ok (ex: correct syntax for the parser) and everithing in its parameters allow the model too run without errors in this component */
-	// virtual bool _check(std::string* errorMessage);
+	virtual bool _check(std::string* errorMessage);
 	/*! This method returns all changes in the parser that are needed by plugins of this ModelDatas. When connecting a new plugin, ParserChangesInformation are used to change parser source code, whch is after compiled and dinamically linked to to simulator kernel to reflect the changes */
 	// virtual ParserChangesInformation* _getParserChangesInformation();
 	/*! This method is called by ModelSimulation when initianting the replication. The model should set all value for a new replication (Ex: setting back to 0 any internal counter, clearing lists, etc. */
-	// virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	/*! This method is called by ModelChecker and is necessary only for those components that instantiate internal elements that must exist before simulation starts and even before model checking. That's the case of components that have internal StatisticsCollectors, since others components may refer to them as expressions (as in "TVAG(ThisCSTAT)") and therefore the modeldatum must exist before checking such expression */
 	// virtual void _createInternalAndAttachedData(); /*< A ModelDataDefinition or ModelComponent that includes (internal) ou refers to (attach) other ModelDataDefinition must register them inside this method. */
 	/*! This method is not used yet. It should be usefull for new UIs */
 	// virtual void _addProperty(PropertyBase* property);
 
 private: /// new private user methods
-	// ...
+	void _resolveNames();
 
 private: /// Attributes that should be loaded or saved with this component (Persistent Fields)
 
 	/// Default values for the attributes. Used on initing, loading and saving
 	const struct DEFAULT_VALUES {
-		const std::string someString = "Test";
-		const unsigned int someUint = 1;
+		const unsigned int stepsPerEntity = 1;
 	} DEFAULT;
-	std::string _someString = DEFAULT.someString;
-	unsigned int _someUint = DEFAULT.someUint;
+	unsigned int _stepsPerEntity = DEFAULT.stepsPerEntity;
+	DefaultNode* _initialNode = nullptr;
 
 private: /// internal COMPONENTS (since it's a modal model / network) (Composition)
     List<DefaultNode*>* _nodes = new List<DefaultNode*>();
     List<DefaultNodeTransition*>* _transitions = new List<DefaultNodeTransition*>();
+    // loaded, referring to names of nodes that may be loaded after this model
+    std::vector<std::string> _loadedNodes;
+    struct LoadedTransition {
+        std::string source;
+        std::string destination;
+        double probability;
+        std::string guardExpression;
+    };
+    std::vector<LoadedTransition> _loadedTransitions;
+    std::string _loadedInitialNode = "";
+
+private: /// simulation
+    DefaultNodeTransitionTable _table;
+    Sampler_if* _sampler;
+    int _currentNode = -1;
+    std::vector<unsigned long> _visits;
+    unsigned long _transitionsTaken = 0;
 
 private: /// internal DataElements (Composition)
     // ...
@@ -63,6 +63,7 @@ Delay::Delay(Model* model, std::string name) : ModelComponent(model, Util::TypeO
 
 void Delay::setDelay(double delay) {
 	_delayExpression = std::to_string(delay);
+	_isDelayNumber = Util::StrToNumber(_delayExpression, &_delayValue);
 }
 
 double Delay::delay() const {
@@ -81,6 +82,7 @@ std::string Delay::show() {
 
 void Delay::setDelayExpression(std::string _delayExpression, Util::TimeUnit _delayTimeUnit) {
 	this->_delayExpression = _delayExpression;
+	_isDelayNumber = Util::StrToNumber(_delayExpression, &_delayValue);
 	if (_delayTimeUnit != Util::TimeUnit::unknown) {
 		this->_delayTimeUnit = _delayTimeUnit;
 	}
@@ -99,7 +101,7 @@ Util::TimeUnit Delay::delayTimeUnit() const {
 }
 
 void Delay::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	double waitTime = _parentModel->parseExpression(_delayExpression);
+	double waitTime = _isDelayNumber ? _delayValue : _parentModel->parseExpression(_delayExpression);
 	Util::TimeUnit stu = _parentModel->getSimulation()->getReplicationBaseTimeUnit(); //getReplicationLengthTimeUnit();
 	waitTime *= Util::TimeUnitConvert(_delayTimeUnit, stu);
 	if (_reportStatistics) {
@@ -111,9 +113,13 @@ void Delay::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 		//}
 		if (entity->getEntityType()->isReportStatistics())
 			entity->getEntityType()->addGetStatisticsCollector(entity->getEntityTypeName() + "." + allocationCategory+ "Time")->getStatistics()->getCollector()->addValue(waitTime);
-		double totalWaitTime = entity->getAttributeValue("Entity.Total" + allocationCategory + "Time");
-		std::string attribIndex="";
-		entity->setAttributeValue("Entity.Total" + allocationCategory + "Time", totalWaitTime + waitTime, attribIndex, true);
+		if (_totalTimeAttributeRank >= 0) {
+			entity->setAttributeValueByRank(_totalTimeAttributeRank, entity->getAttributeValueByRank(_totalTimeAttributeRank) + waitTime);
+		} else {
+			double totalWaitTime = entity->getAttributeValue("Entity.Total" + allocationCategory + "Time");
+			std::string attribIndex="";
+			entity->setAttributeValue("Entity.Total" + allocationCategory + "Time", totalWaitTime + waitTime, attribIndex, true);
+		}
 	}
 	double delayEndTime = _parentModel->getSimulation()->getSimulatedTime() + waitTime;
 	Event* newEvent = new Event(delayEndTime, entity, this->getConnectionManager()->getFrontConnection());
@@ -148,6 +154,11 @@ void Delay::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	fields->saveField("allocation", static_cast<int> (_allocation), static_cast<int> (DEFAULT.allocation), saveDefaultValues);
 }
 
+void Delay::_initBetweenReplications() {
+	_isDelayNumber = Util::StrToNumber(_delayExpression, &_delayValue);
+	_totalTimeAttributeRank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), "Entity.Total" + Util::StrAllocation(_allocation) + "Time");
+}
+
 bool Delay::_check(std::string* errorMessage) {
 	return _parentModel->checkExpression(_delayExpression, "Delay expression", errorMessage);
 }
@@ -67,7 +67,7 @@ protected:
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 protected:
-	//virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	virtual bool _check(std::string* errorMessage);
 	virtual void _createInternalAndAttachedData();
 public:
@@ -83,6 +83,10 @@ private:
 	Util::AllocationType _allocation = DEFAULT.allocation;
 private: // inner internal elements
 	StatisticsCollector* _cstatWaitTime = nullptr;
+private: // compiled at the beginning of each replication
+	bool _isDelayNumber = false;
+	double _delayValue = 0.0; //!< value of the delay expression, when it is a number
+	int _totalTimeAttributeRank = -1;
 };
 //enable_this_owner(Delay, DelayExpression);
 
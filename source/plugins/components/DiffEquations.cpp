@@ -160,6 +160,12 @@ bool DiffEquations::_check(std::string* errorMessage) {
 	bool resultAll = true;
 	CppCompiler::CompilationResult result;
 	std::string name = this->getName();
+	// the equations are compiled into a single function that evaluates all the derivatives at once
+	std::string derivatives = "";
+	unsigned int i = 0;
+	for (std::string equation : *_equations->list()) {
+		derivatives += "\t\tdxdt[" + std::to_string(i++) + "] = " + equation + ";\n";
+	}
 	std::string sourceCode = "\
 //\n\
 // File automatically generated by GenESyS DiffEquations plugin\n\
@@ -175,9 +181,16 @@ bool DiffEquations::_check(std::string* errorMessage) {
 \n\
 \n\
 void _onDispatchEvent_" + name + "(Simulator* simulator, Model* model, Entity* entity) {\n\
-	Solver_if *_solver = new SolverDefaultImpl1("+std::to_string(_precision)+", "+std::to_string(_maxSteps)+");\n\
-	double x["+std::to_string(_equations->size())+"];\
-	delete solver;\n\
+	SolverDefaultImpl1 solver("+std::to_string(_precision)+", "+std::to_string(_maxSteps)+");\n\
+	std::vector<double> x("+std::to_string(_equations->size())+", 0.0);\n\
+	bool solved = solver.solve(0.0, "+std::to_string(_finalTime)+", x, [](double t, const double* x, double* dxdt) {\n\
+" + derivatives + "\
+	}, Solver_if::OdeMethod::DormandPrince45);\n\
+	std::string message = solved ? \"Values on final time:\" : \"Final time not reached. Last values:\";\n\
+	for (unsigned int i = 0; i < x.size(); i++) {\n\
+		message += \" x[\" + std::to_string(i) + \"]=\" + std::to_string(x[i]);\n\
+	}\n\
+	model->getTracer()->trace(message);\n\
 }\n\
 \n\
 extern \"C\" void onDispatchEvent" + "(Simulator* simulator, Model* model, Entity* entity) {\n\
@@ -14,6 +14,7 @@
 #include "Exit.h"
 
 #include "../../kernel/simulator/Model.h"
+#include "../../kernel/simulator/Simulator.h"
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -27,10 +28,30 @@ ModelDataDefinition* Exit::NewInstance(Model* model, std::string name) {
 }
 
 Exit::Exit(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<Exit>(), name) {
+	SimulationControlGenericClass<Conveyor*, Model*, Conveyor>* propConveyor = new SimulationControlGenericClass<Conveyor*, Model*, Conveyor>(
+									_parentModel,
+									std::bind(&Exit::getConveyor, this), std::bind(&Exit::setConveyor, this, std::placeholders::_1),
+									Util::TypeOf<Exit>(), getName(), "Conveyor", "");
+
+	_parentModel->getControls()->insert(propConveyor);
+
+	// setting properties
+	_addProperty(propConveyor);
 }
 
 std::string Exit::show() {
-	return ModelComponent::show() + "";
+	std::string msg = ModelComponent::show();
+	if (_conveyor != nullptr)
+		msg += ",conveyor=" + _conveyor->getName();
+	return msg;
+}
+
+void Exit::setConveyor(Conveyor* conveyor) {
+	_conveyor = conveyor;
+}
+
+Conveyor* Exit::getConveyor() const {
+	return _conveyor;
 }
 
 ModelComponent* Exit::LoadInstance(Model* model, PersistenceRecord *fields) {
@@ -43,34 +64,47 @@ ModelComponent* Exit::LoadInstance(Model* model, PersistenceRecord *fields) {
 	return newComponent;
 }
 
-void Exit::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	traceSimulation(this, "I'm just a dummy model and I'll just send the entity forward");
+void Exit::_onDispatchEvent(Entity* entity, unsigned int) {
+	if (!_conveyor->exit(entity)) {
+		traceSimulation(this, entity->getName() + " is not on conveyor \"" + _conveyor->getName() + "\" and has no cells to release");
+	}
 	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
 bool Exit::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		std::string conveyorName = fields->loadField("conveyor", "");
+		_conveyor = dynamic_cast<Conveyor*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Conveyor>(), conveyorName));
 	}
 	return res;
 }
 
 void Exit::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	if (_conveyor != nullptr)
+		fields->saveField("conveyor", _conveyor->getName());
 }
 
 bool Exit::_check(std::string* errorMessage) {
-	bool resultAll = true;
-	// @TODO: not implemented yet
-	*errorMessage += "";
-	return resultAll;
+	return _parentModel->getDataManager()->check(Util::TypeOf<Conveyor>(), _conveyor, "Conveyor", errorMessage);
+}
+
+void Exit::_createInternalAndAttachedData() {
+	if (_conveyor == nullptr) {
+		_conveyor = _parentModel->getParentSimulator()->getPluginManager()->newInstance<Conveyor>(_parentModel);
+	}
+	_attachedDataInsert("Conveyor", _conveyor);
 }
 
 PluginInformation* Exit::GetPluginInformation() {
 	PluginInformation* info = new PluginInformation(Util::TypeOf<Exit>(), &Exit::LoadInstance, &Exit::NewInstance);
 	info->setCategory("Material Handling");
+	info->insertDynamicLibFileDependence("conveyor.so");
+	std::string help = "The Exit module releases the entity’s cells on the specified conveyor.";
+	help += " If another entity is waiting in queue for the conveyor at the same station when the cells are released, it will then access the conveyor.";
+	help += " TYPICAL USES: (1) Cases exit a conveyor for packing; (2) Bad parts are removed from the conveyor and disposed; (3) Passengers remove luggage from the baggage claim conveyor";
+	info->setDescriptionHelp(help);
 	return info;
 }
 
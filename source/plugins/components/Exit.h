@@ -15,6 +15,7 @@
 #define EXIT_H
 
 #include "../../kernel/simulator/ModelComponent.h"
+#include "../data/Conveyor.h"
 
 /*!
 Exit module
@@ -33,6 +34,7 @@ flowchart.
 Conveyor Name Name of the conveyor on which the entity will exit. If left blank,
 the previously accessed conveyor is assumed.
 # of Cells Number of contiguous conveyor cells the entity will relinquish.
+Entities release all the cells they hold on the conveyor and are then sent forward.
  */
 class Exit : public ModelComponent {
 public: // constructors
@@ -44,6 +46,9 @@ public: // static
 	static PluginInformation* GetPluginInformation();
 	static ModelComponent* LoadInstance(Model* model, PersistenceRecord *fields);
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
+public:
+	void setConveyor(Conveyor* conveyor);
+	Conveyor* getConveyor() const;
 protected: // virtual
 	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber);
 	virtual bool _loadInstance(PersistenceRecord *fields);
@@ -51,8 +56,10 @@ protected: // virtual
 protected: // virtual
 	//virtual void _initBetweenReplications();
 	virtual bool _check(std::string* errorMessage);
+	virtual void _createInternalAndAttachedData();
 private: // methods
 private: // attributes 1:1
+	Conveyor* _conveyor = nullptr;
 private: // attributes 1:n
 };
 
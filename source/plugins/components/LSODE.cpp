@@ -12,8 +12,10 @@
  */
 
 #include <fstream>
+#include <cmath>
 #include "LSODE.h"
 #include "../../kernel/simulator/Model.h"
+#include "../../kernel/simulator/ContinuousIntegrator.h"
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -44,13 +46,21 @@ LSODE::LSODE(Model* model, std::string name) : ModelComponent(model, Util::TypeO
 	SimulationControlGenericList<std::string, Model*, std::string>* propDiffEquations = new SimulationControlGenericList<std::string, Model*, std::string> (
 									_parentModel,
                                     std::bind(&LSODE::getDiffEquations, this), std::bind(&LSODE::addDiffEquation, this, std::placeholders::_1), std::bind(&LSODE::removeDiffEquation, this, std::placeholders::_1),
-									Util::TypeOf<LSODE>(), getName(), "DiffEquations", "");								
+									Util::TypeOf<LSODE>(), getName(), "DiffEquations", "");
+	SimulationControlGenericEnum<Solver_if::OdeMethod, LSODE>* propMethod = new SimulationControlGenericEnum<Solver_if::OdeMethod, LSODE>(
+									std::bind(&LSODE::getMethod, this), std::bind(&LSODE::setMethod, this, std::placeholders::_1),
+									Util::TypeOf<LSODE>(), getName(), "Method", "");
+	SimulationControlGeneric<double>* propPrecision = new SimulationControlGeneric<double>(
+									std::bind(&LSODE::getPrecision, this), std::bind(&LSODE::setPrecision, this, std::placeholders::_1),
+									Util::TypeOf<LSODE>(), getName(), "Precision", "");
 
 	_parentModel->getControls()->insert(propTimeVariable);
 	_parentModel->getControls()->insert(propStep);
 	_parentModel->getControls()->insert(propVariable);
 	_parentModel->getControls()->insert(propFileName);
 	_parentModel->getControls()->insert(propDiffEquations);
+	_parentModel->getControls()->insert(propMethod);
+	_parentModel->getControls()->insert(propPrecision);
 
 	// setting properties
 	_addProperty(propTimeVariable);
@@ -58,6 +68,22 @@ LSODE::LSODE(Model* model, std::string name) : ModelComponent(model, Util::TypeO
 	_addProperty(propVariable);
 	_addProperty(propFileName);
 	_addProperty(propDiffEquations);
+	_addProperty(propMethod);
+	_addProperty(propPrecision);
+}
+
+LSODE::~LSODE() {
+	delete _zeroCrossingConditions;
+	delete _zeroCrossingActions;
+}
+
+std::string LSODE::convertEnumToStr(Solver_if::OdeMethod method) {
+	switch (static_cast<int> (method)) {
+		case 0: return "RungeKutta4";
+		case 1: return "DormandPrince45";
+		case 2: return "BDF2";
+	}
+	return "Unknown";
 }
 
 std::string LSODE::show() {
@@ -118,92 +144,125 @@ std::string LSODE::getFileName() const {
 	return _filename;
 }
 
-bool LSODE::_doStep() {
-	double initTime, time, tnow, eqResult, halfStep;
-	//std::list<std::string>* eqs = _diffEquations->formulaExpressions()->list();
-	unsigned int i, numEqs = _diffEquations->size();
-	double k1[numEqs], k2[numEqs], k3[numEqs], k4[numEqs], valVar[numEqs];
-	time = _timeVariable->getValue();
-	initTime = time;
-	std::string expression;
-	tnow = _parentModel->getSimulation()->getSimulatedTime();
-	// @TODO: numerical error treatment by just adding 1e-15
-	bool res = time + _step <= tnow + 1e-15;
-	if (res) { // if simulatedTime has not reached a single step, do not solve
-		halfStep = _step * 0.5;
-		for (i = 0; i < numEqs; i++) {//(std::list<std::string>::iterator it = eqs->begin(); it != eqs->end(); it++) {
-			expression = _diffEquations->getAtRank(i);
-			valVar[i] = _variable->getValue(std::to_string(i));
-			eqResult = _parentModel->parseExpression(expression);
-			k1[i] = eqResult;
-		}
-		time += halfStep;
-		_timeVariable->setValue(time);
-		for (i = 0; i < numEqs; i++) {
-			_variable->setValue(valVar[i] + k1[i] * halfStep, std::to_string(i));
-		}
-		for (i = 0; i < numEqs; i++) {
-			expression = _diffEquations->getAtRank(i);
-			eqResult = _parentModel->parseExpression(expression);
-			k2[i] = eqResult;
-		}
-		for (i = 0; i < numEqs; i++) {
-			_variable->setValue(valVar[i] + k2[i] * halfStep, std::to_string(i));
-		}
-		for (i = 0; i < numEqs; i++) {
-			expression = _diffEquations->getAtRank(i);
-			eqResult = _parentModel->parseExpression(expression);
-			k3[i] = eqResult;
-		}
-		for (i = 0; i < numEqs; i++) {
-			_variable->setValue(valVar[i] + k3[i] * halfStep, std::to_string(i));
-		}
-		for (i = 0; i < numEqs; i++) {
-			expression = _diffEquations->getAtRank(i);
-			eqResult = _parentModel->parseExpression(expression);
-			k4[i] = eqResult;
-		}
-		for (i = 0; i < numEqs; i++) {
+void LSODE::setMethod(Solver_if::OdeMethod method) {
+	_method = method;
+}
 
-			eqResult = _variable->getValue(std::to_string(i)) +(_step / 6) * (k1[i] + 2 * (k2[i] + k3[i]) + k4[i]);
-			_variable->setValue(eqResult, std::to_string(i));
+Solver_if::OdeMethod LSODE::getMethod() const {
+	return _method;
+}
+
+void LSODE::setPrecision(double precision) {
+	_precision = precision;
+}
+
+double LSODE::getPrecision() const {
+	return _precision;
+}
+
+void LSODE::addZeroCrossing(std::string condition, std::string action) {
+	_zeroCrossingConditions->insert(condition);
+	_zeroCrossingActions->insert(action);
+}
+
+List<std::string>* LSODE::getZeroCrossingConditions() const {
+	return _zeroCrossingConditions;
+}
+
+List<std::string>* LSODE::getZeroCrossingActions() const {
+	return _zeroCrossingActions;
+}
+
+void LSODE::_derivatives(double time, const double* values, double* derivatives) {
+	// the integrator sets the state of the variables before evaluating the equations, since the parser reads them
+	unsigned int i = 0;
+	for (std::string expression : *_diffEquations->list()) {
+		derivatives[i++] = _parentModel->parseExpression(expression);
+	}
+}
+
+void LSODE::_getState(double* values) {
+	for (unsigned int i = 0; i < _indexes.size(); i++) {
+		values[i] = _variable->getValue(_indexes[i]);
+	}
+}
+
+void LSODE::_setState(double time, const double* values) {
+	_timeVariable->setValue(time);
+	for (unsigned int i = 0; i < _indexes.size(); i++) {
+		_variable->setValue(values[i], _indexes[i]);
+	}
+}
+
+void LSODE::_observe(double time, const double* values) {
+	const unsigned int numEqs = _indexes.size();
+	std::string message = "time=" + std::to_string(time);
+	for (unsigned int i = 0; i < numEqs; i++) {
+		message += " ," + _variable->getName() + "[" + _indexes[i] + "]=" + std::to_string(values[i]);
+	}
+	traceSimulation(this, message, TraceManager::Level::L8_detailed);
+	if (_savefile.is_open()) {
+		message = std::to_string(time);
+		for (unsigned int i = 0; i < numEqs; i++) {
+			message += "\t" + std::to_string(values[i]);
 		}
-		time = initTime + _step;
-		_timeVariable->setValue(time);
+		_savefile << message << std::endl;
 	}
-	return res;
+}
+
+void LSODE::_onZeroCrossing(void* action) {
+	std::string* expression = static_cast<std::string*> (action);
+	traceSimulation(this, "Zero-crossing action \"" + *expression + "\"", TraceManager::Level::L8_detailed);
+	_parentModel->parseExpression(*expression);
 }
 
 void LSODE::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	// open file
-	std::ofstream savefile;
-	if (_filename != "") {
-		savefile.open(_filename, std::ofstream::app);
+	// the state is already current, since the continuous integrator advances it up to every event
+	_parentModel->sendEntityToComponent(entity, getConnectionManager()->getFrontConnection());
+}
+
+void LSODE::_initBetweenReplications() {
+	const unsigned int numEqs = _diffEquations->size();
+	_indexes.clear();
+	for (unsigned int i = 0; i < numEqs; i++) {
+		_indexes.push_back(std::to_string(i));
 	}
-	while (_doStep()) {// execute solve ODE step by step until reach TNOW
-		std::string message = "time=" + std::to_string(_timeVariable->getValue());
-		for (unsigned int i = 0; i < _variable->getDimensionSizes()->front(); i++) {
-			message += " ," + _variable->getName() + "[" + std::to_string(i) + "]=" + std::to_string(_variable->getValue(std::to_string(i)));
-		}
-		traceSimulation(this, message, TraceManager::Level::L8_detailed);
-		if (_filename != "") {
-			message = std::to_string(_timeVariable->getValue());
-			for (unsigned int i = 0; i < _variable->getDimensionSizes()->front(); i++) {
-				message += "\t" + std::to_string(_variable->getValue(std::to_string(i)));
-			}
-			savefile << message << std::endl;
-		}
+	if (_savefile.is_open()) {
+		_savefile.close();
 	}
 	if (_filename != "") {
-		savefile.close();
+		_savefile.open(_filename, std::ofstream::app);
+	}
+	ContinuousIntegrator* integrator = _parentModel->getSimulation()->getContinuousIntegrator();
+	ContinuousSystem* system = new ContinuousSystem();
+	system->owner = this;
+	system->size = numEqs;
+	system->getState = std::bind(&LSODE::_getState, this, std::placeholders::_1);
+	system->setState = std::bind(&LSODE::_setState, this, std::placeholders::_1, std::placeholders::_2);
+	system->derivatives = std::bind(&LSODE::_derivatives, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+	system->method = _method;
+	system->precision = _precision;
+	system->outputInterval = _step;
+	system->observer = std::bind(&LSODE::_observe, this, std::placeholders::_1, std::placeholders::_2);
+	integrator->addSystem(system);
+	std::list<std::string>::iterator action = _zeroCrossingActions->list()->begin();
+	for (std::string condition : *_zeroCrossingConditions->list()) {
+		integrator->addZeroCrossing<LSODE>(this, condition, [this, condition]() {
+			return _parentModel->parseExpression(condition);
+		}, &LSODE::_onZeroCrossing, &(*action), ZeroCrossing::Direction::Rising);
+		action++;
 	}
-	_parentModel->sendEntityToComponent(entity, getConnectionManager()->getFrontConnection());
 }
 
 bool LSODE::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_method = static_cast<Solver_if::OdeMethod> (fields->loadField("method", static_cast<int> (DEFAULT.method)));
+		setPrecision(fields->loadField("precision", DEFAULT.precision));
+		unsigned int numZeroCrossings = fields->loadField("zeroCrossings", 0u);
+		for (unsigned int i = 0; i < numZeroCrossings; i++) {
+			addZeroCrossing(fields->loadField("zeroCrossingCondition" + Util::StrIndex(i), ""), fields->loadField("zeroCrossingAction" + Util::StrIndex(i), ""));
+		}
 	}
 
 	return res;
@@ -211,13 +270,22 @@ bool LSODE::_loadInstance(PersistenceRecord *fields) {
 
 void LSODE::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("method", static_cast<int> (_method), static_cast<int> (DEFAULT.method), saveDefaultValues);
+	fields->saveField("precision", _precision, DEFAULT.precision, saveDefaultValues);
+	fields->saveField("zeroCrossings", _zeroCrossingConditions->size(), 0u, saveDefaultValues);
+	std::list<std::string>::iterator action = _zeroCrossingActions->list()->begin();
+	unsigned int i = 0;
+	for (std::string condition : *_zeroCrossingConditions->list()) {
+		fields->saveField("zeroCrossingCondition" + Util::StrIndex(i), condition, "", saveDefaultValues);
+		fields->saveField("zeroCrossingAction" + Util::StrIndex(i), *action, "", saveDefaultValues);
+		action++;
+		i++;
+	}
 }
 
 bool LSODE::_check(std::string* errorMessage) {
 	bool resultAll = true;
 	std::ofstream savefile;
-	// @TODO: not implemented yet
 	*errorMessage += "";
 	if (resultAll) {
 		if (_filename != "") {
@@ -247,6 +315,12 @@ bool LSODE::_check(std::string* errorMessage) {
 	return resultAll;
 }
 
+void LSODE::_createInternalAndAttachedData() {
+	// variables are attached, otherwise they are removed as orphans when the model is checked
+	_attachedDataInsert("Variable", _variable);
+	_attachedDataInsert("TimeVariable", _timeVariable);
+}
+
 PluginInformation* LSODE::GetPluginInformation() {
 	PluginInformation* info = new PluginInformation(Util::TypeOf<LSODE>(), &LSODE::LoadInstance, &LSODE::NewInstance);
 	info->setCategory("Continuous");
@@ -14,20 +14,27 @@
 #ifndef LSODE_H
 #define LSODE_H
 
+#include <fstream>
 #include "../../kernel/simulator/ModelComponent.h"
 #include "../data/Formula.h"
 #include "../data/Variable.h"
+#include "../../tools/Solver_if.h"
 
 /*!
- This component ...
+ This component defines a system of ordinary differential equations whose state is an indexed Variable. The system is registered in the
+ ContinuousIntegrator of the simulation, that keeps the state current by advancing it between discrete events, so entities arriving just
+ read and change the variables. The state is observed (traced and saved to file) every Step, but adaptive methods may take longer steps
+ between observations, and so they evaluate the equations fewer times. Zero-crossings are pairs of a condition and an action (both
+ expressions). When the condition becomes positive, an internal event is scheduled at that exact time, that evaluates the action.
  */
 class LSODE : public ModelComponent {
 public: // constructors
 	LSODE(Model* model, std::string name = "");
-	virtual ~LSODE() = default;
+	virtual ~LSODE();
 public: // virtual
 	virtual std::string show();
 public: // static
+	static std::string convertEnumToStr(Solver_if::OdeMethod method);
 	static PluginInformation* GetPluginInformation();
 	static ModelComponent* LoadInstance(Model* model, PersistenceRecord *fields);
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
@@ -43,27 +50,46 @@ public: // g&s
     void removeDiffEquation(std::string diffEquation);
 	void setFilename(std::string filename);
 	std::string getFileName() const;
+	void setMethod(Solver_if::OdeMethod method);
+	Solver_if::OdeMethod getMethod() const;
+	void setPrecision(double precision);
+	double getPrecision() const;
+	void addZeroCrossing(std::string condition, std::string action);
+	List<std::string>* getZeroCrossingConditions() const;
+	List<std::string>* getZeroCrossingActions() const;
 protected: // virtual
 	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber);
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 protected: // virtual
-	//virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	virtual bool _check(std::string* errorMessage);
-	//virtual void _createInternalAndAttachedData();
+	virtual void _createInternalAndAttachedData();
 private: // methods
-	bool _doStep();
+	void _derivatives(double time, const double* values, double* derivatives);
+	void _getState(double* values);
+	void _setState(double time, const double* values);
+	void _observe(double time, const double* values);
+	void _onZeroCrossing(void* action);
 private: // attributes 1:1
 
 	const struct DEFAULT_VALUES {
 		const std::string filename = "";
+		const Solver_if::OdeMethod method = Solver_if::OdeMethod::DormandPrince45;
+		const double precision = 1e-6;
 	} DEFAULT;
 	List<std::string>* _diffEquations = new List<std::string>();
-	Variable* _variable;
-	Variable* _timeVariable;
+	Variable* _variable = nullptr;
+	Variable* _timeVariable = nullptr;
 	std::string _filename = DEFAULT.filename;
 	double _step;
+	Solver_if::OdeMethod _method = DEFAULT.method;
+	double _precision = DEFAULT.precision;
+	std::vector<std::string> _indexes; //!< Indexes of the variable, as strings, for each equation
+	std::ofstream _savefile;
 private: // attributes 1:n
+	List<std::string>* _zeroCrossingConditions = new List<std::string>();
+	List<std::string>* _zeroCrossingActions = new List<std::string>();
 };
 
 #endif /* LSODE_H */
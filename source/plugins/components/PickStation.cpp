@@ -15,6 +15,7 @@
 #include "../../kernel/simulator/Model.h"
 #include "../../kernel/simulator/Simulator.h"
 #include "../../kernel/simulator/PluginManager.h"
+#include "../../kernel/simulator/Attribute.h"
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -31,6 +32,7 @@ ModelDataDefinition* PickStation::NewInstance(Model* model, std::string name) {
 
 void PickStation::setPickConditionExpression(bool _pickConditionExpression) {
 	this->_pickConditionExpression = _pickConditionExpression;
+	_compiled = false;
 }
 
 bool PickStation::isPickConditionExpression() const {
@@ -39,6 +41,7 @@ bool PickStation::isPickConditionExpression() const {
 
 void PickStation::setPickConditionNumberInQueue(bool _pickConditionNumberInQueue) {
 	this->_pickConditionNumberInQueue = _pickConditionNumberInQueue;
+	_compiled = false;
 }
 
 bool PickStation::isPickConditionNumberInQueue() const {
@@ -47,6 +50,7 @@ bool PickStation::isPickConditionNumberInQueue() const {
 
 void PickStation::setPickConditionNumberBusyResource(bool _pickConditionNumberBusyResource) {
 	this->_pickConditionNumberBusyResource = _pickConditionNumberBusyResource;
+	_compiled = false;
 }
 
 bool PickStation::isPickConditionNumberBusyResource() const {
@@ -65,6 +69,7 @@ PickStation::PickCondition PickStation::getPickCondition() const {
 
 void PickStation::setTestCondition(PickStation::TestCondition _testCondition) {
 	this->_testCondition = _testCondition;
+	_compiled = false;
 }
 
 PickStation::TestCondition PickStation::getTestCondition() const {
@@ -73,6 +78,7 @@ PickStation::TestCondition PickStation::getTestCondition() const {
 
 void PickStation::setSaveAttribute(std::string _saveAttribute) {
 	this->_saveAttribute = _saveAttribute;
+	_compiled = false;
 }
 
 std::string PickStation::getSaveAttribute() const {
@@ -85,10 +91,12 @@ List<PickableStationItem*>* PickStation::getPickableStationItens() const {
 
 void PickStation::addPickableStationItem(PickableStationItem* newItem) {
 	_pickableStationItens->insert(newItem);
+	_compiled = false;
 }
 
 void PickStation::removePickableStationItem(PickableStationItem* item) {
 	_pickableStationItens->remove(item);
+	_compiled = false;
 }
 
 std::string PickStation::convertEnumToStr(TestCondition condition) {
@@ -136,6 +144,23 @@ PickStation::PickStation(Model* model, std::string name) : ModelComponent(model,
 	_addProperty(propPickableStationItens);
 }
 
+PickStation::~PickStation() {
+	// queues and resources already deleted are no longer in the model
+	ModelDataManager* data = _parentModel->getDataManager();
+	List<ModelDataDefinition*>* queues = data->getDataDefinitionList(Util::TypeOf<Queue>());
+	for (Queue* queue : _observedQueues) {
+		if (queues->find(queue) != queues->list()->end()) {
+			queue->removeSizeChangeEventHandler(this);
+		}
+	}
+	List<ModelDataDefinition*>* resources = data->getDataDefinitionList(Util::TypeOf<Resource>());
+	for (Resource* resource : _observedResources) {
+		if (resources->find(resource) != resources->list()->end()) {
+			resource->removeBusyChangeEventHandler(this);
+		}
+	}
+}
+
 std::string PickStation::show() {
 	return ModelComponent::show() + "";
 }
@@ -173,38 +198,31 @@ PluginInformation* PickStation::GetPluginInformation() {
 // protected virtual -- must be overriden
 
 void PickStation::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	double value, valueResource=0, valueQueue=0, valueExpression=0, bestValue;
-	Station* bestStation = nullptr;
-	if (_testCondition == TestCondition::MAXIMUM) {
-		bestValue = std::numeric_limits<double>::min();
-	} else {
-		bestValue = std::numeric_limits<double>::max();
+	if (!_compiled) {
+		_compile();
 	}
-	for (PickableStationItem* item : *_pickableStationItens->list()) {
-		if (_pickConditionExpression) {
-			valueExpression = _parentModel->parseExpression(item->getExpression());
-		}
-		if (_pickConditionNumberInQueue) {
-			if (item->getQueue() != nullptr) {
-				valueQueue = item->getQueue()->size();
-			} else {
-				valueQueue = 0;
-			}
+	int best = -1;
+	if (_isIncremental) {
+		if (!_heap.empty()) {
+			best = _heap.front();
 		}
-		if (_pickConditionNumberBusyResource) {
-			if (item->getResource() != nullptr) {
-				valueResource = item->getResource()->getNumberBusy();
-			} else {
-				valueResource = 0;
+	} else {
+		double value, bestValue = 0.0;
+		for (unsigned int i = 0; i < _items.size(); i++) {
+			value = _valueOf(i, entity);
+			if (best < 0 || (_testCondition == TestCondition::MAXIMUM && value > bestValue) || (_testCondition == TestCondition::MINIMUM && value < bestValue)) {
+				bestValue = value;
+				best = i;
 			}
 		}
-		value = valueResource + valueQueue + valueExpression;
-		if ((_testCondition == TestCondition::MAXIMUM && value > bestValue) || (_testCondition == TestCondition::MINIMUM && value < bestValue)) {
-			bestValue = value;
-			bestStation = item->getStation();
-		}
 	}
-	entity->setAttributeValue(_saveAttribute, bestStation->getId());
+	if (best < 0) {
+		traceSimulation(this, "There is no station to pick", TraceManager::Level::L1_errorFatal);
+	} else if (_saveAttributeRank >= 0) {
+		entity->setAttributeValueByRank(_saveAttributeRank, _items[best]->getStation()->getId());
+	} else {
+		entity->setAttributeValue(_saveAttribute, _items[best]->getStation()->getId());
+	}
 	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
@@ -242,8 +260,7 @@ ParserChangesInformation* PickStation::_getParserChangesInformation() {
 }
 
 void PickStation::_initBetweenReplications() {
-	//_someString = "Test";
-	//_someUint = 1;
+	_compile(); // queues and resources notify when they are initialized too
 }
 
 void PickStation::_createInternalAndAttachedData() {
@@ -259,6 +276,9 @@ void PickStation::_createInternalAndAttachedData() {
 		}
 		i++;
 	}
+	if (_saveAttribute != "") {
+		_attachedAttributesInsert({_saveAttribute});
+	}
 	//if (_internalDataDefinition == nullptr) {
 	//	PluginManager* pm = _parentModel->getParentSimulator()->getPlugins();
 	//	_internalDataDefinition = pm->newInstance<DummyElement>(_parentModel, getName() + "." + "JustaDummy");
@@ -266,6 +286,133 @@ void PickStation::_createInternalAndAttachedData() {
 	//}
 }
 
+// private
+
+void PickStation::_compile() {
+	const unsigned int size = _pickableStationItens->size();
+	_items.assign(_pickableStationItens->list()->begin(), _pickableStationItens->list()->end());
+	_isExpressionCompiled.assign(size, true);
+	_expressionValues.assign(size, Sequence::CompiledValue());
+	_isIncremental = true;
+	for (unsigned int i = 0; i < size; i++) {
+		if (_pickConditionExpression && Util::Trim(_items[i]->getExpression()) != "") {
+			_isExpressionCompiled[i] = Sequence::CompileValue(_parentModel, _items[i]->getExpression(), &_expressionValues[i]);
+			_isIncremental &= _isExpressionCompiled[i] && _expressionValues[i].attributeRank < 0 && _expressionValues[i].variable == nullptr;
+		}
+	}
+	_itemsOfQueue.clear();
+	_itemsOfResource.clear();
+	_heap.clear();
+	_heapPosition.assign(size, 0);
+	_values.assign(size, 0.0);
+	if (_isIncremental) {
+		for (unsigned int i = 0; i < size; i++) {
+			Queue* queue = _items[i]->getQueue();
+			if (_pickConditionNumberInQueue && queue != nullptr) {
+				_itemsOfQueue.insert({queue, i});
+				if (_observedQueues.insert(queue).second) {
+					queue->addSizeChangeEventHandler(Queue::SetQueueEventHandler<PickStation>(&PickStation::_onQueueSizeChange, this), this);
+				}
+			}
+			Resource* resource = _items[i]->getResource();
+			if (_pickConditionNumberBusyResource && resource != nullptr) {
+				_itemsOfResource.insert({resource, i});
+				if (_observedResources.insert(resource).second) {
+					resource->addBusyChangeEventHandler(Resource::SetResourceEventHandler<PickStation>(&PickStation::_onResourceBusyChange, this), this);
+				}
+			}
+			_values[i] = _valueOf(i, nullptr);
+			_heap.push_back(i);
+			_heapPosition[i] = i;
+		}
+		for (int position = size / 2; position >= 0; position--) {
+			_siftDown(position);
+		}
+	}
+	_saveAttributeRank = _saveAttribute != "" ? _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), _saveAttribute) : -1;
+	_compiled = true;
+}
+
+double PickStation::_valueOf(unsigned int item, Entity* entity) {
+	double value = 0.0;
+	if (_pickConditionExpression) {
+		value += _isExpressionCompiled[item] ? Sequence::ValueOf(_expressionValues[item], entity) : _parentModel->parseExpression(_items[item]->getExpression());
+	}
+	if (_pickConditionNumberInQueue && _items[item]->getQueue() != nullptr) {
+		value += _items[item]->getQueue()->size();
+	}
+	if (_pickConditionNumberBusyResource && _items[item]->getResource() != nullptr) {
+		value += _items[item]->getResource()->getNumberBusy();
+	}
+	return value;
+}
+
+bool PickStation::_isBetter(unsigned int item, unsigned int other) const {
+	if (_values[item] != _values[other]) {
+		return _testCondition == TestCondition::MAXIMUM ? _values[item] > _values[other] : _values[item] < _values[other];
+	}
+	return item < other;
+}
+
+void PickStation::_updateItem(unsigned int item) {
+	const double value = _valueOf(item, nullptr);
+	if (value != _values[item]) {
+		_values[item] = value;
+		_siftUp(_heapPosition[item]);
+		_siftDown(_heapPosition[item]);
+	}
+}
+
+void PickStation::_siftUp(unsigned int position) {
+	while (position > 0 && _isBetter(_heap[position], _heap[(position - 1) / 2])) {
+		_swap(position, (position - 1) / 2);
+		position = (position - 1) / 2;
+	}
+}
+
+void PickStation::_siftDown(unsigned int position) {
+	const unsigned int size = _heap.size();
+	while (true) {
+		unsigned int best = position;
+		const unsigned int left = 2 * position + 1, right = left + 1;
+		if (left < size && _isBetter(_heap[left], _heap[best])) {
+			best = left;
+		}
+		if (right < size && _isBetter(_heap[right], _heap[best])) {
+			best = right;
+		}
+		if (best == position) {
+			return;
+		}
+		_swap(position, best);
+		position = best;
+	}
+}
+
+void PickStation::_swap(unsigned int position, unsigned int otherPosition) {
+	std::swap(_heap[position], _heap[otherPosition]);
+	_heapPosition[_heap[position]] = position;
+	_heapPosition[_heap[otherPosition]] = otherPosition;
+}
+
+void PickStation::_onQueueSizeChange(Queue* queue) {
+	if (_compiled && _isIncremental) {
+		std::pair<std::unordered_multimap<Queue*, unsigned int>::iterator, std::unordered_multimap<Queue*, unsigned int>::iterator> range = _itemsOfQueue.equal_range(queue);
+		for (std::unordered_multimap<Queue*, unsigned int>::iterator it = range.first; it != range.second; it++) {
+			_updateItem(it->second);
+		}
+	}
+}
+
+void PickStation::_onResourceBusyChange(Resource* resource) {
+	if (_compiled && _isIncremental) {
+		std::pair<std::unordered_multimap<Resource*, unsigned int>::iterator, std::unordered_multimap<Resource*, unsigned int>::iterator> range = _itemsOfResource.equal_range(resource);
+		for (std::unordered_multimap<Resource*, unsigned int>::iterator it = range.first; it != range.second; it++) {
+			_updateItem(it->second);
+		}
+	}
+}
+
 void PickStation::_addProperty(PropertyBase* property) {
 	_properties->insert(property);
 }
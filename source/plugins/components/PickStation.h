@@ -19,8 +19,12 @@
 #include "../../kernel/util/List.h"
 #include "../../plugins/data/Queue.h"
 #include "../../plugins/data/Resource.h"
+#include "../../plugins/data/Sequence.h"
 
 #include "PickableStationItem.h"
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 /*!
  PickStation module
@@ -64,6 +68,12 @@ that is selected, visible when the transfer method is Connect.
 Route Time Move time of the entity from its current station to the station
 determined through this module.
 Units Time units for route-time parameters.
+ *
+ * Items are compiled at the beginning of each replication, or when items or conditions change. Expressions that are numbers are kept
+ * as their values. When no expression must be evaluated (picking only by the number in queue and the number of busy resources, plus
+ * numbers), the items are kept in a heap, updated whenever the size of their queues or the busy units of their resources change, so
+ * the best station is the top of the heap. Otherwise expressions are evaluated for every item at each pick. Ties are broken by the
+ * order of the items, the first one being picked.
  */
 class PickStation : public ModelComponent {
 public:
@@ -79,7 +89,7 @@ public:
 	static std::string convertEnumToStr(TestCondition condition);
 public: // constructors
 	PickStation(Model* model, std::string name = "");
-	virtual ~PickStation() = default;
+	virtual ~PickStation();
 public: // virtual
 	virtual std::string show();
 public:
@@ -118,6 +128,15 @@ protected: // could be overriden by derived classes
 	virtual void _addProperty(PropertyBase* property);
 
 private: // methods
+	void _compile();
+	double _valueOf(unsigned int item, Entity* entity); //!< entity may be nullptr when incremental
+	bool _isBetter(unsigned int item, unsigned int other) const; //!< by value, and then by order among the items
+	void _updateItem(unsigned int item);
+	void _siftUp(unsigned int position);
+	void _siftDown(unsigned int position);
+	void _swap(unsigned int position, unsigned int otherPosition);
+	void _onQueueSizeChange(Queue* queue);
+	void _onResourceBusyChange(Resource* resource);
 private: // attributes 1:1
 
 	const struct DEFAULT_VALUES {
@@ -138,6 +157,20 @@ private: // attributes 1:1
 	//DummyElement* _internalDataDefinition = nullptr;
 private: // attributes 1:n
 	List<PickableStationItem*>* _pickableStationItens = new List<PickableStationItem*>();
+private: // compiled items
+	bool _compiled = false;
+	std::vector<PickableStationItem*> _items;
+	std::vector<bool> _isExpressionCompiled;
+	std::vector<Sequence::CompiledValue> _expressionValues; //!< expressions read with no parser, when compiled
+	bool _isIncremental = false; //!< every expression is a number, and the best item is kept in the heap
+	std::vector<double> _values; //!< current value of each item, when incremental
+	std::vector<unsigned int> _heap; //!< items, the best one first
+	std::vector<unsigned int> _heapPosition; //!< position of each item in the heap
+	std::unordered_multimap<Queue*, unsigned int> _itemsOfQueue;
+	std::unordered_multimap<Resource*, unsigned int> _itemsOfResource;
+	std::unordered_set<Queue*> _observedQueues; //!< queues that notify changes to this component, until it is deleted
+	std::unordered_set<Resource*> _observedResources;
+	int _saveAttributeRank = -1;
 };
 
 
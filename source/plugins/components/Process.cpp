@@ -155,7 +155,9 @@ ModelComponent* Process::LoadInstance(Model* model, PersistenceRecord *fields) {
 }
 
 void Process::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	this->_parentModel->sendEntityToComponent(entity, _seize, 0.0);
+	// the entity seizes at once, and Seize delays it in place, so the end of the delay is the only event until Release
+	Event seizeEvent(_parentModel->getSimulation()->getSimulatedTime(), entity, _seize);
+	ModelComponent::DispatchEvent(&seizeEvent);
 }
 
 void Process::_adjustConnections() {
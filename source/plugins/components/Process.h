@@ -20,7 +20,9 @@
 #include "Release.h"
 
 /*!
- This component ...
+ This component seizes resources, delays the entity and releases them, by internal Seize, Delay and Release components. An arriving
+ entity is dispatched to the Seize in place, which delays it in place (see Seize), so each entity that does not wait for resources
+ takes a single event (the end of the delay) between arriving at Process and leaving the Release.
  */
 class Process : public ModelComponent {
 public: // constructors
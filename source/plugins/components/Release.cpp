@@ -16,7 +16,7 @@
 #include "../../kernel/simulator/Simulator.h"
 #include "../../kernel/simulator/SimulationControlAndResponse.h"
 #include "../data/Resource.h"
-//#include "../../kernel/simulator/Attribute.h"
+#include "../../kernel/simulator/Attribute.h"
 #include <assert.h>
 #include <cmath>
 
@@ -197,20 +197,27 @@ Resource* Release::_getResourceFromSeizableItem(SeizableItem* seizable, Entity*
 
 
 void Release::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+	unsigned int request = 0;
 	for (SeizableItem* seizable : *_releaseRequests->list()) {
 		Resource* resource = _getResourceFromSeizableItem(seizable, entity);
-		unsigned int quantity = _parentModel->parseExpression(seizable->getQuantityExpression());
+		unsigned int quantity = _quantityOf(request, seizable);
 		assert(resource->getNumberBusy() >= quantity); // 202104 ops. maybe not anymore
 		_parentModel->getTracer()->traceSimulation(this, _parentModel->getSimulation()->getSimulatedTime(), entity, this, entity->getName() + " releases " + std::to_string(quantity) + " units of resource \"" + resource->getName() + "\" seized on time " + std::to_string(resource->getLastTimeSeized()));
 		resource->release(quantity); //{releases and sets the 'LastTimeSeized'property}
 		if (_reportStatistics) {
 			double timeSeized = resource->getLastTimeSeized();
-			double allocationEntityResource = entity->getAttributeValue("Entity.Allocation."+resource->getName()); //@TODO: Seize is not setting this attribute. Fiz it.
+			double allocationEntityResource;
+			if (request < _allocationAttributeRanks.size() && _allocationAttributeRanks[request] >= 0) {
+				allocationEntityResource = entity->getAttributeValueByRank(_allocationAttributeRanks[request]);
+			} else {
+				allocationEntityResource = entity->getAttributeValue("Entity.Allocation."+resource->getName()); //@TODO: Seize is not setting this attribute. Fiz it.
+			}
 			std::string allocationCategory = Util::StrAllocation(static_cast<Util::AllocationType>((int) allocationEntityResource));
 			std::string attribIndex="";
 			entity->getEntityType()->addGetStatisticsCollector(entity->getEntityTypeName() + "."+allocationCategory+"Time")->getStatistics()->getCollector()->addValue(timeSeized);
 			entity->setAttributeValue("Entity.Total"+allocationCategory+"Time", entity->getAttributeValue("Entity.Total"+allocationCategory+"Time") + timeSeized, attribIndex, true);			
 		}
+		request++;
 	}
 	_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
@@ -222,6 +229,26 @@ void Release::_initBetweenReplications() {
 	//	else if (seizable->getSeizableType() == SeizableItem::SeizableType::SET)
 	//		seizable->getSet()->initBetweenReplications();
 	//}
+	_isQuantityNumber.clear();
+	_quantityValues.clear();
+	_allocationAttributeRanks.clear();
+	for (SeizableItem* seizable : *_releaseRequests->list()) {
+		double quantity = 0.0;
+		_isQuantityNumber.push_back(Util::StrToNumber(seizable->getQuantityExpression(), &quantity));
+		_quantityValues.push_back(quantity);
+		int allocationRank = -1;
+		if (seizable->getSeizableType() == SeizableItem::SeizableType::RESOURCE && seizable->getResource() != nullptr) {
+			allocationRank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), "Entity.Allocation." + seizable->getResource()->getName());
+		}
+		_allocationAttributeRanks.push_back(allocationRank);
+	}
+}
+
+unsigned int Release::_quantityOf(unsigned int request, SeizableItem* seizable) {
+	if (request < _isQuantityNumber.size() && _isQuantityNumber[request]) {
+		return _quantityValues[request];
+	}
+	return _parentModel->parseExpression(seizable->getQuantityExpression());
 }
 
 bool Release::_loadInstance(PersistenceRecord *fields) {
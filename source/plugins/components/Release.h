@@ -15,6 +15,7 @@
 #define RELEASE_H
 
 #include <string>
+#include <vector>
 
 #include "../../kernel/simulator/ModelComponent.h"
 #include "../../kernel/simulator/Plugin.h"
@@ -88,6 +89,7 @@ protected:
 	virtual void _createInternalAndAttachedData();
 private:
 	Resource* _getResourceFromSeizableItem(SeizableItem* seizable, Entity* entity);
+	unsigned int _quantityOf(unsigned int request, SeizableItem* seizable);
 private:
 
 	const struct DEFAULT_VALUES {
@@ -96,6 +98,10 @@ private:
 	} DEFAULT;
 	unsigned short _priority = DEFAULT.priority;
 	List<SeizableItem*>* _releaseRequests = new List<SeizableItem*>();
+private: // compiled at the beginning of each replication
+	std::vector<bool> _isQuantityNumber;
+	std::vector<double> _quantityValues; //!< values of quantities that are numbers
+	std::vector<int> _allocationAttributeRanks; //!< rank of the allocation attribute of each request, or -1 when its resource is chosen from a set
 };
 
 #endif /* RELEASE_H */
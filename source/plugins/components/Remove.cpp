@@ -109,52 +109,73 @@ ModelComponent* Remove::LoadInstance(Model* model, PersistenceRecord *fields) {
 	return newComponent;
 }
 
+/*!
+ * Removes from rank startRank to rank endRank (both included, and endRank is startRank when empty) of the queue, or of the group of the
+ * arriving entity (as the representative of a batch) in the entity group, in a single pass. Removed entities are sent in rank order
+ * through output port 1, after the arriving entity
+ */
 void Remove::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+	unsigned int startRank = _parentModel->parseExpression(_removeStartRank);
+	unsigned int endRank = _removeEndRank == "" ? startRank : (unsigned int) _parentModel->parseExpression(_removeEndRank);
+	const std::string from = (_removeFromType == RemoveFromType::QUEUE ? "queue \"" : "entity group \"") + _removeFrom->getName() + "\"";
+	if (startRank == endRank) {
+		traceSimulation(this, TraceManager::Level::L7_internal, "Removing entity from " + from + " at rank " + std::to_string(startRank) + "  // " + _removeStartRank);
+	} else {
+		traceSimulation(this, TraceManager::Level::L7_internal, "Removing entities from " + from + " from rank " + std::to_string(startRank) + " to rank " + std::to_string(endRank) + "  // " + _removeStartRank + "  // " + _removeEndRank);
+	}
+	std::list<Entity*> removedEntities;
 	if (_removeFromType == RemoveFromType::QUEUE) {
-		Queue* queue = dynamic_cast<Queue*> (_removeFrom);
-		unsigned int startRank = _parentModel->parseExpression(_removeStartRank);
-		unsigned int endRank = _parentModel->parseExpression(_removeEndRank);
-		if (startRank == endRank) {
-			traceSimulation(this, TraceManager::Level::L7_internal, "Removing entity from queue \"" + queue->getName() + "\" at rank " + std::to_string(startRank) + "  // " + _removeStartRank);
-		} else {
-			traceSimulation(this, TraceManager::Level::L7_internal, "Removing entities from queue \"" + queue->getName() + "\" from rank " + std::to_string(startRank) + " to rank " + std::to_string(endRank) + "  // " + _removeStartRank + "  // " + _removeEndRank);
-		}
-		Waiting* waiting;
-		for (unsigned int rank = startRank; rank < endRank; rank++) {
-			waiting = queue->getAtRank(rank);
-			if (waiting != nullptr) {
-				//queue->removeElement(waiting); // will remove later, on other loop
-				Entity* removedEntity = waiting->getEntity();
-				traceSimulation(this, TraceManager::Level::L8_detailed, "Entity \"" + removedEntity->getName() + "\" was removed from queue \"" + queue->getName() + "\" at rank "+std::to_string(rank));
-				_parentModel->sendEntityToComponent(removedEntity, this->getConnectionManager()->getConnectionAtPort(1)); // port 1 is the removed entities output
-			} else {
-				traceSimulation(this, TraceManager::Level::L8_detailed, "Could not remove entity from queue \"" + queue->getName() + "\" at rank " + std::to_string(rank));
-			}
-		}
-		for (unsigned int rank = startRank; rank < endRank; rank++) {
-			waiting = queue->getAtRank(startRank); //always startRank, since when one is removed, the next one take its place
-			if (waiting != nullptr) {
-				queue->removeElement(waiting);
-			}			
+		for (Waiting* waiting : static_cast<Queue*> (_removeFrom)->removeElements(startRank, endRank)) {
+			removedEntities.push_back(waiting->getEntity());
+			delete waiting;
 		}
+	} else if (_removeFromType == RemoveFromType::ENTITYGROUP) {
+		removedEntities = static_cast<EntityGroup*> (_removeFrom)->removeElements(entity->getId(), startRank, endRank);
 	}
-	if (_removeFromType == RemoveFromType::ENTITYGROUP) {
-		//@TODO
+	if (endRank >= startRank && removedEntities.size() < endRank - startRank + 1) { // when endRank is before startRank, nothing is removed
+		traceSimulation(this, TraceManager::Level::L8_detailed, "Could remove only " + std::to_string(removedEntities.size()) + " entities from " + from);
 	}
 	_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
+	unsigned int rank = startRank;
+	for (Entity* removedEntity : removedEntities) {
+		traceSimulation(this, TraceManager::Level::L8_detailed, "Entity \"" + removedEntity->getName() + "\" was removed from " + from + " at rank " + std::to_string(rank++));
+		_parentModel->sendEntityToComponent(removedEntity, this->getConnectionManager()->getConnectionAtPort(1)); // port 1 is the removed entities output
+	}
 }
 
 bool Remove::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_removeFromType = static_cast<Remove::RemoveFromType> (fields->loadField("removeFromType", static_cast<int> (DEFAULT.removeFromType)));
+		_removeStartRank = fields->loadField("removeStartRank", DEFAULT.removeStartRank);
+		_removeEndRank = fields->loadField("removeEndRank", DEFAULT.removeEndRank);
+		std::string removeFromName = fields->loadField("removeFrom", "");
+		if (removeFromName != "") {
+			PluginManager* plugins = _parentModel->getParentSimulator()->getPluginManager();
+			if (_removeFromType == RemoveFromType::QUEUE) {
+				_removeFrom = _parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Queue>(), removeFromName);
+				if (_removeFrom == nullptr) { // queue is created with the name it had
+					_removeFrom = plugins->newInstance<Queue>(_parentModel, removeFromName);
+				}
+			} else {
+				_removeFrom = _parentModel->getDataManager()->getDataDefinition(Util::TypeOf<EntityGroup>(), removeFromName);
+				if (_removeFrom == nullptr) {
+					_removeFrom = plugins->newInstance<EntityGroup>(_parentModel, removeFromName);
+				}
+			}
+		}
 	}
 	return res;
 }
 
 void Remove::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("removeFromType", static_cast<int> (_removeFromType), static_cast<int> (DEFAULT.removeFromType), saveDefaultValues);
+	fields->saveField("removeStartRank", _removeStartRank, DEFAULT.removeStartRank, saveDefaultValues);
+	fields->saveField("removeEndRank", _removeEndRank, DEFAULT.removeEndRank, saveDefaultValues);
+	if (_removeFrom != nullptr) {
+		fields->saveField("removeFrom", _removeFrom->getName(), "", saveDefaultValues);
+	}
 }
 
 bool Remove::_check(std::string* errorMessage) {
@@ -182,7 +203,10 @@ void Remove::_createInternalAndAttachedData() {
 		_attachedDataInsert("Queue", _removeFrom);
 	}
 	if (_removeFromType == Remove::RemoveFromType::ENTITYGROUP) {
-		//@TODO
+		if (_removeFrom == nullptr) {
+			_removeFrom = plugins->newInstance<EntityGroup>(_parentModel, getName() + ".EntityGroup");
+		}
+		_attachedDataInsert("EntityGroup", _removeFrom);
 	}
 }
 
@@ -84,7 +84,7 @@ private: // attributes 1:1
 	ModelDataDefinition* _removeFrom = nullptr;
 	Remove::RemoveFromType _removeFromType = DEFAULT.removeFromType;
 	std::string _removeStartRank = DEFAULT.removeStartRank;
-	std::string _removeEndRank = DEFAULT.removeStartRank;
+	std::string _removeEndRank = DEFAULT.removeEndRank;
 	//std::string _removeFromRank = DEFAULT.removeFromRank;
 
 private: // attributes 1:n
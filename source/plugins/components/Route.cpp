@@ -162,21 +162,23 @@ void Route::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	Station* destinyStation = _station;
 	Label* destinyLabel = _label;
 	if (_routeDestinationType == Route::DestinationType::Sequence) {
-		unsigned int sequenceId = static_cast<unsigned int> (entity->getAttributeValue("Entity.Sequence"));
-		unsigned int step = static_cast<unsigned int> (entity->getAttributeValue("Entity.SequenceStep"));
-		Sequence* sequence = static_cast<Sequence*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Sequence>(), sequenceId));
-		SequenceStep* seqStep = sequence->getSteps()->getAtRank(step);
-		if (seqStep == nullptr) {
-			step = 0;
-			seqStep = sequence->getSteps()->getAtRank(step);
-			assert(seqStep != nullptr);
+		if (_sequenceAttributeRank < 0 || _sequenceStepAttributeRank < 0) { // not simulating from the beginning of a replication
+			_initBetweenReplications();
 		}
-		destinyStation = seqStep->getStation(); // one of two is nullptr
-		destinyLabel = seqStep->getLabel();
-		for (Assignment* assignment : *seqStep->getAssignments()) {
-			_parentModel->parseExpression(assignment->getDestination() + "=" + assignment->getExpression());
+		const bool hasAttributes = _sequenceAttributeRank >= 0 && _sequenceStepAttributeRank >= 0;
+		Util::identification sequenceId = hasAttributes ? static_cast<Util::identification> (entity->getAttributeValueByRank(_sequenceAttributeRank)) : 0;
+		unsigned int step = hasAttributes ? static_cast<unsigned int> (entity->getAttributeValueByRank(_sequenceStepAttributeRank)) : 0;
+		Sequence* sequence = hasAttributes ? _sequenceOfId(sequenceId) : nullptr;
+		const Sequence::CompiledStep* seqStep = sequence != nullptr ? sequence->getCompiledStep(&step) : nullptr;
+		if (seqStep == nullptr) {
+			traceSimulation(this, "Entity.Sequence of " + entity->getName() + " is " + std::to_string(sequenceId) + ", which is not a Sequence with steps. Impossible to route.", TraceManager::Level::L1_errorFatal);
+			_parentModel->removeEntity(entity);
+			return;
 		}
-		entity->setAttributeValue("Entity.SequenceStep", step + 1.0);
+		destinyStation = seqStep->station; // one of two is nullptr
+		destinyLabel = seqStep->label;
+		sequence->assign(seqStep, entity);
+		entity->setAttributeValueByRank(_sequenceStepAttributeRank, step + 1.0);
 	} else if (_routeDestinationType == Route::DestinationType::Station && _stationExpression != "") {
 		Util::identification stationID = _parentModel->parseExpression(_stationExpression);
 		destinyStation = dynamic_cast<Station*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Station>(), stationID));
@@ -219,7 +221,26 @@ void Route::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	}
 }
 
-//void Route::_initBetweenReplications() {}
+void Route::_initBetweenReplications() {
+	_sequenceAttributeRank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), "Entity.Sequence");
+	_sequenceStepAttributeRank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), "Entity.SequenceStep");
+	_sequences.clear();
+	for (ModelDataDefinition* sequence : *_parentModel->getDataManager()->getDataDefinitionList(Util::TypeOf<Sequence>())->list()) {
+		_sequences[sequence->getId()] = static_cast<Sequence*> (sequence);
+	}
+}
+
+Sequence* Route::_sequenceOfId(Util::identification id) {
+	std::unordered_map<Util::identification, Sequence*>::iterator it = _sequences.find(id);
+	if (it != _sequences.end()) {
+		return it->second;
+	}
+	Sequence* sequence = dynamic_cast<Sequence*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Sequence>(), id));
+	if (sequence != nullptr) {
+		_sequences[id] = sequence;
+	}
+	return sequence;
+}
 
 bool Route::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
@@ -291,6 +312,13 @@ void Route::_createInternalAndAttachedData() {
 	}
 	_attachedDataInsert("Station", _station);
 	_attachedDataInsert("Label", _label);
+	if (_routeDestinationType == Route::DestinationType::Sequence) { // entities may follow any sequence
+		int i = 0;
+		for (ModelDataDefinition* sequence : *_parentModel->getDataManager()->getDataDefinitionList(Util::TypeOf<Sequence>())->list()) {
+			_attachedDataInsert("Sequence" + Util::StrIndex(i), sequence);
+			i++;
+		}
+	}
 }
 
 bool Route::_check(std::string* errorMessage) {
@@ -19,6 +19,7 @@
 #include "../data/Station.h"
 #include "../data/Sequence.h"
 #include "../data/Label.h"
+#include <unordered_map>
 
 /*!
 Route module
@@ -89,7 +90,7 @@ protected:
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 protected:
-	//virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	virtual bool _check(std::string* errorMessage);
 	virtual void _createInternalAndAttachedData();
 private:
@@ -109,6 +110,11 @@ private: // association
 	Label* _label = nullptr;
 private: // internal elements
 	Counter* _numberIn = nullptr;
+private: // routing by sequence, resolved at the beginning of each replication
+	Sequence* _sequenceOfId(Util::identification id);
+	int _sequenceAttributeRank = -1;
+	int _sequenceStepAttributeRank = -1;
+	std::unordered_map<Util::identification, Sequence*> _sequences;
 };
 
 #endif /* ROUTE_H */
@@ -12,6 +12,8 @@
  */
 
 #include "Seize.h"
+#include "Delay.h"
+#include "Release.h"
 #include "../data/Resource.h"
 #include "../../kernel/simulator/Attribute.h"
 #include "../../kernel/simulator/Simulator.h"
@@ -159,6 +161,7 @@ ModelComponent* Seize::LoadInstance(Model* model, PersistenceRecord *fields) {
 // protected must override
 
 void Seize::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+	unsigned int request = 0;
 	for (SeizableItem* seizable : *_seizeRequests->list()) {
 		unsigned int* index = new unsigned int(99999);
 		Resource* resource = _getResourceFromSeizableItem(seizable, entity, index);
@@ -166,7 +169,7 @@ void Seize::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 		if (_priorityExpression != "") {
 			priority = _parentModel->parseExpression(_priorityExpression);
 		}
-		unsigned int quantity = _parentModel->parseExpression(seizable->getQuantityExpression());
+		unsigned int quantity = _quantityOf(request, seizable);
 		if (!resource->seize(quantity, priority)) { // not enought free quantity to allocate. Entity goes to the queue
 			WaitingResource* waitingRec = new WaitingResource(entity, _parentModel->getSimulation()->getSimulatedTime(), quantity, this);
 			Queue* queue;
@@ -180,17 +183,31 @@ void Seize::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 			}
 			queue->insertElement(waitingRec); // ->list()->insert(waitingRec);
 			_parentModel->getTracer()->traceSimulation(this, _parentModel->getSimulation()->getSimulatedTime(), entity, this, "Entity starts to wait for resource in queue \"" + queue->getName() + "\" with " + std::to_string(queue->size()) + " elements");
+			delete index;
 			return;
 		} else { // alocate the resource
 			std::string attribIndex="";
-			entity->setAttributeValue("Entity.Allocation." + resource->getName(), static_cast<int> (this->_allocationType), attribIndex, true); //@TODO: Check it!
-			if (seizable->getSaveAttribute() != "") {
+			if (request < _allocationAttributeRanks.size() && _allocationAttributeRanks[request] >= 0) {
+				entity->setAttributeValueByRank(_allocationAttributeRanks[request], static_cast<int> (this->_allocationType));
+			} else {
+				entity->setAttributeValue("Entity.Allocation." + resource->getName(), static_cast<int> (this->_allocationType), attribIndex, true); //@TODO: Check it!
+			}
+			if (request < _saveAttributeRanks.size() && _saveAttributeRanks[request] >= 0) {
+				entity->setAttributeValueByRank(_saveAttributeRanks[request], *index);
+			} else if (seizable->getSaveAttribute() != "") {
 				entity->setAttributeValue(seizable->getSaveAttribute(), *index, attribIndex);
 			}
 			_parentModel->getTracer()->traceSimulation(this, _parentModel->getSimulation()->getSimulatedTime(), entity, this, entity->getName() + " seizes " + std::to_string(quantity) + " elements of resource \"" + resource->getName() + "\" (capacity:" + std::to_string(resource->getCapacity()) + ", numberbusy:" + std::to_string(resource->getNumberBusy()) + ")");
 		}
+		delete index;
+		request++;
+	}
+	if (_fusedDelay != nullptr) { // the Delay schedules the end of the delay at once, as if the entity had arrived there by an event
+		Event delayEvent(_parentModel->getSimulation()->getSimulatedTime(), entity, _fusedDelay);
+		ModelComponent::DispatchEvent(&delayEvent);
+	} else {
+		_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 	}
-	_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
 bool Seize::_loadInstance(PersistenceRecord *fields) {
@@ -198,7 +215,7 @@ bool Seize::_loadInstance(PersistenceRecord *fields) {
 	if (res) {
 		this->_allocationType = static_cast<Util::AllocationType> (fields->loadField("allocationType", static_cast<int> (DEFAULT.allocationType)));
 		this->_priority = fields->loadField("priority", DEFAULT.priority);
-		this->_priorityExpression = fields->loadField("priorityExpression", DEFAULT.priority);
+		this->_priorityExpression = fields->loadField("priorityExpression", DEFAULT.priorityExpression);
 		_queueableItem = new QueueableItem(nullptr);
 		_queueableItem->setElementManager(_parentModel->getDataManager());
 		_queueableItem->loadInstance(fields);
@@ -216,8 +233,8 @@ bool Seize::_loadInstance(PersistenceRecord *fields) {
 void Seize::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
 	fields->saveField("allocationType", static_cast<int> (_allocationType), static_cast<int> (DEFAULT.allocationType), saveDefaultValues);
-	fields->saveField("priority=", _priority, DEFAULT.priority, saveDefaultValues);
-	fields->saveField("priorityExpression=", _priorityExpression, DEFAULT.priorityExpression, saveDefaultValues);
+	fields->saveField("priority", _priority, DEFAULT.priority, saveDefaultValues);
+	fields->saveField("priorityExpression", _priorityExpression, DEFAULT.priorityExpression, saveDefaultValues);
 	if (_queueableItem != nullptr) {
 		_queueableItem->saveInstance(fields, saveDefaultValues);
 	}
@@ -238,6 +255,7 @@ void Seize::_initBetweenReplications() {
 	//	(*it)->setLastMemberSeized(0);
 	//	ModelDataDefinition::InitBetweenReplications((*it)->getSeizable());
 	//}
+	_compile();
 }
 
 void Seize::_createInternalAndAttachedData() {
@@ -251,6 +269,7 @@ void Seize::_createInternalAndAttachedData() {
 				seizable->setResource(resource);
 			}
 			_attachedDataInsert("SeizableItem" + Util::StrIndex(i), resource);
+			_attachedAttributesInsert({"Entity.Allocation." + resource->getName()});
 			Resource::ResourceEventHandler handler = Resource::SetResourceEventHandler<Seize>(&Seize::_handlerForResourceEvent, this);
 			resource->addReleaseResourceEventHandler(handler, this, _priority);
 		} else if (seizable->getSeizableType() == SeizableItem::SeizableType::SET) {
@@ -347,9 +366,10 @@ void Seize::_handlerForResourceEvent(Resource* resource) { //@TODO Resource is u
 		bool canSeizeAll = true;
 		unsigned int quantityRequested, quantityAvailable;
 		unsigned int *index = new unsigned int(0);
+		unsigned int request = 0;
 		for (SeizableItem* seizable : *_seizeRequests->list()) {
 			Resource* resource = _getResourceFromSeizableItem(seizable, first->getEntity(), index);
-			quantityRequested = _parentModel->parseExpression(seizable->getQuantityExpression());
+			quantityRequested = _quantityOf(request++, seizable);
 			quantityAvailable = resource->getCapacity() - resource->getNumberBusy();
 			if (quantityAvailable < quantityRequested) {
 				canSeizeAll = false;
@@ -377,6 +397,43 @@ void Seize::_handlerForResourceEvent(Resource* resource) { //@TODO Resource is u
 	}
 }
 
+unsigned int Seize::_quantityOf(unsigned int request, SeizableItem* seizable) {
+	if (request < _isQuantityNumber.size() && _isQuantityNumber[request]) {
+		return _quantityValues[request];
+	}
+	return _parentModel->parseExpression(seizable->getQuantityExpression());
+}
+
+void Seize::_compile() {
+	ModelDataManager* data = _parentModel->getDataManager();
+	_isQuantityNumber.clear();
+	_quantityValues.clear();
+	_allocationAttributeRanks.clear();
+	_saveAttributeRanks.clear();
+	for (SeizableItem* seizable : *_seizeRequests->list()) {
+		double quantity = 0.0;
+		_isQuantityNumber.push_back(Util::StrToNumber(seizable->getQuantityExpression(), &quantity));
+		_quantityValues.push_back(quantity);
+		int allocationRank = -1;
+		if (seizable->getSeizableType() == SeizableItem::SeizableType::RESOURCE && seizable->getResource() != nullptr) {
+			allocationRank = data->getRankOf(Util::TypeOf<Attribute>(), "Entity.Allocation." + seizable->getResource()->getName());
+		}
+		_allocationAttributeRanks.push_back(allocationRank);
+		_saveAttributeRanks.push_back(seizable->getSaveAttribute() != "" ? data->getRankOf(Util::TypeOf<Attribute>(), seizable->getSaveAttribute()) : -1);
+	}
+	// Seize -> Delay -> Release: the Delay is dispatched in place
+	_fusedDelay = nullptr;
+	Connection* next = getConnectionManager()->getFrontConnection();
+	if (next != nullptr && next->component->getClassname() == Util::TypeOf<Delay>()) {
+		Connection* afterDelay = next->component->getConnectionManager()->getFrontConnection();
+		List<ModelComponent*>* breakpoints = _parentModel->getSimulation()->getBreakpointsOnComponent();
+		if (afterDelay != nullptr && afterDelay->component->getClassname() == Util::TypeOf<Release>()
+				&& breakpoints->find(next->component) == breakpoints->list()->end()) {
+			_fusedDelay = next;
+		}
+	}
+}
+
 Resource* Seize::_getResourceFromSeizableItem(SeizableItem* seizable, Entity* entity, unsigned int* indexPtr) {
 	Resource* resource;
 	unsigned int index = 0;
@@ -15,6 +15,7 @@
 #define SEIZE_H
 
 #include <string>
+#include <vector>
 #include "../../kernel/simulator/ModelComponent.h"
 #include "../../kernel/simulator/Model.h"
 #include "../data/Resource.h"
@@ -122,6 +123,11 @@ to be used.
 Expression This field is visible only if Queue Type is Expression. The
 expression entered in this field will be evaluated to indicate
 which queue is to be used.
+ *
+ * At the beginning of each replication quantities that are numbers are kept as their values, and the attributes of allocation and of
+ * saved members are resolved. When Seize is followed by a Delay followed by a Release (as inside Process), an entity that seizes all
+ * its resources is delayed in place, without an event to the Delay at the same time, so the end of the delay is the only event until
+ * the Release. Entities moving in place do not notify entity move handlers, so a breakpoint on the Delay prevents the fusion.
  */
 class Seize : public ModelComponent {
 public:
@@ -163,6 +169,8 @@ private:
 	void _handlerForResourceEvent(Resource* resource); //!< This method is indirectally invocked (notified) by resource when it's released, since it was added as ResourceEventHandler
 	Resource* _getResourceFromSeizableItem(SeizableItem* seizable, Entity* entity, unsigned int*indexPtr);
 	Queue* _getQueue() const;
+	unsigned int _quantityOf(unsigned int request, SeizableItem* seizable);
+	void _compile();
 public:
 
 	const struct DEFAULT_VALUES {
@@ -177,6 +185,12 @@ private:
 	std::string _priorityExpression = DEFAULT.priorityExpression;
 	QueueableItem* _queueableItem = nullptr; // usually has a queue, but not always (it could be a hold or a set)
 	List<SeizableItem*>* _seizeRequests = new List<SeizableItem*>();
+private: // compiled at the beginning of each replication
+	std::vector<bool> _isQuantityNumber;
+	std::vector<double> _quantityValues; //!< values of quantities that are numbers
+	std::vector<int> _allocationAttributeRanks; //!< rank of the allocation attribute of each request, or -1 when its resource is chosen from a set
+	std::vector<int> _saveAttributeRanks;
+	Connection* _fusedDelay = nullptr; //!< Delay dispatched in place, when followed by a Release
 };
 
 #endif /* SEIZE_H */
@@ -35,11 +35,16 @@ Signal::Signal(Model* model, std::string name) : ModelComponent(model, Util::Typ
 	SimulationControlGeneric<std::string>* propExpression = new SimulationControlGeneric<std::string>(
 									std::bind(&Signal::limitExpression, this), std::bind(&Signal::setLimitExpression, this, std::placeholders::_1),
 									Util::TypeOf<Signal>(), getName(), "LimitExpression", "");
+	SimulationControlGeneric<std::string>* propSignalValue = new SimulationControlGeneric<std::string>(
+									std::bind(&Signal::signalValueExpression, this), std::bind(&Signal::setSignalValueExpression, this, std::placeholders::_1),
+									Util::TypeOf<Signal>(), getName(), "SignalValueExpression", "");
 
 	_parentModel->getControls()->insert(propExpression);
+	_parentModel->getControls()->insert(propSignalValue);
 
 	// setting properties
 	_addProperty(propExpression);
+	_addProperty(propSignalValue);
 }
 
 // public virtual
@@ -77,8 +82,9 @@ PluginInformation* Signal::GetPluginInformation() {
 
 void Signal::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	unsigned int limit = _parentModel->parseExpression(_limitExpression);
-	traceSimulation(this, "Triggering signal \""+_signalData->getName()+"\" with limit \""+_limitExpression+"\"="+std::to_string(limit));
-	unsigned int freed = _signalData->generateSignal(_signalData->getId(),limit);
+	double signalValue = _parentModel->parseExpression(_signalValueExpression);
+	traceSimulation(this, "Triggering signal \""+_signalData->getName()+"\" of value "+Util::StrTruncIfInt(std::to_string(signalValue))+" with limit \""+_limitExpression+"\"="+std::to_string(limit));
+	unsigned int freed = _signalData->generateSignal(signalValue, limit);
 	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
 }
 
@@ -87,6 +93,7 @@ bool Signal::_loadInstance(PersistenceRecord *fields) {
 	if (res) {
 		// @TODO: not implemented yet
 		this->_limitExpression = fields->loadField("limitExpression", DEFAULT.limitExpression);
+		this->_signalValueExpression = fields->loadField("signalValue", DEFAULT.signalValueExpression);
 	}
 	return res;
 }
@@ -95,6 +102,7 @@ void Signal::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
 	// @TODO: not implemented yet
 	fields->saveField("limitExpression", _limitExpression, DEFAULT.limitExpression);
+	fields->saveField("signalValue", _signalValueExpression, DEFAULT.signalValueExpression, saveDefaultValues);
 }
 
 // protected should override
@@ -126,6 +134,16 @@ void Signal::setLimitExpression(const std::string&newLimitExpression)
 	_limitExpression = newLimitExpression;
 }
 
+const std::string&Signal::signalValueExpression() const
+{
+	return _signalValueExpression;
+}
+
+void Signal::setSignalValueExpression(const std::string&newSignalValueExpression)
+{
+	_signalValueExpression = newSignalValueExpression;
+}
+
 void Signal::_initBetweenReplications() {
 
 }
@@ -46,6 +46,8 @@ public:
 	void setSignalData(SignalData* signal);
 	const std::string&limitExpression() const;
 	void setLimitExpression(const std::string&newLimitExpression);
+	const std::string&signalValueExpression() const;
+	void setSignalValueExpression(const std::string&newSignalValueExpression);
 public: // static
 	static PluginInformation* GetPluginInformation();
 	static ModelComponent* LoadInstance(Model* model, PersistenceRecord *fields);
@@ -64,8 +66,10 @@ private: // methods
 private: // attributes 1:1
 	const struct DEFAULT_VALUES {
 		const std::string limitExpression = "1";
+		const std::string signalValueExpression = "0";
 	} DEFAULT;
 	std::string _limitExpression = DEFAULT.limitExpression;
+	std::string _signalValueExpression = DEFAULT.signalValueExpression; //!< only entities waiting for this value are released
 	unsigned int _signalsTriggered = 0;
 private: // attributes 1:n
 private: // attached
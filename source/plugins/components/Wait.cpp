@@ -47,6 +47,9 @@ Wait::Wait(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<
 	SimulationControlGeneric<std::string>* propExpression = new SimulationControlGeneric<std::string>(
 									std::bind(&Wait::getlimitExpression, this), std::bind(&Wait::setLimitExpression, this, std::placeholders::_1),
 									Util::TypeOf<Wait>(), getName(), "LimitExpression", "");
+	SimulationControlGeneric<std::string>* propWaitForValue = new SimulationControlGeneric<std::string>(
+									std::bind(&Wait::getWaitForValueExpression, this), std::bind(&Wait::setWaitForValueExpression, this, std::placeholders::_1),
+									Util::TypeOf<Wait>(), getName(), "WaitForValueExpression", "");
     SimulationControlGenericEnum<Wait::WaitType, Wait>* propWaitType = new SimulationControlGenericEnum<Wait::WaitType, Wait>(
                                     std::bind(&Wait::getWaitType, this), std::bind(&Wait::setWaitType, this, std::placeholders::_1),
                                     Util::TypeOf<Wait>(), getName(), "WaitType", "");
@@ -59,12 +62,14 @@ Wait::Wait(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<
     _parentModel->getControls()->insert(propWaitType);
 	_parentModel->getControls()->insert(propCondition);
 	_parentModel->getControls()->insert(propExpression);
+	_parentModel->getControls()->insert(propWaitForValue);
 
 	// setting properties
 	_addProperty(propQueue);
     _addProperty(propWaitType);
 	_addProperty(propCondition);
 	_addProperty(propExpression);
+	_addProperty(propWaitForValue);
 }
 
 // public
@@ -109,6 +114,14 @@ void Wait::setLimitExpression(const std::string &newLimitExpression){
 	limitExpression = newLimitExpression;
 }
 
+std::string Wait::getWaitForValueExpression() const {
+	return _waitForValueExpression;
+}
+
+void Wait::setWaitForValueExpression(const std::string &waitForValueExpression) {
+	_waitForValueExpression = waitForValueExpression;
+}
+
 
 //public static
 
@@ -134,36 +147,54 @@ PluginInformation* Wait::GetPluginInformation() {
 
 void Wait::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
 	std::string message = "Entity is waiting in the queue \"" + _queue->getName() + "\"";
+	double signalValue = 0.0;
 	if (_waitType == Wait::WaitType::WaitForSignal) {
-		message += " for signal \"" + _signalData->getName() + "\"";
+		signalValue = _parentModel->parseExpression(_waitForValueExpression);
+		message += " for signal \"" + _signalData->getName() + "\" of value " + Util::StrTruncIfInt(std::to_string(signalValue));
 	} else if (_waitType == Wait::WaitType::ScanForCondition) {
 		message += " until codition \"" + _condition + "\" is true";
-	} else if (_waitType == Wait::WaitType::ScanForCondition) {
+	} else if (_waitType == Wait::WaitType::InfiniteHold) {
 		message += " indefinitely";
 	}
 	_parentModel->getTracer()->traceSimulation(this, _parentModel->getSimulation()->getSimulatedTime(), entity, this, message);
-	Waiting* waiting = new Waiting(entity, _parentModel->getSimulation()->getSimulatedTime(), this);
-	_queue->insertElement(waiting);
+	if (_waitType == Wait::WaitType::WaitForSignal) {
+		WaitingSignal* waiting = new WaitingSignal(entity, _parentModel->getSimulation()->getSimulatedTime(), signalValue, this);
+		waiting->_positionInQueue = _queue->insertElement(waiting);
+		waiting->_waitingForSameValue = &_waitingBySignalValue[signalValue];
+		waiting->_positionInWaitingForSameValue = waiting->_waitingForSameValue->insert(waiting->_waitingForSameValue->end(), waiting);
+		_signalData->addWaiting(this, signalValue);
+	} else {
+		_queue->insertElement(new Waiting(entity, _parentModel->getSimulation()->getSimulatedTime(), this));
+	}
 }
 
 bool Wait::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_waitType = static_cast<Wait::WaitType> (fields->loadField("waitType", static_cast<int> (DEFAULT.waitType)));
+		_condition = fields->loadField("condition", DEFAULT.condition);
+		limitExpression = fields->loadField("limitExpression", DEFAULT.limitExpression);
+		_waitForValueExpression = fields->loadField("waitForValue", DEFAULT.waitForValueExpression);
 	}
 	return res;
 }
 
 void Wait::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	fields->saveField("waitType", static_cast<int> (_waitType), static_cast<int> (DEFAULT.waitType), saveDefaultValues);
+	fields->saveField("condition", _condition, DEFAULT.condition, saveDefaultValues);
+	fields->saveField("limitExpression", limitExpression, DEFAULT.limitExpression, saveDefaultValues);
+	fields->saveField("waitForValue", _waitForValueExpression, DEFAULT.waitForValueExpression, saveDefaultValues);
 }
 
 // protected virtual could override
 
 bool Wait::_check(std::string * errorMessage) {
 	bool resultAll = true;
-	if (_waitType == Wait::WaitType::ScanForCondition) {
+	if (_waitType == Wait::WaitType::WaitForSignal) {
+		resultAll &= _parentModel->checkExpression(limitExpression, "Limit", errorMessage);
+		resultAll &= _parentModel->checkExpression(_waitForValueExpression, "Wait for value", errorMessage);
+	} else if (_waitType == Wait::WaitType::ScanForCondition) {
 		resultAll = _parentModel->checkExpression(_condition, "Condition", errorMessage);
 		if (resultAll) { // add handler to event AfterProcessEvent
 			_parentModel->getOnEventManager()->addOnAfterProcessEventHandler(this, &Wait::_handlerForAfterProcessEventEvent);
@@ -185,7 +216,7 @@ void Wait::_createInternalAndAttachedData() {
 			_signalData = pm->newInstance<SignalData>(_parentModel);
 		}
 		SignalData::SignalDataEventHandler handler = SignalData::SetSignalDataEventHandler<Wait>(&Wait::_handlerForSignalDataEvent, this);
-		_signalData->addSignalDataEventHandler(handler, this);
+		_signalData->addSignalDataEventHandler(handler, this, true);
 		_attachedDataInsert("SignalData", _signalData);
 	} else {
 		_attachedDataRemove("SignalData");
@@ -193,23 +224,51 @@ void Wait::_createInternalAndAttachedData() {
 }
 
 void Wait::_initBetweenReplications() {
-
+	// the queue forgets those still waiting, and so does the Wait
+	for (std::pair<const double, std::list<WaitingSignal*>>& waiting : _waitingBySignalValue) {
+		for (WaitingSignal* waitingSignal : waiting.second) {
+			waitingSignal->_waitingForSameValue = nullptr;
+		}
+	}
+	_waitingBySignalValue.clear();
 }
 
 // private
 
+/*!
+ * Releases entities waiting for the value of the signal, in the order they arrived, up to the limits of the signal and of the Wait (0 for
+ * no limit). SignalData only calls it when there are entities waiting for the value, and accounts the entities freed in its limit.
+ * Those released are taken from the front of the list of the value, and removed from the queue at their positions, with no search
+ */
 unsigned int Wait::_handlerForSignalDataEvent(SignalData* signalData) {
-	unsigned int freed = 0;
+	unsigned int limit = signalData->remainsToLimit();
 	unsigned int waitLimit = _parentModel->parseExpression(limitExpression);
-	while (_queue->size() > 0 && signalData->remainsToLimit() > 0 &&  freed <= waitLimit) {
-		Waiting* w = _queue->getAtRank(0);
-		_queue->removeElement(w);
+	if (waitLimit > 0 && waitLimit < limit) {
+		limit = waitLimit;
+	}
+	std::map<double, std::list<WaitingSignal*>>::iterator waiting = _waitingBySignalValue.find(signalData->getSignalValue());
+	if (waiting == _waitingBySignalValue.end()) {
+		return 0;
+	}
+	std::list<WaitingSignal*> released;
+	std::list<WaitingSignal*>::iterator last = waiting->second.begin();
+	for (unsigned int i = 0; i < limit && last != waiting->second.end(); i++) {
+		last++;
+	}
+	released.splice(released.end(), waiting->second, waiting->second.begin(), last);
+	if (waiting->second.empty()) {
+		_waitingBySignalValue.erase(waiting);
+	}
+	unsigned int freed = 0;
+	for (WaitingSignal* w : released) {
+		w->_waitingForSameValue = nullptr;
+		_queue->removeElement(w->_positionInQueue);
 		freed++;
-		signalData->decreaseRemainLimit();
 		Entity* ent = w->getEntity();
-		std::string message = getName() + " received " + signalData->getName() + ". " + ent->getName() + " removed from " + _queue->getName() + ". " + std::to_string(freed) + " freed, " + std::to_string(signalData->remainsToLimit()) + " remaining";
+		std::string message = getName() + " received " + signalData->getName() + ". " + ent->getName() + " removed from " + _queue->getName() + ". " + std::to_string(freed) + " freed, " + std::to_string(signalData->remainsToLimit() - freed) + " remaining";
 		_parentModel->getTracer()->traceSimulation(this, TraceManager::Level::L8_detailed, _parentModel->getSimulation()->getSimulatedTime(), ent, this, message);
-		_parentModel->sendEntityToComponent(w->getEntity(), w->geComponent()->getConnectionManager()->getFrontConnection());
+		_parentModel->sendEntityToComponent(ent, w->geComponent()->getConnectionManager()->getFrontConnection());
+		delete w;
 	}
 	return freed;
 }
@@ -19,6 +19,40 @@
 #include "../data/SignalData.h"
 #include "../../kernel/simulator/OnEventManager.h"
 
+/*!
+ * An entity waiting for a signal of some value
+ */
+class WaitingSignal : public Waiting {
+public:
+
+	WaitingSignal(Entity* entity, double timeStartedWaiting, double signalValue, ModelComponent* thisComponent, unsigned int thisComponentOutputPort = 0) : Waiting(entity, timeStartedWaiting, thisComponent, thisComponentOutputPort) {
+		_signalValue = signalValue;
+	}
+
+	virtual ~WaitingSignal() {
+		if (_waitingForSameValue != nullptr) { // removed by another component (such as Remove) before the signal
+			_waitingForSameValue->erase(_positionInWaitingForSameValue);
+		}
+	}
+public:
+
+	virtual std::string show() {
+		return Waiting::show() +
+				",signalValue=" + std::to_string(_signalValue);
+	}
+public:
+
+	double getSignalValue() const {
+		return _signalValue;
+	}
+private:
+	friend class Wait;
+	double _signalValue;
+	std::list<WaitingSignal*>* _waitingForSameValue = nullptr; //!< where the Wait keeps it, until it is released
+	std::list<WaitingSignal*>::iterator _positionInWaitingForSameValue;
+	std::list<Waiting*>::iterator _positionInQueue;
+};
+
 /*!
 Wait module
 DESCRIPTION
@@ -102,6 +136,8 @@ public: // static
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
 	std::string getlimitExpression() const;
 	void setLimitExpression(const std::string &newLimitExpression);
+	std::string getWaitForValueExpression() const;
+	void setWaitForValueExpression(const std::string &waitForValueExpression);
 
 protected: // must be overriden
 	virtual bool _loadInstance(PersistenceRecord *fields);
@@ -120,16 +156,19 @@ private: // attributes 1:1
 	const struct DEFAULT_VALUES {
 		const WaitType waitType = Wait::WaitType::WaitForSignal;
 		const std::string condition = "";
-        const std::string limitExpression = "0";
+        const std::string limitExpression = "0"; // no limit but the signal's
+		const std::string waitForValueExpression = "0";
 	} DEFAULT;
 	WaitType _waitType = DEFAULT.waitType;
 	std::string _condition = DEFAULT.condition;
 	std::string limitExpression = DEFAULT.limitExpression;
+	std::string _waitForValueExpression = DEFAULT.waitForValueExpression; //!< evaluated for each entity when it arrives
 private: // internal
 	Queue *_queue = nullptr; // @TODO: It should be a QueueableItem, (Queue or Set)
 private: // attached
 	SignalData* _signalData = nullptr;
 private: // attributes 1:n
+	std::map<double, std::list<WaitingSignal*>> _waitingBySignalValue; //!< entities waiting for each signal value, in the order they arrived
 };
 
 
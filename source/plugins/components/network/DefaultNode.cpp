@@ -13,8 +13,7 @@
 
 #include "DefaultNode.h"
 #include "../../../kernel/simulator/Model.h"
-//#include "../../kernel/simulator/Simulator.h"
-//#include "../../kernel/simulator/PluginManager.h"
+#include "../../../kernel/TraitsKernel.h"
 
 
 
@@ -31,6 +30,13 @@ extern "C" StaticGetPluginInformation GetPluginInformation() {
 //
 
 DefaultNode::DefaultNode(Model* model, std::string name) : ModelComponent(model, Util::TypeOf<DefaultNode>(), name) {
+	// each node draws its own stream, so networks of many nodes do not repeat the same choices at every node
+	TraitsKernel<Sampler_if>::Implementation* sampler = new TraitsKernel<Sampler_if>::Implementation();
+	TraitsKernel<Sampler_if>::Parameters* parameters = new TraitsKernel<Sampler_if>::Parameters();
+	parameters->seed += 7919u * getId();
+	sampler->setRNGparameters(parameters);
+	sampler->reset();
+	_sampler = sampler;
 }
 
 
@@ -38,7 +44,21 @@ DefaultNode::DefaultNode(Model* model, std::string name) : ModelComponent(model,
 // public: /// new public user methods for this component
 //
 
-// ...
+void DefaultNode::addTransition(DefaultNode* destination, double probability, std::string guardExpression) {
+	_transitions->insert(new DefaultNodeTransition(this, destination, probability, guardExpression));
+}
+
+void DefaultNode::removeTransition(DefaultNodeTransition* transition) {
+	_transitions->remove(transition);
+}
+
+List<DefaultNodeTransition*>* DefaultNode::getTransitions() const {
+	return _transitions;
+}
+
+unsigned long DefaultNode::getNumberOfVisits() const {
+	return _visits;
+}
 
 
 //
@@ -46,7 +66,7 @@ DefaultNode::DefaultNode(Model* model, std::string name) : ModelComponent(model,
 //
 
 std::string DefaultNode::show() {
-	return ModelComponent::show() + "";
+	return ModelComponent::show() + ",transitions=" + std::to_string(_transitions->size() + _loadedTransitions.size());
 }
 
 
@@ -56,20 +76,12 @@ std::string DefaultNode::show() {
 
 PluginInformation* DefaultNode::GetPluginInformation() {
     PluginInformation* info = new PluginInformation(Util::TypeOf<DefaultNode>(), &DefaultNode::LoadInstance, &DefaultNode::NewInstance);
-	//info->setCategory("Discrete Processing");
-	//info->setMinimumInputs(1);
-	//info->setMinimumOutputs(1);
-	//info->setMaximumInputs(1);
-	//info->setMaximumOutputs(1);
-	//info->setSource(false);
-	//info->setSink(false);
-	//info->setSendTransfer(false);
-	//info->setReceiveTransfer(false);
-	//info->insertDynamicLibFileDependence("...");
-	//info->setDescriptionHelp("//@TODO");
-	//info->setAuthor("...");
-	//info->setDate("...");
-	//info->setObservation("...");
+	info->setCategory("Network");
+	info->setMinimumOutputs(0);
+	info->setMaximumOutputs(1);
+	info->setSendTransfer(true);
+	info->setReceiveTransfer(true);
+	info->setDescriptionHelp("A node of a network, or a state of a DefaultModalModel. An entity that arrives at the node is sent to the destination of one of the transitions leaving the node whose guards are true, chosen with probability proportional to their probabilities, or to the next component if no transition is enabled.");
 	return info;
 }
 
@@ -94,19 +106,48 @@ ModelDataDefinition* DefaultNode::NewInstance(Model* model, std::string name) {
 bool DefaultNode::_loadInstance(PersistenceRecord *fields) {
 	bool res = ModelComponent::_loadInstance(fields);
 	if (res) {
-		// @TODO: not implemented yet
+		_loadedTransitions.clear();
+		unsigned int size = fields->loadField("transitions", 0u);
+		for (unsigned int i = 0; i < size; i++) {
+			LoadedTransition transition;
+			transition.destination = fields->loadField("transitionDestination" + Util::StrIndex(i), "");
+			transition.probability = fields->loadField("transitionProbability" + Util::StrIndex(i), 1.0);
+			transition.guardExpression = fields->loadField("transitionGuard" + Util::StrIndex(i), "");
+			_loadedTransitions.push_back(transition);
+		}
 	}
 	return res;
 }
 
 void DefaultNode::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
 	ModelComponent::_saveInstance(fields, saveDefaultValues);
-	// @TODO: not implemented yet
+	_resolveTransitions();
+	std::vector<LoadedTransition> transitions;
+	for (DefaultNodeTransition* transition : *_transitions->list()) {
+		transitions.push_back({transition->getDestination()->getName(), transition->getProbability(), transition->getGuardExpression()});
+	}
+	transitions.insert(transitions.end(), _loadedTransitions.begin(), _loadedTransitions.end());
+	fields->saveField("transitions", (unsigned int) transitions.size(), 0u, saveDefaultValues);
+	for (unsigned int i = 0; i < transitions.size(); i++) {
+		fields->saveField("transitionDestination" + Util::StrIndex(i), transitions[i].destination);
+		fields->saveField("transitionProbability" + Util::StrIndex(i), transitions[i].probability, 1.0, saveDefaultValues);
+		fields->saveField("transitionGuard" + Util::StrIndex(i), transitions[i].guardExpression, "", saveDefaultValues);
+	}
 }
 
 void DefaultNode::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
-	traceSimulation(this, "I'm just a dummy model and I'll just send the entity forward");
-	this->_parentModel->sendEntityToComponent(entity, this->getConnectionManager()->getFrontConnection());
+	_visits++;
+	const int next = _table.next(0, _parentModel, _sampler->random());
+	if (next >= 0) {
+		DefaultNode* destination = _table.getNode(next);
+		traceSimulation(this, "Entity " + std::to_string(entity->getId()) + " transits to node \"" + destination->getName() + "\"");
+		_parentModel->sendEntityToComponent(entity, destination);
+	} else if (getConnectionManager()->size() > 0) {
+		_parentModel->sendEntityToComponent(entity, getConnectionManager()->getFrontConnection());
+	} else {
+		traceSimulation(this, "No transition enabled and no next component. Entity " + std::to_string(entity->getId()) + " is removed");
+		_parentModel->removeEntity(entity);
+	}
 }
 
 
@@ -114,14 +155,15 @@ void DefaultNode::_onDispatchEvent(Entity* entity, unsigned int inputPortNumber)
 // protected: /// virtual methods that could be overriden by derived classes, if needed
 //
 
-/*
 bool DefaultNode::_check(std::string* errorMessage) {
-	bool resultAll = true;
-	resultAll &= _someString != "";
-	resultAll &= _someUint > 0;
+	_resolveTransitions();
+	bool resultAll = _loadedTransitions.empty();
+	for (LoadedTransition& transition : _loadedTransitions) {
+		errorMessage->append("Destination node \"" + transition.destination + "\" not found. ");
+	}
+	resultAll &= DefaultNodeTransitionTable::Check(_transitions, _parentModel, errorMessage);
 	return resultAll;
 }
-*/
 
 /*
 ParserChangesInformation* DefaultNode::_getParserChangesInformation() {
@@ -139,12 +181,12 @@ ParserChangesInformation* DefaultNode::_getParserChangesInformation() {
 }
 */
 
-/*
 void DefaultNode::_initBetweenReplications() {
-	_someString = "Test";
-	_someUint = 1;
+	List<DefaultNode*> self;
+	self.insert(this);
+	_table.compile(&self, _transitions);
+	_visits = 0;
 }
-*/
 
 /*
 void DefaultNode::_createInternalAndAttachedData() {
@@ -165,3 +207,20 @@ void DefaultNode::_createInternalAndAttachedData() {
 void DefaultNode::_addProperty(PropertyBase* property) {
 }
 */
+
+//
+// private: /// new private user methods
+//
+
+void DefaultNode::_resolveTransitions() {
+	std::vector<LoadedTransition> unresolved;
+	for (LoadedTransition& transition : _loadedTransitions) {
+		DefaultNode* destination = dynamic_cast<DefaultNode*> (_parentModel->getComponentManager()->find(transition.destination));
+		if (destination != nullptr) {
+			addTransition(destination, transition.probability, transition.guardExpression);
+		} else {
+			unresolved.push_back(transition);
+		}
+	}
+	_loadedTransitions = unresolved;
+}
@@ -14,23 +14,53 @@
 #pragma once
 
 #include "../../../kernel/simulator/ModelComponent.h"
-//#include "../data/DummyElement.h"
+#include "../../../kernel/statistics/Sampler_if.h"
+#include "DefaultNodeTransitionTable.h"
 
 class DefaultNode;
 
+/*!
+ A transition from a source node to a destination node. Among the transitions leaving a node whose guards are true (not zero), one is
+ chosen with probability proportional to its probability (a weight, so probabilities need not sum 1). An empty guard is always true.
+ */
 class DefaultNodeTransition {
 public:
-    DefaultNodeTransition(DefaultNode* source,DefaultNode* destination) {
+    DefaultNodeTransition(DefaultNode* source, DefaultNode* destination, double probability = 1.0, std::string guardExpression = "") {
         _source = source;
         _destination = destination;
+        _probability = probability;
+        _guardExpression = guardExpression;
+    }
+public:
+    DefaultNode* getSource() const {
+        return _source;
+    }
+    DefaultNode* getDestination() const {
+        return _destination;
+    }
+    void setProbability(double probability) {
+        _probability = probability;
+    }
+    double getProbability() const {
+        return _probability;
+    }
+    void setGuardExpression(std::string guardExpression) {
+        _guardExpression = guardExpression;
+    }
+    std::string getGuardExpression() const {
+        return _guardExpression;
     }
 private:
     DefaultNode* _source = nullptr;
     DefaultNode* _destination = nullptr;
+    double _probability = 1.0;
+    std::string _guardExpression = "";
 };
 
 /*!
- This component ...
+ A node of a network. An entity that arrives at the node is sent to the destination of one of the transitions leaving it, chosen as
+ described in DefaultNodeTransition, or to its next component if it has no transition enabled. Nodes are also the states of a
+ DefaultModalModel.
  */
 class DefaultNode : public ModelComponent {
 public: /// constructors
@@ -38,7 +68,10 @@ public: /// constructors
     virtual ~DefaultNode() = default;
 
 public: /// new public user methods for this component
-	// ...
+	void addTransition(DefaultNode* destination, double probability = 1.0, std::string guardExpression = "");
+	void removeTransition(DefaultNodeTransition* transition);
+	List<DefaultNodeTransition*>* getTransitions() const;
+	unsigned long getNumberOfVisits() const; //!< Entities that arrived at the node in the current replication
 
 public: /// virtual public methods
 	virtual std::string show();
@@ -55,32 +88,36 @@ protected: /// virtual protected method that must be overriden
 
 protected: /// virtual protected methods that could be overriden by derived classes, if needed
 	/*! This method is called by ModelChecker during model check. The component should check itself to verify if user parameters are ok (ex: correct syntax for the parser) and everithing in its parameters allow the model too run without errors in this component */
-	// virtual bool _check(std::string* errorMessage);
+	virtual bool _check(std::string* errorMessage);
 	/*! This method returns all changes in the parser that are needed by plugins of this ModelDatas. When connecting a new plugin, ParserChangesInformation are used to change parser source code, whch is after compiled and dinamically linked to to simulator kernel to reflect the changes */
 	// virtual ParserChangesInformation* _getParserChangesInformation();
 	/*! This method is called by ModelSimulation when initianting the replication. The model should set all value for a new replication (Ex: setting back to 0 any internal counter, clearing lists, etc. */
-	// virtual void _initBetweenReplications();
+	virtual void _initBetweenReplications();
 	/*! This method is called by ModelChecker and is necessary only for those components that instantiate internal elements that must exist before simulation starts and even before model checking. That's the case of components that have internal StatisticsCollectors, since others components may refer to them as expressions (as in "TVAG(ThisCSTAT)") and therefore the modeldatum must exist before checking such expression */
 	// virtual void _createInternalAndAttachedData(); /*< A ModelDataDefinition or ModelComponent that includes (internal) ou refers to (attach) other ModelDataDefinition must register them inside this method. */
 	/*! This method is not used yet. It should be usefull for new UIs */
 	// virtual void _addProperty(PropertyBase* property);
 
 private: /// new private user methods
-	// ...
+	void _resolveTransitions();
 
 private: /// Attributes that should be loaded or saved with this component (Persistent Fields)
 
-	/// Default values for the attributes. Used on initing, loading and saving
-	// const struct DEFAULT_VALUES {
-        //const std::string someString = "Test";
-        //const unsigned int someUint = 1;
-	// } DEFAULT;
-    //std::string _someString = DEFAULT.someString;
-    //unsigned int _someUint = DEFAULT.someUint;
     List<DefaultNodeTransition*>* _transitions = new List<DefaultNodeTransition*>();
+    struct LoadedTransition {
+        std::string destination; // name of a node that may be loaded after this one
+        double probability;
+        std::string guardExpression;
+    };
+    std::vector<LoadedTransition> _loadedTransitions;
+
+private: /// simulation
+    DefaultNodeTransitionTable _table; // its row 0 is this node
+    Sampler_if* _sampler;
+    unsigned long _visits = 0;
 
 private: /// internal DataElements (Composition)
-    //DummyElement* _internalDataDefinition = nullptr;
+    // ...
 
 private: /// attached DataElements (Agrregation)
 	// ...
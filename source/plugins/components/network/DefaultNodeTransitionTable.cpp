@@ -0,0 +1,154 @@
+#include "DefaultNodeTransitionTable.h"
+#include "DefaultNode.h"
+#include "../../../kernel/simulator/Model.h"
+#include <algorithm>
+
+void DefaultNodeTransitionTable::compile(List<DefaultNode*>* nodes, List<DefaultNodeTransition*>* transitions) {
+	clear();
+	if (nodes != nullptr) {
+		for (DefaultNode* node : *nodes->list()) {
+			_indexOf(node);
+		}
+	}
+	// group transitions by source, keeping their order
+	std::vector<std::vector<DefaultNodeTransition*>> rows;
+	for (DefaultNodeTransition* transition : *transitions->list()) {
+		unsigned int source = _indexOf(transition->getSource());
+		_indexOf(transition->getDestination());
+		if (rows.size() < _nodes.size()) {
+			rows.resize(_nodes.size());
+		}
+		rows[source].push_back(transition);
+	}
+	rows.resize(_nodes.size());
+	_rowStart.assign(1, 0);
+	_rowGuarded.assign(_nodes.size(), false);
+	for (unsigned int row = 0; row < rows.size(); row++) {
+		double cumulative = 0.0;
+		for (DefaultNodeTransition* transition : rows[row]) {
+			bool enabled;
+			const bool constant = ConstantGuard(transition->getGuardExpression(), &enabled);
+			if (transition->getProbability() <= 0.0 || (constant && !enabled)) {
+				continue; // never taken
+			}
+			cumulative += transition->getProbability();
+			_destinations.push_back(_indexes[transition->getDestination()]);
+			_weights.push_back(transition->getProbability());
+			_cumulative.push_back(cumulative);
+			_guards.push_back(constant ? "" : transition->getGuardExpression());
+			_rowGuarded[row] = _rowGuarded[row] || !constant;
+		}
+		_rowStart.push_back(_destinations.size());
+	}
+	_enabledCumulative.resize(_destinations.size());
+}
+
+void DefaultNodeTransitionTable::clear() {
+	_nodes.clear();
+	_indexes.clear();
+	_rowStart.assign(1, 0);
+	_destinations.clear();
+	_weights.clear();
+	_cumulative.clear();
+	_guards.clear();
+	_rowGuarded.clear();
+	_enabledCumulative.clear();
+}
+
+int DefaultNodeTransitionTable::next(unsigned int node, Model* model, double random) {
+	const unsigned int first = _rowStart[node], last = _rowStart[node + 1];
+	if (first == last) {
+		return -1;
+	}
+	const double* cumulative = _cumulative.data();
+	if (_rowGuarded[node]) {
+		double total = 0.0;
+		for (unsigned int k = first; k < last; k++) {
+			if (_guards[k] == "" || model->parseExpression(_guards[k]) != 0.0) {
+				total += _weights[k];
+			}
+			_enabledCumulative[k] = total;
+		}
+		if (total <= 0.0) {
+			return -1;
+		}
+		cumulative = _enabledCumulative.data();
+	}
+	// the first transition whose cumulative weight exceeds the drawn one. Disabled transitions do not increase it, so are never chosen
+	const double drawn = random * cumulative[last - 1];
+	unsigned int k = std::upper_bound(cumulative + first, cumulative + last, drawn) - cumulative;
+	if (k == last) {
+		k = last - 1;
+		while (k > first && cumulative[k] == cumulative[k - 1]) {
+			k--;
+		}
+	}
+	return _destinations[k];
+}
+
+int DefaultNodeTransitionTable::getIndex(DefaultNode* node) const {
+	std::unordered_map<DefaultNode*, unsigned int>::const_iterator it = _indexes.find(node);
+	return it == _indexes.end() ? -1 : (int) it->second;
+}
+
+DefaultNode* DefaultNodeTransitionTable::getNode(unsigned int index) const {
+	return _nodes[index];
+}
+
+unsigned int DefaultNodeTransitionTable::getNumberOfNodes() const {
+	return _nodes.size();
+}
+
+unsigned int DefaultNodeTransitionTable::getNumberOfTransitions() const {
+	return _destinations.size();
+}
+
+bool DefaultNodeTransitionTable::isGuarded(unsigned int node) const {
+	return _rowGuarded[node];
+}
+
+bool DefaultNodeTransitionTable::Check(List<DefaultNodeTransition*>* transitions, Model* model, std::string* errorMessage) {
+	bool resultAll = true;
+	unsigned int i = 0;
+	for (DefaultNodeTransition* transition : *transitions->list()) {
+		if (transition->getSource() == nullptr || transition->getDestination() == nullptr) {
+			errorMessage->append("Transition" + Util::StrIndex(i) + " has no source or destination node. ");
+			resultAll = false;
+		}
+		if (transition->getProbability() < 0.0) {
+			errorMessage->append("Transition" + Util::StrIndex(i) + " has a negative probability. ");
+			resultAll = false;
+		}
+		bool value;
+		if (!ConstantGuard(transition->getGuardExpression(), &value)) {
+			resultAll &= model->checkExpression(transition->getGuardExpression(), "Transition" + Util::StrIndex(i) + " guard", errorMessage);
+		}
+		i++;
+	}
+	return resultAll;
+}
+
+bool DefaultNodeTransitionTable::ConstantGuard(std::string guardExpression, bool* value) {
+	if (guardExpression.find_first_not_of(" \t") == std::string::npos) {
+		*value = true;
+		return true;
+	}
+	try {
+		std::size_t length;
+		double constant = std::stod(guardExpression, &length);
+		if (guardExpression.find_first_not_of(" \t", length) == std::string::npos) {
+			*value = constant != 0.0;
+			return true;
+		}
+	} catch (...) {
+	}
+	return false;
+}
+
+unsigned int DefaultNodeTransitionTable::_indexOf(DefaultNode* node) {
+	std::pair < std::unordered_map<DefaultNode*, unsigned int>::iterator, bool> inserted = _indexes.insert({node, (unsigned int) _nodes.size()});
+	if (inserted.second) {
+		_nodes.push_back(node);
+	}
+	return inserted.first->second;
+}
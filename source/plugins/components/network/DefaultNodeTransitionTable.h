@@ -0,0 +1,53 @@
+#ifndef DEFAULTNODETRANSITIONTABLE_H
+#define DEFAULTNODETRANSITIONTABLE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "../../../kernel/util/List.h"
+
+class Model;
+class DefaultNode;
+class DefaultNodeTransition;
+
+/*!
+ * Transitions among nodes compiled into compressed sparse rows: the transitions leaving the i-th node are the entries from rowStart[i] to
+ * rowStart[i+1] of contiguous arrays of destinations and cumulative weights. Constant guards are folded when compiling, so transitions
+ * that can never be taken are dropped and a row without guards chooses its transition by a binary search over its cumulative weights.
+ * Only rows with guards that depend on the state of the model evaluate them, once per choice.
+ */
+class DefaultNodeTransitionTable {
+public:
+	DefaultNodeTransitionTable() = default;
+	virtual ~DefaultNodeTransitionTable() = default;
+public:
+	/*! Compiles the transitions. Nodes are indexed in the order of the list, followed by those that only appear in transitions */
+	void compile(List<DefaultNode*>* nodes, List<DefaultNodeTransition*>* transitions);
+	void clear();
+	/*! Index of the next node from the node of the given index, given a random number in [0,1), or -1 if no transition is enabled */
+	int next(unsigned int node, Model* model, double random);
+	int getIndex(DefaultNode* node) const; //!< Index of the node, or -1 if it is not in the table
+	DefaultNode* getNode(unsigned int index) const;
+	unsigned int getNumberOfNodes() const;
+	unsigned int getNumberOfTransitions() const; //!< Transitions that may be taken, after folding constant guards
+	bool isGuarded(unsigned int node) const; //!< Whether any transition leaving the node has a guard evaluated while simulating
+public:
+	/*! Checks the guard expressions and probabilities of the transitions */
+	static bool Check(List<DefaultNodeTransition*>* transitions, Model* model, std::string* errorMessage);
+	/*! Whether the guard is a constant, and its value if so. An empty guard is always true */
+	static bool ConstantGuard(std::string guardExpression, bool* value);
+private:
+	unsigned int _indexOf(DefaultNode* node);
+private:
+	std::vector<DefaultNode*> _nodes;
+	std::unordered_map<DefaultNode*, unsigned int> _indexes;
+	std::vector<unsigned int> _rowStart{0};
+	std::vector<unsigned int> _destinations;
+	std::vector<double> _weights;
+	std::vector<double> _cumulative;
+	std::vector<std::string> _guards; // empty if folded
+	std::vector<char> _rowGuarded;
+	std::vector<double> _enabledCumulative; // scratch for guarded rows
+};
+
+#endif /* DEFAULTNODETRANSITIONTABLE_H */
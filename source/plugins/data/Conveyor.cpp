@@ -0,0 +1,583 @@
+#include "Conveyor.h"
+#include <cmath>
+#include <algorithm>
+#include "../../kernel/simulator/Model.h"
+#include "../../kernel/simulator/Simulator.h"
+#include "../../kernel/simulator/ModelComponent.h"
+
+#ifdef PLUGINCONNECT_DYNAMIC
+
+extern "C" StaticGetPluginInformation GetPluginInformation() {
+	return &Conveyor::GetPluginInformation;
+}
+#endif
+
+// positions are computed from times, so they are compared with a tolerance relative to their magnitude
+static const double EPSILON = 1e-9;
+
+static bool Reached(double position, double target) {
+	return position >= target - EPSILON * std::max(1.0, std::abs(target));
+}
+
+ModelDataDefinition* Conveyor::NewInstance(Model* model, std::string name) {
+	return new Conveyor(model, name);
+}
+
+std::string Conveyor::convertEnumToStr(ConveyorType type) {
+	switch (static_cast<int> (type)) {
+		case 0: return "NONACCUMULATING";
+		case 1: return "ACCUMULATING";
+	}
+	return "Unknown";
+}
+
+Conveyor::Conveyor(Model* model, std::string name) : ModelDataDefinition(model, Util::TypeOf<Conveyor>(), name) {
+	SimulationControlGeneric<double>* propVelocity = new SimulationControlGeneric<double>(
+			std::bind(&Conveyor::getVelocity, this), std::bind(&Conveyor::setVelocity, this, std::placeholders::_1),
+			Util::TypeOf<Conveyor>(), getName(), "Velocity", "");
+	SimulationControlGenericEnum<Util::TimeUnit, Util>* propVelocityTimeUnit = new SimulationControlGenericEnum<Util::TimeUnit, Util>(
+			std::bind(&Conveyor::getVelocityTimeUnit, this), std::bind(&Conveyor::setVelocityTimeUnit, this, std::placeholders::_1),
+			Util::TypeOf<Conveyor>(), getName(), "VelocityTimeUnit", "");
+	SimulationControlGeneric<double>* propCellSize = new SimulationControlGeneric<double>(
+			std::bind(&Conveyor::getCellSize, this), std::bind(&Conveyor::setCellSize, this, std::placeholders::_1),
+			Util::TypeOf<Conveyor>(), getName(), "CellSize", "");
+	SimulationControlGenericEnum<Conveyor::ConveyorType, Conveyor>* propConveyorType = new SimulationControlGenericEnum<Conveyor::ConveyorType, Conveyor>(
+			std::bind(&Conveyor::getConveyorType, this), std::bind(&Conveyor::setConveyorType, this, std::placeholders::_1),
+			Util::TypeOf<Conveyor>(), getName(), "ConveyorType", "");
+
+	_parentModel->getControls()->insert(propVelocity);
+	_parentModel->getControls()->insert(propVelocityTimeUnit);
+	_parentModel->getControls()->insert(propCellSize);
+	_parentModel->getControls()->insert(propConveyorType);
+
+	// setting properties
+	_addProperty(propVelocity);
+	_addProperty(propVelocityTimeUnit);
+	_addProperty(propCellSize);
+	_addProperty(propConveyorType);
+}
+
+Conveyor::~Conveyor() {
+	_clear();
+	for (PairConveyorEventHandler* pair : *_conveyorEventHandlers->list()) {
+		delete pair;
+	}
+	delete _conveyorEventHandlers;
+	delete _stations;
+}
+
+std::string Conveyor::show() {
+	std::string msg = ModelDataDefinition::show() +
+			",type=" + convertEnumToStr(_conveyorType) +
+			",velocity=" + Util::StrTruncIfInt(std::to_string(_velocity)) + " per " + Util::StrTimeUnitShort(_velocityTimeUnit) +
+			",cellSize=" + Util::StrTruncIfInt(std::to_string(_cellSize)) +
+			",stations=[";
+	unsigned int i = 0;
+	for (Station* station : *_stations->list()) {
+		msg += station->getName() + "@" + Util::StrTruncIfInt(std::to_string(_positions[i++])) + ",";
+	}
+	if (!_stations->empty()) {
+		msg = msg.substr(0, msg.length() - 1);
+	}
+	return msg + "],loads=" + std::to_string(_loads.size());
+}
+
+PluginInformation* Conveyor::GetPluginInformation() {
+	PluginInformation* info = new PluginInformation(Util::TypeOf<Conveyor>(), &Conveyor::LoadInstance, &Conveyor::NewInstance);
+	info->insertDynamicLibFileDependence("station.so");
+	std::string help = "The Conveyor module defines a conveyor, a path of stations along which entities are conveyed at a constant velocity.";
+	help += " Entities access the conveyor at a station (Access module), occupying a number of contiguous cells, are conveyed to a destination station, and then release their cells (Exit module).";
+	help += " A non-accumulating conveyor stops as a whole while an entity that has arrived at its destination has not exited yet.";
+	help += " On an accumulating conveyor only the entities behind such one stop, as they reach it, and then accumulate.";
+	help += " TYPICAL USES: (1) Parts conveyed to a paint booth; (2) Baggage conveyed through an airport";
+	info->setDescriptionHelp(help);
+	return info;
+}
+
+ModelDataDefinition* Conveyor::LoadInstance(Model* model, PersistenceRecord *fields) {
+	Conveyor* newElement = new Conveyor(model);
+	try {
+		newElement->_loadInstance(fields);
+	} catch (const std::exception& e) {
+
+	}
+	return newElement;
+}
+
+void Conveyor::addStation(Station* station, double distanceFromPrevious) {
+	double position = _positions.empty() ? 0.0 : _positions.back() + distanceFromPrevious;
+	_stations->insert(station);
+	_positions.push_back(position);
+}
+
+List<Station*>* Conveyor::getStations() const {
+	return _stations;
+}
+
+double Conveyor::getStationPosition(Station* station) const {
+	unsigned int i = 0;
+	for (Station* member : *_stations->list()) {
+		if (member == station) {
+			return _positions[i];
+		}
+		i++;
+	}
+	return -1.0;
+}
+
+void Conveyor::setVelocity(double velocity) {
+	_velocity = velocity;
+}
+
+double Conveyor::getVelocity() const {
+	return _velocity;
+}
+
+void Conveyor::setVelocityTimeUnit(Util::TimeUnit velocityTimeUnit) {
+	_velocityTimeUnit = velocityTimeUnit;
+}
+
+Util::TimeUnit Conveyor::getVelocityTimeUnit() const {
+	return _velocityTimeUnit;
+}
+
+void Conveyor::setCellSize(double cellSize) {
+	_cellSize = cellSize;
+}
+
+double Conveyor::getCellSize() const {
+	return _cellSize;
+}
+
+void Conveyor::setConveyorType(ConveyorType conveyorType) {
+	_conveyorType = conveyorType;
+}
+
+Conveyor::ConveyorType Conveyor::getConveyorType() const {
+	return _conveyorType;
+}
+
+bool Conveyor::access(Entity* entity, Station* origin, Station* destination, unsigned int cells) {
+	if (!hasSpace(origin, cells)) {
+		return false;
+	}
+	const double now = _now();
+	ConveyorLoad* load = new ConveyorLoad();
+	load->entity = entity;
+	load->destination = destination;
+	load->destinationPosition = getStationPosition(destination);
+	load->length = cells * _cellSize;
+	load->position = getStationPosition(origin);
+	if (load->destinationPosition < load->position) {
+		load->destinationPosition = load->position; // conveyors are not circular
+	}
+	std::list<ConveyorLoad*>::iterator it = _loads.begin();
+	while (it != _loads.end() && _frontAt(*it, now) >= load->position) {
+		it++;
+	}
+	load->it = _loads.insert(it, load);
+	_entityLoads[entity] = load;
+	if (_conveyorType == ConveyorType::NONACCUMULATING) {
+		load->reference = _beltDisplacement; // belt already advanced by hasSpace
+		load->arrival = _arrivals.insert({_beltDisplacement + load->destinationPosition - load->position, load});
+		_scheduleBelt();
+	} else {
+		load->reference = now;
+		_scheduleTrain(_trainHead(load->it));
+		std::list<ConveyorLoad*>::iterator follower = std::next(load->it);
+		if (follower != _loads.end() && (*follower)->state == ConveyorLoad::State::MOVING) {
+			_scheduleTrain(_trainHead(follower)); // its leader has changed
+		}
+	}
+	traceSimulation(this, entity->getName() + " accessed conveyor \"" + getName() + "\" at position " + Util::StrTruncIfInt(std::to_string(load->position)) + " to station \"" + destination->getName() + "\"");
+	return true;
+}
+
+bool Conveyor::hasSpace(Station* origin, unsigned int cells) {
+	return getSpaceTime(origin, cells) == _now();
+}
+
+double Conveyor::getSpaceTime(Station* origin, unsigned int cells) {
+	const double now = _now();
+	if (_conveyorType == ConveyorType::NONACCUMULATING) {
+		_advanceBelt(now);
+	}
+	const double entry = getStationPosition(origin);
+	const double tail = entry - cells * _cellSize;
+	double time = now;
+	for (ConveyorLoad* load : _loads) {
+		const double front = _frontAt(load, now);
+		if (Reached(front - load->length, entry)) {
+			continue; // downstream of the entry
+		}
+		if (Reached(tail, front)) {
+			break; // this and the remaining ones are upstream of the entry
+		}
+		bool stopped = load->state != ConveyorLoad::State::MOVING || (_conveyorType == ConveyorType::NONACCUMULATING && _arrivedLoads > 0);
+		if (stopped) {
+			return -1.0;
+		}
+		time = std::max(time, now + (entry - (front - load->length)) / _speed);
+	}
+	return time;
+}
+
+bool Conveyor::exit(Entity* entity) {
+	std::map<Entity*, ConveyorLoad*>::iterator found = _entityLoads.find(entity);
+	if (found == _entityLoads.end()) {
+		return false;
+	}
+	ConveyorLoad* load = found->second;
+	_entityLoads.erase(found);
+	const double now = _now();
+	if (_conveyorType == ConveyorType::NONACCUMULATING) {
+		_advanceBelt(now);
+		if (load->state == ConveyorLoad::State::ARRIVED) {
+			_arrivedLoads--;
+		} else {
+			_arrivals.erase(load->arrival);
+		}
+		_loads.erase(load->it);
+		delete load;
+		_scheduleBelt();
+	} else {
+		std::list<ConveyorLoad*>::iterator follower = _loads.erase(load->it);
+		load->state = ConveyorLoad::State::EXITED;
+		if (!load->eventTimes.empty()) {
+			_exitedLoads.insert(load); // deleted when its last event is dispatched
+		} else {
+			delete load;
+		}
+		_resumeBehind(follower);
+	}
+	traceSimulation(this, entity->getName() + " exited conveyor \"" + getName() + "\"");
+	for (PairConveyorEventHandler* pair : *_conveyorEventHandlers->list()) {
+		pair->first(this);
+	}
+	return true;
+}
+
+double Conveyor::getPosition(Entity* entity) {
+	std::map<Entity*, ConveyorLoad*>::iterator found = _entityLoads.find(entity);
+	if (found == _entityLoads.end()) {
+		return -1.0;
+	}
+	if (_conveyorType == ConveyorType::NONACCUMULATING) {
+		_advanceBelt(_now());
+	}
+	return _frontAt(found->second, _now());
+}
+
+unsigned int Conveyor::getNumberOfLoads() const {
+	return _loads.size();
+}
+
+unsigned long Conveyor::getNumberOfEvents() const {
+	return _numberOfEvents;
+}
+
+void Conveyor::addConveyorEventHandler(ConveyorEventHandler eventHandler, ModelComponent* component) {
+	for (PairConveyorEventHandler* pair : *_conveyorEventHandlers->list()) {
+		if (pair->second == component) {
+			return; // already exists. Do not insert again
+		}
+	}
+	_conveyorEventHandlers->insert(new PairConveyorEventHandler(eventHandler, component));
+}
+
+double Conveyor::_now() const {
+	return _parentModel->getSimulation()->getSimulatedTime();
+}
+
+/*!
+ * Position of the front of a load at a time not before its reference. On non-accumulating conveyors the belt must have been advanced
+ * to that time
+ */
+double Conveyor::_frontAt(const ConveyorLoad* load, double time) const {
+	if (_conveyorType == ConveyorType::NONACCUMULATING) {
+		return load->position + _beltDisplacement - load->reference;
+	}
+	if (load->state == ConveyorLoad::State::MOVING) {
+		return load->position + (time - load->reference) * _speed;
+	}
+	return load->position;
+}
+
+void Conveyor::_advanceBelt(double time) {
+	if (_arrivedLoads == 0) {
+		_beltDisplacement += (time - _beltTime) * _speed;
+	}
+	_beltTime = time;
+}
+
+/*!
+ * Schedules the next arrival on a non-accumulating conveyor, which moves only while no entity that has arrived is still on it
+ */
+void Conveyor::_scheduleBelt() {
+	if (_arrivedLoads > 0 || _arrivals.empty()) {
+		_beltEventTime = -1.0;
+		return;
+	}
+	double time = _beltTime + std::max(0.0, _arrivals.begin()->first - _beltDisplacement) / _speed;
+	if (time == _beltEventTime) {
+		return; // already scheduled
+	}
+	_beltEventTime = time;
+	InternalEvent* intEvent = new InternalEvent(time, "Conveyor Arrival");
+	intEvent->setEventHandler<Conveyor>(this, &Conveyor::_onBeltEvent, nullptr);
+	_parentModel->getFutureEvents()->insert(intEvent);
+	_numberOfEvents++;
+}
+
+void Conveyor::_onBeltEvent(void*) {
+	const double now = _now();
+	if (now != _beltEventTime) {
+		return; // the belt has stopped or another entity accessed it since this event was scheduled
+	}
+	_beltEventTime = -1.0;
+	_advanceBelt(now);
+	_beltDisplacement = std::max(_beltDisplacement, _arrivals.begin()->first); // no rounding errors
+	while (!_arrivals.empty() && Reached(_beltDisplacement, _arrivals.begin()->first)) {
+		ConveyorLoad* load = _arrivals.begin()->second;
+		_arrivals.erase(_arrivals.begin());
+		_arrivedLoads++;
+		_arrive(load);
+	}
+}
+
+/*!
+ * Position where a moving load on an accumulating conveyor will stop, unless the loads ahead of it change
+ */
+double Conveyor::_targetOf(const ConveyorLoad* load) const {
+	double target = load->destinationPosition;
+	if (load->it != _loads.begin()) {
+		ConveyorLoad* leader = *std::prev(load->it);
+		if (leader->state != ConveyorLoad::State::MOVING) {
+			target = std::min(target, leader->position - leader->length);
+		}
+	}
+	return target;
+}
+
+bool Conveyor::_touches(const ConveyorLoad* leader, const ConveyorLoad* follower, double time) const {
+	const double tail = _frontAt(leader, time) - leader->length, front = _frontAt(follower, time);
+	return Reached(front, tail) && Reached(tail, front);
+}
+
+/*!
+ * Moving loads touching each other on an accumulating conveyor move together, as a train, until one of them stops. The first one
+ * of the train of a load is its head
+ */
+std::list<ConveyorLoad*>::iterator Conveyor::_trainHead(std::list<ConveyorLoad*>::iterator it) const {
+	const double now = _now();
+	while (it != _loads.begin() && (*it)->state == ConveyorLoad::State::MOVING) {
+		std::list<ConveyorLoad*>::iterator leader = std::prev(it);
+		if ((*leader)->state != ConveyorLoad::State::MOVING || !_touches(*leader, *it, now)) {
+			break;
+		}
+		it = leader;
+	}
+	return it;
+}
+
+/*!
+ * Schedules the single event of a train: when its head reaches a stopped load ahead or some load of it reaches its destination.
+ * An event of the head still in the future events list at that time is reused
+ */
+void Conveyor::_scheduleTrain(std::list<ConveyorLoad*>::iterator head) {
+	const double now = _now();
+	ConveyorLoad* headLoad = *head;
+	double distance = _targetOf(headLoad) - _frontAt(headLoad, now);
+	std::list<ConveyorLoad*>::iterator member = std::next(head);
+	for (std::list<ConveyorLoad*>::iterator it = head; member != _loads.end() && (*member)->state == ConveyorLoad::State::MOVING && _touches(*it, *member, now); it = member++) {
+		(*member)->eventTime = -1.0; // it moves with the head
+		distance = std::min(distance, (*member)->destinationPosition - _frontAt(*member, now));
+	}
+	const double time = now + std::max(0.0, distance) / _speed;
+	headLoad->eventTime = time;
+	if (headLoad->eventTimes.count(time) > 0) {
+		return; // already scheduled
+	}
+	headLoad->eventTimes.insert(time);
+	InternalEvent* intEvent = new InternalEvent(time, "Conveyor Train");
+	intEvent->setEventHandler<Conveyor>(this, &Conveyor::_onLoadEvent, headLoad);
+	_parentModel->getFutureEvents()->insert(intEvent);
+	_numberOfEvents++;
+}
+
+void Conveyor::_onLoadEvent(void* parameter) {
+	ConveyorLoad* load = static_cast<ConveyorLoad*> (parameter);
+	const double now = _now();
+	load->eventTimes.erase(load->eventTimes.find(now));
+	if (load->state == ConveyorLoad::State::EXITED) {
+		if (load->eventTimes.empty()) {
+			_exitedLoads.erase(load);
+			delete load;
+		}
+		return;
+	}
+	if (load->state != ConveyorLoad::State::MOVING || now != load->eventTime || _trainHead(load->it) != load->it) {
+		return; // rescheduled since
+	}
+	load->eventTime = -1.0;
+	std::vector<ConveyorLoad*> train{load};
+	std::list<ConveyorLoad*>::iterator it = std::next(load->it);
+	for (; it != _loads.end() && (*it)->state == ConveyorLoad::State::MOVING && _touches(train.back(), *it, now); it++) {
+		train.push_back(*it);
+	}
+	// stops the loads of the train that have reached their destination, and the ones behind them or behind a stopped load ahead
+	ConveyorLoad* leader = load->it == _loads.begin() ? nullptr : *std::prev(load->it);
+	std::vector<ConveyorLoad*> arrived;
+	for (ConveyorLoad* member : train) {
+		const double front = _frontAt(member, now);
+		member->reference = now;
+		if (Reached(front, member->destinationPosition)) {
+			member->position = member->destinationPosition;
+			member->state = ConveyorLoad::State::ARRIVED;
+			arrived.push_back(member);
+		} else if (leader != nullptr && leader->state != ConveyorLoad::State::MOVING && Reached(front, leader->position - leader->length)) {
+			member->position = leader->position - leader->length;
+			member->state = ConveyorLoad::State::BLOCKED;
+		} else {
+			member->position = front;
+		}
+		leader = member;
+	}
+	if (load->state == ConveyorLoad::State::MOVING) {
+		_scheduleTrain(load->it);
+	} else {
+		traceSimulation(this, "Train of " + std::to_string(train.size()) + " entities headed by " + load->entity->getName() + " stopped on conveyor \"" + getName() + "\"", TraceManager::Level::L8_detailed);
+	}
+	if (it != _loads.end() && (*it)->state == ConveyorLoad::State::MOVING) {
+		_scheduleTrain(_trainHead(it)); // the train ahead of it may have stopped
+	}
+	for (ConveyorLoad* member : arrived) {
+		_arrive(member);
+	}
+}
+
+void Conveyor::_arrive(ConveyorLoad* load) {
+	load->state = ConveyorLoad::State::ARRIVED;
+	traceSimulation(this, load->entity->getName() + " arrived at station \"" + load->destination->getName() + "\" on conveyor \"" + getName() + "\"");
+	_parentModel->sendEntityToComponent(load->entity, load->destination->getEnterIntoStationComponent(), 0.0);
+}
+
+/*!
+ * Restarts the loads accumulated behind one that has left, which then move as a train
+ */
+void Conveyor::_resumeBehind(std::list<ConveyorLoad*>::iterator it) {
+	if (it == _loads.end() || (*it)->state == ConveyorLoad::State::ARRIVED) {
+		return;
+	}
+	const double now = _now();
+	if ((*it)->state == ConveyorLoad::State::BLOCKED) {
+		if (it != _loads.begin()) {
+			ConveyorLoad* leader = *std::prev(it);
+			if (leader->state != ConveyorLoad::State::MOVING && _touches(leader, *it, now)) {
+				return; // still behind a stopped load
+			}
+		}
+		std::list<ConveyorLoad*>::iterator first = it;
+		for (; it != _loads.end() && (*it)->state == ConveyorLoad::State::BLOCKED; it++) {
+			(*it)->state = ConveyorLoad::State::MOVING;
+			(*it)->reference = now;
+		}
+		_scheduleTrain(_trainHead(first));
+		if (it == _loads.end() || (*it)->state != ConveyorLoad::State::MOVING) {
+			return;
+		}
+	}
+	_scheduleTrain(_trainHead(it)); // its leader has changed
+}
+
+void Conveyor::_clear() {
+	for (ConveyorLoad* load : _loads) {
+		delete load;
+	}
+	for (ConveyorLoad* load : _exitedLoads) {
+		delete load;
+	}
+	_loads.clear();
+	_exitedLoads.clear();
+	_entityLoads.clear();
+	_arrivals.clear();
+	_beltDisplacement = 0.0;
+	_beltTime = 0.0;
+	_arrivedLoads = 0;
+	_beltEventTime = -1.0;
+	_numberOfEvents = 0;
+}
+
+bool Conveyor::_loadInstance(PersistenceRecord *fields) {
+	bool res = ModelDataDefinition::_loadInstance(fields);
+	if (res) {
+		_velocity = fields->loadField("velocity", DEFAULT.velocity);
+		_velocityTimeUnit = fields->loadField("velocityTimeUnit", DEFAULT.velocityTimeUnit);
+		_cellSize = fields->loadField("cellSize", DEFAULT.cellSize);
+		_conveyorType = static_cast<ConveyorType> (fields->loadField("conveyorType", static_cast<int> (DEFAULT.conveyorType)));
+		_stations->clear();
+		_positions.clear();
+		unsigned int numStations = fields->loadField("stations", 0u);
+		for (unsigned int i = 0; i < numStations; i++) {
+			std::string stationName = fields->loadField("station" + Util::StrIndex(i), "");
+			Station* station = dynamic_cast<Station*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Station>(), stationName));
+			if (station == nullptr) {
+				station = _parentModel->getParentSimulator()->getPluginManager()->newInstance<Station>(_parentModel, stationName);
+			}
+			addStation(station, fields->loadField("stationDistance" + Util::StrIndex(i), 0.0));
+		}
+	}
+	return res;
+}
+
+void Conveyor::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues) {
+	ModelDataDefinition::_saveInstance(fields, saveDefaultValues);
+	fields->saveField("velocity", _velocity, DEFAULT.velocity, saveDefaultValues);
+	fields->saveField("velocityTimeUnit", _velocityTimeUnit, DEFAULT.velocityTimeUnit, saveDefaultValues);
+	fields->saveField("cellSize", _cellSize, DEFAULT.cellSize, saveDefaultValues);
+	fields->saveField("conveyorType", static_cast<int> (_conveyorType), static_cast<int> (DEFAULT.conveyorType), saveDefaultValues);
+	fields->saveField("stations", _stations->size(), 0u, saveDefaultValues);
+	unsigned int i = 0;
+	for (Station* station : *_stations->list()) {
+		fields->saveField("station" + Util::StrIndex(i), station->getName());
+		fields->saveField("stationDistance" + Util::StrIndex(i), i == 0 ? 0.0 : _positions[i] - _positions[i - 1], 0.0, saveDefaultValues);
+		i++;
+	}
+}
+
+bool Conveyor::_check(std::string* errorMessage) {
+	bool resultAll = true;
+	if (_stations->size() < 2) {
+		errorMessage->append("Conveyor needs at least two stations. ");
+		resultAll = false;
+	}
+	if (_velocity <= 0.0) {
+		errorMessage->append("Velocity must be positive. ");
+		resultAll = false;
+	}
+	if (_cellSize <= 0.0) {
+		errorMessage->append("Cell size must be positive. ");
+		resultAll = false;
+	}
+	for (unsigned int i = 1; i < _positions.size(); i++) {
+		if (_positions[i] < _positions[i - 1]) {
+			errorMessage->append("Distances between stations must not be negative. ");
+			resultAll = false;
+			break;
+		}
+	}
+	return resultAll;
+}
+
+void Conveyor::_initBetweenReplications() {
+	_clear();
+	_speed = _velocity / Util::TimeUnitConvert(_velocityTimeUnit, _parentModel->getSimulation()->getReplicationBaseTimeUnit());
+}
+
+void Conveyor::_createInternalAndAttachedData() {
+	_attachedAttributesInsert({"Entity.Station"});
+	unsigned int i = 0;
+	for (Station* station : *_stations->list()) {
+		_attachedDataInsert("Station" + Util::StrIndex(i++), station);
+	}
+}
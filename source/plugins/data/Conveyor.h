@@ -0,0 +1,153 @@
+#ifndef CONVEYOR_H
+#define CONVEYOR_H
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+#include <functional>
+#include "../../kernel/simulator/ModelDataDefinition.h"
+#include "../../kernel/simulator/ModelDataManager.h"
+#include "../../kernel/simulator/Plugin.h"
+#include "../../kernel/simulator/Entity.h"
+#include "Station.h"
+
+/*!
+ * An entity being conveyed. Its position is the position of its front along the conveyor, and the entity occupies the conveyor from
+ * there back to its length.
+ */
+struct ConveyorLoad {
+
+	enum class State : int {
+		MOVING = 0, BLOCKED = 1, ARRIVED = 2, EXITED = 3
+	};
+	Entity* entity;
+	Station* destination;
+	double destinationPosition;
+	double length;
+	State state = State::MOVING;
+	double position; //!< Position of its front at the reference
+	double reference; //!< Time of the position (accumulating conveyors), or displacement of the belt at that time (non-accumulating ones)
+	double eventTime = -1.0; //!< Time of its valid event, if it is the head of a moving train (accumulating conveyors)
+	std::multiset<double> eventTimes; //!< Times of its events still in the future events list, valid or not
+	std::list<ConveyorLoad*>::iterator it;
+	std::multimap<double, ConveyorLoad*>::iterator arrival;
+};
+
+/*!
+Conveyor module
+DESCRIPTION
+The Conveyor module defines a conveyor, a path of stations along which entities are conveyed at a constant velocity. Entities access
+the conveyor at a station (Access module), occupying a number of contiguous cells, are conveyed to a destination station, and then
+release their cells (Exit module).
+A non-accumulating conveyor moves as a whole: it stops while an entity that has arrived at its destination has not exited yet. On an
+accumulating conveyor only the entities behind such one stop, as they reach it, and then accumulate.
+Positions of entities are computed from the time they accessed the conveyor or last started moving, so events are scheduled only for
+arrivals and, on accumulating conveyors, for entities reaching others that have stopped. Entities accumulated one against another
+start moving together as a train, which has a single event.
+TYPICAL USES
+* Parts conveyed to a paint booth
+* Baggage conveyed through an airport
+PROMPTS
+Prompt Description
+Name Unique name of the conveyor.
+Stations Stations along the conveyor, in order, with the distance from each one to the previous one.
+Velocity Velocity of the conveyor, in distance units per the velocity time unit.
+Cell Size Length of each cell of the conveyor, in distance units.
+Type Non-accumulating or accumulating.
+ */
+class Conveyor : public ModelDataDefinition {
+public:
+	typedef std::function<void(Conveyor*) > ConveyorEventHandler;
+	typedef std::pair<ConveyorEventHandler, ModelComponent*> PairConveyorEventHandler;
+
+	template<typename Class>
+	static ConveyorEventHandler SetConveyorEventHandler(void (Class::*function)(Conveyor*), Class * object) {
+		return std::bind(function, object, std::placeholders::_1);
+	}
+
+	enum class ConveyorType : int {
+		NONACCUMULATING = 0, ACCUMULATING = 1, num_elements = 2
+	};
+public:
+	static std::string convertEnumToStr(ConveyorType type);
+public:
+	Conveyor(Model* model, std::string name = "");
+	virtual ~Conveyor();
+public:
+	virtual std::string show();
+public: // static
+	static PluginInformation* GetPluginInformation();
+	static ModelDataDefinition* LoadInstance(Model* model, PersistenceRecord *fields);
+	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
+public:
+	void addStation(Station* station, double distanceFromPrevious = 0.0);
+	List<Station*>* getStations() const;
+	double getStationPosition(Station* station) const; //!< Negative if the station is not on the conveyor
+	void setVelocity(double velocity);
+	double getVelocity() const;
+	void setVelocityTimeUnit(Util::TimeUnit velocityTimeUnit);
+	Util::TimeUnit getVelocityTimeUnit() const;
+	void setCellSize(double cellSize);
+	double getCellSize() const;
+	void setConveyorType(ConveyorType conveyorType);
+	Conveyor::ConveyorType getConveyorType() const;
+public: // simulation
+	/*! Places the entity on the conveyor at the origin station, occupying the given number of cells, and conveys it to the destination station. Returns false if those cells are not free */
+	bool access(Entity* entity, Station* origin, Station* destination, unsigned int cells);
+	bool hasSpace(Station* origin, unsigned int cells); //!< Whether an entity may access the conveyor at the origin station now
+	double getSpaceTime(Station* origin, unsigned int cells); //!< Time when the entities now occupying the cells at the origin station will have left them, or negative if any of them is stopped
+	bool exit(Entity* entity); //!< Releases the cells of the entity. Returns false if the entity is not on the conveyor
+	double getPosition(Entity* entity); //!< Current position of the front of the entity, or negative if it is not on the conveyor
+	unsigned int getNumberOfLoads() const;
+	unsigned long getNumberOfEvents() const; //!< Events scheduled by the conveyor in the current replication
+	void addConveyorEventHandler(ConveyorEventHandler eventHandler, ModelComponent* component); //!< Handlers are notified whenever cells are released
+protected: // must be overriden
+	virtual bool _loadInstance(PersistenceRecord *fields);
+	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
+protected: // could be overriden
+	virtual bool _check(std::string* errorMessage);
+	virtual void _initBetweenReplications();
+	virtual void _createInternalAndAttachedData();
+private:
+	double _now() const;
+	double _frontAt(const ConveyorLoad* load, double time) const;
+	void _advanceBelt(double time);
+	void _scheduleBelt();
+	void _onBeltEvent(void* parameter);
+	double _targetOf(const ConveyorLoad* load) const;
+	bool _touches(const ConveyorLoad* leader, const ConveyorLoad* follower, double time) const;
+	std::list<ConveyorLoad*>::iterator _trainHead(std::list<ConveyorLoad*>::iterator it) const;
+	void _scheduleTrain(std::list<ConveyorLoad*>::iterator head);
+	void _onLoadEvent(void* parameter);
+	void _arrive(ConveyorLoad* load);
+	void _resumeBehind(std::list<ConveyorLoad*>::iterator it);
+	void _clear();
+private:
+	const struct DEFAULT_VALUES {
+		const double velocity = 1.0;
+		const Util::TimeUnit velocityTimeUnit = Util::TimeUnit::second;
+		const double cellSize = 1.0;
+		const ConveyorType conveyorType = ConveyorType::NONACCUMULATING;
+	} DEFAULT;
+	List<Station*>* _stations = new List<Station*>();
+	std::vector<double> _positions;
+	double _velocity = DEFAULT.velocity;
+	Util::TimeUnit _velocityTimeUnit = DEFAULT.velocityTimeUnit;
+	double _cellSize = DEFAULT.cellSize;
+	ConveyorType _conveyorType = DEFAULT.conveyorType;
+private: // simulation
+	double _speed = 1.0; // distance per base time unit
+	std::list<ConveyorLoad*> _loads; // downstream first
+	std::map<Entity*, ConveyorLoad*> _entityLoads;
+	std::set<ConveyorLoad*> _exitedLoads; // still referred by pending events
+	std::multimap<double, ConveyorLoad*> _arrivals; // non-accumulating: loads by the displacement of the belt at their arrival
+	double _beltDisplacement = 0.0;
+	double _beltTime = 0.0;
+	unsigned int _arrivedLoads = 0;
+	double _beltEventTime = -1.0;
+	unsigned long _numberOfEvents = 0;
+	List<PairConveyorEventHandler*>* _conveyorEventHandlers = new List<PairConveyorEventHandler*>();
+};
+
+#endif /* CONVEYOR_H */
@@ -58,6 +58,18 @@ void EntityGroup::removeElement(unsigned int idKey, Entity * modeldatum) {
 	}
 }
 
+std::list<Entity*> EntityGroup::removeElements(unsigned int idKey, unsigned int firstRank, unsigned int lastRank) {
+	std::list<Entity*> removed;
+	std::map<unsigned int, List<Entity*>*>::iterator it = _groupMap->find(idKey);
+	if (it != _groupMap->end()) {
+		removed = (*it).second->removeRange(firstRank, lastRank);
+		if (!removed.empty() && _cstatNumberInGroup != nullptr) {
+			_cstatNumberInGroup->getStatistics()->getCollector()->addValue((*it).second->size());
+		}
+	}
+	return removed;
+}
+
 List<Entity*>* EntityGroup::getGroup(unsigned int idKey) {
 	std::map<unsigned int, List<Entity*>*>::iterator it = _groupMap->find(idKey);
 	if (it == _groupMap->end()) {
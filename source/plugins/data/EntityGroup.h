@@ -38,6 +38,7 @@ public:
 public:
 	void insertElement(unsigned int idKey, Entity* modeldatum);
 	void removeElement(unsigned int idKey, Entity* modeldatum);
+	std::list<Entity*> removeElements(unsigned int idKey, unsigned int firstRank, unsigned int lastRank); //!< Removes entities of the group from firstRank to lastRank (both included) in one pass, and returns them in order
 	List<Entity*>* getGroup(unsigned int idKey);
 public:
 	void initBetweenReplications();
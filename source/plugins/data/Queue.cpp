@@ -71,31 +71,88 @@ std::string Queue::show() {
 			",waiting=" + this->_list->show();
 }
 
-void Queue::insertElement(Waiting* modeldatum) {
+std::list<Waiting*>::iterator Queue::insertElement(Waiting* modeldatum) {
 	if (_reportStatistics) {
 		double tnow = _parentModel->getSimulation()->getSimulatedTime();
 		double duration = tnow - _lastTimeNumberInQueueChanged;
-		this->_cstatNumberInQueue->getStatistics()->getCollector()->addValue(_list->size(), duration); // save the OLD quantity and for how long it was there
+		this->_cstatNumberInQueue->addValue(_list->size(), duration); // save the OLD quantity and for how long it was there
 		_lastTimeNumberInQueueChanged = tnow;
 	}
-	_list->insert(modeldatum);
+	std::list<Waiting*>::iterator position = _list->insert(modeldatum);
+	_notifySizeChangeEventHandlers();
+	return position;
 }
 
 void Queue::removeElement(Waiting* modeldatum) {
+	_collectRemoval(modeldatum);
+	if (!_list->empty() && _list->front() == modeldatum) {
+		_list->pop_front(); // entities usually leave from the front, and then there is no need to search the whole queue
+	} else {
+		_list->remove(modeldatum);
+	}
+	_notifySizeChangeEventHandlers();
+}
+
+void Queue::removeElement(std::list<Waiting*>::iterator position) {
+	_collectRemoval(*position);
+	_list->erase(position);
+	_notifySizeChangeEventHandlers();
+}
+
+void Queue::_collectRemoval(Waiting* modeldatum) {
 	if (_reportStatistics) {
 		double tnow = _parentModel->getSimulation()->getSimulatedTime();
 		double duration = tnow - _lastTimeNumberInQueueChanged;
-		this->_cstatNumberInQueue->getStatistics()->getCollector()->addValue(_list->size(), duration); // save the OLD quantity and for how long it was there
+		this->_cstatNumberInQueue->addValue(_list->size(), duration); // save the OLD quantity and for how long it was there
 		_lastTimeNumberInQueueChanged = tnow;
 		double timeInQueue = tnow - modeldatum->getTimeStartedWaiting();
-		this->_cstatTimeInQueue->getStatistics()->getCollector()->addValue(timeInQueue);
+		this->_cstatTimeInQueue->addValue(timeInQueue);
+	}
+}
+
+std::list<Waiting*> Queue::removeElements(unsigned int firstRank, unsigned int lastRank) {
+	const unsigned int sizeBefore = _list->size();
+	std::list<Waiting*> removed = _list->removeRange(firstRank, lastRank);
+	if (_reportStatistics && !removed.empty()) {
+		double tnow = _parentModel->getSimulation()->getSimulatedTime();
+		double duration = tnow - _lastTimeNumberInQueueChanged;
+		this->_cstatNumberInQueue->addValue(sizeBefore, duration); // save the OLD quantity and for how long it was there
+		_lastTimeNumberInQueueChanged = tnow;
+		for (Waiting* waiting : removed) {
+			this->_cstatTimeInQueue->addValue(tnow - waiting->getTimeStartedWaiting());
+		}
+	}
+	if (!removed.empty()) {
+		_notifySizeChangeEventHandlers();
+	}
+	return removed;
+}
+
+void Queue::addSizeChangeEventHandler(QueueEventHandler eventHandler, ModelComponent* component) {
+	_sizeChangeEventHandlers.push_back({eventHandler, component});
+}
+
+void Queue::removeSizeChangeEventHandler(ModelComponent* component) {
+	std::vector<std::pair<QueueEventHandler, ModelComponent*>>::iterator it = _sizeChangeEventHandlers.begin();
+	while (it != _sizeChangeEventHandlers.end()) {
+		if (it->second == component) {
+			it = _sizeChangeEventHandlers.erase(it);
+		} else {
+			it++;
+		}
+	}
+}
+
+void Queue::_notifySizeChangeEventHandlers() {
+	for (std::pair<QueueEventHandler, ModelComponent*>& eventHandler : _sizeChangeEventHandlers) {
+		eventHandler.first(this);
 	}
-	_list->remove(modeldatum);
 }
 
 void Queue::_initBetweenReplications() {
 	this->_list->clear();
 	_lastTimeNumberInQueueChanged = 0.0;
+	_notifySizeChangeEventHandlers();
 }
 
 unsigned int Queue::size() {
@@ -110,6 +167,10 @@ Waiting* Queue::getAtRank(unsigned int rank) {
 	return _list->getAtRank(rank);
 }
 
+List<Waiting*>* Queue::getList() const {
+	return _list;
+}
+
 void Queue::setAttributeName(std::string _attributeName) {
 	this->_attributeName = _attributeName;
 }
@@ -21,6 +21,8 @@
 #include "../../kernel/simulator/StatisticsCollector.h"
 #include "../../kernel/simulator/Plugin.h"
 #include "../../kernel/simulator/ModelComponent.h"
+#include <functional>
+#include <vector>
 
 class Waiting {
 public:
@@ -91,6 +93,12 @@ and stored in the report database for this queue.
  */
 class Queue : public ModelDataDefinition {
 public:
+	typedef std::function<void(Queue*) > QueueEventHandler;
+
+	template<typename Class>
+	static QueueEventHandler SetQueueEventHandler(void (Class::*function)(Queue*), Class * object) {
+		return std::bind(function, object, std::placeholders::_1);
+	}
 
 	enum class OrderRule : int {
 		FIFO = 0, LIFO = 1, HIGHESTVALUE = 2, SMALLESTVALUE = 3, num_elements = 4
@@ -107,11 +115,16 @@ public: // static
 	static ModelDataDefinition* LoadInstance(Model* model, PersistenceRecord *fields);
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
 public:
-	void insertElement(Waiting* modeldatum);
+	std::list<Waiting*>::iterator insertElement(Waiting* modeldatum); //!< Returns the position of the element in the list of the queue, valid until it is removed
 	void removeElement(Waiting* modeldatum);
+	void removeElement(std::list<Waiting*>::iterator position); //!< Removes the element at a position returned by insertElement, with no search
+	std::list<Waiting*> removeElements(unsigned int firstRank, unsigned int lastRank); //!< Removes those waiting from firstRank to lastRank (both included) in one pass, and returns them in order. The number in queue changes only once
 	unsigned int size();
 	Waiting* first();
 	Waiting* getAtRank(unsigned int rank);
+	List<Waiting*>* getList() const; //!< The waiting entities, in queue order, to be visited without searching each rank
+	void addSizeChangeEventHandler(QueueEventHandler eventHandler, ModelComponent* component); //!< Handlers are notified whenever the number in queue changes by inserting or removing elements (not by changing the list directly)
+	void removeSizeChangeEventHandler(ModelComponent* component); //!< Removes the handlers added by the component, which must do so before it is deleted
 	void setAttributeName(std::string _attributeName);
 	std::string getAttributeName() const;
 	void setOrderRule(OrderRule _orderRule);
@@ -134,9 +147,12 @@ protected: // could be overriden
 
 private:
 	void _initCStats();
+	void _notifySizeChangeEventHandlers();
+	void _collectRemoval(Waiting* modeldatum);
 private:
 	List<Waiting*>* _list = new List<Waiting*>();
 	double _lastTimeNumberInQueueChanged;
+	std::vector<std::pair<QueueEventHandler, ModelComponent*>> _sizeChangeEventHandlers;
 private: //1::1
 
 	const struct DEFAULT_VALUES {
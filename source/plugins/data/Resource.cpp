@@ -111,8 +111,8 @@ bool Resource::seize(unsigned int quantity, double priority) {  //@ TODO: Consid
     double tnow = _parentModel->getSimulation()->getSimulatedTime();
     _sumCapacityOverTime += _lastTimeCapacityEvaluated * getCapacity();
     _lastTimeCapacityEvaluated = tnow;
-    int remainingCapacity = getCapacity() - _numberBusy;
-    bool canSeize = remainingCapacity >= quantity;
+    int remainingCapacity = (int) getCapacity() - (int) _numberBusy; // negative while a decreased capacity waits for busy units
+    bool canSeize = remainingCapacity >= (int) quantity;
     if (canSeize) {
         _sumNumberBusyOverTime += std::max<double>(_lastTimeReleased, _lastTimeSeized) * _lastTimeAnythingNumberBusy;
         _numberBusy += quantity;
@@ -126,6 +126,7 @@ bool Resource::seize(unsigned int quantity, double priority) {  //@ TODO: Consid
             _counterTotalCostIdle->incCountValue(_costIdleTimeUnit * (tnow - _lastTimeIdle));
             _lastTimeBusy = tnow;
         }
+        _notifyBusyChangeEventHandlers();
     }
     return canSeize;
 }
@@ -147,12 +148,18 @@ void Resource::release(unsigned int quantity) {
     }
     _lastTimeReleased = tnow;
     _lastTimeAnythingNumberBusy = _numberBusy;
+    if (_isWaitingCapacityChange && _numberBusy <= _scheduledCapacity) {
+        _capacityScheduleDelay += tnow - _waitingCapacitySince;
+        _isWaitingCapacityChange = false;
+        _scheduleCapacityChange();
+    }
     double timeSeized = _lastTimeReleased - _lastTimeSeized;
     if (_reportStatistics) {
         _counterNumReleases->incCountValue(quantity);
-        _cstatTimeSeized->getStatistics()->getCollector()->addValue(timeSeized);
+        _cstatTimeSeized->addValue(timeSeized);
         _counterTotalTimeSeized->incCountValue(timeSeized);
     }
+    _notifyBusyChangeEventHandlers();
     _notifyReleaseEventHandlers();
     _checkFailByCount();
 }
@@ -160,7 +167,7 @@ void Resource::release(unsigned int quantity) {
 void Resource::_fail() {
     double tnow = _parentModel->getSimulation()->getSimulatedTime();
     _sumCapacityOverTime += _lastTimeCapacityEvaluated * getCapacity();
-    _originalCapacity = getCapacity();
+    _originalCapacity = _capacity;
     _lastTimeFailed = tnow;
     _lastTimeCapacityEvaluated = tnow;
     _capacity = 0;
@@ -176,7 +183,7 @@ void Resource::_active() {
     if (_reportStatistics) {
         double failureTime = tnow - _lastTimeFailed;
         _counterTotalTimeFailed->incCountValue(failureTime);
-        _cstatTimeFailed->getStatistics()->getCollector()->addValue(failureTime);
+        _cstatTimeFailed->addValue(failureTime);
     }
     _isActive = true;
     if (_numberBusy == 0)
@@ -203,10 +210,10 @@ void Resource::setCapacity(unsigned int capacity) {
 }
 
 unsigned int Resource::getCapacity() const {
-    if (_capacitySchedule == nullptr || _parentModel == nullptr || !_isActive)
+    if (!_isCapacityScheduled || !_isActive)
         return _capacity;
     else
-        return _parentModel->parseExpression(_capacitySchedule->getExpression());
+        return _scheduledCapacity;
 }
 
 void Resource::setCostBusyTimeUnit(double _costBusyTimeUnit) {
@@ -289,8 +296,8 @@ void Resource::removeFailure(Failure* failure) {
     failure->falingResources()->remove(this);
 }
 
-void Resource::setCapacitySchedule(Schedule* _capacitySchedule) {
-    _capacitySchedule = _capacitySchedule;
+void Resource::setCapacitySchedule(Schedule* capacitySchedule) {
+    _capacitySchedule = capacitySchedule;
 }
 
 Schedule* Resource::getCapacitySchedule() const {
@@ -325,6 +332,86 @@ void Resource::_initBetweenReplications() {
     _sumCapacityOverTime = 0.0;
     _numberBusy = 0;
     _isActive = true;
+    _capacityScheduleDelay = 0.0;
+    _isWaitingCapacityChange = false;
+    _isCapacityScheduled = _capacitySchedule != nullptr;
+    if (_isCapacityScheduled) {
+        _capacitySchedule->compile();
+        SchedulableItem* item = _capacitySchedule->getItemAt(0.0);
+        _scheduledCapacity = item != nullptr ? (unsigned int) _parentModel->parseExpression(item->getExpression()) : _capacity;
+        _capacityBreakpoint = 0.0;
+        _scheduleCapacityChange();
+    }
+    _notifyBusyChangeEventHandlers();
+}
+
+/*!
+ * Schedules the change of capacity at the breakpoint of the capacity schedule that follows the last one. Breakpoints are postponed by
+ * the time that WAIT decreases have waited
+ */
+void Resource::_scheduleCapacityChange() {
+    SchedulableItem* item;
+    if (_capacitySchedule->getNextBreakpoint(_capacityBreakpoint, &_capacityBreakpoint, &item)) {
+        InternalEvent* intEvent = new InternalEvent(_capacityBreakpoint + _capacityScheduleDelay, "Resource Capacity Change");
+        intEvent->setEventHandler<Resource>(this, &Resource::_onCapacityChangeEvent, item);
+        _parentModel->getFutureEvents()->insert(intEvent);
+    }
+}
+
+/*!
+ * Applies the item beginning at a breakpoint. Units are never seized above the new capacity, and busy units above it are released as
+ * usual. A decrease below the busy units follows the rule of the item: IGNORE keeps the following breakpoints; WAIT postpones them by
+ * the time until enough units are released, so the decreased capacity holds for its whole duration; PREEMPT is applied as IGNORE,
+ * since entities holding units cannot be interrupted //@TODO preempt entities in delays
+ */
+void Resource::_onCapacityChangeEvent(void* parameter) {
+    SchedulableItem* item = static_cast<SchedulableItem*> (parameter);
+    double tnow = _parentModel->getSimulation()->getSimulatedTime();
+    unsigned int capacity = _parentModel->parseExpression(item->getExpression());
+    _changeCapacity(capacity);
+    if (item->getRule() == SchedulableItem::Rule::WAIT && capacity < _numberBusy) {
+        _isWaitingCapacityChange = true;
+        _waitingCapacitySince = tnow;
+        traceSimulation(this, "Resource \"" + getName() + "\" waits " + std::to_string(_numberBusy - capacity) + " busy units to be released");
+        return; // next breakpoint is scheduled when they are
+    }
+    if (_parentModel->getFutureEvents()->empty() && _parentModel->getDataManager()->getNumberOfDataDefinitions(Util::TypeOf<Entity>()) == 0) {
+        return; // nothing but capacity changes could ever happen again (as when sources reached their max creations)
+    }
+    _scheduleCapacityChange();
+}
+
+void Resource::_changeCapacity(unsigned int capacity) {
+    double tnow = _parentModel->getSimulation()->getSimulatedTime();
+    _sumCapacityOverTime += _lastTimeCapacityEvaluated * getCapacity();
+    _lastTimeCapacityEvaluated = tnow;
+    bool increased = capacity > _scheduledCapacity;
+    _scheduledCapacity = capacity;
+    traceSimulation(this, "Resource \"" + getName() + "\" capacity changed to " + std::to_string(capacity));
+    if (increased && _isActive) {
+        _notifyReleaseEventHandlers(); // entities waiting for the resource may seize it now
+    }
+}
+
+void Resource::addBusyChangeEventHandler(ResourceEventHandler eventHandler, ModelComponent* component) {
+    _busyChangeEventHandlers.push_back({eventHandler, component});
+}
+
+void Resource::removeBusyChangeEventHandler(ModelComponent* component) {
+    std::vector<std::pair<ResourceEventHandler, ModelComponent*>>::iterator it = _busyChangeEventHandlers.begin();
+    while (it != _busyChangeEventHandlers.end()) {
+        if (it->second == component) {
+            it = _busyChangeEventHandlers.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+void Resource::_notifyBusyChangeEventHandlers() {
+    for (std::pair<ResourceEventHandler, ModelComponent*>& handler : _busyChangeEventHandlers) {
+        handler.first(this);
+    }
 }
 
 void Resource::_notifyReleaseEventHandlers() {
@@ -367,7 +454,7 @@ void Resource::_onReplicationEnd(SimulationEvent* se) {
     double totalTime = se->getSimulatedTime();
     double seizedTime = _counterTotalTimeSeized->getCountValue();
     double finalProportionSeized = seizedTime / totalTime;
-    _cstatProportionSeized->getStatistics()->getCollector()->addValue(finalProportionSeized); // final proportionSeized is just one more value to this cstat
+    _cstatProportionSeized->addValue(finalProportionSeized); // final proportionSeized is just one more value to this cstat
 }
 
 void Resource::_createInternalAndAttachedData() {
@@ -401,6 +488,9 @@ void Resource::_createInternalAndAttachedData() {
     for (Failure* failure : *_failures->list()) {
         _attachedDataInsert(getName() + "." + failure->getName(), failure);
     }
+    if (_capacitySchedule != nullptr) {
+        _attachedDataInsert("CapacitySchedule", _capacitySchedule);
+    }
 }
 
 //
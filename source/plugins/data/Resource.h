@@ -25,6 +25,7 @@
 #include "Schedule.h"
 
 #include <functional>
+#include <vector>
 
 
 
@@ -121,6 +122,8 @@ public:
 	double getSeizedUtilization() const;
 	double getLastTimeSeized() const; // used only by "Release" component
 	void addReleaseResourceEventHandler(ResourceEventHandler eventHandler, ModelComponent* component, unsigned int priority);
+	void addBusyChangeEventHandler(ResourceEventHandler eventHandler, ModelComponent* component); //!< Handlers are notified whenever the number of busy units changes (as components keeping the best of many resources do)
+	void removeBusyChangeEventHandler(ModelComponent* component); //!< Removes the handlers added by the component, which must do so before it is deleted
 public: // g&s
 	void setResourceState(ResourceState _resourceState);
 	Resource::ResourceState getResourceState() const;
@@ -145,11 +148,15 @@ protected: // protected could override
 	virtual void _initBetweenReplications();
 
 private: //methods
+	void _notifyBusyChangeEventHandlers();
 	void _notifyReleaseEventHandlers(); //!< Notify observer classes that some of the resource capacity has been released. It is useful for allocation components (such as Seize) to know when an entity waiting into a queue can try to seize the resource again
 	void _onReplicationEnd(SimulationEvent* se); //!< Nofified whe replication ended to update cstats based on final replication length
 	void _fail();
 	void _active();
 	void _checkFailByCount();
+	void _scheduleCapacityChange();
+	void _onCapacityChangeEvent(void* parameter);
+	void _changeCapacity(unsigned int capacity);
 	friend class Failure;
 
 private:
@@ -178,8 +185,16 @@ private: // only gets
 	bool _isActive = true;
 private: // not gets nor sets
 	unsigned int _originalCapacity; // used for failing purposes, when _capacity changes to 0
+private: // capacity given by the schedule, changed by an InternalEvent at each breakpoint
+	bool _isCapacityScheduled = false;
+	unsigned int _scheduledCapacity = 0;
+	double _capacityScheduleDelay = 0.0; //!< time waited by WAIT decreases, which postpones the following breakpoints
+	double _capacityBreakpoint = 0.0; //!< time in the schedule of the last change scheduled
+	bool _isWaitingCapacityChange = false;
+	double _waitingCapacitySince = 0.0;
 private: //1::n
 	List<SortedResourceEventHandler*>* _resourceEventHandlers = new List<SortedResourceEventHandler*>();
+	std::vector<std::pair<ResourceEventHandler, ModelComponent*>> _busyChangeEventHandlers;
 	List<Failure*>* _failures = new List<Failure*>();
 private: // attached elements
 	Schedule* _capacitySchedule = nullptr;
@@ -13,6 +13,8 @@
 #include "Schedule.h"
 
 #include "../../kernel/simulator/Model.h"
+#include <algorithm>
+#include <cmath>
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -40,16 +42,68 @@ std::string Schedule::show() {
 }
 
 std::string Schedule::getExpression() {
-	double tnow = _parentModel->getSimulation()->getSimulatedTime();
-	double accumDuration = 0.0;
-	do
-		for (SchedulableItem* item : *_schedulableItems->list()) {
-			if (tnow <= accumDuration + item->getDuration()) {
-				return item->getExpression();
-			}
-			accumDuration += item->getDuration();
-		} while (_repeatAfterLast);
-	return _schedulableItems->last()->getExpression();
+	return getExpression(_parentModel->getSimulation()->getSimulatedTime());
+}
+
+std::string Schedule::getExpression(double time) {
+	SchedulableItem* item = getItemAt(time);
+	return item != nullptr ? item->getExpression() : "";
+}
+
+SchedulableItem* Schedule::getItemAt(double time) {
+	if (_items.size() != _schedulableItems->size()) {
+		compile();
+	}
+	const int index = _itemIndexAt(time);
+	return index >= 0 ? _items[index] : nullptr;
+}
+
+/*!
+ * The item holding the time ends at the breakpoint. Items of no duration are skipped, since they hold no instant after it
+ */
+bool Schedule::getNextBreakpoint(double time, double* breakpoint, SchedulableItem** item) {
+	if (_items.size() != _schedulableItems->size()) {
+		compile();
+	}
+	const int index = _itemIndexAt(time);
+	if (index < 0 || _cycleLength <= 0.0) {
+		return false;
+	}
+	double cycleStart = 0.0;
+	if (time > _cycleLength && _repeatAfterLast) {
+		cycleStart = std::floor(time / _cycleLength) * _cycleLength;
+		if (cycleStart >= time) { // a multiple of the cycle length belongs to the last item of the previous cycle
+			cycleStart -= _cycleLength;
+		}
+	}
+	unsigned int i = index;
+	double end = cycleStart + _itemEnds[i];
+	while (end <= time) { // the item ends just at the time
+		if (!_nextItem(&i, &cycleStart)) {
+			return false;
+		}
+		end = cycleStart + _itemEnds[i];
+	}
+	do {
+		if (!_nextItem(&i, &cycleStart)) {
+			return false;
+		}
+	} while (_items[i]->getDuration() <= 0.0);
+	*breakpoint = end;
+	*item = _items[i];
+	return true;
+}
+
+void Schedule::compile() {
+	_items.clear();
+	_itemEnds.clear();
+	_cycleLength = 0.0;
+	for (SchedulableItem* item : *_schedulableItems->list()) {
+		_cycleLength += item->getDuration();
+		_items.push_back(item);
+		_itemEnds.push_back(_cycleLength);
+	}
+	_cursor = 0;
 }
 
 List<SchedulableItem*>* Schedule::getSchedulableItems() const {
@@ -124,8 +178,7 @@ bool Schedule::_check(std::string* errorMessage) {
 }
 
 void Schedule::_initBetweenReplications() {
-	//_someString = "Test";
-	//_someUint = 1;
+	compile();
 }
 
 void Schedule::_createInternalAndAttachedData() {
@@ -153,4 +206,49 @@ void Schedule::_addProperty(PropertyBase* property) {
 
 //
 // private
-//
\ No newline at end of file
+//
+
+/*!
+ * An item holds from the end of the previous one (exclusive) to its own end (inclusive), and the first one also holds at time zero.
+ * When repeating, the time is reduced to the cycle, so a time that is a multiple of the cycle length belongs to the last item.
+ */
+int Schedule::_itemIndexAt(double time) {
+	const unsigned int size = _items.size();
+	if (size == 0) {
+		return -1;
+	}
+	if (time > _cycleLength) {
+		if (!_repeatAfterLast || _cycleLength <= 0.0) {
+			return size - 1;
+		}
+		time = std::fmod(time, _cycleLength);
+		if (time == 0.0) {
+			time = _cycleLength;
+		}
+	}
+	// the cursor, or the item after it, usually holds the time
+	for (unsigned int i = _cursor; i < size && i <= _cursor + 1; i++) {
+		if (time <= _itemEnds[i] && (i == 0 || time > _itemEnds[i - 1])) {
+			_cursor = i;
+			return i;
+		}
+	}
+	_cursor = std::lower_bound(_itemEnds.begin(), _itemEnds.end(), time) - _itemEnds.begin();
+	if (_cursor >= size) {
+		_cursor = size - 1;
+	}
+	return _cursor;
+}
+
+bool Schedule::_nextItem(unsigned int* index, double* cycleStart) {
+	if (*index + 1 < _items.size()) {
+		(*index)++;
+		return true;
+	}
+	if (!_repeatAfterLast) {
+		return false;
+	}
+	*index = 0;
+	*cycleStart += _cycleLength;
+	return true;
+}
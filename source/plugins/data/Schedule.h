@@ -16,6 +16,7 @@
 #include "../../kernel/simulator/ModelDataDefinition.h"
 #include "../../kernel/simulator/PluginInformation.h"
 #include "../../kernel/util/List.h"
+#include <vector>
 
 class SchedulableItem {
 public:
@@ -26,7 +27,7 @@ public:
 
 public:
 
-	SchedulableItem(std::string expression, double duration, SchedulableItem::Rule = SchedulableItem::Rule::IGNORE) {
+	SchedulableItem(std::string expression, double duration, SchedulableItem::Rule rule = SchedulableItem::Rule::IGNORE) {
 		this->expression = expression;
 		this->duration = duration;
 		this->rule = rule;
@@ -65,6 +66,15 @@ private:
 //class SchedulableResourceItem : public SchedulableItem {
 //};
 
+/*!
+ * A sequence of SchedulableItems, each one holding its expression for its duration, optionally repeated after the last one. Items are
+ * compiled (at the beginning of each replication, or when the number of items changes) into the cumulative end of each item in the
+ * cycle, so the item at a time is found by reducing the time to the cycle and then by a binary search. A cursor on the last item
+ * found makes queries at nondecreasing times (as those at the simulated time) constant time. If durations of items are changed during
+ * a replication, compile() must be invoked.
+ * Components driven by a schedule (as resources with a capacity schedule) do not query it at each use. They schedule an InternalEvent
+ * at each breakpoint, given by getNextBreakpoint(), and apply the item that begins there.
+ */
 class Schedule : public ModelDataDefinition {
 public:
 	Schedule(Model* model, std::string name = "");
@@ -76,7 +86,11 @@ public: // static
 public: // virtual
 	virtual std::string show();
 public:
-	std::string getExpression();
+	std::string getExpression(); //!< The expression of the item at the current simulated time
+	std::string getExpression(double time);
+	SchedulableItem* getItemAt(double time); //!< nullptr if there is no item
+	bool getNextBreakpoint(double time, double* breakpoint, SchedulableItem** item); //!< The first instant after time when the item changes, and the item that holds after it. False if the item never changes after time
+	void compile();
 	List<SchedulableItem*>* getSchedulableItems() const;
 	void setRepeatAfterLast(bool _repeatAfterLast);
 	bool isRepeatAfterLast() const;
@@ -101,6 +115,13 @@ private:
 	} DEFAULT;
 	bool _repeatAfterLast = DEFAULT.repeatAfterLast;
 	List<SchedulableItem*>* _schedulableItems = new List<SchedulableItem*>();
+private: // compiled items
+	int _itemIndexAt(double time);
+	bool _nextItem(unsigned int* index, double* cycleStart);
+	std::vector<SchedulableItem*> _items;
+	std::vector<double> _itemEnds; //!< cumulative end of each item in the cycle
+	double _cycleLength = 0.0;
+	unsigned int _cursor = 0;
 	//std::string _someString = DEFAULT.someString;
 	//unsigned int _someUint = DEFAULT.someUint;
 };
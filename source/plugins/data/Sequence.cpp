@@ -15,6 +15,7 @@
 #include "../../kernel/simulator/Attribute.h"
 #include "../../kernel/simulator/Model.h"
 #include "../../kernel/simulator/Simulator.h"
+#include <sstream>
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -87,12 +88,214 @@ bool Sequence::_check(std::string* errorMessage) {
 	for (SequenceStep* step : *_steps->list()) {
 		_attachedDataInsert("StepStation" + Util::StrIndex(i), step->getStation());
 		_attachedDataInsert("StepLabel" + Util::StrIndex(i), step->getLabel());
+		int j = 0;
+		for (Assignment* assignment : *step->getAssignments()) {
+			// destination without its index, so it is not removed as an orphan before being compiled
+			const std::string name = Util::Trim(assignment->getDestination().substr(0, assignment->getDestination().find('[')));
+			const std::string destinationType = assignment->isAttributeNotVariable() ? Util::TypeOf<Attribute>() : Util::TypeOf<Variable>();
+			ModelDataDefinition* data = _parentModel->getDataManager()->getDataDefinition(destinationType, name);
+			if (data == nullptr) {
+				data = _parentModel->getParentSimulator()->getPluginManager()->newInstance(destinationType, _parentModel, name);
+			}
+			_attachedDataInsert("Step" + Util::StrIndex(i) + "Assignment" + Util::StrIndex(j), data);
+			j++;
+		}
 		i++;
 	}
 	*errorMessage += "";
 	return true;
 }
 
+void Sequence::_initBetweenReplications() {
+	compile();
+}
+
+void Sequence::compile() {
+	_compiledSteps.clear();
+	_compiledSteps.reserve(_steps->size());
+	for (SequenceStep* step : *_steps->list()) {
+		CompiledStep compiled;
+		compiled.station = step->getStation();
+		compiled.label = step->getLabel();
+		for (Assignment* assignment : *step->getAssignments()) {
+			compiled.assignments.push_back(_compileAssignment(assignment));
+		}
+		_compiledSteps.push_back(compiled);
+	}
+	_compiled = true;
+}
+
+const Sequence::CompiledStep* Sequence::getCompiledStep(unsigned int* step) {
+	if (!_compiled || _compiledSteps.size() != _steps->size()) {
+		compile();
+	}
+	if (_compiledSteps.empty()) {
+		return nullptr;
+	}
+	if (*step >= _compiledSteps.size()) {
+		*step = 0;
+	}
+	return &_compiledSteps[*step];
+}
+
+void Sequence::assign(const CompiledStep* step, Entity* entity) {
+	for (const CompiledAssignment& assignment : step->assignments) {
+		if (assignment.statement != "") {
+			_parentModel->parseExpression(assignment.statement);
+			continue;
+		}
+		const double value = assignment.isCompiled ? ValueOf(assignment.value, entity) : _parentModel->parseExpression(assignment.expression);
+		std::string index = assignment.index;
+		for (const CompiledValue& dimension : assignment.dimensions) {
+			index += (index == "" ? "" : ",") + std::to_string(static_cast<unsigned int> (ValueOf(dimension, entity)));
+		}
+		if (assignment.attributeRank >= 0) {
+			entity->setAttributeValueByRank(assignment.attributeRank, value, index);
+		} else {
+			assignment.variable->setValue(value, index);
+		}
+	}
+}
+
+void Sequence::setCompileAssignments(bool compileAssignments) {
+	_compileAssignments = compileAssignments;
+	_compiled = false;
+}
+
+bool Sequence::isCompileAssignments() const {
+	return _compileAssignments;
+}
+
+Sequence::CompiledAssignment Sequence::_compileAssignment(Assignment* assignment) {
+	CompiledAssignment compiled;
+	compiled.expression = assignment->getExpression();
+	compiled.isCompiled = _compileValue(compiled.expression, &compiled.value);
+	// destination as name or name[index,...], each index a number or a compiled value
+	const std::string destination = Util::Trim(assignment->getDestination());
+	std::string name = destination;
+	bool resolved = _compileAssignments;
+	std::string::size_type bracket = destination.find('[');
+	if (resolved && bracket != std::string::npos) {
+		name = Util::Trim(destination.substr(0, bracket));
+		resolved = destination.back() == ']';
+		std::stringstream dimensions(destination.substr(bracket + 1, destination.length() - bracket - 2));
+		std::string dimension;
+		CompiledValue value;
+		while (resolved && std::getline(dimensions, dimension, ',')) {
+			resolved = _compileValue(dimension, &value);
+			compiled.dimensions.push_back(value);
+		}
+		// indexes that are all numbers are built once
+		bool constant = true;
+		for (const CompiledValue& dimension : compiled.dimensions) {
+			constant = constant && dimension.attributeRank < 0 && dimension.variable == nullptr;
+		}
+		if (constant) {
+			for (const CompiledValue& dimension : compiled.dimensions) {
+				compiled.index += (compiled.index == "" ? "" : ",") + std::to_string(static_cast<unsigned int> (dimension.constant));
+			}
+			compiled.dimensions.clear();
+		}
+	}
+	if (resolved) {
+		compiled.attributeRank = _parentModel->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), name);
+		if (compiled.attributeRank < 0) {
+			compiled.variable = dynamic_cast<Variable*> (_parentModel->getDataManager()->getDataDefinition(Util::TypeOf<Variable>(), name));
+			resolved = compiled.variable != nullptr;
+		}
+	}
+	if (!resolved) {
+		compiled = CompiledAssignment();
+		compiled.expression = assignment->getExpression();
+		compiled.statement = assignment->getDestination() + "=" + compiled.expression;
+	}
+	return compiled;
+}
+
+bool Sequence::_compileValue(std::string text, CompiledValue* value) {
+	*value = CompiledValue();
+	return _compileAssignments && CompileValue(_parentModel, text, value);
+}
+
+/*!
+ * Compiles "number", "number ± number", "reference", "reference ± number" and "number + reference", where reference is an attribute or a
+ * variable, with numbers as indexes. Attributes are looked for before variables, as the parser does
+ */
+bool Sequence::CompileValue(Model* model, std::string text, CompiledValue* value) {
+	*value = CompiledValue();
+	text = Util::Trim(text);
+	double number, other;
+	if (Util::StrToNumber(text, &number)) {
+		value->constant = number;
+		return true;
+	}
+	// the first sign out of brackets (but one that begins the text) splits it
+	int depth = 0;
+	for (std::string::size_type i = 1; i < text.length(); i++) {
+		if (text[i] == '[') {
+			depth++;
+		} else if (text[i] == ']') {
+			depth--;
+		} else if (depth == 0 && (text[i] == '+' || text[i] == '-')) {
+			const std::string left = text.substr(0, i), right = text.substr(i + 1);
+			if (Util::StrToNumber(left, &other) && Util::StrToNumber(right, &number)) {
+				value->constant = text[i] == '+' ? other + number : other - number;
+				return true;
+			}
+			if (Util::StrToNumber(right, &number) && _compileReference(model, left, value)) {
+				value->constant = text[i] == '+' ? number : -number;
+				return true;
+			}
+			*value = CompiledValue();
+			if (text[i] == '+' && Util::StrToNumber(left, &number) && _compileReference(model, right, value)) {
+				value->constant = number;
+				return true;
+			}
+			return false;
+		}
+	}
+	return _compileReference(model, text, value);
+}
+
+bool Sequence::_compileReference(Model* model, std::string text, CompiledValue* value) {
+	text = Util::Trim(text);
+	std::string name = text;
+	std::string::size_type bracket = text.find('[');
+	if (bracket != std::string::npos) {
+		if (text.back() != ']') {
+			return false;
+		}
+		name = Util::Trim(text.substr(0, bracket));
+		std::stringstream dimensions(text.substr(bracket + 1, text.length() - bracket - 2));
+		std::string dimension;
+		double number;
+		while (std::getline(dimensions, dimension, ',')) {
+			if (!Util::StrToNumber(dimension, &number)) {
+				return false;
+			}
+			value->index += (value->index == "" ? "" : ",") + std::to_string(static_cast<unsigned int> (number));
+		}
+	}
+	if (name.empty() || name.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_.") != std::string::npos) {
+		return false;
+	}
+	value->attributeRank = model->getDataManager()->getRankOf(Util::TypeOf<Attribute>(), name);
+	if (value->attributeRank < 0) {
+		value->variable = dynamic_cast<Variable*> (model->getDataManager()->getDataDefinition(Util::TypeOf<Variable>(), name));
+	}
+	return value->attributeRank >= 0 || value->variable != nullptr;
+}
+
+double Sequence::ValueOf(const CompiledValue& value, Entity* entity) {
+	if (value.attributeRank >= 0) {
+		return entity->getAttributeValueByRank(value.attributeRank, value.index) + value.constant;
+	}
+	if (value.variable != nullptr) {
+		return value.variable->getValue(value.index) + value.constant;
+	}
+	return value.constant;
+}
+
 SequenceStep::SequenceStep(Station* station, std::list<Assignment*>* assignments) {
 	this->_station = station;
 	if (assignments != nullptr)
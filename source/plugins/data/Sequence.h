@@ -17,9 +17,12 @@
 #include "../../kernel/simulator/ModelDataDefinition.h"
 #include "../../kernel/simulator/ModelDataManager.h"
 #include "../../kernel/simulator/PluginInformation.h"
+#include "../../kernel/simulator/Entity.h"
 #include "Station.h"
 #include "Label.h"
 #include "AssignmentItem.h"
+#include "Variable.h"
+#include <vector>
 
 class SequenceStep : public PersistentObject_base {
 public:
@@ -77,11 +80,46 @@ Jobstep names must be globally unique.
 TYPICAL USES
 * Define a routing path for part processing
 * Define a sequence of steps patients must take upon arrival at an emergency room
+ *
+ * Steps are compiled (at the beginning of each replication, or when the number of steps changes) into a flat array. Each compiled step
+ * holds its station or label and its assignments, whose destinations are resolved to the rank of an attribute or to a variable, so
+ * routing an entity along a step neither builds nor parses assignment statements. If the assignments of steps are changed during a
+ * replication, compile() must be invoked.
  */
 class Sequence : public ModelDataDefinition {
 public:
 
+	/*!
+	 * A value read with no parser: a number, or an attribute or variable (with numbers as indexes) plus or minus a number
+	 */
+	struct CompiledValue {
+		int attributeRank = -1; //!< rank of the attribute read, or -1
+		Variable* variable = nullptr; //!< variable read, if not an attribute
+		std::string index = ""; //!< index of what is read, as the parser builds it
+		double constant = 0.0; //!< added to what is read (the value itself, if nothing is read)
+	};
+
+	/*!
+	 * An assignment of a compiled step. Expressions of the forms of CompiledValue are compiled, and others are evaluated by the parser.
+	 * The destination is an attribute or variable, whose indexes are numbers or compiled values. A destination that could not be resolved
+	 * (as one indexed by any other expression) is assigned by parsing the whole statement.
+	 */
+	struct CompiledAssignment {
+		int attributeRank = -1; //!< rank of the destination attribute, or -1
+		Variable* variable = nullptr; //!< destination variable, if not an attribute
+		std::string index = ""; //!< index of the destination, as the parser builds it, if its dimensions are numbers
+		std::vector<CompiledValue> dimensions; //!< dimensions of the index of the destination, if some of them are not numbers
+		bool isCompiled = false;
+		CompiledValue value; //!< the expression, if it is compiled
+		std::string expression = "";
+		std::string statement = ""; //!< "destination=expression", if the destination could not be resolved
+	};
 
+	struct CompiledStep {
+		Station* station = nullptr; //!< one of station and label is nullptr
+		Label* label = nullptr;
+		std::vector<CompiledAssignment> assignments;
+	};
 public:
 	Sequence(Model* model, std::string name = "");
 	virtual ~Sequence() = default;
@@ -91,14 +129,29 @@ public: // static
 	static PluginInformation* GetPluginInformation();
 	static ModelDataDefinition* LoadInstance(Model* model, PersistenceRecord *fields);
 	static ModelDataDefinition* NewInstance(Model* model, std::string name = "");
+	static bool CompileValue(Model* model, std::string text, CompiledValue* value); //!< Resolves the text to a value read with no parser, if it has one of the forms of CompiledValue
+	static double ValueOf(const CompiledValue& value, Entity* entity); //!< entity may be nullptr if the value reads no attribute
 public:
 	List<SequenceStep*>* getSteps() const;
+	void compile();
+	const CompiledStep* getCompiledStep(unsigned int* step); //!< Step of rank *step, or the first one (and then *step is 0) if there is no such step. nullptr if there are no steps
+	void assign(const CompiledStep* step, Entity* entity); //!< Performs the assignments of the step for the entity, in order
+	void setCompileAssignments(bool compileAssignments); //!< If false, every assignment is parsed as a statement, as Route used to do (such as to compare both)
+	bool isCompileAssignments() const;
 protected:
 	virtual bool _loadInstance(PersistenceRecord *fields);
 	virtual void _saveInstance(PersistenceRecord *fields, bool saveDefaultValues);
 	virtual bool _check(std::string* errorMessage);
+	virtual void _initBetweenReplications();
 private:
 	List<SequenceStep*>* _steps = new List<SequenceStep*>();
+private: // compiled steps
+	CompiledAssignment _compileAssignment(Assignment* assignment);
+	bool _compileValue(std::string text, CompiledValue* value);
+	static bool _compileReference(Model* model, std::string text, CompiledValue* value);
+	std::vector<CompiledStep> _compiledSteps;
+	bool _compiled = false;
+	bool _compileAssignments = true;
 };
 
 #endif /* SEQUENCE_H */
@@ -12,6 +12,7 @@
 
 #include "SignalData.h"
 #include "../../kernel/simulator/Model.h"
+#include <algorithm>
 
 #ifdef PLUGINCONNECT_DYNAMIC
 
@@ -36,21 +37,40 @@ std::string SignalData::show() {
 }
 
 unsigned int SignalData::generateSignal(double signalValue, unsigned int limit) {
+	_signalValue = signalValue;
 	_remainsToLimit = limit;
 	unsigned int freed = _notifySignalDataEventHandlers();
 	return freed;
 }
 
-void SignalData::addSignalDataEventHandler(SignalDataEventHandler eventHandler, ModelComponent* component) {
-	ModelComponent* compHandler;
-	for (PairSignalDataEventHandler* sreh : *_signalDataEventHandlers->list()) {
-		compHandler = sreh->second;
-		if (compHandler == component) {
-			return; // already exists. Do not insert again
-		}
+void SignalData::addSignalDataEventHandler(SignalDataEventHandler eventHandler, ModelComponent* component, bool onlyWhenWaiting) {
+	if (_handlerOfComponent.find(component) != _handlerOfComponent.end()) {
+		return; // already exists. Do not insert again
 	}
 	PairSignalDataEventHandler* pairEventHandler = new PairSignalDataEventHandler(eventHandler, component);
-	_signalDataEventHandlers->insert(pairEventHandler);
+	_handlerOfComponent[component] = pairEventHandler;
+	if (!onlyWhenWaiting) {
+		_signalDataEventHandlers->insert(pairEventHandler);
+	}
+}
+
+void SignalData::addWaiting(ModelComponent* component, double signalValue) {
+	std::unordered_map<ModelComponent*, PairSignalDataEventHandler*>::iterator it = _handlerOfComponent.find(component);
+	if (it == _handlerOfComponent.end()) {
+		return;
+	}
+	std::vector<WaitingHandler>& handlers = _waitingHandlers[signalValue];
+	for (std::vector<WaitingHandler>::reverse_iterator handler = handlers.rbegin(); handler != handlers.rend(); handler++) {
+		if (handler->handler == it->second) {
+			handler->waiting++;
+			return;
+		}
+	}
+	handlers.push_back({it->second, 1});
+}
+
+double SignalData::getSignalValue() const {
+	return _signalValue;
 }
 
 // public static
@@ -99,7 +119,7 @@ void SignalData::_saveInstance(PersistenceRecord *fields, bool saveDefaultValues
 bool SignalData::_check(std::string* errorMessage) {
 	bool resultAll = true;
 	//!@TODO
-	resultAll &= _signalDataEventHandlers->size() > 0;
+	resultAll &= _handlerOfComponent.size() > 0;
 	if (!resultAll) {
 		traceError("There is no handler added to SignalData "+this->getName());
 	}
@@ -108,25 +128,50 @@ bool SignalData::_check(std::string* errorMessage) {
 }
 
 void SignalData::_initBetweenReplications() {
+	_waitingHandlers.clear(); // queues of waiting entities are cleared too
 }
 
 //void SignalData::_createInternalAndAttachedData() {}
 
 // private
 
+/*!
+ * Handlers of every signal are notified first, and then those with entities waiting for the value, while the limit is not reached. A
+ * handler waiting for the value that frees no entity has none waiting for it anymore
+ */
 unsigned int SignalData::_notifySignalDataEventHandlers() {
-	unsigned int freed, sumFreed = 0;
-	for (PairSignalDataEventHandler* sortedHandler : *_signalDataEventHandlers->list()) {
-		if (_remainsToLimit>0) {
-			SignalDataEventHandler handler = sortedHandler->first;
-			freed = handler(this);
-			sumFreed += freed;
-			//_remainsToLimit -= freed;
+	unsigned int sumFreed = 0;
+	for (PairSignalDataEventHandler* handler : *_signalDataEventHandlers->list()) {
+		if (_remainsToLimit == 0) {
+			return sumFreed;
 		}
+		sumFreed += _notify(handler);
+	}
+	std::unordered_map<double, std::vector<WaitingHandler>>::iterator it = _waitingHandlers.find(_signalValue);
+	if (it == _waitingHandlers.end()) {
+		return sumFreed;
+	}
+	std::vector<WaitingHandler>& handlers = it->second;
+	for (unsigned int i = 0; i < handlers.size() && _remainsToLimit > 0; i++) {
+		unsigned int freed = _notify(handlers[i].handler);
+		sumFreed += freed;
+		handlers[i].waiting = freed > 0 && freed < handlers[i].waiting ? handlers[i].waiting - freed : 0;
+	}
+	handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](const WaitingHandler & handler) {
+		return handler.waiting == 0;
+	}), handlers.end());
+	if (handlers.empty()) {
+		_waitingHandlers.erase(it);
 	}
 	return sumFreed;
 }
 
+unsigned int SignalData::_notify(PairSignalDataEventHandler* handler) {
+	unsigned int freed = handler->first(this);
+	_remainsToLimit -= std::min(freed, _remainsToLimit);
+	return freed;
+}
+
 unsigned int SignalData::remainsToLimit() const {
 	return _remainsToLimit;
 }
@@ -16,7 +16,15 @@
 #include "../../kernel/simulator/ModelDataDefinition.h"
 #include "../../kernel/simulator/ModelComponent.h"
 #include "../../kernel/util/List.h"
+#include <unordered_map>
+#include <vector>
 
+/*!
+ * A signal delivered by Signal components to the components that handle it. Handlers added to be notified only when waiting (as Wait)
+ * are indexed by the values their entities wait for, so a signal only notifies those with entities waiting for its value, in the order
+ * they started waiting. Other handlers (as Buffer) are notified of every signal. The limit of entities a signal releases is accounted
+ * here, from the number each handler returns.
+ */
 class SignalData : public ModelDataDefinition {
 public:
 	typedef std::function<unsigned int(SignalData*) > SignalDataEventHandler; //< Returns the total number of freed entities.
@@ -36,7 +44,9 @@ public: //virtual
 	virtual std::string show();
 public:
 	unsigned int generateSignal(double signalValue, unsigned int limit);
-	void addSignalDataEventHandler(SignalDataEventHandler eventHandler, ModelComponent* component);
+	void addSignalDataEventHandler(SignalDataEventHandler eventHandler, ModelComponent* component, bool onlyWhenWaiting = false);
+	void addWaiting(ModelComponent* component, double signalValue); //!< One more entity of the component waits for the value
+	double getSignalValue() const; //!< The value of the signal being delivered
 	unsigned int remainsToLimit() const;
 	void decreaseRemainLimit();
 
@@ -48,12 +58,22 @@ protected: // could be overriden .
 	virtual void _initBetweenReplications();
 	//virtual void _createInternalAndAttachedData();
 	//virtual ParserChangesInformation* _getParserChangesInformation();
+private:
+
+	struct WaitingHandler {
+		PairSignalDataEventHandler* handler;
+		unsigned int waiting; //!< entities waiting for the value, as far as known (handlers may lose them to other components)
+	};
 private: // methods
 	unsigned int  _notifySignalDataEventHandlers(); //!< Notify observer classes that some of the resource capacity has been released. It is useful for allocation components (such as Seize) to know when an entity waiting into a queue can try to seize the resource again
+	unsigned int _notify(PairSignalDataEventHandler* handler);
 private: //1::1
-	unsigned int _remainsToLimit;
+	unsigned int _remainsToLimit = 0;
+	double _signalValue = 0.0;
 private: //1::n
-	List<PairSignalDataEventHandler*>* _signalDataEventHandlers = new List<PairSignalDataEventHandler*>();
+	List<PairSignalDataEventHandler*>* _signalDataEventHandlers = new List<PairSignalDataEventHandler*>(); //!< notified of every signal
+	std::unordered_map<ModelComponent*, PairSignalDataEventHandler*> _handlerOfComponent;
+	std::unordered_map<double, std::vector<WaitingHandler>> _waitingHandlers; //!< by signal value, in the order they started waiting
 };
 
 #endif /* SIGNALDATA_H */
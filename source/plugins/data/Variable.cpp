@@ -142,8 +142,8 @@ bool Variable::_loadInstance(PersistenceRecord *fields) {
 		}
 		nv = fields->loadField("values", 0);
 		for (unsigned int i = 0; i < nv; i++) {
-			pos = fields->loadField("valuePos" + Util::StrIndex(i), 0);
-			value = fields->loadField("value" + Util::StrIndex(i), 0);
+			pos = fields->loadField("valuePos" + Util::StrIndex(i), "0");
+			value = fields->loadField("value" + Util::StrIndex(i), 0.0);
 			this->_initialValues->emplace(pos, value);
 		}
 	}
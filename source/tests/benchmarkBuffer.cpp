@@ -0,0 +1,188 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Buffer.h"
+#include "../plugins/components/Signal.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of buffers. Entities must leave in the order they arrived, after as many advances as the capacity, both when advancing on
+ * new arrivals and on signals, including a signal that advances many positions at once. Simulation times are compared with advancing as
+ * Buffer used to do (erasing the first position of a vector). The buffer advancing on signals has 10^5 positions, mostly empty, since
+ * every entity alive costs the kernel a search when it is created. Also checks that buffers are saved and loaded.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkBuffer) message=" << message << std::endl;
+}
+
+/*
+ * Dispose that records the arrival time of entities leaving
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> arrivals;
+
+	Recorder(Model* model, std::string name) : Dispose(model, name) {
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		arrivals.push_back(entity->getAttributeValue("Entity.ArrivalTime"));
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Create* create;
+	Buffer* buffer;
+	Recorder* recorder;
+
+	Scenario(unsigned int capacity, unsigned int entities, double timeBetweenArrivals) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		create = new Create(model, "Create");
+		create->setTimeBetweenCreationsExpression(std::to_string(timeBetweenArrivals));
+		create->setMaxCreations(entities);
+		buffer = new Buffer(model, "Buffer");
+		buffer->setCapacity(capacity);
+		recorder = new Recorder(model, "Recorder");
+		create->getConnectionManager()->insert(buffer);
+		buffer->getConnectionManager()->insert(recorder);
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	double simulate(double length) {
+		model->getSimulation()->setReplicationLength(length);
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	bool inArrivalOrder() const {
+		for (unsigned int i = 1; i < recorder->arrivals.size(); i++) {
+			if (recorder->arrivals[i] <= recorder->arrivals[i - 1]) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+/*
+ * Seconds to advance a vector of the capacity as Buffer used to do, estimated from some advances
+ */
+double vectorAdvanceSeconds(unsigned int capacity, unsigned int advances) {
+	std::vector<Entity*> buffer(capacity, nullptr);
+	const unsigned int measured = 1000;
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < measured; i++) {
+		buffer.erase(buffer.begin());
+		buffer.push_back(nullptr);
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * advances / measured;
+}
+
+void advanceOnArrivals(unsigned int capacity, unsigned int entities) {
+	Scenario scenario(capacity, entities, 1.0);
+	const double seconds = scenario.simulate(entities + 10.0);
+	std::cout << entities << " arrivals on a buffer of " << capacity << " positions simulated in " << seconds << " seconds. Advancing a vector would take "
+			<< vectorAdvanceSeconds(capacity, entities) << " seconds more" << std::endl;
+	if (scenario.recorder->arrivals.size() != entities - capacity || scenario.buffer->getNumberOfEntities() != capacity || !scenario.inArrivalOrder()) {
+		fail("advanceOnArrivals", std::to_string(scenario.recorder->arrivals.size()) + " entities left the buffer, out of order or not the first ones");
+	}
+}
+
+/*
+ * One signal of limit 1 every time unit, from time 0.5, and then one of a large limit
+ */
+void advanceOnSignals(unsigned int capacity, unsigned int signals, unsigned int timeBetweenArrivals, unsigned int lastLimit) {
+	const unsigned int entities = signals / timeBetweenArrivals;
+	Scenario scenario(capacity, entities, timeBetweenArrivals);
+	SignalData* signalData = new SignalData(scenario.model, "BufferSignal");
+	scenario.buffer->setAdvanceOn(Buffer::AdvanceOn::Signal);
+	scenario.buffer->setArrivalOnFullBufferRule(Buffer::ArrivalOnFullBufferRule::ReplaceLastPosition);
+	scenario.buffer->setSignal(signalData);
+	Dispose* signalDispose = new Dispose(scenario.model, "SignalDispose");
+	const std::string limits[] = {"1", std::to_string(lastLimit)};
+	for (unsigned int i = 0; i < 2; i++) {
+		Create* signalCreate = new Create(scenario.model, "SignalCreate" + std::to_string(i));
+		signalCreate->setTimeBetweenCreationsExpression("1");
+		signalCreate->setFirstCreation(i == 0 ? 0.5 : signals + 0.7);
+		signalCreate->setMaxCreations(i == 0 ? signals : 1);
+		Signal* signal = new Signal(scenario.model, "Signal" + std::to_string(i));
+		signal->setSignalData(signalData);
+		signal->setLimitExpression(limits[i]);
+		signalCreate->getConnectionManager()->insert(signal);
+		signal->getConnectionManager()->insert(signalDispose);
+	}
+	const double seconds = scenario.simulate(signals + 10.0);
+	std::cout << entities << " arrivals and " << signals << " signals on a buffer of " << capacity << " positions, and a signal of limit " << lastLimit
+			<< ", simulated in " << seconds << " seconds. Advancing a vector would take " << vectorAdvanceSeconds(capacity, signals) << " seconds more" << std::endl;
+	// entity arriving at t leaves on the signal at t+capacity-0.5, and the rest is in position capacity-1-(signals-t) when the last signal comes
+	unsigned int expected = 0;
+	for (unsigned int i = 0; i < entities; i++) {
+		const long t = (long) i * timeBetweenArrivals;
+		if (t <= (long) signals - capacity || (long) capacity - 1 - ((long) signals - t) < (long) lastLimit) {
+			expected++;
+		}
+	}
+	if (scenario.recorder->arrivals.size() != expected || scenario.buffer->getNumberOfEntities() != entities - expected || !scenario.inArrivalOrder()) {
+		fail("advanceOnSignals", std::to_string(scenario.recorder->arrivals.size()) + " entities left the buffer, expected " + std::to_string(expected) + " in arrival order");
+	}
+}
+
+void persistence() {
+	const std::string filename = "benchmarkBuffer.gen";
+	Scenario scenario(1, 10, 1.0);
+	scenario.buffer->setCapacity(12345);
+	scenario.buffer->setAdvanceOn(Buffer::AdvanceOn::Signal);
+	scenario.buffer->setArrivalOnFullBufferRule(Buffer::ArrivalOnFullBufferRule::SendToBulkPort);
+	scenario.buffer->setSignal(new SignalData(scenario.model, "SavedSignal"));
+	scenario.model->save(filename);
+	Model* loaded = new Model(scenario.genesys);
+	if (!loaded->load(filename)) {
+		fail("persistence", "could not load the saved model");
+	} else {
+		Buffer* buffer = dynamic_cast<Buffer*> (loaded->getComponentManager()->find("Buffer"));
+		if (buffer == nullptr || buffer->getcapacity() != 12345 || buffer->getadvanceOn() != Buffer::AdvanceOn::Signal
+				|| buffer->getarrivalOnFullBufferRule() != Buffer::ArrivalOnFullBufferRule::SendToBulkPort
+				|| buffer->getsignal() == nullptr || buffer->getsignal()->getName() != "SavedSignal") {
+			fail("persistence", "loaded buffer differs from the saved one");
+		}
+	}
+	delete loaded;
+	std::remove(filename.c_str());
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkBuffer" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% advanceOnArrivals (benchmarkBuffer)" << std::endl;
+	advanceOnArrivals(2000, 10000);
+	std::cout << "%TEST_FINISHED% time=0 advanceOnArrivals (benchmarkBuffer)" << std::endl;
+
+	std::cout << "%TEST_STARTED% advanceOnSignals (benchmarkBuffer)" << std::endl;
+	advanceOnSignals(100000, 300000, 500, 50000);
+	std::cout << "%TEST_FINISHED% time=0 advanceOnSignals (benchmarkBuffer)" << std::endl;
+
+	std::cout << "%TEST_STARTED% persistence (benchmarkBuffer)" << std::endl;
+	persistence();
+	std::cout << "%TEST_FINISHED% time=0 persistence (benchmarkBuffer)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
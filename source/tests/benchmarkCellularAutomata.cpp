@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/components/CellularAutomataComp.h"
+#include "../plugins/components/CellularAutomata/CellularAutomata_Classic.h"
+#include "../plugins/components/CellularAutomata/Boundary_Closed.h"
+#include "../plugins/components/CellularAutomata/Boundary_Fixed.h"
+#include "../plugins/components/CellularAutomata/LocalRule_Elementary.h"
+#include "../plugins/components/CellularAutomata/LocalRule_GameOfLife.h"
+#include "../plugins/components/CellularAutomata/Neighborhood_Center.h"
+#include "../plugins/components/CellularAutomata/Neighborhood_Moore.h"
+
+/*
+ * Benchmark of the cellular automata engine. Checks that bit-packed lattices (updated 64 cells at a time) evolve exactly as dense ones,
+ * with one or many threads, and measures the throughput of both representations. Then simulates a model with the component.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkCellularAutomata) message=" << message << std::endl;
+}
+
+/*!
+ * An automaton whose parts are owned by the caller, as they are by the component
+ */
+struct Automaton {
+	CellularAutomata_Classic ca;
+	Lattice lattice{&ca};
+	StateSet stateSet{&ca};
+	Neighborhood* neighborhood;
+	BoundaryCondition* boundary;
+	LocalRule* rule;
+
+	Automaton(std::vector<unsigned int> dimensions, bool bitBased, bool hexagonal, bool closed, LocalRule* rule, Neighborhood* neighborhood, unsigned int threads) {
+		this->rule = rule;
+		this->neighborhood = neighborhood;
+		boundary = closed ? (BoundaryCondition*) new Boundary_Closed() : new Boundary_Fixed();
+		lattice.setDimensions(dimensions);
+		lattice.setHexagonal(hexagonal);
+		stateSet.setBitBased(bitBased);
+		stateSet.setInitialDensity(0.3);
+		stateSet.setSeed(7);
+		neighborhood->setBoundary(boundary);
+		boundary->setLattice(&lattice);
+		boundary->setNeighborhood(neighborhood);
+		rule->setStateSet(&stateSet);
+		ca.setLattice(&lattice);
+		ca.setStateSet(&stateSet);
+		ca.setNeighborhood(neighborhood);
+		ca.setLocalRule(rule);
+		ca.setNumberOfThreads(threads);
+		ca.init();
+	}
+
+	~Automaton() {
+		delete rule;
+		delete neighborhood;
+		delete boundary;
+	}
+};
+
+bool sameStates(Lattice* a, Lattice* b) {
+	for (unsigned int y = 0; y < a->getHeight(); y++) {
+		for (unsigned int x = 0; x < a->getWidth(); x++) {
+			if (a->getState(x, y) != b->getState(x, y)) return false;
+		}
+	}
+	return true;
+}
+
+void compareGameOfLife(std::string name, std::vector<unsigned int> dimensions, bool hexagonal, bool closed, unsigned int threads) {
+	Automaton dense(dimensions, false, hexagonal, closed, new LocalRule_GameOfLife(nullptr), new Neighborhood_Moore(nullptr), 1);
+	Automaton packed(dimensions, true, hexagonal, closed, new LocalRule_GameOfLife(nullptr), new Neighborhood_Moore(nullptr), threads);
+	for (unsigned int generation = 0; generation < 100; generation++) {
+		if (!sameStates(&dense.lattice, &packed.lattice)) {
+			fail("equivalence", name + " differs at generation " + std::to_string(generation));
+			return;
+		}
+		dense.ca.step();
+		packed.ca.step();
+	}
+	std::cout << name << ": " << dense.lattice.getPopulation() << " cells alive after 100 generations in both lattices" << std::endl;
+}
+
+void compareElementary(unsigned long long rule, bool closed) {
+	Automaton dense({333}, false, false, closed, new LocalRule_Elementary(nullptr, rule), new Neighborhood_Center(nullptr), 1);
+	Automaton packed({333}, true, false, closed, new LocalRule_Elementary(nullptr, rule), new Neighborhood_Center(nullptr), 1);
+	for (unsigned int generation = 0; generation < 200; generation++) {
+		dense.ca.step();
+		packed.ca.step();
+	}
+	if (!sameStates(&dense.lattice, &packed.lattice)) {
+		fail("equivalence", "elementary rule " + std::to_string(rule) + " differs");
+	}
+}
+
+void throughput(std::string name, bool bitBased, unsigned int threads, unsigned int size, unsigned int generations) {
+	Automaton automaton({size, size}, bitBased, false, true, new LocalRule_GameOfLife(nullptr), new Neighborhood_Moore(nullptr), threads);
+	for (unsigned int generation = 0; generation < generations; generation++) {
+		automaton.ca.step();
+	}
+	std::cout << name << " (" << threads << " threads): " << automaton.ca.getCellUpdatesPerSecond() / 1e6 << " million cell-updates/second" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkCellularAutomata" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+	const unsigned int threads = std::max(2u, std::thread::hardware_concurrency());
+
+	std::cout << "%TEST_STARTED% equivalence (benchmarkCellularAutomata)" << std::endl;
+	compareGameOfLife("life 100x37 closed", {100, 37}, false, true, 1);
+	compareGameOfLife("life 130x70 fixed", {130, 70}, false, false, 1);
+	compareGameOfLife("life 64x64 closed", {64, 64}, false, true, 1);
+	compareGameOfLife("life 2000x1100 closed, threaded", {2000, 1100}, false, true, threads);
+	compareGameOfLife("hexagonal life 90x40 closed", {90, 40}, true, true, 1);
+	for (unsigned long long rule : {30ull, 90ull, 110ull, 184ull}) {
+		compareElementary(rule, true);
+		compareElementary(rule, false);
+	}
+	std::cout << "%TEST_FINISHED% time=0 equivalence (benchmarkCellularAutomata)" << std::endl;
+
+	std::cout << "%TEST_STARTED% throughput (benchmarkCellularAutomata)" << std::endl;
+	throughput("dense life 1024x1024", false, 1, 1024, 10);
+	throughput("dense life 1024x1024", false, threads, 1024, 10);
+	throughput("bit-packed life 4096x4096", true, 1, 4096, 20);
+	throughput("bit-packed life 4096x4096", true, threads, 4096, 20);
+	std::cout << "%TEST_FINISHED% time=0 throughput (benchmarkCellularAutomata)" << std::endl;
+
+	std::cout << "%TEST_STARTED% component (benchmarkCellularAutomata)" << std::endl;
+	Simulator* genesys = new Simulator();
+	genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+	genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+	Model* model = genesys->getModelManager()->newModel();
+	PluginManager* plugins = genesys->getPluginManager();
+	Create* create = plugins->newInstance<Create>(model);
+	CellularAutomataComp* ca = plugins->newInstance<CellularAutomataComp>(model);
+	ca->setNeighboorhoodType(CellularAutomataComp::NeighboorhoodType::MOORE);
+	ca->setStateSetType(CellularAutomataComp::StateSetType::BITBASED);
+	ca->setBoundaryType(CellularAutomataComp::BoundaryType::CLOSED);
+	ca->getlattice()->setDimensions({256, 256});
+	Dispose* dispose = plugins->newInstance<Dispose>(model);
+	create->getConnectionManager()->insert(ca);
+	ca->getConnectionManager()->insert(dispose);
+	model->getSimulation()->setReplicationLength(50);
+	model->getSimulation()->start();
+	std::cout << ca->show() << std::endl;
+	if (ca->getcellularAutomata()->getGeneration() == 0) {
+		fail("component", "no generation computed");
+	}
+	delete genesys;
+	std::cout << "%TEST_FINISHED% time=0 component (benchmarkCellularAutomata)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <vector>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/Attribute.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Assign.h"
+#include "../plugins/components/Clone.h"
+#include "../plugins/components/Record.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of entity attribute copies. Checks that copying and adding attribute values keep indexed values, compares bulk copies with
+ * copies attribute by attribute (as Clone used to do), and then clones 1M entities in a model.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkClone) message=" << message << std::endl;
+}
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	PluginManager* plugins;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		plugins = genesys->getPluginManager();
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+};
+
+void copies() {
+	Scenario scenario;
+	new Attribute(scenario.model, "Scalar");
+	new Attribute(scenario.model, "Array");
+	Entity* source = scenario.model->createEntity("Source", false);
+	source->setAttributeValue("Scalar", 3.0);
+	source->setAttributeValue("Array", 5.0, "2");
+	source->setAttributeValue("Array", 7.0, "1,3");
+	source->setAttributeValue("Created", 11.0, "", true); // attribute created after the entities
+	Entity* copy = scenario.model->createEntity("Copy", false);
+	copy->setAttributeValue("Array", 13.0, "4");
+	copy->copyAttributeValuesFrom(source);
+	if (copy->getAttributeValue("Scalar") != 3.0 || copy->getAttributeValue("Array", "2") != 5.0 || copy->getAttributeValue("Array", "1,3") != 7.0
+			|| copy->getAttributeValue("Array", "4") != 0.0 || copy->getAttributeValue("Created") != 11.0) {
+		fail("copies", "copied values differ: " + copy->show());
+	}
+	Entity* sum = scenario.model->createEntity("Sum", false);
+	sum->setAttributeValue("Array", 1.0, "2");
+	sum->addAttributeValuesFrom(source);
+	sum->addAttributeValuesFrom(copy);
+	if (sum->getAttributeValue("Scalar") != 6.0 || sum->getAttributeValue("Array", "2") != 11.0 || sum->getAttributeValue("Array", "1,3") != 14.0
+			|| sum->getAttributeValue("Created") != 22.0) {
+		fail("copies", "added values differ: " + sum->show());
+	}
+	std::cout << copy->show() << std::endl << sum->show() << std::endl;
+}
+
+void throughput(unsigned int numAttributes, unsigned int copies) {
+	Scenario scenario;
+	for (unsigned int i = 0; i < numAttributes; i++) {
+		new Attribute(scenario.model, "Attribute" + std::to_string(i));
+	}
+	Entity* source = scenario.model->createEntity("Source", false);
+	for (unsigned int i = 0; i < numAttributes; i++) {
+		source->setAttributeValue("Attribute" + std::to_string(i), i);
+	}
+	std::vector<Entity*> destinations;
+	for (unsigned int i = 0; i < 1000; i++) {
+		destinations.push_back(scenario.model->createEntity("Destination", false));
+	}
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < copies / 10; i++) {
+		Entity* destination = destinations[i % destinations.size()];
+		for (ModelDataDefinition* attribute : *scenario.model->getDataManager()->getDataDefinitionList(Util::TypeOf<Attribute>())->list()) {
+			destination->setAttributeValue(attribute->getName(), source->getAttributeValue(attribute->getName()));
+		}
+	}
+	const double byNameSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 10;
+	begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < copies; i++) {
+		destinations[i % destinations.size()]->copyAttributeValuesFrom(source);
+	}
+	const double bulkSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	std::cout << copies << " copies of " << numAttributes << " attributes: " << byNameSeconds << " seconds by name (estimated from "
+			<< copies / 10 << "), " << bulkSeconds << " seconds in bulk (" << byNameSeconds / bulkSeconds << " times faster)" << std::endl;
+	if (destinations[7]->getAttributeValue("Attribute" + std::to_string(numAttributes - 1)) != numAttributes - 1) {
+		fail("throughput", "bulk copy lost values");
+	}
+}
+
+void cloning(unsigned int originals, unsigned int clonesEach) {
+	Scenario scenario;
+	Create* create = scenario.plugins->newInstance<Create>(scenario.model);
+	create->setMaxCreations(originals);
+	Assign* assign = scenario.plugins->newInstance<Assign>(scenario.model);
+	for (unsigned int i = 0; i < 8; i++) {
+		assign->getAssignments()->insert(new Assignment(scenario.model, "Attribute" + std::to_string(i), std::to_string(i + 1)));
+	}
+	Clone* clone = scenario.plugins->newInstance<Clone>(scenario.model);
+	clone->setNumClonesExpression(std::to_string(clonesEach));
+	Record* record = scenario.plugins->newInstance<Record>(scenario.model);
+	record->setExpressionName("ClonedAttribute");
+	record->setExpression("Attribute7");
+	Dispose* dispose = scenario.plugins->newInstance<Dispose>(scenario.model);
+	Dispose* disposeClones = scenario.plugins->newInstance<Dispose>(scenario.model);
+	create->getConnectionManager()->insert(assign);
+	assign->getConnectionManager()->insert(clone);
+	clone->getConnectionManager()->insert(dispose);
+	clone->getConnectionManager()->insert(record);
+	record->getConnectionManager()->insert(disposeClones);
+	scenario.model->getSimulation()->setReplicationLength(1e9);
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	scenario.model->getSimulation()->start();
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	Statistics_if* cloned = record->getCstatExpression()->getStatistics();
+	std::cout << cloned->numElements() << " entities cloned, simulated in " << seconds << " seconds" << std::endl;
+	if (cloned->numElements() != originals * clonesEach || cloned->min() != 8.0 || cloned->max() != 8.0) {
+		fail("cloning", "clones did not keep the attributes of their originals");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkClone" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% copies (benchmarkClone)" << std::endl;
+	copies();
+	std::cout << "%TEST_FINISHED% time=0 copies (benchmarkClone)" << std::endl;
+
+	std::cout << "%TEST_STARTED% throughput (benchmarkClone)" << std::endl;
+	throughput(20, 1000000);
+	std::cout << "%TEST_FINISHED% time=0 throughput (benchmarkClone)" << std::endl;
+
+	std::cout << "%TEST_STARTED% cloning (benchmarkClone)" << std::endl;
+	cloning(1000, 1000);
+	std::cout << "%TEST_FINISHED% time=0 cloning (benchmarkClone)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
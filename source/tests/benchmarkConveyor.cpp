@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Access.h"
+#include "../plugins/components/Enter.h"
+#include "../plugins/components/Record.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Exit.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Conveyor.h"
+
+/*
+ * Benchmark of conveyors. Entities access a 100 meters conveyor at its start, are conveyed to its end at 1 meter per second, stay
+ * there for a while and then exit. Their transit times are checked against the analytic ones, and the number of events scheduled by
+ * the conveyor is compared to the number of entities: it should not depend on how far they are conveyed nor on the number of cells.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkConveyor) message=" << message << std::endl;
+}
+
+struct Result {
+	unsigned int conveyed;
+	double minTransit, maxTransit;
+	unsigned long events;
+	unsigned int remainingLoads;
+	double seconds;
+};
+
+Result convey(Conveyor::ConveyorType type, unsigned int entities, std::string timeBetweenArrivals, std::string holdTime, unsigned int cells) {
+	Simulator* genesys = new Simulator();
+	genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+	genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+	Model* model = genesys->getModelManager()->newModel();
+	PluginManager* plugins = genesys->getPluginManager();
+	Station* start = plugins->newInstance<Station>(model, "Start");
+	Station* middle = plugins->newInstance<Station>(model, "Middle");
+	Station* end = plugins->newInstance<Station>(model, "End");
+	Conveyor* conveyor = plugins->newInstance<Conveyor>(model, "Belt");
+	conveyor->addStation(start);
+	conveyor->addStation(middle, 50.0);
+	conveyor->addStation(end, 50.0);
+	conveyor->setVelocity(1.0);
+	conveyor->setCellSize(1.0);
+	conveyor->setConveyorType(type);
+	Create* create = plugins->newInstance<Create>(model);
+	create->setTimeBetweenCreationsExpression(timeBetweenArrivals, Util::TimeUnit::second);
+	create->setMaxCreations(entities);
+	Access* access = plugins->newInstance<Access>(model);
+	access->setConveyor(conveyor);
+	access->setStation(end);
+	access->setCellsExpression(std::to_string(cells));
+	create->getConnectionManager()->insert(access);
+	Enter* enter = plugins->newInstance<Enter>(model);
+	enter->setStation(end);
+	Record* record = plugins->newInstance<Record>(model);
+	record->setExpressionName("Transit");
+	record->setExpression("tnow - Entity.ArrivalTime");
+	Delay* delay = plugins->newInstance<Delay>(model);
+	delay->setDelayExpression(holdTime, Util::TimeUnit::second);
+	Exit* exit = plugins->newInstance<Exit>(model);
+	exit->setConveyor(conveyor);
+	Dispose* dispose = plugins->newInstance<Dispose>(model);
+	enter->getConnectionManager()->insert(record);
+	record->getConnectionManager()->insert(delay);
+	delay->getConnectionManager()->insert(exit);
+	exit->getConnectionManager()->insert(dispose);
+	model->getSimulation()->setReplicationLength(1e9, Util::TimeUnit::second);
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	model->getSimulation()->start();
+	Result result;
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	Statistics_if* transit = record->getCstatExpression()->getStatistics();
+	result.conveyed = transit->numElements();
+	result.minTransit = transit->min();
+	result.maxTransit = transit->max();
+	result.events = conveyor->getNumberOfEvents();
+	result.remainingLoads = conveyor->getNumberOfLoads();
+	delete genesys;
+	return result;
+}
+
+void show(std::string name, Result result) {
+	std::cout << name << ": " << result.conveyed << " entities conveyed in " << result.minTransit << " to " << result.maxTransit
+			<< " seconds with " << result.events << " conveyor events (" << (double) result.events / result.conveyed
+			<< " per entity), simulated in " << result.seconds << " seconds" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkConveyor" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% analytic (benchmarkConveyor)" << std::endl;
+	for (Conveyor::ConveyorType type : {Conveyor::ConveyorType::NONACCUMULATING, Conveyor::ConveyorType::ACCUMULATING}) {
+		// entities leave as soon as they arrive, so none is ever stopped
+		Result result = convey(type, 500, "2", "0", 1);
+		show(Conveyor::convertEnumToStr(type) + ", free flow", result);
+		if (result.conveyed != 500 || result.minTransit != 100.0 || result.maxTransit != 100.0) {
+			fail("analytic", Conveyor::convertEnumToStr(type) + " transit times are not 100 seconds");
+		}
+		if (result.events > 2 * 500) {
+			fail("analytic", Conveyor::convertEnumToStr(type) + " scheduled more than two events per entity");
+		}
+	}
+	std::cout << "%TEST_FINISHED% time=0 analytic (benchmarkConveyor)" << std::endl;
+
+	std::cout << "%TEST_STARTED% congestion (benchmarkConveyor)" << std::endl;
+	// entities stay at the end longer than the time between their arrivals. A non-accumulating conveyor stops while each one stays
+	// there, delaying every entity behind it
+	Result stopping = convey(Conveyor::ConveyorType::NONACCUMULATING, 100, "2", "3", 1);
+	show("NONACCUMULATING, congested", stopping);
+	if (stopping.conveyed != 100 || stopping.remainingLoads != 0 || stopping.minTransit != 100.0 || stopping.maxTransit <= 100.0) {
+		fail("congestion", "non-accumulating conveyor did not stop");
+	}
+	// on an accumulating conveyor entities queue behind the first one, and each arrives 1 second after the previous one exits (the
+	// length of a cell), so the k-th one arrives at 100+4k and its transit time is 100+2k
+	Result accumulating = convey(Conveyor::ConveyorType::ACCUMULATING, 100, "2", "3", 1);
+	show("ACCUMULATING, congested", accumulating);
+	if (accumulating.conveyed != 100 || accumulating.remainingLoads != 0 || accumulating.minTransit != 100.0 || std::abs(accumulating.maxTransit - (100.0 + 2 * 99)) > 1e-6) {
+		fail("congestion", "accumulating transit times differ from the analytic ones");
+	}
+	std::cout << "%TEST_FINISHED% time=0 congestion (benchmarkConveyor)" << std::endl;
+
+	std::cout << "%TEST_STARTED% scale (benchmarkConveyor)" << std::endl;
+	for (Conveyor::ConveyorType type : {Conveyor::ConveyorType::NONACCUMULATING, Conveyor::ConveyorType::ACCUMULATING}) {
+		Result result = convey(type, 20000, "expo(10)", "expo(2.5)", 5);
+		show(Conveyor::convertEnumToStr(type) + ", 20000 random entities of 5 cells", result);
+		if (result.conveyed != 20000 || result.remainingLoads != 0) {
+			fail("scale", Conveyor::convertEnumToStr(type) + " did not convey every entity");
+		}
+	}
+	std::cout << "%TEST_FINISHED% time=0 scale (benchmarkConveyor)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,244 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/components/DefaultModalModel.h"
+
+/*
+ * Benchmark of compiled transition tables. Checks that transitions are chosen with the given probabilities, that guards are honored,
+ * and measures the transitions per second of tables of thousands of nodes. Then simulates a modal model and a network of nodes (limited to
+ * a hundred components by the academic licence).
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkModalModel) message=" << message << std::endl;
+}
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	PluginManager* plugins;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		plugins = genesys->getPluginManager();
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	/*
+	 * Plugins not listed in autoloadplugins.txt are not inserted, and their instances are nullptr
+	 */
+	template <typename T> T* newInstance(std::string test, std::string name = "") {
+		T* instance = plugins->newInstance<T>(model, name);
+		if (instance == nullptr) {
+			fail(test, "plugin " + Util::TypeOf<T>() + " is not inserted");
+		}
+		return instance;
+	}
+};
+
+void probabilities() {
+	Scenario scenario;
+	std::vector<DefaultNode*> nodes;
+	List<DefaultNode*> nodeList;
+	for (unsigned int i = 0; i < 5; i++) {
+		nodes.push_back(scenario.newInstance<DefaultNode>("probabilities"));
+		if (nodes[i] == nullptr) {
+			return;
+		}
+		nodeList.insert(nodes[i]);
+	}
+	List<DefaultNodeTransition*> transitions;
+	transitions.insert(new DefaultNodeTransition(nodes[0], nodes[1], 1.0));
+	transitions.insert(new DefaultNodeTransition(nodes[0], nodes[2], 2.0, "1"));
+	transitions.insert(new DefaultNodeTransition(nodes[0], nodes[3], 5.0, "0")); // folded, never taken
+	transitions.insert(new DefaultNodeTransition(nodes[0], nodes[4], 0.0)); // never taken
+	transitions.insert(new DefaultNodeTransition(nodes[0], nodes[0], 3.0));
+	transitions.insert(new DefaultNodeTransition(nodes[1], nodes[2], 1.0, "tnow < 0")); // evaluated, never true
+	transitions.insert(new DefaultNodeTransition(nodes[1], nodes[3], 1.0, "tnow >= 0"));
+	DefaultNodeTransitionTable table;
+	table.compile(&nodeList, &transitions);
+	if (table.getNumberOfTransitions() != 5 || table.isGuarded(0) || !table.isGuarded(1)) {
+		fail("probabilities", "constant guards were not folded");
+	}
+	std::mt19937 generator(11);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	std::vector<unsigned int> count(5, 0);
+	const unsigned int draws = 600000;
+	for (unsigned int i = 0; i < draws; i++) {
+		count[table.next(0, scenario.model, uniform(generator))]++;
+	}
+	const double expected[] = {0.5, 1.0 / 6, 2.0 / 6, 0.0, 0.0};
+	for (unsigned int i = 0; i < 5; i++) {
+		const double frequency = (double) count[i] / draws;
+		std::cout << "node " << i << ": frequency " << frequency << ", probability " << expected[i] << std::endl;
+		if (std::abs(frequency - expected[i]) > 0.005) {
+			fail("probabilities", "frequency of node " + std::to_string(i) + " differs from its probability");
+		}
+	}
+	for (unsigned int i = 0; i < 1000; i++) {
+		if (table.next(1, scenario.model, uniform(generator)) != 3) {
+			fail("probabilities", "a false guard was taken");
+			break;
+		}
+	}
+	if (table.next(2, scenario.model, 0.5) != -1) {
+		fail("probabilities", "a node without transitions has a next one");
+	}
+}
+
+/*
+ * A random network with a ring, so every node is reachable, plus random transitions with distinct weights
+ */
+bool randomNetwork(Scenario* scenario, std::string test, unsigned int numNodes, unsigned int degree, std::vector<DefaultNode*>* nodes, List<DefaultNodeTransition*>* transitions) {
+	std::mt19937 generator(3);
+	std::uniform_int_distribution<unsigned int> anyNode(0, numNodes - 1);
+	for (unsigned int i = 0; i < numNodes; i++) {
+		nodes->push_back(scenario->newInstance<DefaultNode>(test));
+		if (nodes->back() == nullptr) {
+			return false;
+		}
+	}
+	for (unsigned int i = 0; i < numNodes; i++) {
+		transitions->insert(new DefaultNodeTransition(nodes->at(i), nodes->at((i + 1) % numNodes)));
+		for (unsigned int k = 1; k < degree; k++) {
+			transitions->insert(new DefaultNodeTransition(nodes->at(i), nodes->at(anyNode(generator)), 1.0 + k));
+		}
+	}
+	return true;
+}
+
+void table(unsigned int numNodes, unsigned int degree, unsigned long steps) {
+	Scenario scenario; // not simulated, so not limited in components
+	std::vector<DefaultNode*> nodes;
+	List<DefaultNodeTransition*> transitions;
+	if (!randomNetwork(&scenario, "table", numNodes, degree, &nodes, &transitions)) {
+		return;
+	}
+	DefaultNodeTransitionTable table;
+	const std::chrono::steady_clock::time_point compiling = std::chrono::steady_clock::now();
+	table.compile(nullptr, &transitions);
+	const double compileSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - compiling).count();
+	std::mt19937 generator(5);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	std::vector<unsigned long> visits(numNodes, 0);
+	int node = 0;
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (unsigned long i = 0; i < steps && node >= 0; i++) {
+		node = table.next(node, scenario.model, uniform(generator));
+		visits[node]++;
+	}
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	unsigned long visited = 0;
+	for (unsigned long count : visits) {
+		visited += count > 0;
+	}
+	std::cout << numNodes << " nodes, " << degree << " transitions each: compiled in " << compileSeconds << " seconds, " << steps
+			<< " transitions in " << seconds << " seconds (" << steps / seconds / 1e6 << " million transitions/second), "
+			<< visited << " nodes visited" << std::endl;
+	if (node < 0 || table.getNumberOfTransitions() != numNodes * degree || visited < numNodes / 2) {
+		fail("table", "the walk did not spread over the nodes");
+	}
+}
+
+void modalModel(unsigned int numNodes, unsigned int degree, unsigned int entities, unsigned int steps) {
+	Scenario scenario;
+	Create* create = scenario.newInstance<Create>("modalModel");
+	DefaultModalModel* modal = scenario.newInstance<DefaultModalModel>("modalModel");
+	Dispose* dispose = scenario.newInstance<Dispose>("modalModel");
+	std::vector<DefaultNode*> nodes;
+	List<DefaultNodeTransition*> transitions;
+	if (create == nullptr || modal == nullptr || dispose == nullptr || !randomNetwork(&scenario, "modalModel", numNodes, degree, &nodes, &transitions)) {
+		return;
+	}
+	create->setMaxCreations(entities);
+	modal->setStepsPerEntity(steps);
+	create->getConnectionManager()->insert(modal);
+	modal->getConnectionManager()->insert(dispose);
+	for (DefaultNode* node : nodes) {
+		modal->addNode(node);
+	}
+	for (DefaultNodeTransition* transition : *transitions.list()) {
+		modal->addTransition(transition);
+	}
+	scenario.model->getSimulation()->setReplicationLength(1e9);
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	scenario.model->getSimulation()->start();
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	unsigned long visits = 0, visited = 0;
+	for (DefaultNode* node : nodes) {
+		visits += modal->getNumberOfVisits(node);
+		visited += modal->getNumberOfVisits(node) > 0;
+	}
+	std::cout << "modal model of " << numNodes << " nodes: " << modal->getNumberOfTransitionsTaken() << " transitions taken by " << entities
+			<< " entities, " << visited << " nodes visited, simulated in " << seconds << " seconds" << std::endl;
+	if (modal->getNumberOfTransitionsTaken() != (unsigned long) entities * steps || visits != modal->getNumberOfTransitionsTaken() || visited != numNodes) {
+		fail("modalModel", "not every step took a transition");
+	}
+}
+
+void network(unsigned int entities) {
+	Scenario scenario;
+	Create* create = scenario.newInstance<Create>("network");
+	DefaultNode* origin = scenario.newInstance<DefaultNode>("network", "Origin");
+	DefaultNode* near = scenario.newInstance<DefaultNode>("network", "Near");
+	DefaultNode* far = scenario.newInstance<DefaultNode>("network", "Far");
+	DefaultNode* out = scenario.newInstance<DefaultNode>("network", "Out");
+	Dispose* dispose = scenario.newInstance<Dispose>("network");
+	if (create == nullptr || origin == nullptr || near == nullptr || far == nullptr || out == nullptr || dispose == nullptr) {
+		return;
+	}
+	create->setMaxCreations(entities);
+	create->getConnectionManager()->insert(origin);
+	origin->addTransition(near, 0.3);
+	origin->addTransition(far, 0.7);
+	near->addTransition(origin, 0.5);
+	near->addTransition(out, 0.5);
+	far->getConnectionManager()->insert(dispose);
+	out->getConnectionManager()->insert(dispose);
+	scenario.model->getSimulation()->setReplicationLength(1e9);
+	scenario.model->getSimulation()->start();
+	// an entity returns from near to origin with probability 0.5, so origin is visited 1/(1-0.15) times per entity
+	const double perEntity = (double) origin->getNumberOfVisits() / entities;
+	std::cout << "network: " << origin->getNumberOfVisits() << " visits to origin, " << near->getNumberOfVisits() << " to near and "
+			<< far->getNumberOfVisits() << " to far, " << perEntity << " per entity at origin (expected " << 1 / 0.85 << ")" << std::endl;
+	if (std::abs(perEntity - 1 / 0.85) > 0.02 || far->getNumberOfVisits() + out->getNumberOfVisits() != entities) {
+		fail("network", "visits differ from the expected ones");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkModalModel" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% probabilities (benchmarkModalModel)" << std::endl;
+	probabilities();
+	std::cout << "%TEST_FINISHED% time=0 probabilities (benchmarkModalModel)" << std::endl;
+
+	std::cout << "%TEST_STARTED% table (benchmarkModalModel)" << std::endl;
+	table(5000, 8, 20000000);
+	table(20000, 4, 20000000);
+	std::cout << "%TEST_FINISHED% time=0 table (benchmarkModalModel)" << std::endl;
+
+	std::cout << "%TEST_STARTED% modalModel (benchmarkModalModel)" << std::endl;
+	modalModel(90, 4, 2000, 500);
+	std::cout << "%TEST_FINISHED% time=0 modalModel (benchmarkModalModel)" << std::endl;
+
+	std::cout << "%TEST_STARTED% network (benchmarkModalModel)" << std::endl;
+	network(20000);
+	std::cout << "%TEST_FINISHED% time=0 network (benchmarkModalModel)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <list>
+#include <set>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/ModelCheckerDefaultImpl1.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Queue.h"
+
+/*
+ * Benchmark of the model checker on models much larger than the limits of the academic licence (so checking limits fails, and each
+ * check is invoked by itself). Checks that orphans removed are those removed by checking again after each removal (as the checker used
+ * to do), that a long chain of components is connected and an unconnected component is found, and that an incremental check only
+ * checks the symbols of components inserted or changed since the last check.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkModelChecker) message=" << message << std::endl;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point begin) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/*
+ * Create, a chain of Delays and Dispose, and Queues no component refers to
+ */
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	std::list<Delay*> delays;
+
+	Scenario(unsigned int numberOfDelays, unsigned int unusedQueues) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		ModelComponent* last = new Create(model, "Create");
+		for (unsigned int i = 0; i < numberOfDelays; i++) {
+			Delay* delay = new Delay(model, "Delay" + std::to_string(i));
+			last->getConnectionManager()->insert(delay);
+			delays.push_back(delay);
+			last = delay;
+		}
+		last->getConnectionManager()->insert(new Dispose(model, "Dispose"));
+		model->check(); // creates internal data definitions, and fails on limits
+		for (unsigned int i = 0; i < unusedQueues; i++) {
+			ModelDataDefinition::CreateInternalData(new Queue(model, "Queue" + std::to_string(i))); // orphans, and so their statistics
+		}
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	std::list<ModelDataDefinition*> datadefinitions() const {
+		std::list<ModelDataDefinition*> all;
+		std::list<std::string>* ddtypenames = model->getDataManager()->getDataDefinitionClassnames();
+		for (std::string ddtypename : *ddtypenames) {
+			for (ModelDataDefinition* element : *model->getDataManager()->getDataDefinitionList(ddtypename)->list()) {
+				all.push_back(element);
+			}
+		}
+		delete ddtypenames;
+		return all;
+	}
+};
+
+/*
+ * Orphans as the checker used to find them, without removing them from the model
+ */
+std::set<ModelDataDefinition*> listedOrphans(const Scenario& scenario) {
+	std::set<ModelDataDefinition*> removed;
+	std::list<ModelDataDefinition*> remaining = scenario.datadefinitions();
+	std::list<ModelDataDefinition*> orphaned;
+	do {
+		orphaned = remaining;
+		for (ModelDataDefinition* element : remaining) {
+			for (std::pair<std::string, ModelDataDefinition*> pairInternal : *element->getInternalData()) {
+				orphaned.remove(pairInternal.second);
+			}
+			for (std::pair<std::string, ModelDataDefinition*> pairAttached : *element->getAttachedData()) {
+				orphaned.remove(pairAttached.second);
+			}
+		}
+		for (ModelComponent* component : *scenario.model->getComponentManager()->getAllComponents()) {
+			for (std::pair<std::string, ModelDataDefinition*> pairInternal : *component->getInternalData()) {
+				orphaned.remove(pairInternal.second);
+			}
+			for (std::pair<std::string, ModelDataDefinition*> pairAttached : *component->getAttachedData()) {
+				orphaned.remove(pairAttached.second);
+			}
+		}
+		for (ModelDataDefinition* orphan : orphaned) {
+			remaining.remove(orphan);
+			removed.insert(orphan);
+		}
+	} while (!orphaned.empty());
+	return removed;
+}
+
+void orphans(unsigned int numberOfDelays, unsigned int unusedQueues) {
+	Scenario scenario(numberOfDelays, unusedQueues);
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	std::set<ModelDataDefinition*> expected = listedOrphans(scenario);
+	const double listedSeconds = secondsSince(begin);
+	const unsigned int before = scenario.datadefinitions().size();
+	ModelCheckerDefaultImpl1 checker(scenario.model);
+	begin = std::chrono::steady_clock::now();
+	checker.checkOrphaned();
+	const double seconds = secondsSince(begin);
+	std::list<ModelDataDefinition*> after = scenario.datadefinitions();
+	std::cout << before - after.size() << " orphans of " << before << " data definitions removed in " << seconds << " seconds. Removing them from lists took "
+			<< listedSeconds << " seconds" << std::endl;
+	bool kept = true;
+	for (ModelDataDefinition* element : after) {
+		kept = kept && expected.find(element) == expected.end();
+	}
+	if (before - after.size() != expected.size() || !kept || expected.size() < 3 * unusedQueues) {
+		fail("orphans", std::to_string(before - after.size()) + " orphans removed, expected " + std::to_string(expected.size()));
+	}
+}
+
+void connected(unsigned int numberOfDelays) {
+	Scenario scenario(numberOfDelays, 0);
+	ModelCheckerDefaultImpl1 checker(scenario.model);
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	const bool isConnected = checker.checkConnected();
+	std::cout << numberOfDelays << " components in a chain checked connected in " << secondsSince(begin) << " seconds" << std::endl;
+	new Delay(scenario.model, "Unconnected");
+	scenario.genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L0_noTraces);
+	if (!isConnected || checker.checkConnected()) {
+		fail("connected", "chain of components not found connected, or unconnected component not found");
+	}
+}
+
+void incremental(unsigned int numberOfDelays) {
+	Scenario scenario(numberOfDelays, 0);
+	ModelCheckerDefaultImpl1 checker(scenario.model);
+	checker.setIncremental(true);
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	checker.checkAll(); // fails on limits, after checking symbols and orphans
+	const double firstSeconds = secondsSince(begin);
+	begin = std::chrono::steady_clock::now();
+	const bool unchanged = checker.checkSymbols();
+	const double secondSeconds = secondsSince(begin);
+	std::cout << numberOfDelays << " components checked in " << firstSeconds << " seconds, and their symbols checked again in " << secondSeconds
+			<< " seconds" << std::endl;
+	scenario.genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L0_noTraces);
+	Delay* changed = scenario.delays.back();
+	changed->setDelayExpression("unif(1,");
+	const bool changedUnnoticed = checker.checkSymbols();
+	checker.setChanged(changed);
+	const bool changedNoticed = !checker.checkSymbols();
+	changed->setDelayExpression("1");
+	(new Delay(scenario.model, "Inserted"))->setDelayExpression("unif(1,");
+	const bool insertedNoticed = !checker.checkSymbols();
+	if (!unchanged || !changedUnnoticed || !changedNoticed || !insertedNoticed || secondSeconds * 10 > firstSeconds) {
+		fail("incremental", "symbols were not checked only for components inserted or changed since the last check");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkModelChecker" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% orphans (benchmarkModelChecker)" << std::endl;
+	orphans(5000, 2000);
+	std::cout << "%TEST_FINISHED% time=0 orphans (benchmarkModelChecker)" << std::endl;
+
+	std::cout << "%TEST_STARTED% connected (benchmarkModelChecker)" << std::endl;
+	connected(30000);
+	std::cout << "%TEST_FINISHED% time=0 connected (benchmarkModelChecker)" << std::endl;
+
+	std::cout << "%TEST_STARTED% incremental (benchmarkModelChecker)" << std::endl;
+	incremental(30000);
+	std::cout << "%TEST_FINISHED% time=0 incremental (benchmarkModelChecker)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/GenSerializer.h"
+#include "../kernel/simulator/JsonSerializer.h"
+#include "../kernel/simulator/BinarySerializer.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of model loading. A generated model (a long line of Delays) is saved in every format, and then it is parsed by each
+ * serializer alone and loaded as a whole model (parsing plus instantiating and connecting components). Also checks that every format
+ * loads the same number of components.
+ */
+
+const unsigned int numComponents = 5000;
+const std::string filename = "benchmarkModelPersistence";
+const std::string formats[] = {"gen", "json", "genb"};
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkModelPersistence) message=" << message << std::endl;
+}
+
+Model* generate(Simulator* genesys) {
+	PluginManager* plugins = genesys->getPluginManager();
+	Model* model = genesys->getModelManager()->newModel();
+	Create* create = plugins->newInstance<Create>(model);
+	ModelComponent* previous = create;
+	for (unsigned int i = 0; i < numComponents; i++) {
+		Delay* delay = plugins->newInstance<Delay>(model);
+		delay->setDelayExpression("unif(1," + std::to_string(i + 2) + ")");
+		previous->getConnectionManager()->insert(delay);
+		previous = delay;
+	}
+	Dispose* dispose = plugins->newInstance<Dispose>(model);
+	previous->getConnectionManager()->insert(dispose);
+	return model;
+}
+
+void parse(Model* model, std::string format) {
+	std::unique_ptr<ModelSerializer> serializer;
+	if (format == "json") serializer = std::make_unique<JsonSerializer>(model);
+	else if (format == "genb") serializer = std::make_unique<BinarySerializer>(model);
+	else serializer = std::make_unique<GenSerializer>(model);
+	std::ifstream file(filename + "." + format, std::ios::binary);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bool ok = serializer->load(file);
+	std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+	unsigned int records = 0;
+	serializer->for_each([&](const std::string & name) {
+		records++;
+		return 0;
+	});
+	std::cout << format << ": " << duration.count() << " milliseconds to parse " << records << " records" << std::endl;
+	if (!ok) fail("parse", "could not parse " + format);
+}
+
+void load(Simulator* genesys, std::string format, unsigned int expectedComponents) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	Model* model = new Model(genesys);
+	bool ok = model->load(filename + "." + format);
+	std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+	std::cout << format << ": " << duration.count() << " milliseconds to load the model" << std::endl;
+	if (!ok || model->getComponentManager()->getNumberOfComponents() != expectedComponents) {
+		fail("load", "model loaded from " + format + " is not the saved one");
+	}
+	delete model;
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkModelPersistence" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	Simulator* genesys = new Simulator();
+	genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+	genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+	Model* model = generate(genesys);
+	const unsigned int expectedComponents = model->getComponentManager()->getNumberOfComponents();
+	for (std::string format : formats) {
+		model->save(filename + "." + format);
+		std::ifstream file(filename + "." + format, std::ios::binary | std::ios::ate);
+		std::cout << format << ": " << file.tellg() / 1024 << " KB" << std::endl;
+	}
+
+	std::cout << "%TEST_STARTED% parse (benchmarkModelPersistence)" << std::endl;
+	for (std::string format : formats) {
+		parse(model, format);
+	}
+	std::cout << "%TEST_FINISHED% time=0 parse (benchmarkModelPersistence)" << std::endl;
+
+	std::cout << "%TEST_STARTED% load (benchmarkModelPersistence)" << std::endl;
+	for (std::string format : formats) {
+		load(genesys, format, expectedComponents);
+	}
+	std::cout << "%TEST_FINISHED% time=0 load (benchmarkModelPersistence)" << std::endl;
+
+	delete genesys;
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,267 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/Attribute.h"
+#include "../plugins/data/Variable.h"
+#include "../plugins/components/PickStation.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Station.h"
+#include "../plugins/data/Queue.h"
+#include "../plugins/data/Resource.h"
+
+/*
+ * Benchmark of PickStation. Checks picks by maximum of negative values, deterministic ties and variables read with no parser, and that a
+ * deleted PickStation is no longer notified by queues and resources. Then picks among many stations by the number in queue and of busy
+ * resources while queues and resources change, checking some picks against a scan of all stations and comparing with scanning every
+ * station and evaluating its expression, as PickStation used to do (estimated from some picks). Stations are many more than the limits
+ * of the academic licence allow in a simulation, so entities are picked for without simulating.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkPickStation) message=" << message << std::endl;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point begin) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/*
+ * PickStation that picks for an entity without a simulation, returning the rank of the station picked. The same entity is reused by
+ * every pick, since creating entities costs much more than picking when the model has many data definitions
+ */
+class Picker : public PickStation {
+public:
+	std::vector<Station*> stations;
+
+	Picker(Model* model, std::string name) : PickStation(model, name) {
+		setSaveAttribute("Picked");
+		getConnectionManager()->insert(new Dispose(model, name + "Dispose"));
+		_entity = model->createEntity(name + "Entity", false);
+	}
+
+	int pick() {
+		_onDispatchEvent(_entity, 0);
+		const double picked = _entity->getAttributeValue("Picked");
+		for (unsigned int i = 0; i < stations.size(); i++) {
+			if (stations[i]->getId() == picked) {
+				return i;
+			}
+		}
+		return -1;
+	}
+private:
+	Entity* _entity;
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		new Attribute(model, "Picked");
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	Picker* pickerByExpressions(std::string name, PickStation::TestCondition condition, std::vector<std::string> expressions) {
+		Picker* picker = new Picker(model, name);
+		picker->setTestCondition(condition);
+		for (std::string expression : expressions) {
+			Station* station = new Station(model, name + "Station" + std::to_string(picker->stations.size()));
+			picker->addPickableStationItem(new PickableStationItem(station, expression));
+			picker->stations.push_back(station);
+		}
+		return picker;
+	}
+};
+
+void conditions() {
+	Scenario scenario;
+	const PickStation::TestCondition MAXIMUM = PickStation::TestCondition::MAXIMUM, MINIMUM = PickStation::TestCondition::MINIMUM;
+	struct {
+		PickStation::TestCondition condition;
+		std::vector<std::string> expressions;
+		int expected;
+	} cases[] = {
+		{MAXIMUM, {"-5", "-2", "-9"}, 1},
+		{MAXIMUM, {"1", "3", "3"}, 1},
+		{MINIMUM, {"4", "-1", "7", "-1"}, 1},
+		{MAXIMUM, {"1 + 2", "3", "0"}, 0}, // compiled with no parser
+		{MINIMUM, {"2 * 3", "6", "6 / 1"}, 0} // evaluated by the parser at each pick
+	};
+	unsigned int i = 0;
+	for (auto& pickCase : cases) {
+		Picker* picker = scenario.pickerByExpressions("Picker" + std::to_string(i), pickCase.condition, pickCase.expressions);
+		const int picked = picker->pick();
+		if (picked != pickCase.expected || picker->pick() != picked) {
+			fail("conditions", "case " + std::to_string(i) + " picked station " + std::to_string(picked) + ", expected " + std::to_string(pickCase.expected));
+		}
+		i++;
+	}
+	// expressions that read a variable are compiled, and read it again at each pick
+	Variable* load = new Variable(scenario.model, "Load");
+	load->setValue(5.0, "1");
+	load->setValue(1.0, "2");
+	Picker* picker = scenario.pickerByExpressions("VariablePicker", MINIMUM, {"Load[1]", "Load[2] + 3", "2 * 2 + 1"});
+	const int first = picker->pick();
+	load->setValue(0.0, "1");
+	const int second = picker->pick();
+	load->setValue(9.0, "1");
+	load->setValue(-3.0, "2");
+	const int third = picker->pick();
+	if (first != 1 || second != 0 || third != 1) {
+		fail("conditions", "picks by the variable were " + std::to_string(first) + ", " + std::to_string(second) + " and " + std::to_string(third));
+	}
+}
+
+/*
+ * A picker deleted no longer observes the queues and resources of its stations, which keep changing
+ */
+void deletedPicker() {
+	Scenario scenario;
+	Queue* queue = new Queue(scenario.model, "Queue");
+	Resource* resource = new Resource(scenario.model, "Resource");
+	ModelDataDefinition::CreateInternalData(queue);
+	ModelDataDefinition::CreateInternalData(resource);
+	Picker* picker = new Picker(scenario.model, "Picker");
+	picker->setPickConditionNumberInQueue(true);
+	picker->setPickConditionNumberBusyResource(true);
+	Station* station = new Station(scenario.model, "Station");
+	PickableStationItem* item = new PickableStationItem(station, queue);
+	item->setResource(resource);
+	picker->addPickableStationItem(item);
+	picker->stations.push_back(station);
+	Picker* other = new Picker(scenario.model, "Other");
+	other->setPickConditionNumberInQueue(true);
+	other->addPickableStationItem(new PickableStationItem(station, queue));
+	other->stations.push_back(station);
+	if (picker->pick() != 0 || other->pick() != 0) {
+		fail("deletedPicker", "the only station was not picked");
+	}
+	delete picker;
+	Waiting* waiting = new Waiting(nullptr, 0.0, other);
+	queue->insertElement(waiting);
+	resource->seize(1);
+	queue->removeElement(waiting);
+	delete waiting;
+	resource->release(1);
+	if (other->pick() != 0) {
+		fail("deletedPicker", "the picker left was not notified");
+	}
+}
+
+/*
+ * Rank of the first station with the least number in queue and of busy resources
+ */
+int scanned(const std::vector<Queue*>& queues, const std::vector<Resource*>& resources) {
+	int best = -1;
+	unsigned int bestValue = 0;
+	for (unsigned int i = 0; i < queues.size(); i++) {
+		const unsigned int value = queues[i]->size() + resources[i]->getNumberBusy();
+		if (best < 0 || value < bestValue) {
+			best = i;
+			bestValue = value;
+		}
+	}
+	return best;
+}
+
+void manyStations(unsigned int numberOfStations, unsigned int picks) {
+	Scenario scenario;
+	Model* model = scenario.model;
+	std::vector<Queue*> queues;
+	std::vector<Resource*> resources;
+	Picker* picker = new Picker(model, "Picker");
+	picker->setPickConditionExpression(false);
+	picker->setPickConditionNumberInQueue(true);
+	picker->setPickConditionNumberBusyResource(true);
+	Picker* scanner = new Picker(model, "Scanner"); // evaluates an expression of every station at each pick, as PickStation used to do
+	scanner->setPickConditionNumberInQueue(true);
+	scanner->setPickConditionNumberBusyResource(true);
+	for (unsigned int i = 0; i < numberOfStations; i++) {
+		Station* station = new Station(model, "Station" + std::to_string(i));
+		Queue* queue = new Queue(model, "Queue" + std::to_string(i));
+		Resource* resource = new Resource(model, "Resource" + std::to_string(i));
+		resource->setCapacity(2);
+		ModelDataDefinition::CreateInternalData(queue);
+		ModelDataDefinition::CreateInternalData(resource);
+		PickableStationItem* item = new PickableStationItem(station, queue);
+		item->setResource(resource);
+		picker->addPickableStationItem(item);
+		PickableStationItem* scannerItem = new PickableStationItem(station, queue);
+		scannerItem->setResource(resource);
+		scannerItem->setExpression("0 * 1");
+		scanner->addPickableStationItem(scannerItem);
+		picker->stations.push_back(station);
+		scanner->stations.push_back(station);
+		queues.push_back(queue);
+		resources.push_back(resource);
+	}
+	std::mt19937 random(7);
+	std::uniform_int_distribution<unsigned int> anyStation(0, numberOfStations - 1), anyChange(0, 3);
+	unsigned int mismatches = 0;
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < picks; i++) {
+		const int picked = picker->pick();
+		// entities join the queue picked, and queues and resources change anywhere
+		queues[picked]->insertElement(new Waiting(nullptr, 0.0, picker));
+		const unsigned int changed = anyStation(random);
+		switch (anyChange(random)) {
+			case 0: resources[changed]->seize(1);
+				break;
+			case 1: resources[changed]->release(1);
+				break;
+			default: if (queues[changed]->size() > 0) {
+					Waiting* waiting = queues[changed]->first();
+					queues[changed]->removeElement(waiting);
+					delete waiting;
+				}
+		}
+		if (i % 1000 == 0 && picker->pick() != scanned(queues, resources)) {
+			mismatches++;
+		}
+	}
+	const double seconds = secondsSince(begin);
+	const unsigned int scannedPicks = 200;
+	const std::chrono::steady_clock::time_point scanBegin = std::chrono::steady_clock::now();
+	bool scannerAgrees = true;
+	for (unsigned int i = 0; i < scannedPicks; i++) {
+		scannerAgrees = scannerAgrees && scanner->pick() == picker->pick();
+	}
+	const double scanSeconds = secondsSince(scanBegin) * picks / scannedPicks;
+	std::cout << picks << " picks among " << numberOfStations << " stations whose queues and resources change took " << seconds
+			<< " seconds. Scanning every station and evaluating its expression would take " << scanSeconds << " seconds" << std::endl;
+	if (mismatches > 0 || !scannerAgrees) {
+		fail("manyStations", std::to_string(mismatches) + " picks differ from the first station with the least number in queue and of busy resources");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkPickStation" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% conditions (benchmarkPickStation)" << std::endl;
+	conditions();
+	std::cout << "%TEST_FINISHED% time=0 conditions (benchmarkPickStation)" << std::endl;
+
+	std::cout << "%TEST_STARTED% deletedPicker (benchmarkPickStation)" << std::endl;
+	deletedPicker();
+	std::cout << "%TEST_FINISHED% time=0 deletedPicker (benchmarkPickStation)" << std::endl;
+
+	std::cout << "%TEST_STARTED% manyStations (benchmarkPickStation)" << std::endl;
+	manyStations(2000, 200000);
+	std::cout << "%TEST_FINISHED% time=0 manyStations (benchmarkPickStation)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
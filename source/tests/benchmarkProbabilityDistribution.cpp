@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include "../tools/ProbabilityDistribution.h"
+
+/*
+ * Benchmark of quantile functions. Every evaluation uses a different probability, so the cache does not help, except in the
+ * "cached" benchmark, that repeats the same quantile (as the critical value of a confidence interval is repeatedly requested).
+ * Also checks that the quantiles are accurate by comparing them to tabled values.
+ */
+
+double benchmark(std::string name, unsigned int evaluations, std::function<double(double) > quantile) {
+	double sum = 0.0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < evaluations; i++) {
+		sum += quantile(0.001 + 0.998 * (i + 0.5) / evaluations);
+	}
+	std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+	std::cout << name << ": " << duration.count() / evaluations << " microseconds per quantile" << std::endl;
+	return sum;
+}
+
+bool check(std::string name, double value, double expected) {
+	if (std::abs(value - expected) > 1e-4 * std::abs(expected)) {
+		std::cout << "%TEST_FAILED% time=0 testname=accuracy (benchmarkProbabilityDistribution) message=" << name << " is " << value << " instead of " << expected << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void accuracy() {
+	check("t(0.975;1)", ProbabilityDistribution::inverseTStudent(0.975, 0.0, 1.0, 1), 12.7062);
+	check("t(0.995;2)", ProbabilityDistribution::inverseTStudent(0.995, 0.0, 1.0, 2), 9.92484);
+	check("t(0.025;9)", ProbabilityDistribution::inverseTStudent(0.025, 0.0, 1.0, 9), -2.26216);
+	check("chi2(0.95;10)", ProbabilityDistribution::inverseChi2(0.95, 10), 18.3070);
+	check("chi2(0.025;10)", ProbabilityDistribution::inverseChi2(0.025, 10), 3.24697);
+	check("F(0.95;3,10)", ProbabilityDistribution::inverseFFisherSnedecor(0.95, 3, 10), 3.70827);
+	check("F(0.99;5,20)", ProbabilityDistribution::inverseFFisherSnedecor(0.99, 5, 20), 4.10268);
+	check("z(0.975)", ProbabilityDistribution::inverseNormal(0.975, 0.0, 1.0), 1.959964);
+}
+
+void performance() {
+	const unsigned int evaluations = 20000;
+	benchmark("normal", evaluations, [](double p) {
+		return ProbabilityDistribution::inverseNormal(p, 0.0, 1.0);
+	});
+	benchmark("t-student(9)", evaluations, [](double p) {
+		return ProbabilityDistribution::inverseTStudent(p, 0.0, 1.0, 9);
+	});
+	benchmark("chi2(10)", evaluations, [](double p) {
+		return ProbabilityDistribution::inverseChi2(p, 10);
+	});
+	benchmark("F(3,10)", evaluations, [](double p) {
+		return ProbabilityDistribution::inverseFFisherSnedecor(p, 3, 10);
+	});
+	benchmark("t-student(9) cached", evaluations, [](double p) {
+		return ProbabilityDistribution::inverseTStudent(0.975, 0.0, 1.0, 9);
+	});
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkProbabilityDistribution" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% accuracy (benchmarkProbabilityDistribution)" << std::endl;
+	accuracy();
+	std::cout << "%TEST_FINISHED% time=0 accuracy (benchmarkProbabilityDistribution)" << std::endl;
+
+	std::cout << "%TEST_STARTED% performance (benchmarkProbabilityDistribution)" << std::endl;
+	performance();
+	std::cout << "%TEST_FINISHED% time=0 performance (benchmarkProbabilityDistribution)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Process.h"
+#include "../plugins/components/Seize.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Release.h"
+#include "../plugins/components/Assign.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Resource.h"
+#include "../plugins/data/Queue.h"
+
+/*
+ * Benchmark of Process. The same single server queue is simulated by a Process, by a Seize followed by a Delay and a Release, and by a
+ * Seize whose entities pass through an Assign before the Delay (so it is not fused, and takes as many events as Process used to take).
+ * Checks that entities leave at the same times with the same times accumulated in all of them, and that fused ones process about half
+ * of the events between arriving and leaving the Release. Arrivals and delays depend only on the time, since checking a Process draws
+ * random numbers for its expressions more times than checking separate components does.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkProcess) message=" << message << std::endl;
+}
+
+/*
+ * Dispose that records when entities leave and the times accumulated by them
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> times, waitTimes, othersTimes;
+
+	Recorder(Model* model) : Dispose(model, "Recorder") {
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		times.push_back(_parentModel->getSimulation()->getSimulatedTime());
+		waitTimes.push_back(entity->getAttributeValue("Entity.TotalWaitTime"));
+		othersTimes.push_back(entity->getAttributeValue("Entity.TotalOthersTime"));
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+enum class Layout {
+	PROCESS, SEIZE_DELAY_RELEASE, UNFUSED
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Recorder* recorder;
+	unsigned long events = 0;
+	double seconds = 0.0;
+
+	Scenario(Layout layout, double length) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		model->getOnEventManager()->addOnProcessEventHandler(this, &Scenario::onProcessEvent);
+		Create* create = new Create(model, "Create");
+		create->setTimeUnit(Util::TimeUnit::second);
+		create->setTimeBetweenCreationsExpression("1", Util::TimeUnit::second);
+		Resource* resource = new Resource(model, "Server");
+		Queue* queue = new Queue(model, "Queue");
+		recorder = new Recorder(model);
+		if (layout == Layout::PROCESS) {
+			Process* process = new Process(model, "Process");
+			process->getSeizeRequests()->insert(new SeizableItem(resource));
+			process->setQueueableItem(new QueueableItem(queue));
+			process->setDelayExpression("0.4 + 0.5 * (1 + sin(TNOW * 7))", Util::TimeUnit::second);
+			create->getConnectionManager()->insert(process);
+			process->getConnectionManager()->insert(recorder);
+		} else {
+			Seize* seize = new Seize(model, "Seize");
+			seize->getSeizeRequests()->insert(new SeizableItem(resource));
+			seize->setQueueableItem(new QueueableItem(queue));
+			Delay* delay = new Delay(model, "Delay");
+			delay->setDelayExpression("0.4 + 0.5 * (1 + sin(TNOW * 7))", Util::TimeUnit::second);
+			Release* release = new Release(model, "Release");
+			release->getReleaseRequests()->insert(new SeizableItem(resource));
+			create->getConnectionManager()->insert(seize);
+			if (layout == Layout::UNFUSED) {
+				Assign* pass = new Assign(model, "Pass");
+				seize->getConnectionManager()->insert(pass);
+				pass->getConnectionManager()->insert(delay);
+			} else {
+				seize->getConnectionManager()->insert(delay);
+			}
+			delay->getConnectionManager()->insert(release);
+			release->getConnectionManager()->insert(recorder);
+		}
+		model->getSimulation()->setReplicationReportBaseTimeUnit(Util::TimeUnit::second);
+		model->getSimulation()->setNumberOfReplications(1);
+		model->getSimulation()->setReplicationLength(length, Util::TimeUnit::second);
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	void onProcessEvent(SimulationEvent* event) {
+		events++;
+	}
+};
+
+void fused(double length) {
+	Scenario process(Layout::PROCESS, length);
+	Scenario seizeDelayRelease(Layout::SEIZE_DELAY_RELEASE, length);
+	Scenario unfused(Layout::UNFUSED, length);
+	const unsigned int departures = unfused.recorder->times.size();
+	std::cout << departures << " entities through a Process simulated in " << process.seconds << " seconds and " << process.events << " events, through "
+			<< "Seize, Delay and Release in " << seizeDelayRelease.seconds << " seconds and " << seizeDelayRelease.events << " events, and unfused in "
+			<< unfused.seconds << " seconds and " << unfused.events << " events" << std::endl;
+	for (Scenario* scenario : {&process, &seizeDelayRelease}) {
+		const std::string name = scenario == &process ? "Process" : "Seize, Delay and Release";
+		if (scenario->recorder->times != unfused.recorder->times || scenario->recorder->waitTimes != unfused.recorder->waitTimes
+				|| scenario->recorder->othersTimes != unfused.recorder->othersTimes) {
+			fail("fused", "entities through " + name + " do not leave at the same times, or with the same times accumulated, as unfused ones");
+		}
+	}
+	// unfused entities take events at Create, Seize, Assign, Delay, Release and Dispose, and fused ones at Create, Process (or Seize),
+	// Release and Dispose, so between arriving and leaving the Release there are 2 events instead of 4
+	if (departures < length / 2 || process.events * 4 > unfused.events * 3 || seizeDelayRelease.events * 4 > unfused.events * 3) {
+		fail("fused", "fused entities processed " + std::to_string(process.events) + " events, unfused ones " + std::to_string(unfused.events));
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkProcess" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% fused (benchmarkProcess)" << std::endl;
+	fused(100000.0);
+	std::cout << "%TEST_FINISHED% time=0 fused (benchmarkProcess)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
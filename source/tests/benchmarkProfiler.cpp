@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of the model profiler. Checks the dispatches counted for each component, the evaluations of expressions, the samples of the
+ * future events list and of the entities, and the snapshot file. Then compares the simulation time with and without profiling.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkProfiler) message=" << message << std::endl;
+}
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Create* create;
+	Delay* delay;
+	Dispose* dispose;
+
+	Scenario(unsigned long entities) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		PluginManager* plugins = genesys->getPluginManager();
+		create = plugins->newInstance<Create>(model);
+		create->setTimeBetweenCreationsExpression("expo(1)");
+		create->setMaxCreations(entities);
+		delay = plugins->newInstance<Delay>(model);
+		delay->setDelayExpression("unif(0.5, 1.5)");
+		dispose = plugins->newInstance<Dispose>(model);
+		create->getConnectionManager()->insert(delay);
+		delay->getConnectionManager()->insert(dispose);
+		model->getSimulation()->setReplicationLength(1e9);
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	double simulate() {
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+};
+
+void profile(unsigned long entities) {
+	Scenario scenario(entities);
+	ModelProfiler* profiler = scenario.model->getProfiler();
+	profiler->setEnabled(true);
+	profiler->setSamplingInterval(10);
+	profiler->setMaximumSamples(1000);
+	profiler->setSnapshotFilename("benchmarkProfiler.snapshot");
+	scenario.simulate();
+	std::cout << profiler->show(5);
+	unsigned long dispatches = 0;
+	for (const ModelProfiler::ComponentProfile& component : profiler->getComponentProfiles()) {
+		dispatches += component.dispatches;
+		if (component.dispatches != entities && !(component.component == scenario.create && component.dispatches == entities + 1)) {
+			fail("profile", "component " + component.component->getName() + " dispatched " + std::to_string(component.dispatches) + " events");
+		}
+	}
+	if (profiler->getComponentProfiles().size() != 3 || dispatches > profiler->getNumberOfEvents()) {
+		fail("profile", "not every component was profiled");
+	}
+	bool delayEvaluated = false;
+	for (const ModelProfiler::ExpressionProfile& expression : profiler->getExpressionProfiles()) {
+		delayEvaluated = delayEvaluated || (expression.expression == "unif(0.5, 1.5)" && expression.evaluations == entities);
+	}
+	if (!delayEvaluated) {
+		fail("profile", "evaluations of the delay expression were not counted");
+	}
+	if (profiler->getSamples().size() < 500 || profiler->getSamples().size() > 1000 || profiler->getMaximumEntities() == 0
+			|| profiler->getSamples().back().events > profiler->getNumberOfEvents()) {
+		fail("profile", "samples do not cover the simulation with at most the maximum number of samples");
+	}
+	std::ifstream snapshot("benchmarkProfiler.snapshot");
+	std::string line;
+	unsigned int lines = 0;
+	while (std::getline(snapshot, line)) {
+		lines++;
+	}
+	if (lines < profiler->getSamples().size()) {
+		fail("profile", "snapshot file was not written");
+	}
+	std::remove("benchmarkProfiler.snapshot");
+}
+
+void overhead(unsigned long entities) {
+	double seconds[2];
+	for (unsigned int enabled = 0; enabled < 2; enabled++) {
+		Scenario scenario(entities);
+		scenario.model->getProfiler()->setEnabled(enabled == 1);
+		seconds[enabled] = scenario.simulate();
+	}
+	std::cout << entities << " entities simulated in " << seconds[0] << " seconds without profiling and " << seconds[1] << " seconds with it ("
+			<< 100.0 * (seconds[1] / seconds[0] - 1.0) << "% more)" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkProfiler" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% profile (benchmarkProfiler)" << std::endl;
+	profile(20000);
+	std::cout << "%TEST_FINISHED% time=0 profile (benchmarkProfiler)" << std::endl;
+
+	std::cout << "%TEST_STARTED% overhead (benchmarkProfiler)" << std::endl;
+	overhead(200000);
+	std::cout << "%TEST_FINISHED% time=0 overhead (benchmarkProfiler)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
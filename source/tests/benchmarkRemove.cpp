@@ -0,0 +1,232 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Wait.h"
+#include "../plugins/components/Remove.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Queue.h"
+#include "../plugins/data/EntityGroup.h"
+
+/*
+ * Benchmark of removing ranges of entities. Removes half of queues and groups of 10^5 entities, checking the entities removed and those
+ * that remain, and compares with removing them rank by rank as Remove used to do (estimated from some ranks). Then checks Remove in a
+ * simulation, removing from a queue and from the group of the arriving entity.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkRemove) message=" << message << std::endl;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point begin) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/*
+ * Dispose that records the arrival time of entities leaving
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> arrivals;
+
+	Recorder(Model* model, std::string name) : Dispose(model, name) {
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		arrivals.push_back(entity->getAttributeValue("Entity.ArrivalTime"));
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+/*
+ * Remove from the group of the arriving entity, that is filled with members arrived at times 0 to 9 before removing
+ */
+class GroupRemove : public Remove {
+public:
+
+	GroupRemove(Model* model, EntityGroup* group) : Remove(model, "GroupRemove") {
+		_group = group;
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		for (unsigned int i = 0; i < 10; i++) {
+			Entity* member = _parentModel->createEntity("Member" + std::to_string(i));
+			member->setEntityType(entity->getEntityType());
+			member->setAttributeValue("Entity.ArrivalTime", i);
+			_group->insertElement(entity->getId(), member);
+		}
+		Remove::_onDispatchEvent(entity, inputPortNumber);
+	}
+private:
+	EntityGroup* _group;
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	/*
+	 * Entities not inserted into the model, since every entity alive costs the kernel a search when it is inserted
+	 */
+	std::vector<Entity*> entities(unsigned int number) {
+		std::vector<Entity*> created;
+		for (unsigned int i = 0; i < number; i++) {
+			created.push_back(model->createEntity("Entity" + std::to_string(i), false));
+		}
+		return created;
+	}
+
+	Queue* queueOf(const std::vector<Entity*>& entities, std::string name) {
+		Queue* queue = new Queue(model, name);
+		ModelDataDefinition::CreateInternalData(queue);
+		for (Entity* entity : entities) {
+			queue->insertElement(new Waiting(entity, 0.0, nullptr));
+		}
+		return queue;
+	}
+};
+
+/*
+ * Seconds to remove the ranks from the queue as Remove used to do, estimated from some ranks
+ */
+double rankByRankSeconds(Queue* queue, unsigned int startRank, unsigned int ranks) {
+	const unsigned int measured = 100;
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	unsigned long checksum = 0;
+	for (unsigned int rank = startRank; rank < startRank + measured; rank++) {
+		checksum += queue->getAtRank(rank)->getEntity()->getId() > 0 ? 1 : 0;
+	}
+	for (unsigned int i = 0; i < measured; i++) {
+		Waiting* waiting = queue->getAtRank(startRank);
+		queue->removeElement(waiting);
+		delete waiting;
+	}
+	return checksum > 0 ? secondsSince(begin) * ranks / measured : 0.0;
+}
+
+void queueRange(unsigned int entities) {
+	Scenario scenario;
+	std::vector<Entity*> created = scenario.entities(entities);
+	Queue* queue = scenario.queueOf(created, "Queue");
+	const unsigned int startRank = entities / 4, endRank = 3 * entities / 4 - 1;
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	std::list<Waiting*> removed = queue->removeElements(startRank, endRank);
+	const double seconds = secondsSince(begin);
+	const double rankByRank = rankByRankSeconds(scenario.queueOf(created, "QueueRankByRank"), startRank, endRank - startRank + 1);
+	std::cout << removed.size() << " of " << entities << " entities removed from a queue in " << seconds << " seconds. Removing them rank by rank would take "
+			<< rankByRank << " seconds" << std::endl;
+	bool inOrder = removed.size() == endRank - startRank + 1;
+	unsigned int rank = startRank;
+	for (Waiting* waiting : removed) {
+		inOrder = inOrder && waiting->getEntity() == created[rank++];
+		delete waiting;
+	}
+	inOrder = inOrder && queue->size() == entities - (endRank - startRank + 1) && queue->getAtRank(startRank)->getEntity() == created[endRank + 1]
+			&& queue->getAtRank(startRank - 1)->getEntity() == created[startRank - 1];
+	if (!inOrder || queue->removeElements(entities, entities + 10).size() > 0 || queue->removeElements(0, 2 * entities).size() != queue->size() + entities / 2) {
+		fail("queueRange", "entities removed from the queue are not those in the range, in order");
+	}
+}
+
+void groupRange(unsigned int entities) {
+	Scenario scenario;
+	std::vector<Entity*> created = scenario.entities(entities);
+	EntityGroup* group = new EntityGroup(scenario.model, "Group");
+	for (Entity* entity : created) {
+		group->insertElement(1, entity);
+	}
+	group->insertElement(2, created[0]);
+	const unsigned int startRank = entities / 4, endRank = 3 * entities / 4 - 1;
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	std::list<Entity*> removed = group->removeElements(1, startRank, endRank);
+	std::cout << removed.size() << " of " << entities << " entities removed from a group in " << secondsSince(begin) << " seconds" << std::endl;
+	bool inOrder = removed.size() == endRank - startRank + 1;
+	unsigned int rank = startRank;
+	for (Entity* entity : removed) {
+		inOrder = inOrder && entity == created[rank++];
+	}
+	if (!inOrder || group->getGroup(1)->size() != entities / 2 || group->getGroup(2)->size() != 1 || group->removeElements(3, 0, 10).size() > 0) {
+		fail("groupRange", "entities removed from the group are not those in the range, in order");
+	}
+}
+
+/*
+ * Entities arrive at a Wait from time 0 to 9. At time 100 a Remove takes ranks 2 to 5 of its queue, and at time 101 another takes the
+ * first one. At time 102 a Remove takes ranks 7 to 20 from the group of the arriving entity
+ */
+void removeInSimulation() {
+	Scenario scenario;
+	Model* model = scenario.model;
+	Create* create = new Create(model, "Create");
+	create->setTimeBetweenCreationsExpression("1");
+	create->setMaxCreations(10);
+	Wait* wait = new Wait(model, "Wait");
+	wait->setWaitType(Wait::WaitType::InfiniteHold);
+	Queue* queue = new Queue(model, "Queue");
+	wait->setQueue(queue);
+	create->getConnectionManager()->insert(wait);
+	wait->getConnectionManager()->insert(new Dispose(model, "WaitDispose"));
+	Recorder* fromQueue = new Recorder(model, "FromQueue");
+	Recorder* fromGroup = new Recorder(model, "FromGroup");
+	Dispose* removersDispose = new Dispose(model, "RemoversDispose");
+	EntityGroup* group = new EntityGroup(model, "Group");
+	Remove* removes[] = {new Remove(model, "RemoveRange"), new Remove(model, "RemoveFirst"), new GroupRemove(model, group)};
+	const std::string startRanks[] = {"2", "0", "7"}, endRanks[] = {"5", "", "20"};
+	for (unsigned int i = 0; i < 3; i++) {
+		Create* trigger = new Create(model, "Trigger" + std::to_string(i));
+		trigger->setFirstCreation(100.0 + i);
+		trigger->setMaxCreations(1);
+		removes[i]->setRemoveFromType(i < 2 ? Remove::RemoveFromType::QUEUE : Remove::RemoveFromType::ENTITYGROUP);
+		removes[i]->setRemoveFrom(i < 2 ? (ModelDataDefinition*) queue : group);
+		removes[i]->setRemoveStartRank(startRanks[i]);
+		removes[i]->setRemoveEndRank(endRanks[i]);
+		trigger->getConnectionManager()->insert(removes[i]);
+		removes[i]->getConnectionManager()->insert(removersDispose);
+		removes[i]->getConnectionManager()->insert(i < 2 ? fromQueue : fromGroup); // output port 1, of removed entities
+	}
+	model->getSimulation()->setReplicationLength(200.0);
+	model->getSimulation()->start();
+	const std::vector<double> expectedFromQueue = {2, 3, 4, 5, 0}, expectedFromGroup = {7, 8, 9};
+	if (fromQueue->arrivals != expectedFromQueue || queue->size() != 5) {
+		fail("removeInSimulation", std::to_string(fromQueue->arrivals.size()) + " entities removed from the queue, not those in the ranges");
+	}
+	if (fromGroup->arrivals != expectedFromGroup) {
+		fail("removeInSimulation", std::to_string(fromGroup->arrivals.size()) + " entities removed from the group, not those in the range");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkRemove" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% queueRange (benchmarkRemove)" << std::endl;
+	queueRange(100000);
+	std::cout << "%TEST_FINISHED% time=0 queueRange (benchmarkRemove)" << std::endl;
+
+	std::cout << "%TEST_STARTED% groupRange (benchmarkRemove)" << std::endl;
+	groupRange(100000);
+	std::cout << "%TEST_FINISHED% time=0 groupRange (benchmarkRemove)" << std::endl;
+
+	std::cout << "%TEST_STARTED% removeInSimulation (benchmarkRemove)" << std::endl;
+	removeInSimulation();
+	std::cout << "%TEST_FINISHED% time=0 removeInSimulation (benchmarkRemove)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
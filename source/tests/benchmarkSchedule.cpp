@@ -0,0 +1,124 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <random>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/data/Schedule.h"
+
+/*
+ * Benchmark of schedule lookups. Checks that compiled schedules give the same items as walking the items from time zero (as Schedule
+ * used to do), including at the ends of items, and then compares both in 10^6 lookups late in a long run.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkSchedule) message=" << message << std::endl;
+}
+
+/*
+ * The item as Schedule used to find it
+ */
+std::string walkedExpression(Schedule* schedule, double tnow) {
+	double accumDuration = 0.0;
+	do
+		for (SchedulableItem* item : *schedule->getSchedulableItems()->list()) {
+			if (tnow <= accumDuration + item->getDuration()) {
+				return item->getExpression();
+			}
+			accumDuration += item->getDuration();
+		} while (schedule->isRepeatAfterLast());
+	return schedule->getSchedulableItems()->last()->getExpression();
+}
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Schedule* schedule;
+
+	Scenario(unsigned int items, bool repeat) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		model = genesys->getModelManager()->newModel();
+		schedule = new Schedule(model, "Schedule");
+		schedule->setRepeatAfterLast(repeat);
+		for (unsigned int i = 0; i < items; i++) {
+			// integer durations, so sums have no rounding. One item of zero duration
+			schedule->getSchedulableItems()->insert(new SchedulableItem(std::to_string(i), i == items / 2 ? 0.0 : 1.0 + i % 5));
+		}
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+};
+
+void equivalence() {
+	std::mt19937 generator(7);
+	for (unsigned int repeat = 0; repeat < 2; repeat++) {
+		Scenario scenario(24, repeat == 1);
+		std::uniform_real_distribution<double> anyTime(0.0, 500.0);
+		unsigned int differences = 0;
+		for (unsigned int i = 0; i < 100000; i++) {
+			// ends of items, and times between them
+			const double time = i % 2 == 0 ? std::floor(anyTime(generator)) : anyTime(generator);
+			if (scenario.schedule->getExpression(time) != walkedExpression(scenario.schedule, time)) {
+				differences++;
+			}
+		}
+		for (double time = 0.0; time < 300.0; time += 0.5) { // nondecreasing, as those at the simulated time
+			if (scenario.schedule->getExpression(time) != walkedExpression(scenario.schedule, time)) {
+				differences++;
+			}
+		}
+		if (differences > 0) {
+			fail("equivalence", std::to_string(differences) + " lookups differ " + (repeat == 1 ? "repeating" : "not repeating"));
+		}
+	}
+}
+
+void lateLookups(unsigned int lookups, double from) {
+	Scenario scenario(24, true);
+	std::mt19937 generator(11);
+	std::uniform_real_distribution<double> anyTime(from, 2 * from);
+	double time = from;
+	unsigned long checksum = 0;
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < lookups; i++) {
+		time += 0.37;
+		checksum += scenario.schedule->getExpression(time).length();
+	}
+	const double monotoneSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	begin = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < lookups; i++) {
+		checksum += scenario.schedule->getExpression(anyTime(generator)).length();
+	}
+	const double randomSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	begin = std::chrono::steady_clock::now();
+	time = from;
+	for (unsigned int i = 0; i < lookups / 1000; i++) {
+		time += 0.37 * 1000;
+		checksum += walkedExpression(scenario.schedule, time).length();
+	}
+	const double walkedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 1000;
+	std::cout << lookups << " lookups after time " << from << ": " << monotoneSeconds << " seconds at nondecreasing times, " << randomSeconds
+			<< " seconds at random times, " << walkedSeconds << " seconds walking the items (estimated from " << lookups / 1000 << ")" << std::endl;
+	if (checksum == 0 || scenario.schedule->getExpression(from) != walkedExpression(scenario.schedule, from)) {
+		fail("lateLookups", "late lookups differ");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkSchedule" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% equivalence (benchmarkSchedule)" << std::endl;
+	equivalence();
+	std::cout << "%TEST_FINISHED% time=0 equivalence (benchmarkSchedule)" << std::endl;
+
+	std::cout << "%TEST_STARTED% lateLookups (benchmarkSchedule)" << std::endl;
+	lateLookups(1000000, 1e7);
+	std::cout << "%TEST_FINISHED% time=0 lateLookups (benchmarkSchedule)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Process.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Resource.h"
+#include "../plugins/data/Schedule.h"
+
+/*
+ * Benchmark of models driven by schedules. Checks that a Create whose schedule gives the arrival rate generates the expected number of
+ * arrivals in each item, evaluating each rate once per breakpoint, and that a resource whose capacity schedule drops to zero seizes no
+ * units while it is zero, with the IGNORE and the WAIT rules. At last, checks that rate scheduled Creates draw different arrivals, and that
+ * schedules that repeat do not keep a replication going after the last creation.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkScheduleDriven) message=" << message << std::endl;
+}
+
+/*
+ * Dispose that records when entities leave
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> times;
+
+	Recorder(Model* model, std::string name = "Recorder") : Dispose(model, name) {
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		times.push_back(_parentModel->getSimulation()->getSimulatedTime());
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Schedule* schedule;
+	Create* create;
+	Recorder* recorder;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		schedule = new Schedule(model, "Schedule");
+		create = new Create(model, "Create");
+		create->setTimeUnit(Util::TimeUnit::second);
+		recorder = new Recorder(model);
+		model->getSimulation()->setReplicationReportBaseTimeUnit(Util::TimeUnit::second);
+		model->getSimulation()->setNumberOfReplications(1);
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	double simulate(double length) {
+		model->getSimulation()->setReplicationLength(length, Util::TimeUnit::second);
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+};
+
+void arrivals(unsigned int cycles) {
+	Scenario scenario;
+	const double rates[] = {2.0, 0.0, 5.0};
+	for (double rate : rates) {
+		scenario.schedule->getSchedulableItems()->insert(new SchedulableItem(std::to_string((int) rate), 100.0));
+	}
+	scenario.create->setTimeBetweenCreationsExpression("");
+	scenario.create->setTimeBetweenCreationsSchedule(scenario.schedule);
+	scenario.create->getConnectionManager()->insert(scenario.recorder);
+	scenario.model->getProfiler()->setEnabled(true);
+	const double seconds = scenario.simulate(300.0 * cycles);
+	double counts[3] = {0.0, 0.0, 0.0};
+	for (double time : scenario.recorder->times) {
+		counts[std::min<int>(2, (int) (std::fmod(time, 300.0) / 100.0))]++;
+	}
+	std::cout << scenario.recorder->times.size() << " arrivals in " << cycles << " cycles simulated in " << seconds << " seconds: " << counts[0]
+			<< ", " << counts[1] << " and " << counts[2] << " in each item" << std::endl;
+	for (unsigned int i = 0; i < 3; i++) {
+		const double expected = rates[i] * 100.0 * cycles;
+		if (std::abs(counts[i] - expected) > 4.0 * std::sqrt(expected) + 1.0) {
+			fail("arrivals", "item " + std::to_string(i) + " had " + std::to_string((int) counts[i]) + " arrivals, expected about " + std::to_string((int) expected));
+		}
+	}
+	for (const ModelProfiler::ExpressionProfile& expression : scenario.model->getProfiler()->getExpressionProfiles()) {
+		if ((expression.expression == "2" || expression.expression == "5") && expression.evaluations > cycles + 1) {
+			fail("arrivals", "rate \"" + expression.expression + "\" evaluated " + std::to_string(expression.evaluations) + " times");
+		}
+	}
+}
+
+/*
+ * Capacity 2 for 10 seconds and 0 for 10 seconds, with a constant delay of 4 seconds
+ */
+void capacity(SchedulableItem::Rule rule, unsigned int cycles) {
+	Scenario scenario;
+	scenario.schedule->getSchedulableItems()->insert(new SchedulableItem("2", 10.0));
+	scenario.schedule->getSchedulableItems()->insert(new SchedulableItem("0", 10.0, rule));
+	Resource* resource = new Resource(scenario.model, "Resource");
+	resource->setCapacitySchedule(scenario.schedule);
+	Process* process = new Process(scenario.model, "Process");
+	process->getSeizeRequests()->insert(new SeizableItem(resource));
+	process->setQueueableItem(new QueueableItem(scenario.model, "Queue"));
+	process->setDelayExpression("4", Util::TimeUnit::second);
+	scenario.create->setTimeBetweenCreationsExpression("expo(2)", Util::TimeUnit::second);
+	scenario.create->getConnectionManager()->insert(process);
+	process->getConnectionManager()->insert(scenario.recorder);
+	const double seconds = scenario.simulate(20.0 * cycles);
+	const std::vector<double>& departures = scenario.recorder->times;
+	const std::string ruleName = rule == SchedulableItem::Rule::WAIT ? "WAIT" : "IGNORE";
+	double shortestBreak = 1e99;
+	unsigned int breaks = 0;
+	for (unsigned int i = 1; i < departures.size(); i++) {
+		if (departures[i] - departures[i - 1] > 5.0) {
+			breaks++;
+			shortestBreak = std::min(shortestBreak, departures[i] - departures[i - 1]);
+		}
+	}
+	std::cout << departures.size() << " departures with the " << ruleName << " rule in " << cycles << " cycles simulated in " << seconds
+			<< " seconds: " << breaks << " breaks, the shortest of " << shortestBreak << " seconds" << std::endl;
+	if (departures.size() < cycles || breaks < cycles / 2) {
+		fail("capacity", "the capacity of the resource did not follow the schedule with the " + ruleName + " rule");
+	}
+	if (rule == SchedulableItem::Rule::IGNORE) {
+		// units seized only while capacity is 2, in [20k, 20k+10], so they are released in [20k+4, 20k+14]
+		for (double time : departures) {
+			const double inCycle = std::fmod(time, 20.0);
+			if (inCycle < 4.0 - 1e-9 || inCycle > 14.0 + 1e-9) {
+				fail("capacity", "unit released at " + std::to_string(time) + " was seized while the capacity was 0");
+				break;
+			}
+		}
+	} else if (shortestBreak < 14.0 - 1e-9) {
+		// capacity 0 holds 10 seconds after the last unit is released, and the next release is 4 seconds after it grows
+		fail("capacity", "capacity 0 did not hold for its whole duration with the WAIT rule");
+	}
+}
+
+/*
+ * Two Creates with the same rate schedule, and a resource with a capacity schedule, all repeating forever, in a replication that never
+ * ends by its length
+ */
+void lastCreation(unsigned int maxCreations) {
+	Scenario scenario;
+	scenario.schedule->getSchedulableItems()->insert(new SchedulableItem("1", 10.0));
+	scenario.schedule->getSchedulableItems()->insert(new SchedulableItem("3", 10.0));
+	Schedule* capacitySchedule = new Schedule(scenario.model, "CapacitySchedule");
+	capacitySchedule->getSchedulableItems()->insert(new SchedulableItem("2", 10.0));
+	capacitySchedule->getSchedulableItems()->insert(new SchedulableItem("1", 10.0));
+	Resource* resource = new Resource(scenario.model, "Resource");
+	resource->setCapacitySchedule(capacitySchedule);
+	Process* process = new Process(scenario.model, "Process");
+	process->getSeizeRequests()->insert(new SeizableItem(resource));
+	process->setQueueableItem(new QueueableItem(scenario.model, "Queue"));
+	process->setDelayExpression("0.1", Util::TimeUnit::second);
+	Create* other = new Create(scenario.model, "Other");
+	other->setTimeUnit(Util::TimeUnit::second);
+	Recorder* otherRecorder = new Recorder(scenario.model, "OtherRecorder");
+	for (Create* create : {scenario.create, other}) {
+		create->setTimeBetweenCreationsExpression("");
+		create->setTimeBetweenCreationsSchedule(scenario.schedule);
+		create->setMaxCreations(maxCreations);
+	}
+	scenario.create->getConnectionManager()->insert(process);
+	process->getConnectionManager()->insert(scenario.recorder);
+	other->getConnectionManager()->insert(otherRecorder);
+	const double seconds = scenario.simulate(1e12);
+	const double simulatedTime = scenario.model->getSimulation()->getSimulatedTime();
+	std::cout << scenario.recorder->times.size() << " and " << otherRecorder->times.size() << " arrivals simulated up to " << simulatedTime
+			<< " seconds in " << seconds << " seconds" << std::endl;
+	if (scenario.recorder->times.size() != maxCreations || otherRecorder->times.size() != maxCreations || simulatedTime > 1e6) {
+		fail("lastCreation", "replication did not end after the last creation");
+	} else if (scenario.recorder->times[0] == otherRecorder->times[0] && scenario.recorder->times[1] == otherRecorder->times[1]) {
+		fail("lastCreation", "Creates with the same rate schedule drew the same arrivals");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkScheduleDriven" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% arrivals (benchmarkScheduleDriven)" << std::endl;
+	arrivals(200);
+	std::cout << "%TEST_FINISHED% time=0 arrivals (benchmarkScheduleDriven)" << std::endl;
+
+	std::cout << "%TEST_STARTED% capacity (benchmarkScheduleDriven)" << std::endl;
+	capacity(SchedulableItem::Rule::IGNORE, 500);
+	capacity(SchedulableItem::Rule::WAIT, 500);
+	std::cout << "%TEST_FINISHED% time=0 capacity (benchmarkScheduleDriven)" << std::endl;
+
+	std::cout << "%TEST_STARTED% lastCreation (benchmarkScheduleDriven)" << std::endl;
+	lastCreation(100);
+	std::cout << "%TEST_FINISHED% time=0 lastCreation (benchmarkScheduleDriven)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
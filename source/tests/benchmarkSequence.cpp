@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/Attribute.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Assign.h"
+#include "../plugins/components/Route.h"
+#include "../plugins/components/Enter.h"
+#include "../plugins/components/Dispose.h"
+#include "../plugins/data/Sequence.h"
+#include "../plugins/data/Variable.h"
+
+/*
+ * Benchmark of routing by sequence. Entities follow a long sequence alternating between two stations, and each step assigns an attribute
+ * by an expression, an attribute by a constant, an indexed variable, an attribute indexed by a constant expression, and an attribute
+ * indexed by a variable (never assigned), by an expression that is not compiled. The same model is simulated with compiled assignments and parsing
+ * every assignment statement, as Route used to do, with no profiling. Then checks that both assign the same values, and, profiling, that
+ * the parser is invoked only for the expression that is not compiled.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkSequence) message=" << message << std::endl;
+}
+
+/*
+ * Dispose that records the attributes assigned along the sequence
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> visits, lasts, trails, doubles;
+
+	Recorder(Model* model, std::string name) : Dispose(model, name) {
+	}
+
+	void clear() {
+		visits.clear();
+		lasts.clear();
+		trails.clear();
+		doubles.clear();
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		visits.push_back(entity->getAttributeValue("Visits"));
+		lasts.push_back(entity->getAttributeValue("Last"));
+		trails.push_back(entity->getAttributeValue("Trail", "1"));
+		doubles.push_back(entity->getAttributeValue("Trail", "2"));
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	Sequence* sequence;
+	Variable* total;
+	Recorder* recorder;
+
+	Scenario(unsigned int entities, unsigned int steps) {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		new Attribute(model, "Visits");
+		new Attribute(model, "Last");
+		new Attribute(model, "Trail");
+		total = new Variable(model, "Total");
+		Create* create = new Create(model, "Create");
+		create->setTimeBetweenCreationsExpression("1");
+		create->setMaxCreations(entities);
+		sequence = new Sequence(model, "Sequence");
+		Assign* assign = new Assign(model, "Assign");
+		assign->getAssignments()->insert(new Assignment("Entity.Sequence", std::to_string(sequence->getId())));
+		Route* route = new Route(model, "Route");
+		route->setRouteDestinationType(Route::DestinationType::Sequence);
+		create->getConnectionManager()->insert(assign);
+		assign->getConnectionManager()->insert(route);
+		const std::string stationNames[] = {"StationA", "StationB", "StationEnd"};
+		for (std::string stationName : stationNames) {
+			Enter* enter = new Enter(model, "Enter" + stationName);
+			enter->setStationName(stationName);
+			if (stationName != "StationEnd") {
+				Route* stationRoute = new Route(model, "Route" + stationName);
+				stationRoute->setRouteDestinationType(Route::DestinationType::Sequence);
+				enter->getConnectionManager()->insert(stationRoute);
+			} else {
+				recorder = new Recorder(model, "Recorder");
+				enter->getConnectionManager()->insert(recorder);
+			}
+		}
+		for (unsigned int i = 0; i <= steps; i++) {
+			std::list<Assignment*>* assignments = new std::list<Assignment*>();
+			if (i < steps) {
+				assignments->push_back(new Assignment("Visits", "Visits + 1"));
+				assignments->push_back(new Assignment("Last", std::to_string(i)));
+				assignments->push_back(new Assignment("Total[2]", "Total[2] + 1", false));
+				assignments->push_back(new Assignment("Trail[3 - 2]", "Visits"));
+				assignments->push_back(new Assignment("Trail[Total[1] + 2]", "Visits * 2"));
+			}
+			sequence->getSteps()->insert(new SequenceStep(model, i == steps ? "StationEnd" : stationNames[i % 2], true, assignments));
+		}
+		model->getSimulation()->setReplicationLength(entities + 10.0);
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	double simulate() {
+		recorder->clear();
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	bool assigned(unsigned int entities, unsigned int steps) const {
+		bool assigned = recorder->visits.size() == entities && total->getValue("2") == (double) entities * steps;
+		for (unsigned int i = 0; i < recorder->visits.size(); i++) {
+			assigned = assigned && recorder->visits[i] == steps && recorder->lasts[i] == steps - 1 && recorder->trails[i] == steps
+					&& recorder->doubles[i] == 2.0 * steps;
+		}
+		return assigned;
+	}
+};
+
+void routing(unsigned int entities, unsigned int steps) {
+	Scenario scenario(entities, steps);
+	const double seconds = scenario.simulate();
+	const bool compiledAssigned = scenario.assigned(entities, steps);
+	scenario.sequence->setCompileAssignments(false);
+	const double baselineSeconds = scenario.simulate();
+	const bool baselineAssigned = scenario.assigned(entities, steps);
+	const double routings = (double) entities * (steps + 1);
+	std::cout << routings << " routings along a sequence of " << steps << " steps with 5 assignments each simulated in " << seconds
+			<< " seconds with compiled assignments, and in " << baselineSeconds << " seconds parsing every assignment statement, as Route used to do" << std::endl;
+	if (!compiledAssigned || !baselineAssigned) {
+		fail("routing", std::string("values assigned along the sequence differ ") + (compiledAssigned ? "parsing statements" : "with compiled assignments"));
+	}
+	// no assignment statement is parsed, nor any expression that is compiled (but the assignment of the sequence to entities)
+	scenario.sequence->setCompileAssignments(true);
+	scenario.model->getProfiler()->setEnabled(true);
+	scenario.simulate();
+	bool parsedExpression = false;
+	for (const ModelProfiler::ExpressionProfile& expression : scenario.model->getProfiler()->getExpressionProfiles()) {
+		if (expression.expression == "Visits * 2") {
+			parsedExpression = expression.evaluations == (unsigned long) entities * steps;
+		} else if ((expression.expression.find('=') != std::string::npos && expression.expression.find("Entity.Sequence=") != 0)
+				|| expression.expression == "Visits + 1" || expression.expression == "Total[2] + 1" || expression.expression == "Visits"
+				|| expression.expression == "3 - 2") {
+			fail("routing", "\"" + expression.expression + "\" parsed " + std::to_string(expression.evaluations) + " times");
+		}
+	}
+	if (!parsedExpression) {
+		fail("routing", "expression that is not compiled was not parsed at each step");
+	}
+}
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkSequence" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% routing (benchmarkSequence)" << std::endl;
+	routing(100, 1000);
+	std::cout << "%TEST_FINISHED% time=0 routing (benchmarkSequence)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
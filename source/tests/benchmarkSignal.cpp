@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Wait.h"
+#include "../plugins/components/Signal.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of signals. Waits hold entities waiting for different values of the same signal, and a signal must release only entities
+ * waiting for its value, in the order they arrived, up to the limits of the signal and of the Wait. Then many Waits receive many signals,
+ * each releasing one entity of one of them, and a single Wait holds entities waiting for many values, released one by one.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkSignal) message=" << message << std::endl;
+}
+
+/*
+ * Dispose that records the arrival time of entities leaving
+ */
+class Recorder : public Dispose {
+public:
+	std::vector<double> arrivals;
+
+	Recorder(Model* model, std::string name) : Dispose(model, name) {
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		arrivals.push_back(entity->getAttributeValue("Entity.ArrivalTime"));
+		Dispose::_onDispatchEvent(entity, inputPortNumber);
+	}
+};
+
+/*
+ * Signal whose values cycle through a number of values
+ */
+class CyclingSignal : public Signal {
+public:
+
+	CyclingSignal(Model* model, unsigned int values) : Signal(model, "CyclingSignal") {
+		_values = values;
+	}
+protected:
+
+	virtual void _onDispatchEvent(Entity* entity, unsigned int inputPortNumber) {
+		setSignalValueExpression(std::to_string(_signals++ % _values));
+		Signal::_onDispatchEvent(entity, inputPortNumber);
+	}
+private:
+	unsigned int _values;
+	unsigned int _signals = 0;
+};
+
+struct Scenario {
+	Simulator* genesys;
+	Model* model;
+	SignalData* signalData;
+	std::vector<Recorder*> recorders;
+
+	Scenario() {
+		genesys = new Simulator();
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		model = genesys->getModelManager()->newModel();
+		signalData = new SignalData(model, "SignalData");
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+
+	/*
+	 * Entities arriving from time 0 to a Wait for the value
+	 */
+	Wait* addWait(unsigned int entities, double value, std::string limit = "0") {
+		return addWait(entities, std::to_string(value), "0.001", limit);
+	}
+
+	Wait* addWait(unsigned int entities, std::string valueExpression, std::string timeBetweenCreations, std::string limit) {
+		const std::string suffix = std::to_string(recorders.size());
+		Create* create = new Create(model, "Create" + suffix);
+		create->setTimeBetweenCreationsExpression(timeBetweenCreations);
+		create->setMaxCreations(entities);
+		Wait* wait = new Wait(model, "Wait" + suffix);
+		wait->setSignalData(signalData);
+		wait->setWaitForValueExpression(valueExpression);
+		wait->setLimitExpression(limit);
+		Recorder* recorder = new Recorder(model, "Recorder" + suffix);
+		create->getConnectionManager()->insert(wait);
+		wait->getConnectionManager()->insert(recorder);
+		recorders.push_back(recorder);
+		return wait;
+	}
+
+	void addSignal(Signal* signal, double firstTime, unsigned int signals, std::string limit) {
+		const std::string suffix = std::to_string(firstTime);
+		Create* create = new Create(model, "SignalCreate" + suffix);
+		create->setTimeBetweenCreationsExpression("1");
+		create->setFirstCreation(firstTime);
+		create->setMaxCreations(signals);
+		signal->setSignalData(signalData);
+		signal->setLimitExpression(limit);
+		Dispose* dispose = new Dispose(model, "SignalDispose" + suffix);
+		create->getConnectionManager()->insert(signal);
+		signal->getConnectionManager()->insert(dispose);
+	}
+
+	double simulate(double length) {
+		model->getSimulation()->setReplicationLength(length);
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	bool inArrivalOrder(unsigned int wait) const {
+		const std::vector<double>& arrivals = recorders[wait]->arrivals;
+		for (unsigned int i = 1; i < arrivals.size(); i++) {
+			if (arrivals[i] <= arrivals[i - 1]) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+void targeting() {
+	Scenario scenario;
+	scenario.addWait(10, 1.0);
+	scenario.addWait(10, 2.0);
+	scenario.addWait(10, 3.0, "3");
+	const std::string values[] = {"2", "1", "3", "4"};
+	const std::string limits[] = {"100", "4", "100", "100"};
+	for (unsigned int i = 0; i < 4; i++) {
+		Signal* signal = new Signal(scenario.model, "Signal" + std::to_string(i));
+		signal->setSignalValueExpression(values[i]);
+		scenario.addSignal(signal, 10.0 + i, 1, limits[i]);
+	}
+	scenario.simulate(100.0);
+	const unsigned int expected[] = {4, 10, 3};
+	for (unsigned int i = 0; i < 3; i++) {
+		if (scenario.recorders[i]->arrivals.size() != expected[i] || !scenario.inArrivalOrder(i)) {
+			fail("targeting", "Wait" + std::to_string(i) + " released " + std::to_string(scenario.recorders[i]->arrivals.size()) + " entities, expected the first "
+					+ std::to_string(expected[i]));
+		}
+	}
+	if (scenario.recorders[0]->arrivals.size() > 0 && scenario.recorders[0]->arrivals[0] != 0.0) {
+		fail("targeting", "Wait0 did not release the first entities to arrive");
+	}
+}
+
+void manyWaits(unsigned int waits, unsigned int entitiesPerWait) {
+	Scenario scenario;
+	for (unsigned int i = 0; i < waits; i++) {
+		scenario.addWait(entitiesPerWait, i);
+	}
+	const unsigned int signals = waits * entitiesPerWait;
+	scenario.addSignal(new CyclingSignal(scenario.model, waits), 100.0, signals, "1");
+	const double seconds = scenario.simulate(signals + 200.0);
+	unsigned int released = 0;
+	bool ordered = true;
+	for (unsigned int i = 0; i < waits; i++) {
+		released += scenario.recorders[i]->arrivals.size();
+		ordered = ordered && scenario.inArrivalOrder(i) && scenario.recorders[i]->arrivals.size() == entitiesPerWait;
+	}
+	std::cout << signals << " signals of " << waits << " values to " << waits << " Waits with " << entitiesPerWait << " entities each simulated in "
+			<< seconds << " seconds" << std::endl;
+	if (released != signals || !ordered) {
+		fail("manyWaits", std::to_string(released) + " entities released, expected " + std::to_string(signals) + ", as many from each Wait in arrival order");
+	}
+}
+
+/*
+ * Entities arrive one per time unit, each waiting for the value of its arrival time modulo the number of values, and signals cycling
+ * through the values release them one by one, in the order they arrived
+ */
+void manyValues(unsigned int values, unsigned int entities) {
+	Scenario scenario;
+	scenario.addWait(entities, "MOD(TNOW, " + std::to_string(values) + ")", "1", "0");
+	scenario.addSignal(new CyclingSignal(scenario.model, values), entities + 10.0, entities, "1");
+	const double seconds = scenario.simulate(2.0 * entities + 20.0);
+	std::cout << entities << " signals of " << values << " values to a Wait with " << entities << " entities simulated in " << seconds << " seconds" << std::endl;
+	if (scenario.recorders[0]->arrivals.size() != entities || !scenario.inArrivalOrder(0)) {
+		fail("manyValues", std::to_string(scenario.recorders[0]->arrivals.size()) + " entities released, expected " + std::to_string(entities) + " in arrival order");
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkSignal" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% targeting (benchmarkSignal)" << std::endl;
+	targeting();
+	std::cout << "%TEST_FINISHED% time=0 targeting (benchmarkSignal)" << std::endl;
+
+	std::cout << "%TEST_STARTED% manyWaits (benchmarkSignal)" << std::endl;
+	manyWaits(30, 300);
+	std::cout << "%TEST_FINISHED% time=0 manyWaits (benchmarkSignal)" << std::endl;
+
+	std::cout << "%TEST_STARTED% manyValues (benchmarkSignal)" << std::endl;
+	manyValues(100, 280);
+	std::cout << "%TEST_FINISHED% time=0 manyValues (benchmarkSignal)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
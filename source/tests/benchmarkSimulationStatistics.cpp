@@ -0,0 +1,276 @@
+#include <stdlib.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+#include "../kernel/simulator/Simulator.h"
+#include "../kernel/simulator/StatisticsCollector.h"
+#include "../kernel/simulator/Counter.h"
+#include "../kernel/simulator/SimulationResults.h"
+#include "../kernel/simulator/ExperimentManagerDefaultImpl1.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/components/Delay.h"
+#include "../plugins/components/Dispose.h"
+
+/*
+ * Benchmark of the aggregation of replication statistics into simulation statistics. A model with many statistics collectors and
+ * counters is simulated for many short replications, and the number of values each simulation statistics collected is checked in the
+ * simulation report. Then the same model writes its results into a results file, for two scenarios, and they are read back. At last,
+ * scenarios of an experiment simulated by parallel worker processes write into the same results file.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkSimulationStatistics) message=" << message << std::endl;
+}
+
+/*
+ * A Create that owns the statistics collectors and counters of the benchmark, so the model checker does not remove them as orphans
+ */
+class StatisticsSource : public Create {
+public:
+
+	StatisticsSource(Model* model) : Create(model, "Source") {
+	}
+
+	void own(ModelDataDefinition* data) {
+		_internalDataInsert(data->getName(), data);
+	}
+};
+
+std::string reportedCounter, reportedCstat, reportedReplacement;
+
+void reportHandler(TraceEvent event) {
+	std::istringstream line(event.getText());
+	std::string name;
+	while (line >> name && name == "|") { // indentation
+	}
+	// names are padded with dots
+	if (name.compare(0, 12, "LastCounter.") == 0) {
+		reportedCounter = event.getText();
+	} else if (name.compare(0, 10, "LastCstat.") == 0) {
+		reportedCstat = event.getText();
+	} else if (name.compare(0, 12, "Replacement.") == 0) {
+		reportedReplacement = event.getText();
+	}
+}
+
+unsigned int reportedElements(std::string reportLine) {
+	std::istringstream line(reportLine);
+	std::string name;
+	unsigned int elements = 0;
+	while (line >> name && name == "|") {
+	}
+	line >> elements;
+	return elements;
+}
+
+Model* statisticsModel(Simulator* genesys, unsigned int numCstats, unsigned int numCounters, unsigned int replications) {
+	genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L2_results);
+	genesys->getTraceManager()->addTraceReportHandler(&reportHandler);
+	genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+	Model* model = genesys->getModelManager()->newModel();
+	PluginManager* plugins = genesys->getPluginManager();
+	StatisticsSource* create = new StatisticsSource(model);
+	Dispose* dispose = plugins->newInstance<Dispose>(model);
+	create->getConnectionManager()->insert(dispose);
+	for (unsigned int i = 0; i < numCstats; i++) {
+		create->own(new StatisticsCollector(model, i + 1 < numCstats ? "Cstat" + std::to_string(i) : "LastCstat", create));
+	}
+	for (unsigned int i = 0; i < numCounters; i++) {
+		create->own(new Counter(model, i + 1 < numCounters ? "Counter" + std::to_string(i) : "LastCounter", create));
+	}
+	model->getSimulation()->setReplicationLength(10);
+	model->getSimulation()->setNumberOfReplications(replications);
+	model->getSimulation()->setShowReportsAfterReplication(false);
+	return model;
+}
+
+void aggregate(unsigned int numCstats, unsigned int numCounters, unsigned int replications) {
+	Simulator* genesys = new Simulator();
+	Model* model = statisticsModel(genesys, numCstats, numCounters, replications);
+	reportedCounter = reportedCstat = "";
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	model->getSimulation()->start();
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	std::cout << numCstats << " statistics collectors and " << numCounters << " counters, " << replications << " replications simulated in "
+			<< seconds << " seconds (" << seconds / replications * 1000 << " ms per replication)" << std::endl;
+	if (reportedElements(reportedCstat) != replications || reportedElements(reportedCounter) != replications) {
+		fail("aggregate", "simulation statistics did not collect one value per replication: \"" + reportedCstat + "\", \"" + reportedCounter + "\"");
+	}
+	delete genesys;
+}
+
+/*
+ * Removes the last statistics collector and inserts another one when the second replication starts, so their number does not change
+ */
+Model* replacingModel;
+
+void replaceHandler(SimulationEvent* event) {
+	if (event->getCurrentReplicationNumber() == 2) {
+		StatisticsCollector* last = static_cast<StatisticsCollector*> (replacingModel->getDataManager()->getDataDefinition(Util::TypeOf<StatisticsCollector>(), "LastCstat"));
+		replacingModel->getDataManager()->remove(last);
+		new StatisticsCollector(replacingModel, "Replacement", last->getParent());
+	}
+}
+
+void replaced(unsigned int replications) {
+	Simulator* genesys = new Simulator();
+	replacingModel = statisticsModel(genesys, 10, 1, replications);
+	replacingModel->getOnEventManager()->addOnReplicationStartHandler(&replaceHandler);
+	reportedReplacement = "";
+	replacingModel->getSimulation()->start();
+	if (reportedElements(reportedReplacement) != replications - 1) {
+		fail("replaced", "a statistics collector inserted in place of a removed one did not collect one value per replication: \"" + reportedReplacement + "\"");
+	}
+	delete genesys;
+}
+
+void results(unsigned int numCstats, unsigned int numCounters, unsigned int replications) {
+	const std::string filename = "benchmarkSimulationStatistics.results";
+	std::remove(filename.c_str());
+	std::remove(SimulationResults::IndexFilename(filename).c_str());
+	double seconds[2];
+	for (unsigned int scenario = 0; scenario < 2; scenario++) {
+		Simulator* genesys = new Simulator();
+		Model* model = statisticsModel(genesys, numCstats, numCounters, replications);
+		model->getSimulation()->setShowReportsAfterSimulation(false);
+		model->getSimulation()->setResultsFilename(filename);
+		model->getSimulation()->setResultsLabel("Scenario" + std::to_string(scenario));
+		model->getSimulation()->setReplicationLength(10 * (scenario + 1)); // so scenarios differ
+		const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		model->getSimulation()->start();
+		seconds[scenario] = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		delete genesys;
+	}
+	std::string errorMessage;
+	SimulationResultsReader reader(filename);
+	const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	if (!reader.open(&errorMessage)) {
+		fail("results", errorMessage);
+		return;
+	}
+	std::vector<double> created = reader.getReplicationValues("Scenario1", "Source.CountNumberOut");
+	const double readSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	std::cout << replications << " replications of " << numCstats + numCounters + 3 << " statistics written in " << seconds[0] << " and "
+			<< seconds[1] << " seconds, " << reader.getNumberOfChunks() << " chunks of " << reader.getStatistics().size() << " statistics indexed and "
+			<< created.size() << " values read in " << readSeconds << " seconds" << std::endl;
+	if (reader.getLabels().size() != 2 || reader.getNumberOfChunks() != 2 * (replications + 1) || created.size() != replications
+			|| reader.getStatistics().size() != numCstats + numCounters + 3) {
+		fail("results", "results file does not have every replication of both scenarios");
+		return;
+	}
+	double sum = 0.0;
+	for (double value : created) {
+		sum += value;
+	}
+	const double simulationAverage = reader.getSimulationValue("Scenario1", "Source.CountNumberOut");
+	const double simulationElements = reader.getSimulationValue("Scenario1", "Source.CountNumberOut", SimulationResults::Column::elements);
+	if (std::abs(sum / replications - simulationAverage) > 1e-9 || simulationElements != replications
+			|| reader.getSimulationValue("Scenario0", "Source.CountNumberOut") >= simulationAverage) {
+		fail("results", "values of replications differ from those of the simulation");
+	}
+	SimulationResults::Chunk chunk;
+	reader.readChunk(reader.getNumberOfChunks() - 1, &chunk);
+	if (chunk.info.type != SimulationResults::BlockType::simulation || chunk.ids.size() != numCstats + numCounters + 3) {
+		fail("results", "last chunk is not the simulation of the last scenario");
+	}
+	// without the index, the file is scanned
+	std::remove(SimulationResults::IndexFilename(filename).c_str());
+	SimulationResultsReader scanner(filename);
+	if (!scanner.open(&errorMessage) || scanner.getNumberOfChunks() != reader.getNumberOfChunks() || scanner.getReplicationValues("Scenario1", "Source.CountNumberOut") != created) {
+		fail("results", "scanned results differ from indexed ones");
+	}
+	std::remove(filename.c_str());
+}
+
+void parallel(unsigned int numScenarios, unsigned int replications) {
+	const std::string filename = "benchmarkSimulationStatistics.parallel.results";
+	const std::string modelFilename = "benchmarkSimulationStatistics.parallel.gen";
+	std::remove(filename.c_str());
+	std::remove(SimulationResults::IndexFilename(filename).c_str());
+	Simulator* genesys = new Simulator();
+	genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+	genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+	Model* model = genesys->getModelManager()->newModel();
+	PluginManager* plugins = genesys->getPluginManager();
+	Create* create = plugins->newInstance<Create>(model);
+	Delay* delay = plugins->newInstance<Delay>(model);
+	Dispose* dispose = plugins->newInstance<Dispose>(model);
+	create->getConnectionManager()->insert(delay);
+	delay->getConnectionManager()->insert(dispose);
+	model->getSimulation()->setReplicationLength(100);
+	model->getSimulation()->setNumberOfReplications(replications);
+	model->getSimulation()->setShowReportsAfterReplication(false);
+	model->getSimulation()->setShowReportsAfterSimulation(false);
+	model->getSimulation()->setResultsFilename(filename);
+	model->save(modelFilename);
+	ExperimentManagerDefaultImpl1* experiment = new ExperimentManagerDefaultImpl1(genesys, numScenarios);
+	for (unsigned int i = 0; i < numScenarios; i++) {
+		SimulationScenario* scenario = new SimulationScenario();
+		scenario->setScenarioName("Scenario" + std::to_string(i));
+		scenario->setModelFilename(modelFilename);
+		experiment->getScenarios()->insert(scenario);
+	}
+	experiment->startExperiment();
+	std::string errorMessage;
+	SimulationResultsReader reader(filename);
+	if (experiment->getNumberOfFailedScenarios() > 0 || !reader.open(&errorMessage)) {
+		fail("parallel", "scenarios failed or their results file could not be read. " + errorMessage);
+	} else if (reader.getLabels().size() != numScenarios || reader.getNumberOfChunks() != numScenarios * (replications + 1)) {
+		fail("parallel", "results file has " + std::to_string(reader.getNumberOfChunks()) + " chunks of " + std::to_string(reader.getLabels().size()) + " scenarios");
+	} else {
+		for (const std::string& label : reader.getLabels()) {
+			if (reader.getReplicationValues(label, create->getName() + ".CountNumberOut").size() != replications) {
+				fail("parallel", "results file does not have every replication of " + label);
+			}
+		}
+	}
+	std::remove(filename.c_str());
+	std::remove(SimulationResults::IndexFilename(filename).c_str());
+	std::remove(modelFilename.c_str());
+	// statistics with the same name are told apart by their parents
+	SimulationResultsWriter writer(filename);
+	Counter* ofCreate = new Counter(model, "Shared", create);
+	Counter* ofDispose = new Counter(model, "Shared", dispose);
+	if (!writer.open(&errorMessage) || writer.identify(ofCreate, create) == writer.identify(ofDispose, dispose)
+			|| writer.identify(ofCreate, create) != writer.identify(ofCreate, create)) {
+		fail("parallel", "statistics with the same name and different parents are not identified apart");
+	}
+	writer.close();
+	SimulationResultsReader identified(filename);
+	if (!identified.open(&errorMessage) || identified.getStatisticsId("Shared", dispose->getClassname(), dispose->getName()) != 1
+			|| identified.getStatisticsId("Shared") != 0) {
+		fail("parallel", "statistics with the same name and different parents are not read apart");
+	}
+	std::remove(filename.c_str());
+	std::remove(SimulationResults::IndexFilename(filename).c_str());
+	delete experiment;
+	delete genesys;
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkSimulationStatistics" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% aggregate (benchmarkSimulationStatistics)" << std::endl;
+	aggregate(100, 10, 50);
+	aggregate(250, 30, 20000); // about the limit of 300 elements imposed by the academic licence
+	std::cout << "%TEST_FINISHED% time=0 aggregate (benchmarkSimulationStatistics)" << std::endl;
+
+	std::cout << "%TEST_STARTED% replaced (benchmarkSimulationStatistics)" << std::endl;
+	replaced(20);
+	std::cout << "%TEST_FINISHED% time=0 replaced (benchmarkSimulationStatistics)" << std::endl;
+
+	std::cout << "%TEST_STARTED% results (benchmarkSimulationStatistics)" << std::endl;
+	results(250, 30, 20000);
+	std::cout << "%TEST_FINISHED% time=0 results (benchmarkSimulationStatistics)" << std::endl;
+
+	std::cout << "%TEST_STARTED% parallel (benchmarkSimulationStatistics)" << std::endl;
+	parallel(4, 20);
+	std::cout << "%TEST_FINISHED% time=0 parallel (benchmarkSimulationStatistics)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include "../tools/SolverDefaultImpl1.h"
+
+/*
+ * Benchmark of the numerical integration and of the ODE solvers. For each problem with known solution, it reports the error, the
+ * number of evaluations of the function (or of the whole system of equations) and the time, so fixed and adaptive methods can be compared.
+ */
+
+unsigned int evaluations = 0;
+
+bool check(std::string name, double value, double expected, double tolerance) {
+	if (std::abs(value - expected) > tolerance) {
+		std::cout << "%TEST_FAILED% time=0 testname=" << name << " (benchmarkSolver) message=" << name << " is " << value << " instead of " << expected << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void integrate(std::string name, double min, double max, Solver_if::Function f, double expected) {
+	SolverDefaultImpl1 solver(1e-10, 1e3);
+	evaluations = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double value = solver.integrate(min, max, f);
+	std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+	std::cout << name << ": error " << std::abs(value - expected) << ", " << evaluations << " evaluations, " << duration.count() << " microseconds" << std::endl;
+	check(name, value, expected, 1e-8);
+}
+
+void quadrature() {
+	integrate("4/(1+x^2) in [0,1]", 0.0, 1.0, [](double x) {
+		evaluations++;
+		return 4.0 / (1.0 + x * x);
+	}, M_PI);
+	integrate("exp(-x) in [0,20]", 0.0, 20.0, [](double x) {
+		evaluations++;
+		return std::exp(-x);
+	}, 1.0 - std::exp(-20.0));
+	integrate("sqrt(x) in [0,1]", 0.0, 1.0, [](double x) {
+		evaluations++;
+		return std::sqrt(x);
+	}, 2.0 / 3.0);
+}
+
+void solve(std::string name, double finalTime, std::vector<double> y, Solver_if::OdeSystem f, Solver_if::OdeMethod method, double step, double expected, double tolerance) {
+	SolverDefaultImpl1 solver(1e-8, 1e7);
+	evaluations = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bool solved = solver.solve(0.0, finalTime, y, f, method, step);
+	std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+	std::cout << name << ": error " << std::abs(y[0] - expected) << ", " << evaluations << " evaluations, " << duration.count() << " microseconds" << std::endl;
+	if (!solved) {
+		std::cout << "%TEST_FAILED% time=0 testname=" << name << " (benchmarkSolver) message=" << name << " did not reach the final time" << std::endl;
+	}
+	check(name, y[0], expected, tolerance);
+}
+
+void ode() {
+	// harmonic oscillator y''=-y, y(0)=1, y'(0)=0, so y(t)=cos(t)
+	Solver_if::OdeSystem oscillator = [](double t, const double* y, double* dydt) {
+		evaluations++;
+		dydt[0] = y[1];
+		dydt[1] = -y[0];
+	};
+	solve("oscillator RungeKutta4 step 1e-3", 20.0, {1.0, 0.0}, oscillator, Solver_if::OdeMethod::RungeKutta4, 1e-3, std::cos(20.0), 1e-6);
+	solve("oscillator DormandPrince45", 20.0, {1.0, 0.0}, oscillator, Solver_if::OdeMethod::DormandPrince45, 0.0, std::cos(20.0), 1e-6);
+	solve("oscillator BDF2", 20.0, {1.0, 0.0}, oscillator, Solver_if::OdeMethod::BDF2, 0.0, std::cos(20.0), 1e-4);
+	// stiff y'=-1000(y-cos(t)), y(0)=0, that quickly approaches a slow solution
+	const double k = 1000.0;
+	Solver_if::OdeSystem stiff = [k](double t, const double* y, double* dydt) {
+		evaluations++;
+		dydt[0] = -k * (y[0] - std::cos(t));
+	};
+	const double exact = (k * k * std::cos(10.0) + k * std::sin(10.0) - k * k * std::exp(-k * 10.0)) / (k * k + 1.0);
+	solve("stiff RungeKutta4 step 1e-3", 10.0, {0.0}, stiff, Solver_if::OdeMethod::RungeKutta4, 1e-3, exact, 1e-6);
+	solve("stiff DormandPrince45", 10.0, {0.0}, stiff, Solver_if::OdeMethod::DormandPrince45, 0.0, exact, 1e-6);
+	solve("stiff BDF2", 10.0, {0.0}, stiff, Solver_if::OdeMethod::BDF2, 0.0, exact, 1e-6);
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkSolver" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% quadrature (benchmarkSolver)" << std::endl;
+	quadrature();
+	std::cout << "%TEST_FINISHED% time=0 quadrature (benchmarkSolver)" << std::endl;
+
+	std::cout << "%TEST_STARTED% ode (benchmarkSolver)" << std::endl;
+	ode();
+	std::cout << "%TEST_FINISHED% time=0 ode (benchmarkSolver)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,100 @@
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "../kernel/simulator/Simulator.h"
+#include "../plugins/components/Create.h"
+#include "../plugins/data/Queue.h"
+
+/*
+ * Benchmark of starting simulators. Measures constructing many short lived simulators and inserting their plugins, and compares with
+ * completing fields and templates of every plugin at once, as inserting plugins used to do. Then checks that plugins inserted again are
+ * not duplicated, and that fields and templates are completed when first used, without changing the names given to elements of models.
+ */
+
+void fail(std::string test, std::string message) {
+	std::cout << "%TEST_FAILED% time=0 testname=" << test << " (benchmarkStartup) message=" << message << std::endl;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point begin) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+struct Scenario {
+	Simulator* genesys;
+	double constructionSeconds, insertionSeconds;
+
+	Scenario() {
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		genesys = new Simulator();
+		constructionSeconds = secondsSince(begin);
+		genesys->getTraceManager()->setTraceLevel(TraceManager::Level::L1_errorFatal);
+		begin = std::chrono::steady_clock::now();
+		genesys->getPluginManager()->autoInsertPlugins("autoloadplugins.txt");
+		insertionSeconds = secondsSince(begin);
+	}
+
+	~Scenario() {
+		delete genesys;
+	}
+};
+
+void startup(unsigned int simulators) {
+	double construction = 0.0, insertion = 0.0, completion = 0.0;
+	unsigned int plugins = 0;
+	for (unsigned int i = 0; i < simulators; i++) {
+		Scenario scenario;
+		construction += scenario.constructionSeconds;
+		insertion += scenario.insertionSeconds;
+		plugins = scenario.genesys->getPluginManager()->size();
+		if (i % 10 == 0) {
+			const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+			scenario.genesys->getPluginManager()->completePluginsFieldsAndTemplates();
+			completion += secondsSince(begin) * 10;
+		}
+	}
+	std::cout << simulators << " simulators constructed in " << construction << " seconds, and " << plugins << " plugins inserted into each in "
+			<< insertion << " seconds. Completing their fields and templates, as inserting them used to do, would take " << completion
+			<< " seconds more" << std::endl;
+	if (plugins < 50) {
+		fail("startup", "only " + std::to_string(plugins) + " plugins were inserted");
+	}
+}
+
+void lazyInformation() {
+	Scenario scenario;
+	PluginManager* plugins = scenario.genesys->getPluginManager();
+	const unsigned int size = plugins->size();
+	Plugin* queuePlugin = plugins->find(Util::TypeOf<Queue>());
+	if (queuePlugin == nullptr || plugins->insert("queue.so") != queuePlugin || plugins->insert("create.so") != plugins->find(Util::TypeOf<Create>())
+			|| plugins->size() != size || plugins->insert("nonexistent.so") != nullptr) {
+		fail("lazyInformation", "plugins inserted again are not those already inserted");
+	}
+	Model* model = scenario.genesys->getModelManager()->newModel();
+	Queue* before = plugins->newInstance<Queue>(model);
+	PluginInformation* createInfo = plugins->find(Util::TypeOf<Create>())->getPluginInfo();
+	if (createInfo->getFields()->size() == 0 || createInfo->getLanguageTemplate().find(Util::TypeOf<Create>()) == std::string::npos
+			|| queuePlugin->getPluginInfo()->getFields()->size() == 0) {
+		fail("lazyInformation", "fields and template of plugins are not completed when first used");
+	}
+	Queue* after = plugins->newInstance<Queue>(model);
+	if (before->getName() != "Queue_1" || after->getName() != "Queue_2" || after->getId() <= before->getId()) {
+		fail("lazyInformation", "elements created after completing plugins are named " + before->getName() + " and " + after->getName());
+	}
+}
+
+int main(int argc, char** argv) {
+	std::cout << "%SUITE_STARTING% benchmarkStartup" << std::endl;
+	std::cout << "%SUITE_STARTED%" << std::endl;
+
+	std::cout << "%TEST_STARTED% startup (benchmarkStartup)" << std::endl;
+	startup(200);
+	std::cout << "%TEST_FINISHED% time=0 startup (benchmarkStartup)" << std::endl;
+
+	std::cout << "%TEST_STARTED% lazyInformation (benchmarkStartup)" << std::endl;
+	lazyInformation();
+	std::cout << "%TEST_FINISHED% time=0 lazyInformation (benchmarkStartup)" << std::endl;
+
+	std::cout << "%SUITE_FINISHED% time=0" << std::endl;
+	return (EXIT_SUCCESS);
+}
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <tuple>
 #include "FactorialDesign.h"
+#include "../ProbabilityDistribution.h"
 
 /**
  * @brief Checks the feasibility of the factorial design.
@@ -192,7 +193,7 @@ void FactorialDesign::createSignTable() {
         }
 
         // Retrieve the results for the current experiment
-        std::vector<int> results;
+        std::vector<double> results;
         for (int j = 0; j < r; ++j)
             results.push_back(resultsMatrix[j][i]);
 
@@ -241,9 +242,12 @@ void FactorialDesign::showSignTable() {
         for (int input : inputCombination)
             std::cout << center(std::to_string(input)) << " ";
         // Display results of all replications
-        const std::vector<int>& results = std::get<2>(row);
-        for (int result : results)
-            std::cout << center(std::to_string(result)) << " ";
+        const std::vector<double>& results = std::get<2>(row);
+        for (double result : results) {
+            std::stringstream rs;
+            rs << result;
+            std::cout << center(rs.str()) << " ";
+        }
         // Display mean of results rounded to two decimal places
         std::stringstream ss;
         ss << std::fixed << std::setprecision(2) << std::get<3>(row);
@@ -285,7 +289,7 @@ void FactorialDesign::calculateStatistics() {
             squareSumError += pow(resultsMatrix[i][j] - resultsMean[j], 2);
 
     // Calculate the square sum total by summing square sums and square sum of errors
-    squareSumTotal = std::accumulate(squareSums.begin(), squareSums.end(), 0);
+    squareSumTotal = std::accumulate(squareSums.begin(), squareSums.end(), 0.0);
     squareSumTotal += squareSumError;
 
     // Calculate variations for each factor and interaction
@@ -342,6 +346,76 @@ void FactorialDesign::showImpacts() {
     std::cout << "Impact of experimental error: " << errorVariation << "%" << std::endl << std::endl;
 }
 
+/**
+ * @brief Calculates confidence intervals for the effects of factors and interactions.
+ *
+ * This method estimates the standard deviation of the experimental error from the
+ * replications (se^2 = SSE / (2^(k-p) * (r-1))), and the standard deviation of each
+ * effect as sq = se / sqrt(2^(k-p) * r). The half width of the confidence interval of
+ * each effect is t[1-alpha/2; 2^(k-p)*(r-1)] * sq. An effect whose confidence interval
+ * includes zero is not statistically significant. At least two replications are needed;
+ * otherwise the half widths are NaN.
+ *
+ * The resulting half widths are stored in the 'effectHalfWidths' member variable,
+ * in the same order as 'effectAverages'.
+ *
+ * @param confidenceLevel The confidence level of the intervals (e.g. 0.95).
+ */
+void FactorialDesign::calculateConfidenceIntervals(double confidenceLevel) {
+    this->confidenceLevel = confidenceLevel;
+    effectHalfWidths.assign(NUM_ROWS, std::nan(""));
+    if (r < 2)
+        return;
+    int degreesOfFreedom = NUM_ROWS * (r - 1);
+    double errorStddev = std::sqrt(squareSumError / degreesOfFreedom);
+    double effectStddev = errorStddev / std::sqrt(NUM_ROWS * r);
+    double t = ProbabilityDistribution::inverseTStudent(1.0 - (1.0 - confidenceLevel) / 2.0, 0.0, 1.0, degreesOfFreedom);
+    for (int i = 0; i < NUM_ROWS; ++i)
+        effectHalfWidths[i] = t * effectStddev;
+}
+
+/**
+ * @brief Returns the levels of all k factors for an experiment.
+ *
+ * The first k-p factors follow the binary pattern of the inputs, while the level of
+ * each confounded factor is the product of the levels of the factors it is aliased to
+ * (see createColumnLabels). A high level is represented by '1' and a low level by '-1'.
+ *
+ * @param experiment The index of the experiment (0 to 2^(k-p)-1).
+ * @return A vector with the levels of the k factors.
+ */
+std::vector<int> FactorialDesign::getFactorLevels(int experiment) const {
+    std::vector<int> levels(inputs[experiment]);
+    for (int j = 0; j < p; ++j) {
+        int product = 1;
+        for (int index : indexCombinations[NUM_FACTORS + j])
+            product *= inputs[experiment][index];
+        levels.push_back(product);
+    }
+    return levels;
+}
+
+/**
+ * @brief Displays the effects of factors and interactions with their confidence intervals.
+ *
+ * This method prints the average effect of each factor and interaction, the confidence
+ * interval calculated by calculateConfidenceIntervals, and whether the effect is
+ * statistically significant (its confidence interval does not include zero).
+ */
+void FactorialDesign::showEffects() {
+    for (int i = 0; i < NUM_ROWS; ++i) {
+        std::cout << "Effect of " << columnLabels[i+1] << ": " << effectAverages[i];
+        if (i < static_cast<int>(effectHalfWidths.size()) && !std::isnan(effectHalfWidths[i])) {
+            double low = effectAverages[i] - effectHalfWidths[i];
+            double high = effectAverages[i] + effectHalfWidths[i];
+            std::cout << " +- " << effectHalfWidths[i] << " (" << confidenceLevel * 100.0 << "% CI [" << low << ", " << high << "]"
+                      << ((low > 0.0 || high < 0.0) ? ", significant)" : ", not significant)");
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
 /**
  * @brief Displays the linear regression model.
  *
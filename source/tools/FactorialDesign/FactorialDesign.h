@@ -16,7 +16,7 @@ public:
     int NUM_ROWS;  // Number of rows in the sign table
 
     // Storage of experimental results
-    std::vector<std::vector<int>> resultsMatrix; 
+    std::vector<std::vector<double>> resultsMatrix; // resultsMatrix[replication][experiment]
 
     // Constructor and main methods
     FactorialDesign(int k, int p, int r);
@@ -27,9 +27,12 @@ public:
     void calculateResultsMean();
     void createSignTable();
     void calculateStatistics();
+    void calculateConfidenceIntervals(double confidenceLevel);
+    std::vector<int> getFactorLevels(int experiment) const;
     double linearRegression(const std::vector<int>& xs);
     void showSignTable();
     void showImpacts();
+    void showEffects();
     void showLinearRegressionModel();
     void showResiduals();
 
@@ -50,7 +53,7 @@ public:
         return resultsMean;
     }
 
-    const std::vector<std::tuple<int, std::vector<int>, std::vector<int>, double>>& getSignTable() const {
+    const std::vector<std::tuple<int, std::vector<int>, std::vector<double>, double>>& getSignTable() const {
         return signTable;
     }
 
@@ -62,7 +65,7 @@ public:
         return effectAverages;
     }
 
-    const std::vector<int>& getSquareSums() const {
+    const std::vector<double>& getSquareSums() const {
         return squareSums;
     }
 
@@ -82,8 +85,16 @@ public:
         return errorVariation;
     }
 
+    const std::vector<double>& getEffectHalfWidths() const {
+        return effectHalfWidths;
+    }
+
+    double getConfidenceLevel() const {
+        return confidenceLevel;
+    }
+
     // Setters
-    void setResultsMatrix(const std::vector<std::vector<int>>& matrix) {
+    void setResultsMatrix(const std::vector<std::vector<double>>& matrix) {
         resultsMatrix = matrix;
     }
 
@@ -94,14 +105,16 @@ private:
     std::vector<std::string> columnLabels;
     std::vector<std::vector<int>> inputs;
     std::vector<double> resultsMean;
-    std::vector<std::tuple<int, std::vector<int>, std::vector<int>, double>> signTable;
+    std::vector<std::tuple<int, std::vector<int>, std::vector<double>, double>> signTable;
     std::vector<double> effectSums;
     std::vector<double> effectAverages;
-    std::vector<int> squareSums;
+    std::vector<double> squareSums;
     double squareSumTotal;
     std::vector<double> factorVariations;
     double squareSumError;
     double errorVariation;
+    std::vector<double> effectHalfWidths;
+    double confidenceLevel = 0.0;
 
     // Helper method
     std::vector<std::vector<int>> generateCombinations(const std::vector<int>& elements, int length);
@@ -0,0 +1,132 @@
+#include "FactorialDesignExperiment.h"
+#include <iostream>
+
+FactorialDesignExperiment::FactorialDesignExperiment(Simulator* simulator, std::string modelFilename, std::string responseName, unsigned int replications, unsigned int p) {
+	_simulator = simulator;
+	_modelFilename = modelFilename;
+	_responseName = responseName;
+	_replications = replications;
+	_p = p;
+	_experimentManager = new ExperimentManagerDefaultImpl1(simulator);
+}
+
+FactorialDesignExperiment::~FactorialDesignExperiment() {
+	_clear();
+	delete _experimentManager;
+}
+
+void FactorialDesignExperiment::addFactor(std::string controlName, double lowLevel, double highLevel) {
+	_factors.push_back({controlName, lowLevel, highLevel});
+}
+
+bool FactorialDesignExperiment::startExperiment(std::string* errorMessage) {
+	*errorMessage = "";
+	_clear();
+	const int k = _factors.size();
+	if (k == 0 || static_cast<int> (_p) >= k) {
+		*errorMessage = "The design needs more factors (" + std::to_string(k) + ") than the size of the fraction (" + std::to_string(_p) + ")";
+		return false;
+	}
+	if (_replications == 0) {
+		*errorMessage = "At least one replication is needed";
+		return false;
+	}
+	_design = new FactorialDesign(k, _p, _replications);
+	if (!_design->checkFeasibility()) {
+		*errorMessage = "A 2^(" + std::to_string(k) + "-" + std::to_string(_p) + ") design is not feasible";
+		return false;
+	}
+	_design->generateIndexCombinations();
+	_design->createColumnLabels();
+	_design->generateInputs();
+	// one scenario for each experiment
+	for (int row = 0; row < _design->NUM_ROWS; ++row) {
+		SimulationScenario* scenario = new SimulationScenario();
+		scenario->setScenarioName("Experiment " + std::to_string(row + 1));
+		scenario->setModelFilename(_modelFilename);
+		std::vector<int> levels = _design->getFactorLevels(row);
+		for (int j = 0; j < k; ++j) {
+			const Factor& factor = _factors[j];
+			scenario->setControl(factor.controlName, levels[j] > 0 ? factor.highLevel : factor.lowLevel);
+		}
+		scenario->setControl("ModelSimulation.NumberOfReplications", _replications);
+		scenario->getSelectedResponses()->push_back(_responseName);
+		_experimentManager->getScenarios()->insert(scenario);
+	}
+	_experimentManager->startExperiment();
+	// fill the results matrix with the response at the end of each replication
+	std::vector<std::vector<double>> results(_replications, std::vector<double>(_design->NUM_ROWS));
+	int row = 0;
+	for (SimulationScenario* scenario : *_experimentManager->getScenarios()->list()) {
+		std::list<std::pair<std::string, double>*>* values = scenario->getReplicationResponseValues();
+		if (values->size() != _replications) {
+			*errorMessage = "Scenario \"" + scenario->getScenarioName() + "\" returned " + std::to_string(values->size()) + " of " + std::to_string(_replications) + " values of response \"" + _responseName + "\"";
+			return false;
+		}
+		unsigned int rep = 0;
+		for (std::pair<std::string, double>* value : *values) {
+			results[rep++][row] = value->second;
+		}
+		row++;
+	}
+	_design->setResultsMatrix(results);
+	_design->calculateResultsMean();
+	_design->createSignTable();
+	_design->calculateStatistics();
+	_design->calculateConfidenceIntervals(_confidenceLevel);
+	return true;
+}
+
+void FactorialDesignExperiment::showResults() {
+	if (_design == nullptr) {
+		return;
+	}
+	std::cout << "Factors:" << std::endl;
+	for (unsigned int j = 0; j < _factors.size(); ++j) {
+		std::cout << " F" << j + 1 << " = " << _factors[j].controlName << " (low " << _factors[j].lowLevel << ", high " << _factors[j].highLevel << ")" << std::endl;
+	}
+	std::cout << "Response: " << _responseName << std::endl << std::endl;
+	_design->showSignTable();
+	_design->showEffects();
+	_design->showImpacts();
+	_design->showLinearRegressionModel();
+}
+
+void FactorialDesignExperiment::setConfidenceLevel(double confidenceLevel) {
+	_confidenceLevel = confidenceLevel;
+}
+
+double FactorialDesignExperiment::getConfidenceLevel() const {
+	return _confidenceLevel;
+}
+
+void FactorialDesignExperiment::setMaxParallelScenarios(unsigned int maxParallelScenarios) {
+	_experimentManager->setMaxParallelScenarios(maxParallelScenarios);
+}
+
+void FactorialDesignExperiment::addTraceSimulationHandler(traceSimulationProcessListener traceSimulationProcessListener) {
+	_experimentManager->addTraceSimulationHandler(traceSimulationProcessListener);
+}
+
+const std::vector<FactorialDesignExperiment::Factor>& FactorialDesignExperiment::getFactors() const {
+	return _factors;
+}
+
+FactorialDesign* FactorialDesignExperiment::getDesign() const {
+	return _design;
+}
+
+List<SimulationScenario*>* FactorialDesignExperiment::getScenarios() const {
+	return _experimentManager->getScenarios();
+}
+
+void FactorialDesignExperiment::_clear() {
+	for (SimulationScenario* scenario : *_experimentManager->getScenarios()->list()) {
+		delete scenario;
+	}
+	_experimentManager->getScenarios()->clear();
+	if (_design != nullptr) {
+		delete _design;
+		_design = nullptr;
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef FACTORIALDESIGNEXPERIMENT_H
+#define FACTORIALDESIGNEXPERIMENT_H
+
+#include <string>
+#include <vector>
+#include "FactorialDesign.h"
+#include "../../kernel/simulator/ExperimentManagerDefaultImpl1.h"
+
+/*!
+ * Runs a 2^(k-p) fractional factorial design of experiments on a model. Each factor is a SimulationControl of the model
+ * ("ElementName.PropertyName") with a low and a high level. One SimulationScenario is created for each experiment (row of the
+ * sign table) and all of them are simulated in parallel by ExperimentManagerDefaultImpl1. Each scenario simulates r replications,
+ * and the value of the response at the end of each replication fills the resultsMatrix of the FactorialDesign, which then
+ * calculates the effects of factors and interactions with their confidence intervals.
+ */
+class FactorialDesignExperiment {
+public:
+	struct Factor {
+		std::string controlName;
+		double lowLevel;
+		double highLevel;
+	};
+public:
+	FactorialDesignExperiment(Simulator* simulator, std::string modelFilename, std::string responseName, unsigned int replications, unsigned int p = 0);
+	virtual ~FactorialDesignExperiment();
+public:
+	void addFactor(std::string controlName, double lowLevel, double highLevel); //!< Factors beyond the first k-p ones are confounded (aliased) with interactions
+	bool startExperiment(std::string* errorMessage); //!< Generates the design, simulates all experiments and replications and calculates the effects
+	void showResults(); //!< Shows the sign table, effects with their confidence intervals, impacts and the regression model
+public:
+	void setConfidenceLevel(double confidenceLevel);
+	double getConfidenceLevel() const;
+	void setMaxParallelScenarios(unsigned int maxParallelScenarios); //!< 0 means the number of hardware threads
+	void addTraceSimulationHandler(traceSimulationProcessListener traceSimulationProcessListener);
+	const std::vector<Factor>& getFactors() const;
+	FactorialDesign* getDesign() const; //!< Available after startExperiment
+	List<SimulationScenario*>* getScenarios() const; //!< One scenario for each experiment of the design
+private:
+	void _clear();
+private:
+	Simulator* _simulator;
+	std::string _modelFilename;
+	std::string _responseName;
+	unsigned int _replications;
+	unsigned int _p;
+	double _confidenceLevel = 0.95;
+	std::vector<Factor> _factors;
+	FactorialDesign* _design = nullptr;
+	ExperimentManagerDefaultImpl1* _experimentManager;
+};
+
+#endif /* FACTORIALDESIGNEXPERIMENT_H */
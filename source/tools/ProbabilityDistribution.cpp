@@ -12,171 +12,370 @@
 
 #include "ProbabilityDistribution.h"
 #include <cmath>
-#include <cassert>
-#include "TraitsTools.h"
+#include <limits>
+#include <algorithm>
 
-std::map<std::string, double>* ProbabilityDistribution::memory = new std::map<std::string, double>();
-Solver_if* ProbabilityDistribution::integrator = new TraitsTools<Solver_if>::Implementation(TraitsTools<Solver_if>::Precision, TraitsTools<Solver_if>::MaxSteps);
+std::map<ProbabilityDistribution::MemoryKey, std::pair<double, ProbabilityDistribution::MemoryUses::iterator>>* ProbabilityDistribution::memory = new std::map<ProbabilityDistribution::MemoryKey, std::pair<double, ProbabilityDistribution::MemoryUses::iterator>>();
+ProbabilityDistribution::MemoryUses* ProbabilityDistribution::memoryUses = new ProbabilityDistribution::MemoryUses();
+std::mutex ProbabilityDistribution::memoryMutex;
+
+namespace {
+	const double Epsilon = std::numeric_limits<double>::epsilon();
+	const double FloatingPointMin = std::numeric_limits<double>::min() / Epsilon;
+	const unsigned int MaxIterations = 10000;
+}
 
 double ProbabilityDistribution::inverseFFisherSnedecor(double cumulativeProbability, double d1, double d2) {
-	std::string key = "fisher(" + std::to_string(d1) + "," + std::to_string(d2) + ")" + std::to_string(cumulativeProbability);
-	auto search = ProbabilityDistribution::memory->find(key);
-	if (search != ProbabilityDistribution::memory->end()) { //found
-		return search->second;
-	} else {
-		double a, fa;
-		double b, fb;
-		a = 0.0;
-		fa = 0.0;
-		b = 10000.0; ///@TODO: Is there a way to better determine the upper limit?
-		unsigned int savedSteps = integrator->getMaxSteps();
-		integrator->setMaxSteps(1e4);
-		fb = integrator->integrate(a, b, ProbabilityDistributionBase::fisherSnedecor, d1, d2);
-		//integrator->setMaxSteps(1e3);
-		double inv = ProbabilityDistribution::_findInverseFFisherSnedecor(a, fa, b, fb, 0, cumulativeProbability, d1, d2);
-		integrator->setMaxSteps(savedSteps);
-		std::pair<std::string, double> pair = std::pair<std::string, double>(key, inv);
-		ProbabilityDistribution::memory->insert(pair);
+	MemoryKey key('F', cumulativeProbability, d1, d2);
+	double inv;
+	if (_recall(key, &inv)) {
 		return inv;
 	}
+	if (cumulativeProbability <= 0.0) {
+		inv = 0.0;
+	} else if (cumulativeProbability >= 1.0) {
+		inv = std::numeric_limits<double>::infinity();
+	} else {
+		double x = _inverseRegularizedIncompleteBeta(cumulativeProbability, d1 / 2.0, d2 / 2.0);
+		inv = d2 * x / (d1 * (1.0 - x));
+	}
+	return _remember(key, inv);
 }
 
 double ProbabilityDistribution::inverseChi2(double cumulativeProbability, double m) {
-	std::string key = "chi2(" + std::to_string(m) + ")" + std::to_string(cumulativeProbability);
-	auto search = ProbabilityDistribution::memory->find(key);
-	if (search != ProbabilityDistribution::memory->end()) { //found
-		return search->second;
-	} else {
-		double a, fa;
-		double b, fb;
-		a = 0.0;
-		fa = 0.0;
-		b = 1000.0; ///@TODO: Is there a way to better determine the upper limit?
-		unsigned int savedSteps = integrator->getMaxSteps();
-		integrator->setMaxSteps(1e3);
-		fb = integrator->integrate(a, b, ProbabilityDistributionBase::chi2, m);
-		//integrator->setMaxSteps(1e3);
-		double inv = ProbabilityDistribution::_findInverseChi2(a, fa, b, fb, 0, cumulativeProbability, m);
-		integrator->setMaxSteps(savedSteps);
-		std::pair<std::string, double> pair = std::pair<std::string, double>(key, inv);
-		ProbabilityDistribution::memory->insert(pair);
+	MemoryKey key('C', cumulativeProbability, m, 0.0);
+	double inv;
+	if (_recall(key, &inv)) {
 		return inv;
 	}
+	if (cumulativeProbability <= 0.0) {
+		inv = 0.0;
+	} else if (cumulativeProbability >= 1.0) {
+		inv = std::numeric_limits<double>::infinity();
+	} else {
+		inv = 2.0 * _inverseRegularizedIncompleteGamma(cumulativeProbability, m / 2.0);
+	}
+	return _remember(key, inv);
 }
 
+/*!
+ * Normal quantiles are cheap enough not to be cached.
+ */
 double ProbabilityDistribution::inverseNormal(double cumulativeProbability, double mean, double stddev) {
-	std::string key = "normal(" + std::to_string(mean) + "," + std::to_string(stddev) + ")" + std::to_string(cumulativeProbability);
-	auto search = ProbabilityDistribution::memory->find(key);
-	if (search != ProbabilityDistribution::memory->end()) { //found
-		return search->second;
-	} else {
-		double a, fa;
-		double b, fb;
-		if (cumulativeProbability <= 0.5) { ///@TODO: Could be better (separate into 1,2,3xstddev)
-			a = mean - stddev * 5.0;
-			fa = 0.0;
-			b = mean;
-			fb = 0.5;
-		} else {
-			a = mean;
-			fa = 0.5;
-			b = mean + stddev * 5.0;
-			fb = 1.0;
-		}
-		double inv = ProbabilityDistribution::_findInverseNormal(a, fa, b, fb, 0, cumulativeProbability, mean, stddev);
-		std::pair<std::string, double> pair = std::pair<std::string, double>(key, inv);
-		ProbabilityDistribution::memory->insert(pair);
-		return inv;
-	}
+	return mean + stddev * _inverseStandardNormal(cumulativeProbability);
 }
 
 double ProbabilityDistribution::inverseTStudent(double cumulativeProbability, double mean, double stddev, double degreeFreedom) {
-	std::string key = "tstudent(" + std::to_string(mean) + "," + std::to_string(stddev) + "," + std::to_string(degreeFreedom) + ")" + std::to_string(cumulativeProbability);
-	auto search = ProbabilityDistribution::memory->find(key);
-	if (search != ProbabilityDistribution::memory->end()) { //found
-		return search->second;
-	} else {
-		double a, fa;
-		double b, fb;
-		double inv;
-		if (cumulativeProbability <= 0.5) { ///@TODO: Could be better
-			a = mean - stddev * 5.0;
-			fa = 0.0;
-			b = mean;
-			fb = 0.5;
+	MemoryKey key('T', cumulativeProbability, degreeFreedom, 0.0);
+	double inv;
+	if (!_recall(key, &inv)) {
+		if (cumulativeProbability <= 0.0) {
+			inv = -std::numeric_limits<double>::infinity();
+		} else if (cumulativeProbability >= 1.0) {
+			inv = std::numeric_limits<double>::infinity();
+		} else if (cumulativeProbability == 0.5) {
+			inv = 0.0;
 		} else {
-			a = mean;
-			fa = 0.5;
-			b = mean + stddev * 5.0;
-			fb = 1.0;
-		}
-		if (degreeFreedom <= 341) {// threshold based on numeric tests for the gamma function to provide valid (not NaN) results
-			inv = ProbabilityDistribution::_findInverseTStudent(a, fa, b, fb, 0, cumulativeProbability, mean, stddev, degreeFreedom);
-			if (inv != inv) { // is NaN
-				inv = ProbabilityDistribution::_findInverseNormal(a, fa, b, fb, 0, cumulativeProbability, mean, stddev);
+			// P(|T| > t) = I_{v/(v+t^2)}(v/2, 1/2)
+			double tail = cumulativeProbability < 0.5 ? cumulativeProbability : 1.0 - cumulativeProbability;
+			double x = _inverseRegularizedIncompleteBeta(2.0 * tail, degreeFreedom / 2.0, 0.5);
+			inv = std::sqrt(degreeFreedom * (1.0 - x) / x);
+			if (cumulativeProbability < 0.5) {
+				inv = -inv;
 			}
-		} else {
-			inv = ProbabilityDistribution::_findInverseNormal(a, fa, b, fb, 0, cumulativeProbability, mean, stddev);
 		}
-		std::pair<std::string, double> pair = std::pair<std::string, double>(key, inv);
-		ProbabilityDistribution::memory->insert(pair);
-		return inv;
+		_remember(key, inv);
+	}
+	return mean + stddev * inv;
+}
+
+double ProbabilityDistribution::cumulativeChi2(double x, double degreeFreedom) {
+	if (x <= 0.0) {
+		return 0.0;
+	}
+	return _regularizedIncompleteGamma(degreeFreedom / 2.0, x / 2.0);
+}
+
+double ProbabilityDistribution::cumulativeFFisherSnedecor(double x, double d1, double d2) {
+	if (x <= 0.0) {
+		return 0.0;
 	}
+	return _regularizedIncompleteBeta(d1 / 2.0, d2 / 2.0, d1 * x / (d1 * x + d2));
+}
+
+double ProbabilityDistribution::cumulativeNormal(double x, double mean, double stddev) {
+	return 0.5 * std::erfc(-(x - mean) / (stddev * M_SQRT2));
+}
+
+double ProbabilityDistribution::cumulativeTStudent(double x, double mean, double stddev, double degreeFreedom) {
+	double t = (x - mean) / stddev;
+	double tail = 0.5 * _regularizedIncompleteBeta(degreeFreedom / 2.0, 0.5, degreeFreedom / (degreeFreedom + t * t));
+	return t > 0.0 ? 1.0 - tail : tail;
 }
 
 //************************
 
-double ProbabilityDistribution::_findInverseFFisherSnedecor(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double d1, double d2) {
-	double x = ((cumulativeProbability - fa) / (fb - fa)) * (b - a) + a;
-	double fx = fa + integrator->integrate(a, x, ProbabilityDistributionBase::fisherSnedecor, d1, d2);
-	++recursions;
-	if ((recursions == integrator->getMaxSteps()) || (abs(fx - cumulativeProbability) <= integrator->getPrecision())) {
-		return x;
-	} else if (fx < cumulativeProbability) {
-		return ProbabilityDistribution::_findInverseFFisherSnedecor(x, fx, b, fb, recursions, cumulativeProbability, d1, d2);
-	} else {
-		return ProbabilityDistribution::_findInverseFFisherSnedecor(a, fa, x, fx, recursions, cumulativeProbability, d1, d2);
+bool ProbabilityDistribution::_recall(const MemoryKey& key, double* value) {
+	std::lock_guard<std::mutex> lock(memoryMutex);
+	auto search = memory->find(key);
+	if (search == memory->end()) {
+		return false;
+	}
+	memoryUses->splice(memoryUses->begin(), *memoryUses, search->second.second); // now the most recently used
+	*value = search->second.first;
+	return true;
+}
+
+double ProbabilityDistribution::_remember(const MemoryKey& key, double value) {
+	std::lock_guard<std::mutex> lock(memoryMutex);
+	if (memory->find(key) != memory->end()) { // remembered by another thread meanwhile
+		return value;
 	}
+	if (memory->size() >= memoryCapacity) {
+		memory->erase(memoryUses->back());
+		memoryUses->pop_back();
+	}
+	memoryUses->push_front(key);
+	memory->insert({key, {value, memoryUses->begin()}});
+	return value;
 }
 
-double ProbabilityDistribution::_findInverseNormal(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double mean, double stddev) {
-	double x = ((cumulativeProbability - fa) / (fb - fa)) * (b - a) + a;
-	double fx = fa + integrator->integrate(a, x, ProbabilityDistributionBase::normal, mean, stddev);
-	++recursions;
-	if ((recursions == integrator->getMaxSteps()) || (abs(fx - cumulativeProbability) <= integrator->getPrecision())) {
-		return x;
-	} else if (fx < cumulativeProbability) {
-		return ProbabilityDistribution::_findInverseNormal(x, fx, b, fb, recursions, cumulativeProbability, mean, stddev);
+/*!
+ * Acklam's rational approximation (relative error below 1.15e-9), refined by one step of Halley's method using erfc, which gives
+ * full double precision.
+ */
+double ProbabilityDistribution::_inverseStandardNormal(double p) {
+	static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+	static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01};
+	static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+	static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+	const double pLow = 0.02425;
+	if (p <= 0.0) {
+		return -std::numeric_limits<double>::infinity();
+	}
+	if (p >= 1.0) {
+		return std::numeric_limits<double>::infinity();
+	}
+	double q, r, x;
+	if (p < pLow) {
+		q = std::sqrt(-2.0 * std::log(p));
+		x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+	} else if (p <= 1.0 - pLow) {
+		q = p - 0.5;
+		r = q * q;
+		x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
 	} else {
-		return ProbabilityDistribution::_findInverseNormal(a, fa, x, fx, recursions, cumulativeProbability, mean, stddev);
+		q = std::sqrt(-2.0 * std::log(1.0 - p));
+		x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+	}
+	double e = 0.5 * std::erfc(-x / M_SQRT2) - p;
+	double u = e * std::sqrt(2.0 * M_PI) * std::exp(x * x / 2.0);
+	return x - u / (1.0 + x * u / 2.0);
+}
+
+/*!
+ * Regularized lower incomplete gamma function P(a,x), by its series when x < a+1 and by the continued fraction of Q(a,x) otherwise.
+ */
+double ProbabilityDistribution::_regularizedIncompleteGamma(double a, double x) {
+	if (x <= 0.0) {
+		return 0.0;
+	}
+	double logFactor = -x + a * std::log(x) - std::lgamma(a);
+	if (x < a + 1.0) {
+		double ap = a, del = 1.0 / a, sum = del;
+		for (unsigned int n = 0; n < MaxIterations; n++) {
+			ap += 1.0;
+			del *= x / ap;
+			sum += del;
+			if (std::abs(del) < std::abs(sum) * Epsilon) {
+				break;
+			}
+		}
+		return sum * std::exp(logFactor);
+	}
+	// modified Lentz's method
+	double b = x + 1.0 - a, c = 1.0 / FloatingPointMin, d = 1.0 / b, h = d;
+	for (unsigned int i = 1; i < MaxIterations; i++) {
+		double an = -(i * (i - a));
+		b += 2.0;
+		d = an * d + b;
+		if (std::abs(d) < FloatingPointMin) {
+			d = FloatingPointMin;
+		}
+		c = b + an / c;
+		if (std::abs(c) < FloatingPointMin) {
+			c = FloatingPointMin;
+		}
+		d = 1.0 / d;
+		double del = d * c;
+		h *= del;
+		if (std::abs(del - 1.0) <= Epsilon) {
+			break;
+		}
+	}
+	return 1.0 - std::exp(logFactor) * h;
+}
+
+/*!
+ * Regularized incomplete beta function I_x(a,b), by its continued fraction, using the symmetry I_x(a,b) = 1 - I_{1-x}(b,a) to
+ * keep the fraction converging fast.
+ */
+double ProbabilityDistribution::_regularizedIncompleteBeta(double a, double b, double x) {
+	if (x <= 0.0) {
+		return 0.0;
+	}
+	if (x >= 1.0) {
+		return 1.0;
 	}
+	double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1.0 - x));
+	if (x < (a + 1.0) / (a + b + 2.0)) {
+		return front * _incompleteBetaContinuedFraction(a, b, x) / a;
+	}
+	return 1.0 - front * _incompleteBetaContinuedFraction(b, a, 1.0 - x) / b;
 }
 
-double ProbabilityDistribution::_findInverseTStudent(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double mean, double stddev, double degreeFreedom) {
-	double x = ((cumulativeProbability - fa) / (fb - fa)) * (b - a) + a;
-	double fx = fa + integrator->integrate(a, x, ProbabilityDistributionBase::tStudent, mean, stddev, degreeFreedom);
-	if (fx != fx) { // check if NaN
-		return fx;
+double ProbabilityDistribution::_incompleteBetaContinuedFraction(double a, double b, double x) {
+	double qab = a + b, qap = a + 1.0, qam = a - 1.0;
+	double c = 1.0, d = 1.0 - qab * x / qap;
+	if (std::abs(d) < FloatingPointMin) {
+		d = FloatingPointMin;
+	}
+	d = 1.0 / d;
+	double h = d;
+	for (unsigned int m = 1; m < MaxIterations; m++) {
+		double m2 = 2.0 * m;
+		double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+		d = 1.0 + aa * d;
+		if (std::abs(d) < FloatingPointMin) {
+			d = FloatingPointMin;
+		}
+		c = 1.0 + aa / c;
+		if (std::abs(c) < FloatingPointMin) {
+			c = FloatingPointMin;
+		}
+		d = 1.0 / d;
+		h *= d * c;
+		aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+		d = 1.0 + aa * d;
+		if (std::abs(d) < FloatingPointMin) {
+			d = FloatingPointMin;
+		}
+		c = 1.0 + aa / c;
+		if (std::abs(c) < FloatingPointMin) {
+			c = FloatingPointMin;
+		}
+		d = 1.0 / d;
+		double del = d * c;
+		h *= del;
+		if (std::abs(del - 1.0) <= Epsilon) {
+			break;
+		}
 	}
-	++recursions;
-	if ((recursions == integrator->getMaxSteps()) || (abs(fx - cumulativeProbability) <= integrator->getPrecision())) {
-		return x;
-	} else if (fx < cumulativeProbability) {
-		return ProbabilityDistribution::_findInverseTStudent(x, fx, b, fb, recursions, cumulativeProbability, mean, stddev, degreeFreedom);
+	return h;
+}
+
+/*!
+ * Finds x such that P(a,x) = p by Halley's method, starting from the Wilson-Hilferty approximation (a > 1) or from the behaviour
+ * of P near zero and infinity (a <= 1).
+ */
+double ProbabilityDistribution::_inverseRegularizedIncompleteGamma(double p, double a) {
+	const double a1 = a - 1.0, gln = std::lgamma(a);
+	double x, t, lna1 = 0.0, afac = 0.0;
+	if (a > 1.0) {
+		lna1 = std::log(a1);
+		afac = std::exp(a1 * (lna1 - 1.0) - gln);
+		double pp = p < 0.5 ? p : 1.0 - p;
+		t = std::sqrt(-2.0 * std::log(pp));
+		x = (2.30753 + t * 0.27061) / (1.0 + t * (0.99229 + t * 0.04481)) - t;
+		if (p < 0.5) {
+			x = -x;
+		}
+		x = std::max(1e-3, a * std::pow(1.0 - 1.0 / (9.0 * a) - x / (3.0 * std::sqrt(a)), 3));
 	} else {
-		return ProbabilityDistribution::_findInverseTStudent(a, fa, x, fx, recursions, cumulativeProbability, mean, stddev, degreeFreedom);
+		t = 1.0 - a * (0.253 + a * 0.12);
+		if (p < t) {
+			x = std::pow(p / t, 1.0 / a);
+		} else {
+			x = 1.0 - std::log(1.0 - (p - t) / (1.0 - t));
+		}
+	}
+	for (unsigned int j = 0; j < 100; j++) {
+		if (x <= 0.0) {
+			return 0.0;
+		}
+		double err = _regularizedIncompleteGamma(a, x) - p;
+		if (a > 1.0) {
+			t = afac * std::exp(-(x - a1) + a1 * (std::log(x) - lna1));
+		} else {
+			t = std::exp(-x + a1 * std::log(x) - gln);
+		}
+		double u = err / t;
+		t = u / (1.0 - 0.5 * std::min(1.0, u * ((a - 1.0) / x - 1.0)));
+		x -= t;
+		if (x <= 0.0) {
+			x = 0.5 * (x + t);
+		}
+		if (std::abs(t) < 1e-12 * x) {
+			break;
+		}
 	}
+	return x;
 }
 
-double ProbabilityDistribution::_findInverseChi2(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double degreeFreedom) {
-	double x = ((cumulativeProbability - fa) / (fb - fa)) * (b - a) + a;
-	double fx = fa + integrator->integrate(a, x, ProbabilityDistributionBase::chi2, degreeFreedom);
-	++recursions;
-	if ((recursions == integrator->getMaxSteps()) || (abs(fx - cumulativeProbability) <= integrator->getPrecision())) {
-		return x;
-	} else if (fx < cumulativeProbability) {
-		return ProbabilityDistribution::_findInverseChi2(x, fx, b, fb, recursions, cumulativeProbability, degreeFreedom);
+/*!
+ * Finds x such that I_x(a,b) = p by Halley's method, starting from the approximations of Abramowitz and Stegun (26.5.22) when
+ * a,b >= 1, or from the behaviour of I near 0 and 1 otherwise.
+ */
+double ProbabilityDistribution::_inverseRegularizedIncompleteBeta(double p, double a, double b) {
+	if (p <= 0.0) {
+		return 0.0;
+	}
+	if (p >= 1.0) {
+		return 1.0;
+	}
+	const double a1 = a - 1.0, b1 = b - 1.0;
+	double x, t, u, w;
+	if (a >= 1.0 && b >= 1.0) {
+		double pp = p < 0.5 ? p : 1.0 - p;
+		t = std::sqrt(-2.0 * std::log(pp));
+		x = (2.30753 + t * 0.27061) / (1.0 + t * (0.99229 + t * 0.04481)) - t;
+		if (p < 0.5) {
+			x = -x;
+		}
+		double al = (x * x - 3.0) / 6.0;
+		double h = 2.0 / (1.0 / (2.0 * a - 1.0) + 1.0 / (2.0 * b - 1.0));
+		w = x * std::sqrt(al + h) / h - (1.0 / (2.0 * b - 1.0) - 1.0 / (2.0 * a - 1.0)) * (al + 5.0 / 6.0 - 2.0 / (3.0 * h));
+		x = a / (a + b * std::exp(2.0 * w));
 	} else {
-		return ProbabilityDistribution::_findInverseChi2(a, fa, x, fx, recursions, cumulativeProbability, degreeFreedom);
+		double lna = std::log(a / (a + b)), lnb = std::log(b / (a + b));
+		t = std::exp(a * lna) / a;
+		u = std::exp(b * lnb) / b;
+		w = t + u;
+		if (p < t / w) {
+			x = std::pow(a * w * p, 1.0 / a);
+		} else {
+			x = 1.0 - std::pow(b * w * (1.0 - p), 1.0 / b);
+		}
+	}
+	const double afac = -std::lgamma(a) - std::lgamma(b) + std::lgamma(a + b);
+	for (unsigned int j = 0; j < 100; j++) {
+		if (x == 0.0 || x == 1.0) {
+			return x;
+		}
+		double err = _regularizedIncompleteBeta(a, b, x) - p;
+		t = std::exp(a1 * std::log(x) + b1 * std::log(1.0 - x) + afac);
+		u = err / t;
+		t = u / (1.0 - 0.5 * std::min(1.0, u * (a1 / x - b1 / (1.0 - x))));
+		x -= t;
+		if (x <= 0.0) {
+			x = 0.5 * (x + t);
+		}
+		if (x >= 1.0) {
+			x = 0.5 * (x + t + 1.0);
+		}
+		if (std::abs(t) < 1e-12 * x && j > 0) {
+			break;
+		}
 	}
+	return x;
 }
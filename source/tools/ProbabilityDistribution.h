@@ -3,7 +3,7 @@
  * Click nbfs://nbhost/SystemFileSystem/Templates/cppFiles/class.h to edit this template
  */
 
-/* 
+/*
  * File:   ProbabilityDistribution.h
  * Author: rlcancian
  *
@@ -14,21 +14,45 @@
 #define PROBABILITYDISTRIBUTION_H
 
 #include "ProbabilityDistributionBase.h"
+#include <mutex>
+#include <tuple>
+#include <list>
 
+/*!
+ * Cumulative distribution and quantile (inverse cumulative) functions. Quantiles of the normal distribution use Acklam's rational
+ * approximation refined by a Halley step, and those of t, chi-square and F distributions invert the regularized incomplete beta and
+ * gamma functions (evaluated by series and continued fractions) with Halley's method, so no numerical integration is needed.
+ * The most recently used quantiles are cached (critical values, for instance, are asked again and again), and the cache can be used by
+ * several threads.
+ */
 class ProbabilityDistribution : public ProbabilityDistributionBase {
 public:
 	static double inverseChi2(double cumulativeProbability, double degreeFreedom);
 	static double inverseFFisherSnedecor(double cumulativeProbability, double d1, double d2);
 	static double inverseNormal(double cumulativeProbability, double mean, double stddev);
 	static double inverseTStudent(double cumulativeProbability, double mean, double stddev, double degreeFreedom);
+public:
+	static double cumulativeChi2(double x, double degreeFreedom);
+	static double cumulativeFFisherSnedecor(double x, double d1, double d2);
+	static double cumulativeNormal(double x, double mean, double stddev);
+	static double cumulativeTStudent(double x, double mean, double stddev, double degreeFreedom);
+private:
+	static double _regularizedIncompleteBeta(double a, double b, double x);
+	static double _regularizedIncompleteGamma(double a, double x);
+	static double _inverseRegularizedIncompleteBeta(double p, double a, double b);
+	static double _inverseRegularizedIncompleteGamma(double p, double a);
+	static double _inverseStandardNormal(double p);
+	static double _incompleteBetaContinuedFraction(double a, double b, double x);
 private:
-	static double _findInverseChi2(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double degreeFreedom);
-	static double _findInverseFFisherSnedecor(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double d1, double d2);
-	static double _findInverseNormal(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double mean, double stddev);
-	static double _findInverseTStudent(double a, double fa, double b, double fb, unsigned int recursions, double cumulativeProbability, double mean, double stddev, double degreeFreedom);
+	typedef std::tuple<char, double, double, double> MemoryKey; //!< <distribution, cumulative probability, parameter 1, parameter 2>
+	typedef std::list<MemoryKey> MemoryUses; //!< keys from the most to the least recently used
+	static bool _recall(const MemoryKey& key, double* value);
+	static double _remember(const MemoryKey& key, double value);
 private:
-	static std::map<std::string, double>* memory; // = std::map<std::string, double>();
-	static Solver_if* integrator;
+	static const unsigned int memoryCapacity = 256; //!< least recently used quantiles are forgotten beyond it
+	static std::map<MemoryKey, std::pair<double, MemoryUses::iterator>>* memory;
+	static MemoryUses* memoryUses;
+	static std::mutex memoryMutex;
 };
 #endif /* PROBABILITYDISTRIBUTION_H */
 
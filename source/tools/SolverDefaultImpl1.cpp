@@ -12,6 +12,9 @@
 
 #include "SolverDefaultImpl1.h"
 #include <math.h>
+#include <cmath>
+#include <limits>
+#include <queue>
 
 SolverDefaultImpl1::SolverDefaultImpl1(double precision, unsigned int steps) {
 	_precision = precision;
@@ -35,96 +38,27 @@ double SolverDefaultImpl1::getMaxSteps() {
 }
 
 double SolverDefaultImpl1::integrate(double min, double max, double (*f)(double, double), double p2) {
-	// Simpson's 1/3 rule
-	double steps = _numSteps;
-	double h = (max - min) / steps; // distance between points
-	if (h < _precision) {
-		steps = (max - min) / _precision;
-		h = (max - min) / steps;
-	}
-	double x, c; // x is the point being evaluated, c is the weight
-	double sum = 0.0;
-	for (int i = 0; i <= steps; i++) {
-		if (i == 0 || i == steps)
-			c = 1;
-		else if (i % 2 == 0)
-			c = 2;
-		else
-			c = 4;
-		x = min + i*h;
-		sum += c * f(x, p2);
-	}
-	return (h / 3)*sum;
+	return integrate(min, max, [f, p2](double x) {
+		return f(x, p2);
+	});
 }
 
 double SolverDefaultImpl1::integrate(double min, double max, double (*f)(double, double, double), double p2, double p3) {
-	// Simpson's 1/3 rule
-
-	unsigned int steps = _numSteps;
-	double h = (max - min) / steps; // distance between points
-	if (h < _precision) {
-		steps = ceil((max - min) / _precision);
-		h = (max - min) / steps;
-	}
-	double x, c; // x is the point being evaluated, c is the weight
-	double sum = 0.0;
-	for (unsigned int i = 0; i <= steps; i++) {
-		if (i == 0 || i == steps)
-			c = 1;
-		else if (i % 2 == 0)
-			c = 2;
-		else
-			c = 4;
-		x = min + i*h;
-		sum += c * f(x, p2, p3);
-	}
-	return (h / 3)*sum;
+	return integrate(min, max, [f, p2, p3](double x) {
+		return f(x, p2, p3);
+	});
 }
 
 double SolverDefaultImpl1::integrate(double min, double max, double (*f)(double, double, double, double), double p2, double p3, double p4) {
-	// Simpson's 1/3 rule
-	double steps = _numSteps;
-	double h = (max - min) / steps; // distance between points
-	if (h < _precision) {
-		steps = (max - min) / _precision;
-		h = (max - min) / steps;
-	}
-	double x, c; // x is the point being evaluated, c is the weight
-	double sum = 0.0;
-	for (int i = 0; i <= steps; i++) {
-		if (i == 0 || i == steps)
-			c = 1;
-		else if (i % 2 == 0)
-			c = 2;
-		else
-			c = 4;
-		x = min + i*h;
-		sum += c * f(x, p2, p3, p4);
-	}
-	return (h / 3)*sum;
+	return integrate(min, max, [f, p2, p3, p4](double x) {
+		return f(x, p2, p3, p4);
+	});
 }
 
 double SolverDefaultImpl1::integrate(double min, double max, double (*f)(double, double, double, double, double), double p2, double p3, double p4, double p5) {
-	// Simpson's 1/3 rule
-	double steps = _numSteps;
-	double h = (max - min) / steps; // distance between points
-	if (h < _precision) {
-		steps = (max - min) / _precision;
-		h = (max - min) / steps;
-	}
-	double x, c; // x is the point being evaluated, c is the weight
-	double sum = 0.0;
-	for (int i = 0; i <= steps; i++) {
-		if (i == 0 || i == steps)
-			c = 1;
-		else if (i % 2 == 0)
-			c = 2;
-		else
-			c = 4;
-		x = min + i*h;
-		sum += c * f(x, p2, p3, p4, p5);
-	}
-	return (h / 3)*sum;
+	return integrate(min, max, [f, p2, p3, p4, p5](double x) {
+		return f(x, p2, p3, p4, p5);
+	});
 }
 
 double SolverDefaultImpl1::derivate(double initPoint, double initValue, double (*f)(double, double), double p2) {
@@ -168,3 +102,382 @@ double SolverDefaultImpl1::derivate(double initPoint, double initValue, double (
 	/*  @TODO: +-: not implemented yet */
 	return 0.0;
 }
+
+double SolverDefaultImpl1::integrate(double min, double max, Function f) {
+	// adaptive Gauss-Kronrod quadrature: the subinterval with the largest error estimate is bisected until the total error is below precision
+
+	struct Subinterval {
+		double min, max, integral, error;
+
+		bool operator<(const Subinterval& other) const {
+			return error < other.error;
+		}
+	};
+	std::priority_queue<Subinterval> subintervals;
+	double error;
+	double integral = _gaussKronrod(min, max, f, &error);
+	subintervals.push({min, max, integral, error});
+	double totalError = error;
+	unsigned int subdivisions = 0;
+	while (totalError > std::max(_precision, _precision * std::abs(integral)) && subdivisions < _numSteps) {
+		Subinterval worst = subintervals.top();
+		double middle = 0.5 * (worst.min + worst.max);
+		if (middle == worst.min || middle == worst.max) {
+			break; // no more resolution
+		}
+		subintervals.pop();
+		double leftError, rightError;
+		double left = _gaussKronrod(worst.min, middle, f, &leftError);
+		double right = _gaussKronrod(middle, worst.max, f, &rightError);
+		subintervals.push({worst.min, middle, left, leftError});
+		subintervals.push({middle, worst.max, right, rightError});
+		integral += left + right - worst.integral;
+		totalError += leftError + rightError - worst.error;
+		subdivisions++;
+	}
+	// sum again to avoid accumulating rounding errors of the updates
+	integral = 0.0;
+	while (!subintervals.empty()) {
+		integral += subintervals.top().integral;
+		subintervals.pop();
+	}
+	return integral;
+}
+
+double SolverDefaultImpl1::_gaussKronrod(double min, double max, Function& f, double* error) {
+	// 15 points Kronrod rule and its embedded 7 points Gauss rule. The difference between them estimates the error
+	static const double node[8] = {0.991455371120812639206854697526329, 0.949107912342758524526189684047851, 0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+		0.586087235467691130294144845693013, 0.405845151377397166906606412076961, 0.207784955007898467600689403773245, 0.0};
+	static const double kronrodWeight[8] = {0.022935322010529224963732008058970, 0.063092092629978553290700663189204, 0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+		0.169004726639267902826583426598550, 0.190350578064785409913256402421014, 0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+	static const double gaussWeight[4] = {0.129484966168869693270611432679082, 0.279705391489276667901467771423780, 0.381830050505118944950369775488975, 0.417959183673469387755102040816327};
+	const double center = 0.5 * (min + max);
+	const double halfLength = 0.5 * (max - min);
+	double fCenter = f(center);
+	double kronrod = fCenter * kronrodWeight[7];
+	double gauss = fCenter * gaussWeight[3];
+	for (unsigned int i = 0; i < 7; i++) {
+		double dx = halfLength * node[i];
+		double sum = f(center - dx) + f(center + dx);
+		kronrod += kronrodWeight[i] * sum;
+		if (i % 2 == 1) { // odd Kronrod nodes are the Gauss nodes
+			gauss += gaussWeight[i / 2] * sum;
+		}
+	}
+	*error = std::abs((kronrod - gauss) * halfLength);
+	return kronrod * halfLength;
+}
+
+bool SolverDefaultImpl1::solve(double initTime, double finalTime, std::vector<double>& y, OdeSystem f, OdeMethod method, double outputInterval, OdeObserver observer, OdeObserver stepObserver) {
+	const unsigned int n = y.size();
+	std::vector<double> f0(n), y1(n), f1(n), yPrevious(n);
+	for (unsigned int i = 0; i < 7; i++) {
+		_stage[i].resize(n);
+	}
+	double t = initTime, h, previousStep = 0.0, error = 0.0;
+	const double minimumStep = 16.0 * std::numeric_limits<double>::epsilon() * std::max(std::abs(initTime), std::abs(finalTime));
+	unsigned int steps = 0;
+	double nextOutput = outputInterval > 0.0 ? std::floor(initTime / outputInterval + 1e-9) + 1.0 : 0.0; // outputs are at multiples of the interval
+	f(t, y.data(), f0.data());
+	if (method == OdeMethod::RungeKutta4) {
+		h = outputInterval > 0.0 ? outputInterval : (finalTime - initTime) / _numSteps;
+	} else {
+		h = _initialStep(t, finalTime, y, f0, f);
+	}
+	while (t < finalTime) {
+		if (steps >= _numSteps || h <= minimumStep) {
+			return false;
+		}
+		bool lastStep = t + h >= finalTime - minimumStep;
+		if (lastStep) {
+			h = finalTime - t;
+		}
+		bool accepted;
+		double order;
+		switch (method) {
+			case OdeMethod::DormandPrince45:
+				accepted = _stepDormandPrince45(t, h, y, f0, y1, f1, &error, f) && error <= 1.0;
+				order = 5.0;
+				break;
+			case OdeMethod::BDF2:
+				accepted = _stepBDF2(t, h, previousStep, yPrevious, y, f0, y1, &error, f);
+				if (!accepted) { // Newton iterations did not converge
+					h *= 0.25;
+					continue;
+				}
+				accepted = error <= 1.0;
+				if (accepted) {
+					f(t + h, y1.data(), f1.data());
+				}
+				order = 2.0;
+				break;
+			default:
+				accepted = _stepRungeKutta4(t, h, y, f0, y1, f);
+				f(t + h, y1.data(), f1.data());
+				order = 0.0;
+		}
+		const double stepTaken = h;
+		if (order > 0.0) { // adaptive step
+			double factor = 0.9 * std::pow(std::max(error, 1e-10), -1.0 / (order + 1.0));
+			double maxFactor = accepted ? (method == OdeMethod::BDF2 ? 2.0 : 5.0) : 1.0; // larger changes would make the variable step BDF unstable
+			h *= std::min(maxFactor, std::max(0.2, factor));
+		}
+		if (!accepted) {
+			continue;
+		}
+		const double t1 = lastStep ? finalTime : t + stepTaken;
+		if (stepObserver != nullptr && !stepObserver(t1, y1.data())) {
+			y.swap(y1); // the state at the end of the step
+			return false;
+		}
+		if (observer != nullptr && !_observe(t, t1, y, f0, y1, f1, outputInterval, &nextOutput, yPrevious, observer)) {
+			y.swap(yPrevious); // the observed state
+			return false;
+		}
+		yPrevious.swap(y);
+		y.swap(y1);
+		f0.swap(f1);
+		previousStep = stepTaken;
+		t = t1;
+		steps++;
+	}
+	return true;
+}
+
+bool SolverDefaultImpl1::_stepRungeKutta4(double t, double h, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, OdeSystem& f) {
+	const unsigned int n = y0.size();
+	std::vector<double>& k2 = _stage[1];
+	std::vector<double>& k3 = _stage[2];
+	std::vector<double>& k4 = _stage[3];
+	std::vector<double>& work = _stage[6];
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + 0.5 * h * f0[i];
+	}
+	f(t + 0.5 * h, work.data(), k2.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + 0.5 * h * k2[i];
+	}
+	f(t + 0.5 * h, work.data(), k3.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * k3[i];
+	}
+	f(t + h, work.data(), k4.data());
+	for (unsigned int i = 0; i < n; i++) {
+		y1[i] = y0[i] + (h / 6.0) * (f0[i] + 2.0 * (k2[i] + k3[i]) + k4[i]);
+	}
+	return true;
+}
+
+bool SolverDefaultImpl1::_stepDormandPrince45(double t, double h, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, std::vector<double>& f1, double* error, OdeSystem& f) {
+	// Butcher tableau of Dormand-Prince 5(4). The last stage is evaluated at the new state, so it is the first stage of the next step (FSAL)
+	const unsigned int n = y0.size();
+	std::vector<double>& k2 = _stage[1];
+	std::vector<double>& k3 = _stage[2];
+	std::vector<double>& k4 = _stage[3];
+	std::vector<double>& k5 = _stage[4];
+	std::vector<double>& k6 = _stage[5];
+	std::vector<double>& work = _stage[6];
+	const std::vector<double>& k1 = f0;
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * (1.0 / 5.0) * k1[i];
+	}
+	f(t + h / 5.0, work.data(), k2.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * (3.0 / 40.0 * k1[i] + 9.0 / 40.0 * k2[i]);
+	}
+	f(t + h * 3.0 / 10.0, work.data(), k3.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * (44.0 / 45.0 * k1[i] - 56.0 / 15.0 * k2[i] + 32.0 / 9.0 * k3[i]);
+	}
+	f(t + h * 4.0 / 5.0, work.data(), k4.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * (19372.0 / 6561.0 * k1[i] - 25360.0 / 2187.0 * k2[i] + 64448.0 / 6561.0 * k3[i] - 212.0 / 729.0 * k4[i]);
+	}
+	f(t + h * 8.0 / 9.0, work.data(), k5.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h * (9017.0 / 3168.0 * k1[i] - 355.0 / 33.0 * k2[i] + 46732.0 / 5247.0 * k3[i] + 49.0 / 176.0 * k4[i] - 5103.0 / 18656.0 * k5[i]);
+	}
+	f(t + h, work.data(), k6.data());
+	for (unsigned int i = 0; i < n; i++) {
+		y1[i] = y0[i] + h * (35.0 / 384.0 * k1[i] + 500.0 / 1113.0 * k3[i] + 125.0 / 192.0 * k4[i] - 2187.0 / 6784.0 * k5[i] + 11.0 / 84.0 * k6[i]);
+	}
+	f(t + h, y1.data(), f1.data());
+	// difference between the fifth and the embedded fourth order solutions
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = h * (71.0 / 57600.0 * k1[i] - 71.0 / 16695.0 * k3[i] + 71.0 / 1920.0 * k4[i] - 17253.0 / 339200.0 * k5[i] + 22.0 / 525.0 * k6[i] - 1.0 / 40.0 * f1[i]);
+	}
+	*error = _errorNorm(work, y0, y1);
+	return std::isfinite(*error);
+}
+
+bool SolverDefaultImpl1::_stepBDF2(double t, double h, double previousStep, const std::vector<double>& yPrevious, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, double* error, OdeSystem& f) {
+	// y1 = a1*y0 + a2*yPrevious + beta*h*f(t+h,y1), with coefficients for variable steps. The first step is a backward Euler one.
+	// The predictor interpolates yPrevious, y0 and f0, so the local error is estimated from the difference to the corrector (Milne's device)
+	const unsigned int n = y0.size();
+	std::vector<double> predicted(n), base(n), fy(n), column(n), delta(n), matrix(n * n);
+	std::vector<unsigned int> pivot(n);
+	double beta, errorConstant;
+	if (previousStep <= 0.0) {
+		for (unsigned int i = 0; i < n; i++) {
+			predicted[i] = y0[i] + h * f0[i];
+			base[i] = y0[i];
+		}
+		beta = 1.0;
+		errorConstant = 0.5;
+	} else {
+		const double w = h / previousStep;
+		const double a1 = (1.0 + w)*(1.0 + w) / (1.0 + 2.0 * w);
+		const double a2 = -w * w / (1.0 + 2.0 * w);
+		for (unsigned int i = 0; i < n; i++) {
+			double c = (yPrevious[i] - y0[i] + f0[i] * previousStep) / (previousStep * previousStep);
+			predicted[i] = y0[i] + h * f0[i] + c * h * h;
+			base[i] = a1 * y0[i] + a2 * yPrevious[i];
+		}
+		beta = (1.0 + w) / (1.0 + 2.0 * w);
+		errorConstant = 0.4;
+	}
+	const double t1 = t + h;
+	// iteration matrix I-beta*h*J, with the jacobian J approximated by forward differences at the predicted state
+	f(t1, predicted.data(), fy.data());
+	for (unsigned int j = 0; j < n; j++) {
+		const double yj = predicted[j];
+		const double dy = 1e-8 * std::max(1.0, std::abs(yj));
+		predicted[j] = yj + dy;
+		f(t1, predicted.data(), column.data());
+		predicted[j] = yj;
+		for (unsigned int i = 0; i < n; i++) {
+			matrix[i * n + j] = (i == j ? 1.0 : 0.0) - beta * h * (column[i] - fy[i]) / dy;
+		}
+	}
+	// LU decomposition with partial pivoting
+	for (unsigned int k = 0; k < n; k++) {
+		unsigned int p = k;
+		for (unsigned int i = k + 1; i < n; i++) {
+			if (std::abs(matrix[i * n + k]) > std::abs(matrix[p * n + k])) {
+				p = i;
+			}
+		}
+		if (matrix[p * n + k] == 0.0) {
+			return false;
+		}
+		pivot[k] = p;
+		if (p != k) {
+			for (unsigned int j = 0; j < n; j++) {
+				std::swap(matrix[k * n + j], matrix[p * n + j]);
+			}
+		}
+		for (unsigned int i = k + 1; i < n; i++) {
+			double factor = matrix[i * n + k] /= matrix[k * n + k];
+			for (unsigned int j = k + 1; j < n; j++) {
+				matrix[i * n + j] -= factor * matrix[k * n + j];
+			}
+		}
+	}
+	// simplified Newton iterations
+	y1 = predicted;
+	bool converged = false;
+	double lastNorm = std::numeric_limits<double>::infinity();
+	for (unsigned int iteration = 0; iteration < 8 && !converged; iteration++) {
+		for (unsigned int i = 0; i < n; i++) {
+			delta[i] = base[i] + beta * h * fy[i] - y1[i];
+		}
+		for (unsigned int k = 0; k < n; k++) {
+			std::swap(delta[k], delta[pivot[k]]);
+			for (unsigned int i = k + 1; i < n; i++) {
+				delta[i] -= matrix[i * n + k] * delta[k];
+			}
+		}
+		for (unsigned int k = n; k-- > 0;) {
+			for (unsigned int j = k + 1; j < n; j++) {
+				delta[k] -= matrix[k * n + j] * delta[j];
+			}
+			delta[k] /= matrix[k * n + k];
+		}
+		for (unsigned int i = 0; i < n; i++) {
+			y1[i] += delta[i];
+		}
+		double norm = _errorNorm(delta, y0, y1);
+		if (!std::isfinite(norm) || norm > 2.0 * lastNorm) {
+			return false; // diverging
+		}
+		lastNorm = norm;
+		converged = norm <= 1e-2;
+		if (!converged) {
+			f(t1, y1.data(), fy.data());
+		}
+	}
+	if (!converged) {
+		return false;
+	}
+	for (unsigned int i = 0; i < n; i++) {
+		delta[i] = errorConstant * (y1[i] - predicted[i]);
+	}
+	*error = _errorNorm(delta, y0, y1);
+	return true;
+}
+
+double SolverDefaultImpl1::_initialStep(double t, double finalTime, const std::vector<double>& y0, const std::vector<double>& f0, OdeSystem& f) {
+	// Hairer, Norsett and Wanner's heuristic, based on the magnitudes of the state and its first and second derivatives
+	const unsigned int n = y0.size();
+	const double span = finalTime - t;
+	double d0 = _errorNorm(y0, y0, y0);
+	double d1 = _errorNorm(f0, y0, y0);
+	double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+	h0 = std::min(h0, span);
+	std::vector<double>& work = _stage[6];
+	std::vector<double>& f1 = _stage[5];
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = y0[i] + h0 * f0[i];
+	}
+	f(t + h0, work.data(), f1.data());
+	for (unsigned int i = 0; i < n; i++) {
+		work[i] = (f1[i] - f0[i]) / h0;
+	}
+	double d2 = _errorNorm(work, y0, y0);
+	double dmax = std::max(d1, d2);
+	double h1 = dmax <= 1e-15 ? std::max(1e-6, h0 * 1e-3) : std::pow(0.01 / dmax, 1.0 / 5.0);
+	return std::min(std::min(100.0 * h0, h1), span);
+}
+
+double SolverDefaultImpl1::_errorNorm(const std::vector<double>& error, const std::vector<double>& y0, const std::vector<double>& y1) const {
+	// root mean square of the error relative to the mixed absolute and relative tolerance, so values below 1 are acceptable
+	const unsigned int n = error.size();
+	if (n == 0) {
+		return 0.0;
+	}
+	double sum = 0.0;
+	for (unsigned int i = 0; i < n; i++) {
+		double scaled = error[i] / (_precision + _precision * std::max(std::abs(y0[i]), std::abs(y1[i])));
+		sum += scaled * scaled;
+	}
+	return std::sqrt(sum / n);
+}
+
+bool SolverDefaultImpl1::_observe(double t0, double t1, const std::vector<double>& y0, const std::vector<double>& f0, const std::vector<double>& y1, const std::vector<double>& f1, double outputInterval, double* nextOutput, std::vector<double>& observed, OdeObserver& observer) {
+	if (outputInterval <= 0.0) { // observes every step
+		observed = y1;
+		return observer(t1, y1.data());
+	}
+	// output times inside the step are interpolated by cubic Hermite polynomials
+	const double h = t1 - t0;
+	const double tolerance = 1e-9 * outputInterval;
+	const unsigned int n = y0.size();
+	double tout;
+	while ((tout = (*nextOutput) * outputInterval) <= t1 + tolerance) {
+		if (std::abs(tout - t1) <= tolerance) {
+			observed = y1;
+		} else {
+			observed.resize(n);
+			const double s = (tout - t0) / h;
+			const double h00 = (1.0 + 2.0 * s)*(1.0 - s)*(1.0 - s), h10 = s * (1.0 - s)*(1.0 - s), h01 = s * s * (3.0 - 2.0 * s), h11 = s * s * (s - 1.0);
+			for (unsigned int i = 0; i < n; i++) {
+				observed[i] = h00 * y0[i] + h10 * h * f0[i] + h01 * y1[i] + h11 * h * f1[i];
+			}
+		}
+		(*nextOutput)++;
+		if (!observer(tout, observed.data())) {
+			return false;
+		}
+	}
+	return true;
+}
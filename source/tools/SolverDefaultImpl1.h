@@ -32,10 +32,21 @@ public:
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double), double p2, double p3);
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double, double), double p2, double p3, double p4);
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double, double, double), double p2, double p3, double p4, double p5);
+	virtual double integrate(double min, double max, Function f);
+	virtual bool solve(double initTime, double finalTime, std::vector<double>& y, OdeSystem f, OdeMethod method, double outputInterval = 0.0, OdeObserver observer = nullptr, OdeObserver stepObserver = nullptr);
+private:
+	double _gaussKronrod(double min, double max, Function& f, double* error);
+	bool _stepRungeKutta4(double t, double h, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, OdeSystem& f);
+	bool _stepDormandPrince45(double t, double h, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, std::vector<double>& f1, double* error, OdeSystem& f);
+	bool _stepBDF2(double t, double h, double previousStep, const std::vector<double>& yPrevious, const std::vector<double>& y0, const std::vector<double>& f0, std::vector<double>& y1, double* error, OdeSystem& f);
+	double _initialStep(double t, double finalTime, const std::vector<double>& y0, const std::vector<double>& f0, OdeSystem& f);
+	double _errorNorm(const std::vector<double>& error, const std::vector<double>& y0, const std::vector<double>& y1) const;
+	bool _observe(double t0, double t1, const std::vector<double>& y0, const std::vector<double>& f0, const std::vector<double>& y1, const std::vector<double>& f1, double outputInterval, double* nextOutput, std::vector<double>& observed, OdeObserver& observer);
 private:
 	double _precision;
 	unsigned int _numSteps;
 	double _stepSize;
+	std::vector<double> _stage[7]; //!< Workspace for the stages of Runge-Kutta methods
 	//Variable* _variables;
 	//Variable* _timeVariable;
 };
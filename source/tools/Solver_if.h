@@ -14,13 +14,30 @@
 #ifndef SOLVER_IF_H
 #define SOLVER_IF_H
 
+#include <functional>
+#include <vector>
+
 /*!
  * Interface used by classes that perform the numerical integration and derivation of functions with from one up to four parameters.
  * It is mainly used for calculating the probability of theoretical distributions, from its probability distribution functions.
  * p1 is the value where function is being evaluated and p2, ... are the function parameters
+ * It also solves systems of ordinary differential equations dy/dt=f(t,y), whose derivatives are all evaluated at once by a single
+ * callable over contiguous state vectors, as used by continuous components (LSODE, DiffEquations).
  */
 class Solver_if {
 public:
+
+	enum class OdeMethod : int {
+		RungeKutta4 = 0, //!< Classic fourth order Runge-Kutta with fixed step
+		DormandPrince45 = 1, //!< Embedded Runge-Kutta 5(4) with adaptive step, for nonstiff systems
+		BDF2 = 2, //!< Second order backward differentiation formula with adaptive step and Newton iterations, for stiff systems
+		num_elements = 3
+	};
+	typedef std::function<double(double) > Function; //!< f(x)
+	typedef std::function<void(double t, const double* y, double* dydt) > OdeSystem; //!< Evaluates all the derivatives dydt[i]=f[i](t,y)
+	typedef std::function<bool(double t, const double* y) > OdeObserver; //!< Receives the state at each output time. Returning false stops the solver at that time
+public:
+	virtual ~Solver_if() = default;
 	virtual void setPrecision(double e) = 0;
 	virtual double getPrecision() = 0;
 	virtual void setMaxSteps(double steps) = 0;
@@ -33,6 +50,28 @@ public:
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double), double p2, double p3) = 0;
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double, double), double p2, double p3, double p4) = 0;
 	virtual double derivate(double initPoint, double initValue, double (*f)(double, double, double, double, double), double p2, double p3, double p4, double p5) = 0;
+	/*!
+	 * \brief integrate
+	 * \param min
+	 * \param max
+	 * \param f
+	 * \return The integral of f from min to max, with absolute or relative error below precision, unless max steps (subdivisions) are reached
+	 */
+	virtual double integrate(double min, double max, Function f) = 0;
+	/*!
+	 * \brief solve
+	 * \param initTime
+	 * \param finalTime
+	 * \param y Initial state. On return, the state at finalTime (or where the solver or the observer stopped)
+	 * \param f
+	 * \param method
+	 * \param outputInterval The observer is invoked at the multiples of outputInterval after initTime, up to finalTime, or after every step if it is zero. Fixed step methods use it as the step
+	 * \param observer
+	 * \param stepObserver Receives the state at the end of every accepted step, before the outputs inside the step. If it returns false, the
+	 * solver stops with the state at the end of that step (so events located inside a step are bracketed by it, whatever the output interval)
+	 * \return false if finalTime could not be reached within max steps or the precision, or if an observer stopped the solver
+	 */
+	virtual bool solve(double initTime, double finalTime, std::vector<double>& y, OdeSystem f, OdeMethod method, double outputInterval = 0.0, OdeObserver observer = nullptr, OdeObserver stepObserver = nullptr) = 0;
 };
 
 #endif /* SOLVER_IF_H */